@@ -0,0 +1,581 @@
+/*******************************************************************************************
+ * @file    driver_benchmark.c
+ * @author  ka5j
+ * @brief   Throughput, latency and init-cost benchmark of the drivers (DWT cycle counter)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Measures, in CPU cycles:
+ *          - GPIO toggle cost through every API (driver call, static pin, bit-band, BSRR)
+ *          - interrupt entry latency of TIM2-TIM5 (software update event) and EXTI0
+ *            (software interrupt), from the triggering store to the first handler line
+ *          - USART2 sustained transmit throughput in polled, interrupt and DMA modes
+ *          - CRC cost per byte on every path: hardware unit, slicing tables and DMA
+ *          - bare_frame codec throughput (COBS + CRC-16) for encoding and decoding
+ *          - the cost of every driver's init call
+ *          Results are collected first and printed afterwards over USART2 (115200 8N1)
+ *          between "BENCH BEGIN" and "BENCH END" as "metric,value,unit" lines; the USART
+ *          payload lines start with '#'. tools/bench_compare.py compares two captures.
+ *
+ *          Pins touched: PA5 (LED), PA4 (DAC1), PA0 (ADC1 IN0), PB13-15 (SPI2),
+ *          PB8/PB9 (I2C1), PA11/PA12 (CAN1, internal loop back).
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "nvic_registers.h"
+#include "exti_registers.h"
+#include "bare_dwt.h"
+#include "bare_rcc.h"
+#include "bare_gpio.h"
+#include "bare_pin.h"
+#include "bare_bitband.h"
+#include "bare_usart.h"
+#include "bare_dma.h"
+#include "bare_periph.h"
+#include "bare_tim2_5.h"
+#include "bare_systick.h"
+#include "bare_crc.h"
+#include "bare_frame.h"
+#include "bare_adc.h"
+#include "bare_dac.h"
+#include "bare_spi.h"
+#include "bare_i2c.h"
+#include "bare_can.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Benchmark Configuration
+ *******************************************************************************************/
+#define TOGGLES 1000U       /*!< GPIO edges per API */
+#define IRQ_TRIALS 32U      /*!< Interrupt entries per vector (min and max reported) */
+#define USART_BYTES 1024U   /*!< Bytes per USART mode (multiple of 32) */
+#define CRC_WORDS 256U      /*!< CRC block size in words (1 KiB) */
+#define FRAME_PAYLOAD 240U  /*!< Payload per benchmarked frame (bare_packet maximum) */
+#define FRAME_COUNT 16U     /*!< Frames per codec measurement */
+#define RESULTS_MAX 64U     /*!< Result table size */
+#define EXTI0_IRQ 6U        /*!< EXTI line 0 NVIC number */
+
+BARE_PIN_DEFINE(led, GPIOA, 5)
+
+/** One measurement */
+typedef struct
+{
+    const char *name; /*!< Metric name */
+    uint32_t value;   /*!< Measured value */
+    const char *unit; /*!< cycles / cycles_x100 (lower is better), Bps (higher), hz (info) */
+} result_t;
+
+static result_t results[RESULTS_MAX];
+static uint32_t result_count;
+static char payload[USART_BYTES];
+static volatile uint32_t irq_stamp;
+static uint32_t crc_block[CRC_WORDS];
+static volatile uint8_t crc_dma_done;
+static uint8_t frame_wire[FRAME_WIRE_SIZE(FRAME_PAYLOAD)];
+static uint32_t frame_wire_len;
+
+/** Run a loop body n times and store the elapsed cycles */
+#define TIME_LOOP(cycles, n, body)                \
+    do                                            \
+    {                                             \
+        uint32_t t0_ = bare_dwt_cycles();         \
+        uint32_t i_;                              \
+        for (i_ = 0U; i_ < (n); i_++)             \
+        {                                         \
+            body;                                 \
+        }                                         \
+        (cycles) = bare_dwt_cycles() - t0_;       \
+    } while (0)
+
+/** Time one statement */
+#define TIME_ONCE(cycles, stmt)                   \
+    do                                            \
+    {                                             \
+        uint32_t t0_ = bare_dwt_cycles();         \
+        stmt;                                     \
+        (cycles) = bare_dwt_cycles() - t0_;       \
+    } while (0)
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Store a result for printing at the end
+ */
+static void record(const char *name, uint32_t value, const char *unit)
+{
+    if (result_count < RESULTS_MAX)
+    {
+        results[result_count].name = name;
+        results[result_count].value = value;
+        results[result_count].unit = unit;
+        result_count++;
+    }
+}
+
+/**
+ * @brief  Wait until the USART2 ring is empty and the last frame has left
+ */
+static void usart_wait_idle(void)
+{
+    while (bare_usart_tx_free() != USART_TX_RING_SIZE)
+    {
+    }
+    while (!(USART2->SR & USART_SR_TC))
+    {
+    }
+}
+
+/**
+ * @brief  Bytes per second from a byte count and elapsed cycles
+ */
+static uint32_t bytes_per_s(uint32_t bytes, uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)bytes * bare_rcc_get_hclk()) / cycles);
+}
+
+/*******************************************************************************************
+ *                                    GPIO Toggle Rate
+ *******************************************************************************************/
+
+/**
+ * @brief  Cycles per GPIO edge (x100) through each API, loop overhead included
+ */
+static void bench_gpio(void)
+{
+    uint32_t c;
+
+    bare_gpio_init(GPIOA, GPIO_PIN5, GPIO_MODE_OUTPUT, GPIO_OTYPE_PP, GPIO_SPEED_HIGH,
+                   GPIO_NOPULL);
+
+    TIME_LOOP(c, TOGGLES, __asm volatile(""));
+    record("gpio_loop_empty", (c * 100U) / TOGGLES, "cycles_x100");
+
+    TIME_LOOP(c, TOGGLES, bare_gpio_toggle(GPIOA, GPIO_PIN5));
+    record("gpio_driver_toggle", (c * 100U) / TOGGLES, "cycles_x100");
+
+    TIME_LOOP(c, TOGGLES, bare_gpio_write(GPIOA, GPIO_PIN5, (GPIO_PinState_t)(i_ & 1U)));
+    record("gpio_driver_write", (c * 100U) / TOGGLES, "cycles_x100");
+
+    TIME_LOOP(c, TOGGLES, led_toggle());
+    record("gpio_pin_toggle", (c * 100U) / TOGGLES, "cycles_x100");
+
+    TIME_LOOP(c, TOGGLES, led_write(i_ & 1U));
+    record("gpio_pin_write", (c * 100U) / TOGGLES, "cycles_x100");
+
+    TIME_LOOP(c, TOGGLES, bare_bitband_write(&GPIOA->ODR, led_MASK, i_ & 1U));
+    record("gpio_bitband_odr", (c * 100U) / TOGGLES, "cycles_x100");
+
+    TIME_LOOP(c, TOGGLES, GPIOA->BSRR = (i_ & 1U) ? led_MASK : ((uint32_t)led_MASK << 16));
+    record("gpio_bsrr_direct", (c * 100U) / TOGGLES, "cycles_x100");
+}
+
+/*******************************************************************************************
+ *                                  Interrupt Entry Latency
+ *******************************************************************************************/
+
+void TIM2_IRQHandler(void)
+{
+    irq_stamp = bare_dwt_cycles();
+    TIM2->SR = ~TIM_SR_UIF;
+}
+
+void TIM3_IRQHandler(void)
+{
+    irq_stamp = bare_dwt_cycles();
+    TIM3->SR = ~TIM_SR_UIF;
+}
+
+void TIM4_IRQHandler(void)
+{
+    irq_stamp = bare_dwt_cycles();
+    TIM4->SR = ~TIM_SR_UIF;
+}
+
+void TIM5_IRQHandler(void)
+{
+    irq_stamp = bare_dwt_cycles();
+    TIM5->SR = ~TIM_SR_UIF;
+}
+
+void EXTI0_IRQHandler(void)
+{
+    irq_stamp = bare_dwt_cycles();
+    EXTI->PR = 1UL; // rc_w1
+}
+
+/**
+ * @brief  Trigger an interrupt through a register store and time the handler entry
+ */
+static void bench_irq(const char *min_name, const char *max_name, volatile uint32_t *trigger,
+                      uint32_t value)
+{
+    uint32_t lo = 0xFFFFFFFFUL;
+    uint32_t hi = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < IRQ_TRIALS; i++)
+    {
+        uint32_t t0;
+
+        irq_stamp = 0U;
+        t0 = bare_dwt_cycles();
+        *trigger = value;
+        while (irq_stamp == 0U)
+        {
+        }
+        t0 = irq_stamp - t0;
+        lo = (t0 < lo) ? t0 : lo;
+        hi = (t0 > hi) ? t0 : hi;
+    }
+    record(min_name, lo, "cycles");
+    record(max_name, hi, "cycles");
+}
+
+/**
+ * @brief  Update interrupt of a stopped timer, raised by EGR.UG
+ */
+static void bench_tim_irq(TIM2_5_TypeDef *TIMx, const char *min_name, const char *max_name)
+{
+    bare_tim2_5_set_rate(TIMx, 1U); // Counter stays stopped: UG is the only update source
+    TIMx->DIER |= TIM_DIER_UIE;
+    bare_tim2_5_enable_interrupt(TIMx);
+
+    bench_irq(min_name, max_name, &TIMx->EGR, TIM_EGR_UG);
+
+    TIMx->DIER &= ~TIM_DIER_UIE;
+    bare_tim2_5_stop(TIMx);
+}
+
+/**
+ * @brief  Interrupt entry latency of every TIM2-TIM5 vector and EXTI0
+ */
+static void bench_latency(void)
+{
+    bench_tim_irq(TIM2, "irq_tim2_min", "irq_tim2_max");
+    bench_tim_irq(TIM3, "irq_tim3_min", "irq_tim3_max");
+    bench_tim_irq(TIM4, "irq_tim4_min", "irq_tim4_max");
+    bench_tim_irq(TIM5, "irq_tim5_min", "irq_tim5_max");
+
+    EXTI->IMR |= 1UL;
+    NVIC->ISER[EXTI0_IRQ >> 5] = 1UL << (EXTI0_IRQ & 0x1FU);
+    bench_irq("irq_exti0_min", "irq_exti0_max", &EXTI->SWIER, 1UL);
+    NVIC->ICER[EXTI0_IRQ >> 5] = 1UL << (EXTI0_IRQ & 0x1FU);
+    EXTI->IMR &= ~1UL;
+}
+
+/*******************************************************************************************
+ *                                 USART2 Transmit Throughput
+ *******************************************************************************************/
+
+/**
+ * @brief  Payload: 32-byte comment lines the host side ignores
+ */
+static void fill_payload(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < USART_BYTES; i++)
+    {
+        uint32_t col = i & 31U;
+
+        if (col == 0U)
+        {
+            payload[i] = '#';
+        }
+        else if (col == 30U)
+        {
+            payload[i] = '\r';
+        }
+        else if (col == 31U)
+        {
+            payload[i] = '\n';
+        }
+        else
+        {
+            payload[i] = (char)('a' + (col % 26U));
+        }
+    }
+}
+
+/**
+ * @brief  Sustained transmit rate in polled, interrupt and DMA modes
+ */
+static void bench_usart(void)
+{
+    DMA_Stream_TypeDef *stream = bare_periph_dma_stream(PERIPH_USART2, 1U);
+    DMA_Config_t dma = {
+        .channel = bare_periph_dma_channel(PERIPH_USART2, 1U),
+        .dir = DMA_DIR_MEM_TO_PERIPH,
+        .psize = DMA_SIZE_BYTE,
+        .msize = DMA_SIZE_BYTE,
+        .pinc = 0U,
+        .minc = 1U,
+        .priority = DMA_PRIORITY_MEDIUM,
+        .fifo = DMA_FIFO_DIRECT,
+    };
+    uint32_t t0, c, sent;
+
+    fill_payload();
+
+    // Polled: one blocking call per byte
+    usart_wait_idle();
+    t0 = bare_dwt_cycles();
+    for (sent = 0U; sent < USART_BYTES; sent++)
+    {
+        bare_usart_send_char(payload[sent]);
+    }
+    usart_wait_idle();
+    record("usart_polled", bytes_per_s(USART_BYTES, bare_dwt_cycles() - t0), "Bps");
+
+    // Interrupt: refill the ring as it drains
+    TIME_ONCE(c, (void)bare_usart_write(payload, 128U));
+    record("usart_irq_queue_128", c, "cycles");
+    usart_wait_idle();
+    t0 = bare_dwt_cycles();
+    for (sent = 0U; sent < USART_BYTES;)
+    {
+        sent += bare_usart_write(&payload[sent], (uint16_t)(USART_BYTES - sent));
+    }
+    usart_wait_idle();
+    record("usart_irq", bytes_per_s(USART_BYTES, bare_dwt_cycles() - t0), "Bps");
+
+    // DMA: one transfer from memory to DR
+    bare_dma_enable_clock(stream);
+    bare_dma_config(stream, &dma);
+    USART2->SR = ~USART_SR_TC; // rc_w0
+    USART2->CR3 |= USART_CR3_DMAT;
+    t0 = bare_dwt_cycles();
+    bare_dma_start(stream, (uint32_t)&USART2->DR, (uint32_t)payload, 0U, USART_BYTES);
+    record("usart_dma_start", bare_dwt_cycles() - t0, "cycles");
+    while (bare_dma_remaining(stream) != 0U)
+    {
+    }
+    while (!(USART2->SR & USART_SR_TC))
+    {
+    }
+    record("usart_dma", bytes_per_s(USART_BYTES, bare_dwt_cycles() - t0), "Bps");
+    bare_dma_stop(stream);
+    USART2->CR3 &= ~USART_CR3_DMAT;
+}
+
+/*******************************************************************************************
+ *                                    CRC Paths
+ *******************************************************************************************/
+
+static void crc_done(CRC_Status_t status, uint32_t crc, void *ctx)
+{
+    (void)status;
+    (void)crc;
+    (void)ctx;
+    crc_dma_done = 1U;
+}
+
+/**
+ * @brief  Cycles per byte (x100) of each CRC implementation over the same 1 KiB block
+ */
+static void bench_crc(void)
+{
+    const uint32_t bytes = CRC_WORDS * 4U;
+    volatile uint32_t sink;
+    uint32_t c;
+    uint32_t i;
+
+    for (i = 0U; i < CRC_WORDS; i++)
+    {
+        crc_block[i] = i * 0x9E3779B9UL;
+    }
+
+    TIME_ONCE(c, sink = bare_crc32_stm32(crc_block, CRC_WORDS));
+    record("crc32_stm32_hw", (c * 100U) / bytes, "cycles_x100");
+    TIME_ONCE(c, sink = bare_crc32_stm32_sw(BARE_CRC32_STM32_INIT, crc_block, CRC_WORDS));
+    record("crc32_stm32_table", (c * 100U) / bytes, "cycles_x100");
+
+    TIME_ONCE(c, sink = bare_crc32(crc_block, bytes));
+    record("crc32_hw", (c * 100U) / bytes, "cycles_x100");
+    TIME_ONCE(c, sink = bare_crc32_sw(BARE_CRC32_INIT, crc_block, bytes));
+    record("crc32_table", (c * 100U) / bytes, "cycles_x100");
+
+    TIME_ONCE(c, sink = bare_crc16_ccitt(BARE_CRC16_CCITT_INIT, crc_block, bytes));
+    record("crc16_ccitt_table", (c * 100U) / bytes, "cycles_x100");
+    TIME_ONCE(c, sink = bare_crc16_modbus(BARE_CRC16_MODBUS_INIT, crc_block, bytes));
+    record("crc16_modbus_table", (c * 100U) / bytes, "cycles_x100");
+
+    crc_dma_done = 0U;
+    TIME_ONCE(c, {
+        (void)bare_crc_dma_start(crc_block, CRC_WORDS, crc_done, NULL);
+        while (!crc_dma_done)
+        {
+        }
+    });
+    record("crc32_stm32_dma", (c * 100U) / bytes, "cycles_x100");
+    (void)sink;
+}
+
+/*******************************************************************************************
+ *                                  Frame Codec
+ *******************************************************************************************/
+
+static void frame_sink(uint8_t byte, void *ctx)
+{
+    (void)ctx;
+    frame_wire[frame_wire_len++] = byte;
+}
+
+/**
+ * @brief  Payload bytes per second through bare_frame_encode and bare_frame_decode
+ */
+static void bench_frame(void)
+{
+    const uint8_t *src = (const uint8_t *)crc_block; // Pseudo-random, contains zeros
+    FRAME_Packet_t pkt;
+    uint32_t encode = 0U;
+    uint32_t decode = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < FRAME_COUNT; i++)
+    {
+        uint32_t t0 = bare_dwt_cycles();
+
+        frame_wire_len = 0U;
+        bare_frame_encode((uint8_t)i, 1U, &src[i * 16U], FRAME_PAYLOAD, frame_sink, NULL);
+        encode += bare_dwt_cycles() - t0;
+
+        /* Decode runs in place: time it on the frame just encoded, delimiter excluded */
+        t0 = bare_dwt_cycles();
+        (void)bare_frame_decode(frame_wire, frame_wire_len - 1U, &pkt);
+        decode += bare_dwt_cycles() - t0;
+    }
+    record("frame_encode", bytes_per_s(FRAME_PAYLOAD * FRAME_COUNT, encode), "Bps");
+    record("frame_decode", bytes_per_s(FRAME_PAYLOAD * FRAME_COUNT, decode), "Bps");
+}
+
+/*******************************************************************************************
+ *                                     Init Cost
+ *******************************************************************************************/
+
+static void adc_block(const uint16_t *block, uint32_t frames, void *ctx)
+{
+    (void)block;
+    (void)frames;
+    (void)ctx;
+}
+
+static const ADC_Channel_t adc_channels[] = {ADC_CHANNEL0};
+static uint16_t adc_buffer[2];
+static const ADC_Config_t adc_cfg = {
+    .channels = adc_channels,
+    .count = 1U,
+    .sample_time = ADC_SMP_3CYC,
+    .resolution = ADC_RES_12BIT,
+    .trigger = ADC_TRIG_SOFTWARE,
+    .buffer = adc_buffer,
+    .frames_per_block = 1U,
+    .cb = adc_block,
+};
+
+/**
+ * @brief  Cycles taken by each driver's init call (first call, clocks off before)
+ */
+static void bench_init(void)
+{
+    const SPI_Config_t spi = {
+        .sck = {GPIOB, GPIO_PIN13},
+        .miso = {GPIOB, GPIO_PIN14},
+        .mosi = {GPIOB, GPIO_PIN15},
+        .af = 5U,
+        .mode = SPI_MODE0,
+        .frame = SPI_FRAME_8BIT,
+        .max_hz = 1000000UL,
+    };
+    const I2C_Config_t i2c = {
+        .scl = {GPIOB, GPIO_PIN8},
+        .sda = {GPIOB, GPIO_PIN9},
+        .af = 4U,
+        .speed_hz = 100000UL,
+    };
+    const CAN_Config_t can = {
+        .rx = {GPIOA, GPIO_PIN11},
+        .tx = {GPIOA, GPIO_PIN12},
+        .af = 9U,
+        .bitrate = 500000UL,
+        .sample_point = 875U,
+        .loopback = 1U,
+        .silent = 1U,
+    };
+    const DMA_Config_t dma = {
+        .channel = 0U,
+        .dir = DMA_DIR_MEM_TO_MEM,
+        .psize = DMA_SIZE_WORD,
+        .msize = DMA_SIZE_WORD,
+        .pinc = 1U,
+        .minc = 1U,
+        .priority = DMA_PRIORITY_LOW,
+        .fifo = DMA_FIFO_FULL,
+    };
+    uint32_t c;
+
+    TIME_ONCE(c, bare_gpio_init(GPIOB, GPIO_PIN0, GPIO_MODE_OUTPUT, GPIO_OTYPE_PP,
+                                GPIO_SPEED_LOW, GPIO_NOPULL));
+    record("init_gpio", c, "cycles");
+    TIME_ONCE(c, SysTick_Init(SYSTICK_RELOAD, SYSTICK_PROCESSOR_CLK, SYSTICK_DISABLE_INTERRUPT,
+                              SYSTICK_CLK_IMPL, SYSTICK_CALIB));
+    record("init_systick", c, "cycles");
+    TIME_ONCE(c, (void)bare_tim2_5_set_rate(TIM3, 1000U));
+    record("init_tim2_5_rate", c, "cycles");
+    bare_tim2_5_stop(TIM3);
+    bare_dma_enable_clock(DMA2_Stream7);
+    TIME_ONCE(c, bare_dma_config(DMA2_Stream7, &dma));
+    record("init_dma", c, "cycles");
+    TIME_ONCE(c, bare_crc_init());
+    record("init_crc", c, "cycles");
+    TIME_ONCE(c, bare_adc_init(ADC1, &adc_cfg));
+    record("init_adc", c, "cycles");
+    TIME_ONCE(c, bare_dac_init(DAC_CHANNEL1, 1U));
+    record("init_dac", c, "cycles");
+    TIME_ONCE(c, (void)bare_spi_init(SPI2, &spi));
+    record("init_spi", c, "cycles");
+    TIME_ONCE(c, (void)bare_i2c_init(I2C1, &i2c));
+    record("init_i2c", c, "cycles");
+    TIME_ONCE(c, (void)bare_can_init(CAN1, &can));
+    record("init_can", c, "cycles");
+}
+
+/*******************************************************************************************
+ *                                    Main Program
+ *******************************************************************************************/
+int main(void)
+{
+    uint32_t c;
+    uint32_t i;
+
+    bare_dwt_init();
+    TIME_ONCE(c, bare_usart_init());
+
+    record("hclk", bare_rcc_get_hclk(), "hz");
+    record("init_usart", c, "cycles");
+    bench_init();
+    bench_gpio();
+    bench_latency();
+    bench_usart();
+    bench_crc();
+    bench_frame();
+
+    bare_usart_send_string("\r\nBENCH BEGIN\r\n");
+    for (i = 0U; i < result_count; i++)
+    {
+        bare_usart_send_string(results[i].name);
+        bare_usart_send_char(',');
+        bare_print_u32(results[i].value);
+        bare_usart_send_char(',');
+        bare_usart_send_string(results[i].unit);
+        bare_usart_send_string("\r\n");
+    }
+    bare_usart_send_string("BENCH END\r\n");
+
+    while (1)
+    {
+    }
+}
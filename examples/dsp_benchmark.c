@@ -0,0 +1,163 @@
+/*******************************************************************************************
+ * @file    dsp_benchmark.c
+ * @author  ka5j
+ * @brief   Cycles-per-sample benchmark of the bare_dsp kernels (DWT cycle counter)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Runs every kernel and its scalar reference over the same block, checks that
+ *          the outputs are identical and prints "name,kernel_cps_x100,ref_cps_x100,ok"
+ *          lines over USART2 (115200 8N1).
+ *******************************************************************************************/
+
+#include "bare_dsp.h"
+#include "bare_dwt.h"
+#include "bare_usart.h"
+#include "bare_util.h"
+#include <string.h>
+
+/*******************************************************************************************
+ *                                Benchmark Configuration
+ *******************************************************************************************/
+#define BLOCK 256U    /*!< Samples per block */
+#define FIR_TAPS 32U  /*!< FIR / decimator length */
+#define STAGES 2U     /*!< Biquad sections */
+#define DECIM 4U      /*!< Decimation factor */
+#define AVG_LOG2 4U   /*!< Moving average window 16 */
+
+static q15_t input[BLOCK];
+static q15_t out_a[BLOCK];
+static q15_t out_b[BLOCK];
+static q31_t input32[BLOCK];
+static q31_t out32_a[BLOCK];
+static q31_t out32_b[BLOCK];
+
+static q15_t fir_coeffs[FIR_TAPS];
+static q31_t fir32_coeffs[FIR_TAPS];
+static q15_t fir_state[2][FIR_TAPS - 1U + BLOCK];
+static q31_t fir32_state[2][FIR_TAPS - 1U + BLOCK];
+
+/* Butterworth low-pass sections at fs / 10, q14 (post_shift 1), feedback negated */
+static const q15_t biquad_coeffs[5U * STAGES] = {
+    1106, 2210, 1106, 18727, -6763,
+    1106, 2210, 1106, 18727, -6763};
+static q15_t biquad_state[2][4U * STAGES];
+static q15_t avg_state[2][(1U << AVG_LOG2) + BLOCK];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Print one result line, cycles per sample scaled by 100
+ */
+static void report(const char *name, uint32_t kernel, uint32_t ref, uint32_t samples, int ok)
+{
+    bare_usart_send_string(name);
+    bare_usart_send_char(',');
+    bare_print_u32((kernel * 100U) / samples);
+    bare_usart_send_char(',');
+    bare_print_u32((ref * 100U) / samples);
+    bare_usart_send_string(ok ? ",ok\r\n" : ",MISMATCH\r\n");
+}
+
+/**
+ * @brief  Deterministic pseudo-random q15 test signal
+ */
+static void fill_input(void)
+{
+    uint32_t lfsr = 0xACE1U;
+    uint32_t i;
+
+    for (i = 0U; i < BLOCK; i++)
+    {
+        lfsr = (lfsr * 1103515245U) + 12345U;
+        input[i] = (q15_t)(lfsr >> 16);
+        input32[i] = (q31_t)lfsr;
+    }
+    for (i = 0U; i < FIR_TAPS; i++)
+    {
+        fir_coeffs[i] = (q15_t)(1024 - (int32_t)(i * 32U));
+        fir32_coeffs[i] = (q31_t)fir_coeffs[i] << 16;
+    }
+}
+
+/*******************************************************************************************
+ *                                    Main Program
+ *******************************************************************************************/
+int main(void)
+{
+    DSP_FirQ15_t fir[2];
+    DSP_FirQ31_t fir32[2];
+    DSP_DecimQ15_t decim[2];
+    DSP_BiquadQ15_t iir[2];
+    DSP_MovAvgQ15_t avg[2];
+    uint32_t t0, k, r;
+
+    bare_usart_init();
+    bare_dwt_init();
+    fill_input();
+    bare_usart_send_string("kernel,cycles_per_sample_x100,ref_x100,check\r\n");
+
+    bare_dsp_fir_q15_init(&fir[0], fir_coeffs, FIR_TAPS, fir_state[0]);
+    bare_dsp_fir_q15_init(&fir[1], fir_coeffs, FIR_TAPS, fir_state[1]);
+    t0 = bare_dwt_cycles();
+    bare_dsp_fir_q15(&fir[0], input, out_a, BLOCK);
+    k = bare_dwt_cycles() - t0;
+    t0 = bare_dwt_cycles();
+    bare_dsp_fir_q15_ref(&fir[1], input, out_b, BLOCK);
+    r = bare_dwt_cycles() - t0;
+    report("fir_q15_32", k, r, BLOCK, !memcmp(out_a, out_b, sizeof(out_a)));
+
+    bare_dsp_fir_q31_init(&fir32[0], fir32_coeffs, FIR_TAPS, fir32_state[0]);
+    bare_dsp_fir_q31_init(&fir32[1], fir32_coeffs, FIR_TAPS, fir32_state[1]);
+    t0 = bare_dwt_cycles();
+    bare_dsp_fir_q31(&fir32[0], input32, out32_a, BLOCK);
+    k = bare_dwt_cycles() - t0;
+    t0 = bare_dwt_cycles();
+    bare_dsp_fir_q31_ref(&fir32[1], input32, out32_b, BLOCK);
+    r = bare_dwt_cycles() - t0;
+    report("fir_q31_32", k, r, BLOCK, !memcmp(out32_a, out32_b, sizeof(out32_a)));
+
+    bare_dsp_decim_q15_init(&decim[0], DECIM, fir_coeffs, FIR_TAPS, fir_state[0]);
+    bare_dsp_decim_q15_init(&decim[1], DECIM, fir_coeffs, FIR_TAPS, fir_state[1]);
+    t0 = bare_dwt_cycles();
+    bare_dsp_decim_q15(&decim[0], input, out_a, BLOCK);
+    k = bare_dwt_cycles() - t0;
+    t0 = bare_dwt_cycles();
+    bare_dsp_decim_q15_ref(&decim[1], input, out_b, BLOCK);
+    r = bare_dwt_cycles() - t0;
+    report("decim_q15_32x4", k, r, BLOCK, !memcmp(out_a, out_b, (BLOCK / DECIM) * sizeof(q15_t)));
+
+    bare_dsp_biquad_q15_init(&iir[0], STAGES, biquad_coeffs, biquad_state[0], 1U);
+    bare_dsp_biquad_q15_init(&iir[1], STAGES, biquad_coeffs, biquad_state[1], 1U);
+    t0 = bare_dwt_cycles();
+    bare_dsp_biquad_q15(&iir[0], input, out_a, BLOCK);
+    k = bare_dwt_cycles() - t0;
+    t0 = bare_dwt_cycles();
+    bare_dsp_biquad_q15_ref(&iir[1], input, out_b, BLOCK);
+    r = bare_dwt_cycles() - t0;
+    report("biquad_q15_x2", k, r, BLOCK, !memcmp(out_a, out_b, sizeof(out_a)));
+
+    bare_dsp_movavg_q15_init(&avg[0], AVG_LOG2, avg_state[0]);
+    bare_dsp_movavg_q15_init(&avg[1], AVG_LOG2, avg_state[1]);
+    t0 = bare_dwt_cycles();
+    bare_dsp_movavg_q15(&avg[0], input, out_a, BLOCK);
+    k = bare_dwt_cycles() - t0;
+    t0 = bare_dwt_cycles();
+    bare_dsp_movavg_q15_ref(&avg[1], input, out_b, BLOCK);
+    r = bare_dwt_cycles() - t0;
+    report("movavg_q15_16", k, r, BLOCK, !memcmp(out_a, out_b, sizeof(out_a)));
+
+    t0 = bare_dwt_cycles();
+    bare_dsp_add_q15(input, out_b, out_a, BLOCK);
+    k = bare_dwt_cycles() - t0;
+    t0 = bare_dwt_cycles();
+    bare_dsp_add_q15_ref(input, out_b, out_b, BLOCK);
+    r = bare_dwt_cycles() - t0;
+    report("add_q15", k, r, BLOCK, !memcmp(out_a, out_b, sizeof(out_a)));
+
+    while (1)
+    {
+    }
+}
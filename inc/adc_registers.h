@@ -0,0 +1,94 @@
+/*******************************************************************************************
+ * @file    adc_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE ADC1/ADC2/ADC3 Device Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for the ADC peripherals.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef ADC_REGISTERS_H_
+#define ADC_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * ADC Base Addresses
+ * Located on the APB2 peripheral bus
+ *******************************************************************************************/
+#define ADC1_BASE (APB2PERIPH_BASE + 0x2000UL)
+#define ADC2_BASE (APB2PERIPH_BASE + 0x2100UL)
+#define ADC3_BASE (APB2PERIPH_BASE + 0x2200UL)
+#define ADC_COMMON_BASE (APB2PERIPH_BASE + 0x2300UL)
+
+/*******************************************************************************************
+ * ADC Register Definitions (RM0390, Section 13.13)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t SR;    /*!< Status register                       (offset 0x00) */
+    volatile uint32_t CR1;   /*!< Control register 1                    (offset 0x04) */
+    volatile uint32_t CR2;   /*!< Control register 2                    (offset 0x08) */
+    volatile uint32_t SMPR1; /*!< Sample time register 1 (ch 10-18)     (offset 0x0C) */
+    volatile uint32_t SMPR2; /*!< Sample time register 2 (ch 0-9)       (offset 0x10) */
+    volatile uint32_t JOFR1; /*!< Injected channel data offset 1        (offset 0x14) */
+    volatile uint32_t JOFR2; /*!< Injected channel data offset 2        (offset 0x18) */
+    volatile uint32_t JOFR3; /*!< Injected channel data offset 3        (offset 0x1C) */
+    volatile uint32_t JOFR4; /*!< Injected channel data offset 4        (offset 0x20) */
+    volatile uint32_t HTR;   /*!< Watchdog higher threshold             (offset 0x24) */
+    volatile uint32_t LTR;   /*!< Watchdog lower threshold              (offset 0x28) */
+    volatile uint32_t SQR1;  /*!< Regular sequence register 1 (L, 13-16)(offset 0x2C) */
+    volatile uint32_t SQR2;  /*!< Regular sequence register 2 (7-12)    (offset 0x30) */
+    volatile uint32_t SQR3;  /*!< Regular sequence register 3 (1-6)     (offset 0x34) */
+    volatile uint32_t JSQR;  /*!< Injected sequence register            (offset 0x38) */
+    volatile uint32_t JDR1;  /*!< Injected data register 1              (offset 0x3C) */
+    volatile uint32_t JDR2;  /*!< Injected data register 2              (offset 0x40) */
+    volatile uint32_t JDR3;  /*!< Injected data register 3              (offset 0x44) */
+    volatile uint32_t JDR4;  /*!< Injected data register 4              (offset 0x48) */
+    volatile uint32_t DR;    /*!< Regular data register                 (offset 0x4C) */
+} ADC_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t CSR; /*!< Common status register                  (offset 0x00) */
+    volatile uint32_t CCR; /*!< Common control register                 (offset 0x04) */
+    volatile uint32_t CDR; /*!< Common regular data register (dual/triple) (offset 0x08) */
+} ADC_Common_TypeDef;
+
+/*******************************************************************************************
+ * ADC Register Bits
+ *******************************************************************************************/
+#define ADC_SR_EOC (1UL << 1)       /*!< Regular channel end of conversion */
+#define ADC_SR_OVR (1UL << 5)       /*!< Overrun */
+
+#define ADC_CR1_SCAN (1UL << 8)     /*!< Scan mode */
+#define ADC_CR1_RES_Pos 24U         /*!< Resolution */
+#define ADC_CR1_OVRIE (1UL << 26)   /*!< Overrun interrupt enable */
+
+#define ADC_CR2_ADON (1UL << 0)     /*!< A/D converter on */
+#define ADC_CR2_CONT (1UL << 1)     /*!< Continuous conversion */
+#define ADC_CR2_DMA (1UL << 8)      /*!< DMA mode */
+#define ADC_CR2_DDS (1UL << 9)      /*!< DMA requests after last transfer (circular DMA) */
+#define ADC_CR2_EOCS (1UL << 10)    /*!< EOC after each conversion */
+#define ADC_CR2_EXTSEL_Pos 24U      /*!< External event select for regular group */
+#define ADC_CR2_EXTEN_Pos 28U       /*!< External trigger enable (edge) */
+#define ADC_CR2_SWSTART (1UL << 30) /*!< Start conversion of regular channels */
+
+#define ADC_SQR1_L_Pos 20U          /*!< Regular sequence length - 1 */
+
+#define ADC_CCR_ADCPRE_Pos 16U      /*!< ADC prescaler (PCLK2 / 2, 4, 6, 8) */
+#define ADC_CCR_VBATE (1UL << 22)   /*!< VBAT channel enable */
+#define ADC_CCR_TSVREFE (1UL << 23) /*!< Temperature sensor and VREFINT enable */
+
+/*******************************************************************************************
+ * ADC Peripheral Definitions
+ *******************************************************************************************/
+#define ADC1 ((ADC_TypeDef *)ADC1_BASE)
+#define ADC2 ((ADC_TypeDef *)ADC2_BASE)
+#define ADC3 ((ADC_TypeDef *)ADC3_BASE)
+#define ADC_COMMON ((ADC_Common_TypeDef *)ADC_COMMON_BASE)
+
+#endif /* ADC_REGISTERS_H_ */
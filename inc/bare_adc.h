@@ -0,0 +1,173 @@
+/*******************************************************************************************
+ * @file    bare_adc.h
+ * @author  ka5j
+ * @brief   Bare-metal ADC1/ADC2/ADC3 driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Provides multi-channel scan sequences, timer triggering and circular DMA that
+ *          delivers whole sample blocks (half- and full-buffer callbacks) without relying
+ *          on STM32 HAL drivers. Per-sample interrupts are never used.
+ *
+ *          Samples are interleaved: block[frame * count + i] holds channels[i] of frame.
+ *******************************************************************************************/
+
+#ifndef BARE_ADC_H_
+#define BARE_ADC_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "adc_registers.h"         // Include ADC register map
+#include "dma_registers.h"         // Include DMA register map
+#include "rcc_registers.h"         // Include RCC definitions for ADC clock enable
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * ADC Configuration Constants
+ *******************************************************************************************/
+#define ADC_MAX_CLOCK 36000000UL /*!< Maximum ADCCLK at VDDA >= 2.4 V (datasheet) */
+#define ADC_MAX_SEQUENCE 16U     /*!< Regular sequence length */
+
+/*******************************************************************************************
+ * ADC Configuration Enumerations
+ *******************************************************************************************/
+
+/**
+ * @brief ADC input channels (pins as on the LQFP64 package)
+ */
+typedef enum
+{
+    ADC_CHANNEL0 = 0U,   /*!< PA0 */
+    ADC_CHANNEL1 = 1U,   /*!< PA1 */
+    ADC_CHANNEL2 = 2U,   /*!< PA2 */
+    ADC_CHANNEL3 = 3U,   /*!< PA3 */
+    ADC_CHANNEL4 = 4U,   /*!< PA4 (ADC1/2) */
+    ADC_CHANNEL5 = 5U,   /*!< PA5 (ADC1/2) */
+    ADC_CHANNEL6 = 6U,   /*!< PA6 (ADC1/2) */
+    ADC_CHANNEL7 = 7U,   /*!< PA7 (ADC1/2) */
+    ADC_CHANNEL8 = 8U,   /*!< PB0 (ADC1/2) */
+    ADC_CHANNEL9 = 9U,   /*!< PB1 (ADC1/2) */
+    ADC_CHANNEL10 = 10U, /*!< PC0 */
+    ADC_CHANNEL11 = 11U, /*!< PC1 */
+    ADC_CHANNEL12 = 12U, /*!< PC2 */
+    ADC_CHANNEL13 = 13U, /*!< PC3 */
+    ADC_CHANNEL14 = 14U, /*!< PC4 (ADC1/2) */
+    ADC_CHANNEL15 = 15U, /*!< PC5 (ADC1/2) */
+    ADC_CHANNEL_TEMP = 16U,  /*!< Internal temperature sensor (ADC1) */
+    ADC_CHANNEL_VREFINT = 17U, /*!< Internal reference voltage (ADC1) */
+    ADC_CHANNEL_VBAT = 18U   /*!< VBAT / 4 (ADC1) */
+} ADC_Channel_t;
+
+/**
+ * @brief Conversion resolution
+ */
+typedef enum
+{
+    ADC_RES_12BIT = 0x00U, /*!< 15 ADCCLK cycles per conversion */
+    ADC_RES_10BIT = 0x01U, /*!< 13 ADCCLK cycles */
+    ADC_RES_8BIT = 0x02U,  /*!< 11 ADCCLK cycles */
+    ADC_RES_6BIT = 0x03U   /*!< 9 ADCCLK cycles */
+} ADC_Resolution_t;
+
+/**
+ * @brief Sampling time in ADCCLK cycles
+ */
+typedef enum
+{
+    ADC_SMP_3CYC = 0x00U,
+    ADC_SMP_15CYC = 0x01U,
+    ADC_SMP_28CYC = 0x02U,
+    ADC_SMP_56CYC = 0x03U,
+    ADC_SMP_84CYC = 0x04U,
+    ADC_SMP_112CYC = 0x05U,
+    ADC_SMP_144CYC = 0x06U,
+    ADC_SMP_480CYC = 0x07U
+} ADC_SampleTime_t;
+
+/**
+ * @brief Start-of-sequence trigger
+ *
+ * TIM4 and TIM5 have no TRGO connection to the regular group, so their channel 4 /
+ * channel 1 compare events are used instead (configured automatically).
+ */
+typedef enum
+{
+    ADC_TRIG_SOFTWARE = 0x00U,  /*!< Free-running continuous conversion */
+    ADC_TRIG_TIM2_TRGO = 0x01U, /*!< TIM2 update event */
+    ADC_TRIG_TIM3_TRGO = 0x02U, /*!< TIM3 update event */
+    ADC_TRIG_TIM4_CC4 = 0x03U,  /*!< TIM4 channel 4 compare */
+    ADC_TRIG_TIM5_CC1 = 0x04U   /*!< TIM5 channel 1 compare */
+} ADC_Trigger_t;
+
+/**
+ * @brief Block callback, executed in DMA interrupt context
+ *
+ * @param block   First sample of the completed half buffer
+ * @param frames  Number of scan sequences in the block
+ * @param ctx     User context
+ */
+typedef void (*ADC_BlockCallback_t)(const uint16_t *block, uint32_t frames, void *ctx);
+
+/**
+ * @brief ADC scan configuration
+ */
+typedef struct
+{
+    const ADC_Channel_t *channels; /*!< Scan sequence, converted in order */
+    uint8_t count;                 /*!< Sequence length (1-16) */
+    ADC_SampleTime_t sample_time;  /*!< Sampling time applied to every sequence channel */
+    ADC_Resolution_t resolution;   /*!< Conversion resolution */
+    ADC_Trigger_t trigger;         /*!< Sequence trigger */
+    uint32_t rate_hz;              /*!< Sequence rate for timer triggers */
+    uint16_t *buffer;              /*!< 2 * frames_per_block * count samples */
+    uint32_t frames_per_block;     /*!< Sequences delivered per callback */
+    ADC_BlockCallback_t cb;        /*!< Block callback */
+    void *ctx;                     /*!< Callback context */
+} ADC_Config_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Configure an ADC for DMA-driven scanning
+ *
+ * Enables the ADC and GPIO clocks, puts every sequence pin in GPIO_MODE_ANALOG, programs
+ * the sequence, sampling times, trigger timer and a circular DMA stream.
+ *
+ * @param ADCx  Pointer to ADC peripheral (ADC1, ADC2, ADC3)
+ * @param cfg   Scan configuration (must stay valid while running)
+ */
+void bare_adc_init(ADC_TypeDef *ADCx, const ADC_Config_t *cfg);
+
+/**
+ * @brief Start scanning (DMA, converter and trigger source)
+ *
+ * @param ADCx  Pointer to ADC peripheral
+ */
+void bare_adc_start(ADC_TypeDef *ADCx);
+
+/**
+ * @brief Stop scanning and the trigger timer
+ *
+ * @param ADCx  Pointer to ADC peripheral
+ */
+void bare_adc_stop(ADC_TypeDef *ADCx);
+
+/**
+ * @brief Single blocking conversion of one channel (ADC must not be scanning)
+ *
+ * @param ADCx     Pointer to ADC peripheral
+ * @param channel  Channel to convert
+ * @return uint16_t Conversion result
+ */
+uint16_t bare_adc_read(ADC_TypeDef *ADCx, ADC_Channel_t channel);
+
+/**
+ * @brief Number of DMA errors / overruns since bare_adc_init()
+ *
+ * @param ADCx  Pointer to ADC peripheral
+ * @return uint32_t Error count
+ */
+uint32_t bare_adc_errors(ADC_TypeDef *ADCx);
+
+#endif /* BARE_ADC_H_ */
@@ -0,0 +1,97 @@
+/*******************************************************************************************
+ * @file    bare_bitband.h
+ * @author  ka5j
+ * @brief   Cortex-M4 bit-band alias access for STM32F446RE (header-only)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Every bit of the first 1 MB of SRAM (0x20000000) and of the peripheral space
+ *          (0x40000000: APB1, APB2 and AHB1) has a word in the alias regions. A store to
+ *          the alias word sets or clears that one bit as a single locked bus operation,
+ *          so an interrupt can neither split it nor lose a concurrent update of another
+ *          bit of the same register. SRAM1 and SRAM2 are both covered; AHB2 / AHB3
+ *          peripherals (USB OTG HS/FS, DCMI, FMC, QSPI) are not. Do not use on rc_w0 /
+ *          rc_w1 status registers: the bus read-modify-write would write back flags
+ *          raised in between.
+ *******************************************************************************************/
+
+#ifndef BARE_BITBAND_H_
+#define BARE_BITBAND_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Alias Address Computation
+ *******************************************************************************************/
+
+/**
+ * @brief Alias word address of bit 'bit' of the byte or word at 'addr'
+ *
+ * @note  Works for both regions: the alias base is the region base + 0x02000000.
+ */
+#define BARE_BITBAND_ADDR(addr, bit)                                                          \
+    ((((uint32_t)(uintptr_t)(addr)) & 0xF0000000UL) + 0x02000000UL +                          \
+     ((((uint32_t)(uintptr_t)(addr)) & 0x000FFFFFUL) << 5) + ((uint32_t)(bit) << 2))
+
+/**
+ * @brief Alias word of one bit, usable as an lvalue
+ */
+#define BARE_BITBAND(addr, bit) (*(volatile uint32_t *)BARE_BITBAND_ADDR((addr), (bit)))
+
+/**
+ * @brief Bit number of a single-bit mask (folds to a constant for constant masks)
+ */
+#define BARE_BITBAND_BIT(mask) ((uint32_t)__builtin_ctz((uint32_t)(mask)))
+
+/*******************************************************************************************
+ * Single-Bit Access
+ *******************************************************************************************/
+
+/**
+ * @brief Atomically set or clear one bit of a peripheral register or SRAM word
+ *
+ * @param reg     Register or variable inside a bit-band region
+ * @param mask    Single-bit mask of the bit (e.g. TIM_DIER_UIE)
+ * @param on      Non-zero sets the bit, zero clears it
+ */
+static inline void bare_bitband_write(volatile uint32_t *reg, uint32_t mask, uint32_t on)
+{
+    BARE_BITBAND(reg, BARE_BITBAND_BIT(mask)) = (on != 0U) ? 1U : 0U;
+}
+
+/**
+ * @brief Atomically set one bit
+ *
+ * @param reg     Register or variable inside a bit-band region
+ * @param mask    Single-bit mask of the bit
+ */
+static inline void bare_bitband_set(volatile uint32_t *reg, uint32_t mask)
+{
+    BARE_BITBAND(reg, BARE_BITBAND_BIT(mask)) = 1U;
+}
+
+/**
+ * @brief Atomically clear one bit
+ *
+ * @param reg     Register or variable inside a bit-band region
+ * @param mask    Single-bit mask of the bit
+ */
+static inline void bare_bitband_clear(volatile uint32_t *reg, uint32_t mask)
+{
+    BARE_BITBAND(reg, BARE_BITBAND_BIT(mask)) = 0U;
+}
+
+/**
+ * @brief Read one bit through its alias word
+ *
+ * @param reg     Register or variable inside a bit-band region
+ * @param mask    Single-bit mask of the bit
+ * @return uint32_t 1 if the bit is set, 0 otherwise
+ */
+static inline uint32_t bare_bitband_read(const volatile uint32_t *reg, uint32_t mask)
+{
+    return BARE_BITBAND(reg, BARE_BITBAND_BIT(mask));
+}
+
+#endif /* BARE_BITBAND_H_ */
@@ -0,0 +1,171 @@
+/*******************************************************************************************
+ * @file    bare_can.h
+ * @author  ka5j
+ * @brief   Bare-metal bxCAN (CAN1/CAN2) driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Bit timing is derived from the real PCLK1. Received frames are drained from both
+ *          hardware FIFOs into a lock-free ring by the RX interrupts; transmit frames wait in
+ *          a priority queue (lowest identifier first) that keeps all three TX mailboxes busy.
+ *
+ *          Filter banks 0-13 belong to CAN1 and 14-27 to CAN2 (CAN2SB reset value).
+ *******************************************************************************************/
+
+#ifndef BARE_CAN_H_
+#define BARE_CAN_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "can_registers.h"         // Include CAN register map
+#include "gpio_registers.h"        // GPIO peripheral definitions
+#include "bare_gpio.h"             // GPIO header file
+#include "bare_can_filter.h"       // Filter rules and packing
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * CAN Configuration Constants
+ *******************************************************************************************/
+#ifndef CAN_RX_RING_SIZE
+#define CAN_RX_RING_SIZE 32U /*!< Received frames buffered per controller (power of two) */
+#endif
+
+#ifndef CAN_TX_QUEUE_SIZE
+#define CAN_TX_QUEUE_SIZE 16U /*!< Frames waiting for a mailbox per controller */
+#endif
+
+#define CAN_BANKS_PER_CONTROLLER 14U /*!< Filter banks available to each controller */
+
+/*******************************************************************************************
+ * CAN Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Operation status
+ */
+typedef enum
+{
+    CAN_OK = 0x00U,          /*!< Success */
+    CAN_FULL = 0x01U,        /*!< TX queue full */
+    CAN_ERR_TIMING = 0x02U,  /*!< Bit rate not reachable from PCLK1 */
+    CAN_ERR_TIMEOUT = 0x03U, /*!< Controller did not enter/leave initialization */
+    CAN_ERR_FILTERS = 0x04U  /*!< Rules do not fit in the controller's filter banks */
+} CAN_Status_t;
+
+/**
+ * @brief GPIO pin reference
+ */
+typedef struct
+{
+    GPIO_TypeDef *port; /*!< GPIO port */
+    GPIO_Pins_t pin;    /*!< Pin number */
+} CAN_Pin_t;
+
+/**
+ * @brief Controller configuration
+ */
+typedef struct
+{
+    CAN_Pin_t rx;          /*!< CAN_RX pin */
+    CAN_Pin_t tx;          /*!< CAN_TX pin */
+    uint8_t af;            /*!< Alternate function (AF9) */
+    uint32_t bitrate;      /*!< Bit rate in bit/s */
+    uint16_t sample_point; /*!< Sample point in permille (875 = 87.5 %) */
+    uint8_t loopback;      /*!< 1 = internal loop back (self test) */
+    uint8_t silent;        /*!< 1 = listen only */
+} CAN_Config_t;
+
+/**
+ * @brief CAN 2.0 frame
+ */
+typedef struct
+{
+    uint32_t id;        /*!< 11 or 29-bit identifier */
+    uint8_t ide;        /*!< 1 = extended identifier */
+    uint8_t rtr;        /*!< 1 = remote frame */
+    uint8_t dlc;        /*!< Data length (0-8) */
+    uint8_t fmi;        /*!< Filter match index (receive only) */
+    uint16_t timestamp; /*!< Bit-time stamp of the SOF (receive only) */
+    uint8_t fifo;       /*!< Hardware FIFO it arrived in (receive only) */
+    uint8_t data[8];    /*!< Payload */
+} CAN_Frame_t;
+
+/**
+ * @brief Driver counters
+ */
+typedef struct
+{
+    uint32_t tx_frames;   /*!< Frames transmitted */
+    uint32_t tx_aborts;   /*!< Mailboxes preempted by a higher priority frame */
+    uint32_t rx_frames;   /*!< Frames received into the ring */
+    uint32_t rx_dropped;  /*!< Frames lost because the ring was full */
+    uint32_t rx_overruns; /*!< Frames lost in a full hardware FIFO */
+} CAN_Stats_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Initialize a controller and bring it onto the bus
+ *
+ * Filters are left accepting nothing; call bare_can_set_filters() to receive.
+ *
+ * @param CANx  Pointer to CAN peripheral (CAN1 or CAN2)
+ * @param cfg   Controller configuration
+ * @return CAN_Status_t CAN_OK, CAN_ERR_TIMING or CAN_ERR_TIMEOUT
+ */
+CAN_Status_t bare_can_init(CAN_TypeDef *CANx, const CAN_Config_t *cfg);
+
+/**
+ * @brief Compute BTR for a bit rate
+ *
+ * Picks the prescaler giving the most time quanta per bit (8-25) with an exact rate,
+ * then splits them around the requested sample point.
+ *
+ * @param pclk1         APB1 clock in Hz
+ * @param bitrate       Bit rate in bit/s
+ * @param sample_point  Sample point in permille
+ * @param btr           Output: BTR timing fields
+ * @return uint8_t 1 on success, 0 if no exact setting exists
+ */
+uint8_t bare_can_timing(uint32_t pclk1, uint32_t bitrate, uint16_t sample_point,
+                        uint32_t *btr);
+
+/**
+ * @brief Pack acceptance rules and load them into the controller's filter banks
+ *
+ * @param CANx   Pointer to CAN peripheral
+ * @param rules  Acceptance rules
+ * @param count  Number of rules
+ * @return CAN_Status_t CAN_OK or CAN_ERR_FILTERS
+ */
+CAN_Status_t bare_can_set_filters(CAN_TypeDef *CANx, const CAN_FilterRule_t *rules,
+                                  uint32_t count);
+
+/**
+ * @brief Queue a frame for transmission
+ *
+ * @param CANx   Pointer to CAN peripheral
+ * @param frame  Frame to send (copied)
+ * @return CAN_Status_t CAN_OK or CAN_FULL
+ */
+CAN_Status_t bare_can_send(CAN_TypeDef *CANx, const CAN_Frame_t *frame);
+
+/**
+ * @brief Take the oldest received frame
+ *
+ * @param CANx   Pointer to CAN peripheral
+ * @param frame  Output frame
+ * @return uint8_t 1 if a frame was returned, 0 if the ring is empty
+ */
+uint8_t bare_can_receive(CAN_TypeDef *CANx, CAN_Frame_t *frame);
+
+/**
+ * @brief Read the driver counters
+ *
+ * @param CANx  Pointer to CAN peripheral
+ * @param out   Output counters
+ */
+void bare_can_stats(CAN_TypeDef *CANx, CAN_Stats_t *out);
+
+#endif /* BARE_CAN_H_ */
@@ -0,0 +1,106 @@
+/*******************************************************************************************
+ * @file    bare_can_filter.h
+ * @author  ka5j
+ * @brief   bxCAN acceptance filter bank packing (target and host)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Register free: turns a list of identifier / mask rules into the fewest filter
+ *          banks, so it can be unit tested on the host. bare_can_set_filters() writes the
+ *          result to the hardware.
+ *
+ *          Bank capacities: 16-bit list 4 standard IDs, 16-bit mask 2 standard rules,
+ *          32-bit list 2 IDs of either kind, 32-bit mask 1 rule of either kind.
+ *          Exact rules (full mask) go to list banks, which match data frames only; mask
+ *          rules, and an exact rule sharing a mask bank, also accept remote frames.
+ *******************************************************************************************/
+
+#ifndef BARE_CAN_FILTER_H_
+#define BARE_CAN_FILTER_H_
+
+#include <stdint.h> // Include standard integer types
+
+/*******************************************************************************************
+ * Filter Configuration Constants
+ *******************************************************************************************/
+#define CAN_FILTER_BANKS 28U        /*!< Banks shared by CAN1 and CAN2 */
+#define CAN_FILTER_MAX_RULES 112U   /*!< 28 banks x 4 standard IDs */
+#define CAN_STD_ID_MASK 0x7FFUL     /*!< 11-bit identifier */
+#define CAN_EXT_ID_MASK 0x1FFFFFFFUL /*!< 29-bit identifier */
+
+/*******************************************************************************************
+ * Filter Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Bank mode (FM1R bit value)
+ */
+typedef enum
+{
+    CAN_FILTER_MASK = 0x00U, /*!< Identifier + mask */
+    CAN_FILTER_LIST = 0x01U  /*!< List of exact identifiers */
+} CAN_FilterMode_t;
+
+/**
+ * @brief Bank scale (FS1R bit value)
+ */
+typedef enum
+{
+    CAN_FILTER_16BIT = 0x00U, /*!< Two 16-bit halves per register */
+    CAN_FILTER_32BIT = 0x01U  /*!< One 32-bit value per register */
+} CAN_FilterScale_t;
+
+/**
+ * @brief One acceptance rule: a frame passes when (frame_id & mask) == (id & mask)
+ */
+typedef struct
+{
+    uint32_t id;   /*!< Identifier */
+    uint32_t mask; /*!< Bits that must match (CAN_STD_ID_MASK / CAN_EXT_ID_MASK: exact) */
+    uint8_t ide;   /*!< 1 = 29-bit extended identifier */
+    uint8_t fifo;  /*!< Receive FIFO (0 or 1) */
+} CAN_FilterRule_t;
+
+/**
+ * @brief Packed filter bank, ready for FR1/FR2
+ */
+typedef struct
+{
+    CAN_FilterMode_t mode;   /*!< List or mask */
+    CAN_FilterScale_t scale; /*!< 16 or 32-bit */
+    uint8_t fifo;            /*!< FIFO assignment */
+    uint32_t fr1;            /*!< Filter register 1 */
+    uint32_t fr2;            /*!< Filter register 2 */
+} CAN_FilterBank_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Pack rules into the minimum number of filter banks
+ *
+ * Duplicate rules and rules covered by a wider rule on the same FIFO are dropped first.
+ *
+ * @param rules  Acceptance rules
+ * @param count  Number of rules (at most CAN_FILTER_MAX_RULES)
+ * @param banks  Output banks
+ * @param max    Capacity of banks
+ * @return int32_t Number of banks used, or -1 if they do not fit
+ */
+int32_t bare_can_filter_pack(const CAN_FilterRule_t *rules, uint32_t count,
+                             CAN_FilterBank_t *banks, uint32_t max);
+
+/**
+ * @brief Check a frame identifier against a packed bank (mirrors the hardware match)
+ *
+ * @param bank  Filter bank
+ * @param id    Frame identifier
+ * @param ide   1 = extended identifier
+ * @param rtr   1 = remote frame
+ * @return uint8_t 1 if the bank accepts the frame
+ */
+uint8_t bare_can_filter_match(const CAN_FilterBank_t *bank, uint32_t id, uint8_t ide,
+                              uint8_t rtr);
+
+#endif /* BARE_CAN_FILTER_H_ */
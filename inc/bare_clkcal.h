@@ -0,0 +1,152 @@
+/*******************************************************************************************
+ * @file    bare_clkcal.h
+ * @author  ka5j
+ * @brief   HSI trimming and USART baud calibration by timer input capture (STM32F446RE)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The HSI is only specified to +-1 % at 25 degC and drifts further over temperature,
+ *          which is enough for framing errors at high baud rates. Its frequency is measured
+ *          by counting timer clock ticks over a number of reference periods:
+ *          - CLKCAL_REF_LSE: the 32.768 kHz crystal, fed internally to TIM5 CH4 (TIM5_OR)
+ *          - CLKCAL_REF_PIN: any pulse train (GPS PPS, signal generator) on a TIM2-TIM5
+ *            channel pin
+ *          bare_clkcal_trim_hsi() then walks RCC_CR.HSITRIM one step at a time toward the
+ *          reference until the error changes sign, and keeps the best step. The residual
+ *          is at best half a trim step (roughly 0.2-0.3 %) plus the reference tolerance.
+ *
+ *          bare_clkcal_autobaud() measures an incoming sync character 'U' (0x55) on PA3
+ *          (USART2 RX, captured by TIM2 or TIM5 CH4). Its five falling edges are two bit
+ *          times apart, so the bit time is read directly against the local clock and BRR
+ *          matches the sender whatever the remaining HSI error.
+ *
+ *          All captures are polled with interrupts enabled; an interrupt that delays the
+ *          loop past the next capture is detected (overcapture) and reported.
+ *******************************************************************************************/
+
+#ifndef BARE_CLKCAL_H_
+#define BARE_CLKCAL_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "tim2_5_registers.h"      // Timer register structures
+#include "gpio_registers.h"        // GPIO peripheral definitions
+#include "bare_gpio.h"             // GPIO pin enumeration
+#include "bare_tim2_5.h"           // Timer channel enumeration
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Calibration Configuration
+ *******************************************************************************************/
+#define CLKCAL_TIMEOUT_MS 2000U  /*!< Default LSE start-up and per-edge timeout */
+#define CLKCAL_BAUD_TOL_PCT 10U  /*!< Accepted deviation of a sync character from nominal */
+
+/*******************************************************************************************
+ * Calibration Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Frequency reference
+ */
+typedef enum
+{
+    CLKCAL_REF_LSE = 0x00U, /*!< LSE crystal on TIM5 CH4 (timer, channel and pin ignored) */
+    CLKCAL_REF_PIN = 0x01U  /*!< Rising edges on a timer channel pin */
+} CLKCAL_Ref_t;
+
+/**
+ * @brief Status codes
+ */
+typedef enum
+{
+    CLKCAL_OK = 0x00U,          /*!< Success */
+    CLKCAL_ERR_PARAM = 0x01U,   /*!< Bad configuration */
+    CLKCAL_ERR_SOURCE = 0x02U,  /*!< The timer clock does not come from HSI */
+    CLKCAL_ERR_TIMEOUT = 0x03U, /*!< LSE did not start, or no edge / sync character */
+    CLKCAL_ERR_OVERRUN = 0x04U, /*!< A capture was missed (interrupt load too high) */
+    CLKCAL_ERR_RANGE = 0x05U    /*!< Trim limit reached, or baud rate not reachable */
+} CLKCAL_Status_t;
+
+/**
+ * @brief Reference configuration
+ */
+typedef struct
+{
+    CLKCAL_Ref_t ref;       /*!< Reference source */
+    TIM2_5_TypeDef *tim;    /*!< Capture timer (CLKCAL_REF_PIN) */
+    TIM2_5_CHNL_t channel;  /*!< Capture channel (CLKCAL_REF_PIN) */
+    GPIO_TypeDef *port;     /*!< Channel pin port (CLKCAL_REF_PIN) */
+    GPIO_Pins_t pin;        /*!< Channel pin (CLKCAL_REF_PIN) */
+    uint32_t ref_hz;        /*!< Reference frequency, 0 = LSE_VALUE */
+    uint32_t periods;       /*!< Reference periods per measurement, 0 = 1/16 s worth */
+    uint32_t timeout_ms;    /*!< LSE start-up and per-edge timeout, 0 = CLKCAL_TIMEOUT_MS */
+} CLKCAL_Config_t;
+
+/**
+ * @brief Trim outcome (ppm: positive when the clock runs fast)
+ */
+typedef struct
+{
+    uint8_t initial_trim; /*!< HSITRIM before calibration */
+    uint8_t trim;         /*!< HSITRIM left programmed */
+    uint8_t steps;        /*!< Measurements taken */
+    int32_t initial_ppm;  /*!< Error before calibration */
+    int32_t residual_ppm; /*!< Error measured at the final trim */
+} CLKCAL_Result_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Measure the timer clock against the reference
+ *
+ * Works with any clock source; with HSI (directly or through the PLL) the result is the
+ * HSI error.
+ *
+ * The capture timer may be in use: its PSC, ARR, CR1 and channel setup are put back
+ * afterwards (the counter restarts from 0).
+ *
+ * @param cfg     Reference configuration
+ * @param ppm     Receives the error in ppm of the nominal timer clock
+ * @return CLKCAL_Status_t CLKCAL_OK or an error
+ */
+CLKCAL_Status_t bare_clkcal_measure(const CLKCAL_Config_t *cfg, int32_t *ppm);
+
+/**
+ * @brief Trim the HSI to the reference and report the residual error
+ *
+ * On an error the trim with the smallest measured error so far is left programmed.
+ *
+ * @param cfg     Reference configuration
+ * @param res     Receives the trim steps and errors
+ * @return CLKCAL_Status_t CLKCAL_OK, CLKCAL_ERR_RANGE when HSITRIM hit 0 or 31, or an error
+ */
+CLKCAL_Status_t bare_clkcal_trim_hsi(const CLKCAL_Config_t *cfg, CLKCAL_Result_t *res);
+
+/**
+ * @brief Measure a sync character 'U' on PA3 and tune the USART2 baud rate to it
+ *
+ * PA3 is lent to the timer for the measurement and handed back to USART2. The timer may
+ * be in use: its PSC, ARR, CR1 and CH4 setup are saved and put back afterwards, which
+ * restarts its counter from 0.
+ *
+ * @param TIMx        TIM2 or TIM5 (CH4 on PA3)
+ * @param nominal     Expected rate; the sync must be within CLKCAL_BAUD_TOL_PCT of it
+ *                    (0: accept any, only 'U' may be on the line)
+ * @param timeout_ms  Time to wait for the sync character
+ * @param baud        Receives the measured rate (may be NULL)
+ * @return CLKCAL_Status_t CLKCAL_OK, CLKCAL_ERR_TIMEOUT, CLKCAL_ERR_RANGE or CLKCAL_ERR_PARAM
+ */
+CLKCAL_Status_t bare_clkcal_autobaud(TIM2_5_TypeDef *TIMx, uint32_t nominal,
+                                     uint32_t timeout_ms, uint32_t *baud);
+
+/**
+ * @brief Write a trim outcome over USART2
+ *
+ * Format: "HSITRIM <initial> <final> PPM <initial> <residual> STEPS <n>".
+ *
+ * @param res     Outcome of bare_clkcal_trim_hsi()
+ */
+void bare_clkcal_report(const CLKCAL_Result_t *res);
+
+#endif /* BARE_CLKCAL_H_ */
@@ -0,0 +1,117 @@
+/*******************************************************************************************
+ * @file    bare_console.h
+ * @author  ka5j
+ * @brief   Non-blocking UART command shell for STM32F446RE (USART2)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Received bytes are queued by the USART2 interrupt and consumed by
+ *          bare_console_poll() from the main loop, a bounded number per call, so the
+ *          console never waits for keystrokes. All output goes through the interrupt-driven
+ *          USART2 transmit ring and is dropped, not waited for, when the ring is full.
+ *          Commands are found through a hash index built once by bare_console_init():
+ *          one FNV-1a hash of the typed word, one probe, one confirming compare.
+ *******************************************************************************************/
+
+#ifndef BARE_CONSOLE_H_
+#define BARE_CONSOLE_H_
+
+#include <stdint.h> // Include standard integer types
+
+/*******************************************************************************************
+ * Console Configuration
+ *******************************************************************************************/
+#define CONSOLE_LINE_MAX 64U     /*!< Longest command line, including the terminator */
+#define CONSOLE_ARGS_MAX 8U      /*!< Words per command line */
+#define CONSOLE_HISTORY 4U       /*!< Remembered lines (arrow up / down) */
+#define CONSOLE_RX_RING_SIZE 64U /*!< Received bytes awaiting the poll (power of 2) */
+#define CONSOLE_POLL_BUDGET 16U  /*!< Bytes handled per bare_console_poll() call */
+#define CONSOLE_HASH_SIZE 64U    /*!< Hash index slots (power of 2, > 2x commands) */
+
+/*******************************************************************************************
+ * Console Types
+ *******************************************************************************************/
+
+/**
+ * @brief Command handler
+ *
+ * @param argc    Number of words, argv[0] is the command name
+ * @param argv    Words of the line (NUL-terminated, valid during the call)
+ */
+typedef void (*CONSOLE_Handler_t)(int argc, char *argv[]);
+
+/**
+ * @brief Command table entry
+ */
+typedef struct
+{
+    const char *name;          /*!< Command word */
+    CONSOLE_Handler_t handler; /*!< Called with the parsed line */
+    const char *help;          /*!< One-line description for "help" */
+} CONSOLE_Command_t;
+
+/**
+ * @brief Status codes
+ */
+typedef enum
+{
+    CONSOLE_OK = 0x00U,           /*!< Success */
+    CONSOLE_ERR_FULL = 0x01U,     /*!< More commands than the hash index can hold */
+    CONSOLE_ERR_DUPLICATE = 0x02U /*!< Two names hash equal (rename one) or repeat */
+} CONSOLE_Status_t;
+
+/**
+ * @brief Counters
+ */
+typedef struct
+{
+    uint32_t lines;      /*!< Lines executed */
+    uint32_t unknown;    /*!< Lines whose command was not found */
+    uint32_t rx_dropped; /*!< Received bytes lost to a full RX ring */
+    uint32_t tx_dropped; /*!< Output bytes lost to a full TX ring */
+} CONSOLE_Stats_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Build the command index, hook USART2 reception and print the prompt
+ *
+ * @param cmds    Command table (referenced, must stay valid); "help" is built in
+ * @param n       Number of entries
+ * @param prompt  Prompt string (referenced)
+ * @return CONSOLE_Status_t CONSOLE_OK, CONSOLE_ERR_FULL or CONSOLE_ERR_DUPLICATE
+ *
+ * @note  USART2 must already be initialized with bare_usart_init().
+ */
+CONSOLE_Status_t bare_console_init(const CONSOLE_Command_t *cmds, uint8_t n,
+                                   const char *prompt);
+
+/**
+ * @brief Process up to CONSOLE_POLL_BUDGET received bytes (call from the main loop)
+ */
+void bare_console_poll(void);
+
+/**
+ * @brief Queue a string for output without waiting
+ *
+ * @param str     NUL-terminated string
+ */
+void bare_console_print(const char *str);
+
+/**
+ * @brief Queue an unsigned decimal number for output
+ *
+ * @param v       Value
+ */
+void bare_console_print_u32(uint32_t v);
+
+/**
+ * @brief Console counters
+ *
+ * @return const CONSOLE_Stats_t* Counters
+ */
+const CONSOLE_Stats_t *bare_console_stats(void);
+
+#endif /* BARE_CONSOLE_H_ */
@@ -0,0 +1,122 @@
+/*******************************************************************************************
+ * @file    bare_crc.h
+ * @author  ka5j
+ * @brief   Bare-metal CRC calculation unit driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Provides the hardware CRC32 unit (word feed and DMA streaming). The table-driven
+ *          software implementations are declared in bare_crc_sw.h (included here); they
+ *          produce bit-exact results with the hardware paths and serve as its fallback.
+ *
+ *          Two CRC32 flavours are offered:
+ *          - "STM32" / CRC-32/MPEG-2 on 32-bit words: the peripheral's native algorithm
+ *            (poly 0x04C11DB7, init 0xFFFFFFFF, no reflection, no final XOR), each word
+ *            fed MSB first.
+ *          - CRC-32/ISO-HDLC (zlib, Ethernet) on bytes: computed by the peripheral with
+ *            bit-reversed input/output, remaining tail bytes in software.
+ *******************************************************************************************/
+
+#ifndef BARE_CRC_H_
+#define BARE_CRC_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "crc_registers.h"         // Include CRC register map
+#include "dma_registers.h"         // Include DMA register map (DMA streaming)
+#include "bare_crc_sw.h"           // Software implementations and initial values
+#include <stddef.h>                // Include size_t
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * CRC Configuration Constants
+ *******************************************************************************************/
+#ifndef BARE_CRC_DMA_STREAM
+#define BARE_CRC_DMA_STREAM DMA2_Stream0 /*!< Memory-to-memory capable stream (DMA2 only) */
+#endif
+
+/*******************************************************************************************
+ * CRC Enumerations
+ *******************************************************************************************/
+
+/**
+ * @brief CRC operation status
+ */
+typedef enum
+{
+    CRC_OK = 0x00U,   /*!< Operation accepted / completed */
+    CRC_BUSY = 0x01U, /*!< Peripheral owned by a DMA transfer */
+    CRC_ERROR = 0x02U /*!< DMA transfer error (bad buffer address) */
+} CRC_Status_t;
+
+/**
+ * @brief DMA completion callback, executed in DMA interrupt context
+ *
+ * @param status  CRC_OK or CRC_ERROR
+ * @param crc     CRC-32/MPEG-2 (peripheral) result of the streamed block
+ * @param ctx     User context passed to bare_crc_dma_start()
+ */
+typedef void (*CRC_Callback_t)(CRC_Status_t status, uint32_t crc, void *ctx);
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Enable the CRC peripheral clock and reset the unit
+ */
+void bare_crc_init(void);
+
+/**
+ * @brief Reset the CRC unit to BARE_CRC32_STM32_INIT
+ */
+void bare_crc_reset(void);
+
+/**
+ * @brief Feed words into the running hardware CRC (no reset)
+ *
+ * @param words  Pointer to 32-bit words
+ * @param count  Number of words
+ * @return uint32_t Running CRC-32/MPEG-2 value
+ */
+uint32_t bare_crc_feed(const uint32_t *words, size_t count);
+
+/**
+ * @brief One-shot CRC-32/MPEG-2 of a word buffer
+ *
+ * @param words  Pointer to 32-bit words
+ * @param count  Number of words
+ * @return uint32_t CRC value (software fallback if the unit is busy with DMA)
+ */
+uint32_t bare_crc32_stm32(const uint32_t *words, size_t count);
+
+/**
+ * @brief One-shot CRC-32/ISO-HDLC (zlib) of a byte buffer using the hardware unit
+ *
+ * @param data  Pointer to data (any alignment)
+ * @param len   Length in bytes
+ * @return uint32_t CRC value (software fallback if the unit is busy with DMA)
+ */
+uint32_t bare_crc32(const void *data, size_t len);
+
+/**
+ * @brief Stream a word buffer through the CRC unit with memory-to-memory DMA
+ *
+ * Buffers longer than 65535 words are transferred in chunks from the DMA interrupt.
+ *
+ * @param words  Word aligned buffer, must stay valid until the callback runs
+ * @param count  Number of words
+ * @param cb     Completion callback receiving the CRC-32/MPEG-2 result
+ * @param ctx    User context passed to the callback
+ * @return CRC_Status_t CRC_OK, or CRC_BUSY if a transfer is already running
+ */
+CRC_Status_t bare_crc_dma_start(const uint32_t *words, size_t count,
+                                CRC_Callback_t cb, void *ctx);
+
+/**
+ * @brief Check whether a DMA CRC transfer is in progress
+ *
+ * @return uint8_t 1 if busy, 0 otherwise
+ */
+uint8_t bare_crc_dma_busy(void);
+
+#endif /* BARE_CRC_H_ */
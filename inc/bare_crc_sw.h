@@ -0,0 +1,74 @@
+/*******************************************************************************************
+ * @file    bare_crc_sw.h
+ * @author  ka5j
+ * @brief   Table-driven software CRC implementations (register free)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Split from bare_crc.h so that code which only needs a software CRC (the frame
+ *          codec, host tools and tests) links bare_crc_sw.c alone, without the CRC unit,
+ *          DMA and peripheral table.
+ *
+ *          CRC-32/MPEG-2 on words is bit-exact with the STM32 CRC unit; CRC-32/ISO-HDLC is
+ *          the zlib / Ethernet CRC.
+ *******************************************************************************************/
+
+#ifndef BARE_CRC_SW_H_
+#define BARE_CRC_SW_H_
+
+#include <stddef.h> // Include size_t
+#include <stdint.h> // Include standard integer types
+
+/*******************************************************************************************
+ * CRC Initial Values
+ *******************************************************************************************/
+#define BARE_CRC32_STM32_INIT 0xFFFFFFFFUL /*!< Peripheral reset value of DR */
+#define BARE_CRC32_INIT 0x00000000UL       /*!< Initial value for bare_crc32_sw() */
+#define BARE_CRC16_CCITT_INIT 0xFFFFU      /*!< CRC-16/CCITT-FALSE (0x0000 gives XMODEM) */
+#define BARE_CRC16_MODBUS_INIT 0xFFFFU     /*!< CRC-16/MODBUS */
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief CRC-32/MPEG-2 of a word buffer, bit-exact with the peripheral (slicing-by-4)
+ *
+ * @param crc    Previous value (BARE_CRC32_STM32_INIT to start)
+ * @param words  Pointer to 32-bit words
+ * @param count  Number of words
+ * @return uint32_t Updated CRC value
+ */
+uint32_t bare_crc32_stm32_sw(uint32_t crc, const uint32_t *words, size_t count);
+
+/**
+ * @brief CRC-32/ISO-HDLC (zlib) of a byte buffer (slicing-by-4)
+ *
+ * @param crc   Previous result (BARE_CRC32_INIT to start)
+ * @param data  Pointer to data
+ * @param len   Length in bytes
+ * @return uint32_t Updated CRC value
+ */
+uint32_t bare_crc32_sw(uint32_t crc, const void *data, size_t len);
+
+/**
+ * @brief CRC-16/CCITT (poly 0x1021, not reflected, no final XOR)
+ *
+ * @param crc   Previous value (BARE_CRC16_CCITT_INIT to start)
+ * @param data  Pointer to data
+ * @param len   Length in bytes
+ * @return uint16_t Updated CRC value
+ */
+uint16_t bare_crc16_ccitt(uint16_t crc, const void *data, size_t len);
+
+/**
+ * @brief CRC-16/MODBUS (poly 0x8005 reflected, no final XOR)
+ *
+ * @param crc   Previous value (BARE_CRC16_MODBUS_INIT to start)
+ * @param data  Pointer to data
+ * @param len   Length in bytes
+ * @return uint16_t Updated CRC value
+ */
+uint16_t bare_crc16_modbus(uint16_t crc, const void *data, size_t len);
+
+#endif /* BARE_CRC_SW_H_ */
@@ -0,0 +1,171 @@
+/*******************************************************************************************
+ * @file    bare_ctrl.h
+ * @author  ka5j
+ * @brief   Fixed-rate control loop runner on TIM2-TIM5 with timing statistics
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The loop step is called from the timer update interrupt. PSC/ARR are derived
+ *          from the live timer clock (bare_tim2_5_set_rate) and follow clock profile
+ *          switches. Each activation is timestamped with the DWT cycle counter:
+ *          - jitter: |interval between activations - nominal period|, in CPU cycles
+ *          - execution time: cycles spent in the step
+ *          - overrun: the next update was already pending when the step returned
+ *          - missed: whole periods without an activation
+ *          Both distributions are kept as log2 histograms (bin k counts values in
+ *          [2^(k-1), 2^k), bin 0 counts zero, the last bin is open-ended).
+ *
+ *          Route the timer interrupt to the runner in the application:
+ *
+ *              void TIM3_IRQHandler(void) { bare_ctrl_irq_handler(TIM3); }
+ *******************************************************************************************/
+
+#ifndef BARE_CTRL_H_
+#define BARE_CTRL_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "tim2_5_registers.h"      // Timer register structures
+#include "bare_dsp.h"              // Include q15 type
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Control Loop Configuration
+ *******************************************************************************************/
+#define CTRL_HIST_BINS 24U /*!< Log2 histogram bins (last bin: 2^22 cycles and more) */
+
+/*******************************************************************************************
+ * Control Loop Types
+ *******************************************************************************************/
+
+/**
+ * @brief Loop step, timer interrupt context
+ *
+ * @param ctx     User context from the configuration
+ * @param cycles  DWT cycle count at the activation (for dt between steps)
+ */
+typedef void (*CTRL_Step_t)(void *ctx, uint32_t cycles);
+
+/**
+ * @brief Loop configuration
+ */
+typedef struct
+{
+    TIM2_5_TypeDef *tim; /*!< Timer owned by the loop */
+    uint32_t rate_hz;    /*!< Loop rate */
+    uint8_t priority;    /*!< NVIC priority (0 = highest, 15 = lowest) */
+    CTRL_Step_t step;    /*!< Called once per period */
+    void *ctx;           /*!< Passed to step */
+} CTRL_Config_t;
+
+/**
+ * @brief Timing statistics (cycles are CPU/HCLK cycles)
+ */
+typedef struct
+{
+    uint32_t rate_hz;                     /*!< Achieved loop rate */
+    uint32_t period_cycles;               /*!< Nominal period */
+    uint32_t activations;                 /*!< Steps run */
+    uint32_t overruns;                    /*!< Steps still running at the next update */
+    uint32_t missed;                      /*!< Periods without an activation */
+    uint32_t last_start;                  /*!< Cycle count of the latest activation */
+    uint32_t exec_min;                    /*!< Shortest step */
+    uint32_t exec_max;                    /*!< Longest step */
+    uint32_t jitter_max;                  /*!< Largest start deviation */
+    uint32_t exec_hist[CTRL_HIST_BINS];   /*!< Step execution time histogram */
+    uint32_t jitter_hist[CTRL_HIST_BINS]; /*!< Start deviation histogram */
+} CTRL_Stats_t;
+
+/**
+ * @brief q15 PID controller with clamping anti-windup
+ *
+ * Gains are non-negative q15 values scaled by 2^shift. ki and kd are per step
+ * (ki = Ki * Ts, kd = Kd / Ts). The derivative acts on the measurement, so setpoint steps
+ * cause no kick. A step that would carry the output past a limit integrates only up to
+ * it; while the output is saturated, the integrator only moves back toward the range, and
+ * it is itself clamped to [out_min, out_max].
+ */
+typedef struct
+{
+    q15_t kp;        /*!< Proportional gain */
+    q15_t ki;        /*!< Integral gain per step */
+    q15_t kd;        /*!< Derivative gain per step */
+    uint8_t shift;   /*!< Gain scale: effective gain = k * 2^shift */
+    q15_t out_min;   /*!< Output lower limit */
+    q15_t out_max;   /*!< Output upper limit */
+    int32_t integ;   /*!< Integrator, q15 with 16 extra fraction bits */
+    q15_t prev_meas; /*!< Previous measurement */
+} CTRL_PidQ15_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Configure the timer for the loop rate and start calling the step
+ *
+ * Starts the DWT cycle counter if it is not running.
+ *
+ * @param cfg     Configuration (copied)
+ * @return uint32_t Achieved loop rate in Hz, 0 on a bad configuration
+ */
+uint32_t bare_ctrl_start(const CTRL_Config_t *cfg);
+
+/**
+ * @brief Stop the loop and its timer; statistics stay readable
+ *
+ * @param TIMx    Timer of the loop
+ */
+void bare_ctrl_stop(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Take a consistent copy of the statistics (lock-free, retries if interrupted)
+ *
+ * @param TIMx    Timer of the loop
+ * @param out     Receives the statistics
+ */
+void bare_ctrl_get_stats(TIM2_5_TypeDef *TIMx, CTRL_Stats_t *out);
+
+/**
+ * @brief Clear the statistics at the next activation
+ *
+ * @param TIMx    Timer of the loop
+ */
+void bare_ctrl_reset_stats(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Write the statistics over USART2
+ *
+ * Format: "CTRL <hz> <period> <activations> <overruns> <missed>",
+ * "EXEC <min> <max> <bins...>", "JITTER <max> <bins...>", "END".
+ *
+ * @param TIMx    Timer of the loop
+ */
+void bare_ctrl_dump(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Timer update interrupt work: timestamp, run the step, record timing
+ *
+ * @param TIMx    Timer of the loop
+ */
+void bare_ctrl_irq_handler(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Reset a PID for a bumpless start from the current plant state
+ *
+ * @param pid          Controller (gains and limits already set)
+ * @param measurement  Current measurement
+ * @param output       Output currently applied
+ */
+void bare_ctrl_pid_reset(CTRL_PidQ15_t *pid, q15_t measurement, q15_t output);
+
+/**
+ * @brief Run one PID step
+ *
+ * @param pid          Controller
+ * @param setpoint     Setpoint
+ * @param measurement  Measurement
+ * @return q15_t Output within [out_min, out_max]
+ */
+q15_t bare_ctrl_pid_q15(CTRL_PidQ15_t *pid, q15_t setpoint, q15_t measurement);
+
+#endif /* BARE_CTRL_H_ */
@@ -0,0 +1,144 @@
+/*******************************************************************************************
+ * @file    bare_dac.h
+ * @author  ka5j
+ * @brief   Bare-metal DAC channel 1/2 driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Waveforms are streamed by a timer TRGO (TIM2/TIM4/TIM5 through bare_tim2_5)
+ *          triggering one conversion per sample, fed from a circular DMA buffer split into
+ *          two blocks: the application refills one block while the other is played.
+ *          The built-in noise (LFSR) and triangle generators need only the trigger.
+ *******************************************************************************************/
+
+#ifndef BARE_DAC_H_
+#define BARE_DAC_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "dac_registers.h"         // Include DAC register map
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * DAC Configuration Enumerations
+ *******************************************************************************************/
+
+/**
+ * @brief Output channel
+ */
+typedef enum
+{
+    DAC_CHANNEL1 = 0x00U, /*!< PA4 */
+    DAC_CHANNEL2 = 0x01U  /*!< PA5 */
+} DAC_Channel_t;
+
+/**
+ * @brief Conversion trigger (TSEL value)
+ */
+typedef enum
+{
+    DAC_TRIG_TIM5_TRGO = 0x03U, /*!< TIM5 update event */
+    DAC_TRIG_TIM2_TRGO = 0x04U, /*!< TIM2 update event */
+    DAC_TRIG_TIM4_TRGO = 0x05U  /*!< TIM4 update event */
+} DAC_Trigger_t;
+
+/**
+ * @brief Built-in waveform generator
+ */
+typedef enum
+{
+    DAC_WAVE_NONE = 0x00U,    /*!< Output DHR only */
+    DAC_WAVE_NOISE = 0x01U,   /*!< LFSR noise added to DHR */
+    DAC_WAVE_TRIANGLE = 0x02U /*!< Triangle added to DHR */
+} DAC_Wave_t;
+
+/**
+ * @brief Refill callback, executed in DMA interrupt context
+ *
+ * @param block    Block that has just finished playing and may be rewritten
+ * @param samples  Number of samples in the block
+ * @param ctx      User context
+ */
+typedef void (*DAC_RefillCallback_t)(uint16_t *block, uint32_t samples, void *ctx);
+
+/**
+ * @brief Streaming configuration
+ */
+typedef struct
+{
+    DAC_Trigger_t trigger;      /*!< Sample clock */
+    uint32_t rate_hz;           /*!< Sample rate */
+    uint16_t *buffer;           /*!< 2 * samples_per_block 12-bit right-aligned samples */
+    uint32_t samples_per_block; /*!< Samples per refill callback */
+    DAC_RefillCallback_t cb;    /*!< Refill callback (NULL: loop the buffer unchanged) */
+    void *ctx;                  /*!< Callback context */
+} DAC_StreamConfig_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Enable a channel for static output (pin in analog mode)
+ *
+ * @param ch         Channel
+ * @param buffered   1 = output buffer on (drives loads), 0 = off (rail to rail)
+ */
+void bare_dac_init(DAC_Channel_t ch, uint8_t buffered);
+
+/**
+ * @brief Write a 12-bit value (takes effect immediately without a trigger)
+ *
+ * @param ch     Channel
+ * @param value  0-4095
+ */
+void bare_dac_write(DAC_Channel_t ch, uint16_t value);
+
+/**
+ * @brief Configure timer-triggered DMA streaming on an initialized channel
+ *
+ * @param ch   Channel
+ * @param cfg  Streaming configuration (must stay valid while running)
+ * @return uint32_t Achieved sample rate in Hz
+ */
+uint32_t bare_dac_stream_init(DAC_Channel_t ch, const DAC_StreamConfig_t *cfg);
+
+/**
+ * @brief Start streaming (DMA then sample timer)
+ *
+ * The output keeps its current level for the first sample period, then plays every
+ * buffer sample once, starting with sample 0.
+ *
+ * @param ch  Channel
+ */
+void bare_dac_stream_start(DAC_Channel_t ch);
+
+/**
+ * @brief Stop streaming and the sample timer (output holds the last sample)
+ *
+ * @param ch  Channel
+ */
+void bare_dac_stream_stop(DAC_Channel_t ch);
+
+/**
+ * @brief Run the built-in noise or triangle generator from a timer trigger
+ *
+ * @param ch         Channel
+ * @param wave       Generator
+ * @param amplitude  0-11: triangle peak 2^(amplitude+1)-1 / LFSR bits unmasked
+ * @param offset     Base value the generator is added to
+ * @param trigger    Step clock
+ * @param rate_hz    Step rate (triangle period = 2 * 2^(amplitude+1) steps)
+ * @return uint32_t Achieved step rate in Hz
+ */
+uint32_t bare_dac_wave(DAC_Channel_t ch, DAC_Wave_t wave, uint8_t amplitude, uint16_t offset,
+                       DAC_Trigger_t trigger, uint32_t rate_hz);
+
+/**
+ * @brief Number of DMA underruns recovered since bare_dac_stream_init()
+ *
+ * @param ch  Channel
+ * @return uint32_t Underrun count
+ */
+uint32_t bare_dac_underruns(DAC_Channel_t ch);
+
+#endif /* BARE_DAC_H_ */
@@ -0,0 +1,198 @@
+/*******************************************************************************************
+ * @file    bare_dma.h
+ * @author  ka5j
+ * @brief   Bare-metal DMA1/DMA2 stream driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Provides stream configuration, start/stop and interrupt dispatch for the two
+ *          DMA controllers without relying on STM32 HAL drivers. Streams are addressed by
+ *          their register block (e.g. DMA2_Stream0); the owning controller and stream index
+ *          are derived from the address.
+ *******************************************************************************************/
+
+#ifndef BARE_DMA_H_
+#define BARE_DMA_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "dma_registers.h"         // Include DMA register map
+#include "rcc_registers.h"         // Include RCC definitions for DMA clock enable
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * DMA Configuration Enumerations
+ *******************************************************************************************/
+
+/**
+ * @brief DMA transfer direction
+ */
+typedef enum
+{
+    DMA_DIR_PERIPH_TO_MEM = 0x00U, /*!< Peripheral (PAR) to memory (M0AR) */
+    DMA_DIR_MEM_TO_PERIPH = 0x01U, /*!< Memory (M0AR) to peripheral (PAR) */
+    DMA_DIR_MEM_TO_MEM = 0x02U     /*!< PAR to M0AR, DMA2 only */
+} DMA_Dir_t;
+
+/**
+ * @brief DMA data item size
+ */
+typedef enum
+{
+    DMA_SIZE_BYTE = 0x00U,     /*!< 8-bit */
+    DMA_SIZE_HALFWORD = 0x01U, /*!< 16-bit */
+    DMA_SIZE_WORD = 0x02U      /*!< 32-bit */
+} DMA_Size_t;
+
+/**
+ * @brief DMA stream priority
+ */
+typedef enum
+{
+    DMA_PRIORITY_LOW = 0x00U,
+    DMA_PRIORITY_MEDIUM = 0x01U,
+    DMA_PRIORITY_HIGH = 0x02U,
+    DMA_PRIORITY_VERY_HIGH = 0x03U
+} DMA_Priority_t;
+
+/**
+ * @brief DMA FIFO mode (direct mode or FIFO threshold)
+ */
+typedef enum
+{
+    DMA_FIFO_DIRECT = 0x00U,   /*!< Direct mode (not allowed for memory-to-memory) */
+    DMA_FIFO_QUARTER = 0x01U,  /*!< FIFO enabled, 1/4 threshold */
+    DMA_FIFO_HALF = 0x02U,     /*!< FIFO enabled, 1/2 threshold */
+    DMA_FIFO_3QUARTER = 0x03U, /*!< FIFO enabled, 3/4 threshold */
+    DMA_FIFO_FULL = 0x04U      /*!< FIFO enabled, full threshold */
+} DMA_Fifo_t;
+
+/**
+ * @brief DMA burst length (FIFO mode only)
+ */
+typedef enum
+{
+    DMA_BURST_SINGLE = 0x00U,
+    DMA_BURST_INCR4 = 0x01U,
+    DMA_BURST_INCR8 = 0x02U,
+    DMA_BURST_INCR16 = 0x03U
+} DMA_Burst_t;
+
+/**
+ * @brief DMA events reported to a stream callback
+ */
+typedef enum
+{
+    DMA_EVENT_HALF = 0x01U,     /*!< First half of the buffer transferred */
+    DMA_EVENT_COMPLETE = 0x02U, /*!< Whole buffer (or current target) transferred */
+    DMA_EVENT_ERROR = 0x04U     /*!< Transfer, FIFO or direct mode error */
+} DMA_Event_t;
+
+/**
+ * @brief DMA stream configuration
+ */
+typedef struct
+{
+    uint8_t channel;         /*!< Request channel (0-7), see RM0390 Tables 28/29 */
+    DMA_Dir_t dir;           /*!< Transfer direction */
+    DMA_Size_t psize;        /*!< Peripheral data size */
+    DMA_Size_t msize;        /*!< Memory data size */
+    uint8_t pinc;            /*!< 1 = increment peripheral address */
+    uint8_t minc;            /*!< 1 = increment memory address */
+    uint8_t circular;        /*!< 1 = circular mode */
+    uint8_t double_buffer;   /*!< 1 = double buffer mode (M0AR/M1AR), implies circular */
+    DMA_Priority_t priority; /*!< Stream priority */
+    DMA_Fifo_t fifo;         /*!< Direct mode or FIFO threshold */
+    DMA_Burst_t pburst;      /*!< Peripheral burst (FIFO mode only) */
+    DMA_Burst_t mburst;      /*!< Memory burst (FIFO mode only) */
+    uint8_t half_irq;        /*!< 1 = raise DMA_EVENT_HALF */
+    uint8_t complete_irq;    /*!< 1 = raise DMA_EVENT_COMPLETE (and errors) */
+} DMA_Config_t;
+
+/**
+ * @brief Stream event callback, executed in the stream's interrupt context
+ *
+ * @param events  OR-combination of DMA_Event_t values
+ * @param ctx     User context registered with the callback
+ */
+typedef void (*DMA_Callback_t)(uint32_t events, void *ctx);
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Enable the RCC clock of the controller owning a stream
+ *
+ * @param stream  Pointer to DMA stream (e.g., DMA2_Stream0)
+ */
+void bare_dma_enable_clock(DMA_Stream_TypeDef *stream);
+
+/**
+ * @brief Configure a DMA stream (the stream is disabled first)
+ *
+ * @param stream  Pointer to DMA stream
+ * @param cfg     Stream configuration
+ */
+void bare_dma_config(DMA_Stream_TypeDef *stream, const DMA_Config_t *cfg);
+
+/**
+ * @brief Register the event callback of a stream and enable its NVIC line
+ *
+ * @param stream  Pointer to DMA stream
+ * @param cb      Callback (NULL to detach and disable the NVIC line)
+ * @param ctx     User context passed back to the callback
+ */
+void bare_dma_set_callback(DMA_Stream_TypeDef *stream, DMA_Callback_t cb, void *ctx);
+
+/**
+ * @brief Program addresses/count and enable a configured stream
+ *
+ * @param stream  Pointer to DMA stream
+ * @param par     Peripheral address (source in memory-to-memory mode)
+ * @param m0ar    Memory 0 address (destination in memory-to-memory mode)
+ * @param m1ar    Memory 1 address (double buffer mode only, otherwise ignored)
+ * @param count   Number of data items (in peripheral data size units), 1-65535
+ */
+void bare_dma_start(DMA_Stream_TypeDef *stream, uint32_t par, uint32_t m0ar,
+                    uint32_t m1ar, uint16_t count);
+
+/**
+ * @brief Disable a stream and wait until the hardware releases it
+ *
+ * @param stream  Pointer to DMA stream
+ */
+void bare_dma_stop(DMA_Stream_TypeDef *stream);
+
+/**
+ * @brief Read the status flags of a stream (DMA_FLAG_* bits)
+ *
+ * @param stream  Pointer to DMA stream
+ * @return uint32_t Flags normalised to the stream 0 bit positions
+ */
+uint32_t bare_dma_get_flags(DMA_Stream_TypeDef *stream);
+
+/**
+ * @brief Clear status flags of a stream
+ *
+ * @param stream  Pointer to DMA stream
+ * @param flags   DMA_FLAG_* bits to clear
+ */
+void bare_dma_clear_flags(DMA_Stream_TypeDef *stream, uint32_t flags);
+
+/**
+ * @brief Number of data items still to be transferred (NDTR)
+ *
+ * @param stream  Pointer to DMA stream
+ * @return uint16_t Remaining items
+ */
+uint16_t bare_dma_remaining(DMA_Stream_TypeDef *stream);
+
+/**
+ * @brief Index of the memory target currently in use in double buffer mode
+ *
+ * @param stream  Pointer to DMA stream
+ * @return uint8_t 0 = M0AR, 1 = M1AR
+ */
+uint8_t bare_dma_current_target(DMA_Stream_TypeDef *stream);
+
+#endif /* BARE_DMA_H_ */
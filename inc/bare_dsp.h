@@ -0,0 +1,188 @@
+/*******************************************************************************************
+ * @file    bare_dsp.h
+ * @author  ka5j
+ * @brief   Fixed-point block filtering kernels for the Cortex-M4 DSP extension
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    q15 kernels are written around the M4 SIMD instructions (SMLAD, SMUAD, SMLALD,
+ *          QADD16) on packed 16-bit pairs. When __ARM_FEATURE_DSP is not defined (e.g. a
+ *          Linux host build) the same kernels run on exact C emulations of those
+ *          instructions. Every kernel also has a plain scalar *_ref twin; both produce
+ *          bit-identical output, so the kernels can be verified and timed off-target.
+ *
+ *          All kernels are block based and keep their history in caller-provided state so
+ *          blocks from bare_adc can be filtered back to back.
+ *******************************************************************************************/
+
+#ifndef BARE_DSP_H_
+#define BARE_DSP_H_
+
+#include <stdint.h> // Include standard integer types
+
+/*******************************************************************************************
+ * Fixed-Point Types
+ *******************************************************************************************/
+typedef int16_t q15_t; /*!< 1.15 signed fraction */
+typedef int32_t q31_t; /*!< 1.31 signed fraction */
+
+/*******************************************************************************************
+ * Filter Instances
+ *******************************************************************************************/
+
+/**
+ * @brief FIR filter, y[n] = sum b[k] * x[n-k]
+ *
+ * Coefficients are stored time-reversed (coeffs[0] = b[num_taps-1]). The state buffer
+ * holds num_taps - 1 + max_block samples.
+ */
+typedef struct
+{
+    const q15_t *coeffs; /*!< Time-reversed coefficients, q15 */
+    q15_t *state;        /*!< History followed by the current block */
+    uint16_t num_taps;   /*!< Number of taps */
+} DSP_FirQ15_t;
+
+/**
+ * @brief q31 FIR filter (same layout as DSP_FirQ15_t)
+ */
+typedef struct
+{
+    const q31_t *coeffs; /*!< Time-reversed coefficients, q31 */
+    q31_t *state;        /*!< num_taps - 1 + max_block samples */
+    uint16_t num_taps;   /*!< Number of taps */
+} DSP_FirQ31_t;
+
+/**
+ * @brief FIR decimator: FIR followed by keeping every factor-th output
+ */
+typedef struct
+{
+    DSP_FirQ15_t fir; /*!< Anti-alias FIR */
+    uint8_t factor;   /*!< Decimation factor, block sizes must be a multiple of it */
+} DSP_DecimQ15_t;
+
+/**
+ * @brief Cascade of direct form I biquads
+ *
+ * Per stage 5 coefficients {b0, b1, b2, a1, a2} in q(15 - post_shift), with the feedback
+ * terms already negated: y = b0 x0 + b1 x1 + b2 x2 + a1 y1 + a2 y2. Per stage 4 state
+ * values {x1, x2, y1, y2}. The accumulator is 32 bits (SMLAD); coefficient sets must keep
+ * |acc| < 2^31, the usual one bit of headroom of a post_shift = 1 design.
+ */
+typedef struct
+{
+    const q15_t *coeffs; /*!< 5 * stages coefficients */
+    q15_t *state;        /*!< 4 * stages state values */
+    uint8_t stages;      /*!< Number of second-order sections */
+    uint8_t post_shift;  /*!< Coefficient headroom shift (0-2) */
+} DSP_BiquadQ15_t;
+
+/**
+ * @brief Power-of-two moving average (boxcar) filter
+ */
+typedef struct
+{
+    q15_t *state;  /*!< (1 << log2_len) + max_block samples */
+    int32_t sum;   /*!< Running sum of the window */
+    uint8_t log2_len; /*!< Window length = 1 << log2_len */
+} DSP_MovAvgQ15_t;
+
+/*******************************************************************************************
+ * API Function Prototypes - Initialisation
+ *******************************************************************************************/
+
+/**
+ * @brief Initialise a q15 FIR and clear its history
+ *
+ * @param f         Instance
+ * @param coeffs    Time-reversed coefficients
+ * @param num_taps  Number of taps
+ * @param state     Buffer of num_taps - 1 + max_block samples
+ */
+void bare_dsp_fir_q15_init(DSP_FirQ15_t *f, const q15_t *coeffs, uint16_t num_taps, q15_t *state);
+
+/**
+ * @brief Initialise a q31 FIR and clear its history
+ *
+ * @param f         Instance
+ * @param coeffs    Time-reversed coefficients
+ * @param num_taps  Number of taps
+ * @param state     Buffer of num_taps - 1 + max_block samples
+ */
+void bare_dsp_fir_q31_init(DSP_FirQ31_t *f, const q31_t *coeffs, uint16_t num_taps, q31_t *state);
+
+/**
+ * @brief Initialise a q15 FIR decimator and clear its history
+ *
+ * @param d         Instance
+ * @param factor    Decimation factor
+ * @param coeffs    Time-reversed anti-alias coefficients
+ * @param num_taps  Number of taps
+ * @param state     Buffer of num_taps - 1 + max_block samples
+ */
+void bare_dsp_decim_q15_init(DSP_DecimQ15_t *d, uint8_t factor, const q15_t *coeffs,
+                             uint16_t num_taps, q15_t *state);
+
+/**
+ * @brief Initialise a q15 biquad cascade and clear its state
+ *
+ * @param f           Instance
+ * @param stages      Number of sections
+ * @param coeffs      5 * stages coefficients
+ * @param state       4 * stages state values
+ * @param post_shift  Coefficient headroom shift
+ */
+void bare_dsp_biquad_q15_init(DSP_BiquadQ15_t *f, uint8_t stages, const q15_t *coeffs,
+                              q15_t *state, uint8_t post_shift);
+
+/**
+ * @brief Initialise a moving average and clear its window
+ *
+ * @param f         Instance
+ * @param log2_len  Window length as a power of two
+ * @param state     Buffer of (1 << log2_len) + max_block samples
+ */
+void bare_dsp_movavg_q15_init(DSP_MovAvgQ15_t *f, uint8_t log2_len, q15_t *state);
+
+/*******************************************************************************************
+ * API Function Prototypes - Kernels (SIMD) and References (scalar)
+ *******************************************************************************************/
+
+/**
+ * @brief q15 FIR, 64-bit accumulation with SMLALD on tap pairs
+ */
+void bare_dsp_fir_q15(DSP_FirQ15_t *f, const q15_t *in, q15_t *out, uint32_t n);
+void bare_dsp_fir_q15_ref(DSP_FirQ15_t *f, const q15_t *in, q15_t *out, uint32_t n);
+
+/**
+ * @brief q31 FIR, 64-bit accumulation (SMLAL), two outputs per coefficient load
+ */
+void bare_dsp_fir_q31(DSP_FirQ31_t *f, const q31_t *in, q31_t *out, uint32_t n);
+void bare_dsp_fir_q31_ref(DSP_FirQ31_t *f, const q31_t *in, q31_t *out, uint32_t n);
+
+/**
+ * @brief q15 FIR decimator, only every factor-th output is computed (n / factor outputs)
+ */
+void bare_dsp_decim_q15(DSP_DecimQ15_t *d, const q15_t *in, q15_t *out, uint32_t n);
+void bare_dsp_decim_q15_ref(DSP_DecimQ15_t *d, const q15_t *in, q15_t *out, uint32_t n);
+
+/**
+ * @brief q15 biquad cascade, SMUAD/SMLAD on packed {b1,b2}x{x1,x2} and {a1,a2}x{y1,y2}
+ */
+void bare_dsp_biquad_q15(DSP_BiquadQ15_t *f, const q15_t *in, q15_t *out, uint32_t n);
+void bare_dsp_biquad_q15_ref(DSP_BiquadQ15_t *f, const q15_t *in, q15_t *out, uint32_t n);
+
+/**
+ * @brief q15 moving average, out = floor(window sum / window length)
+ */
+void bare_dsp_movavg_q15(DSP_MovAvgQ15_t *f, const q15_t *in, q15_t *out, uint32_t n);
+void bare_dsp_movavg_q15_ref(DSP_MovAvgQ15_t *f, const q15_t *in, q15_t *out, uint32_t n);
+
+/**
+ * @brief Saturating element-wise add of two q15 blocks, two samples per QADD16
+ */
+void bare_dsp_add_q15(const q15_t *a, const q15_t *b, q15_t *out, uint32_t n);
+void bare_dsp_add_q15_ref(const q15_t *a, const q15_t *b, q15_t *out, uint32_t n);
+
+#endif /* BARE_DSP_H_ */
@@ -0,0 +1,38 @@
+/*******************************************************************************************
+ * @file    bare_dwt.h
+ * @author  ka5j
+ * @brief   Bare-metal DWT cycle counter access for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    CYCCNT counts HCLK cycles and wraps every 2^32 cycles (23.8 s at 180 MHz);
+ *          unsigned subtraction of two readings is correct across one wrap.
+ *******************************************************************************************/
+
+#ifndef BARE_DWT_H_
+#define BARE_DWT_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "dwt_registers.h"         // Include DWT register map
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Enable trace and start the DWT cycle counter from zero
+ */
+void bare_dwt_init(void);
+
+/**
+ * @brief Read the cycle counter (single load, inlined for timing use)
+ *
+ * @return uint32_t Current CYCCNT value
+ */
+static inline uint32_t bare_dwt_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+#endif /* BARE_DWT_H_ */
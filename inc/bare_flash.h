@@ -0,0 +1,112 @@
+/*******************************************************************************************
+ * @file    bare_flash.h
+ * @author  ka5j
+ * @brief   Bare-metal embedded flash program/erase driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Programming uses 32-bit parallelism (VDD 2.7-3.6 V, as on the Nucleo board).
+ *          Sector erases take 0.25-2 s and can be started without waiting; the F446 has
+ *          a single bank, so any instruction or data fetch from flash stalls until the
+ *          erase is over. Code that must keep running during an erase has to execute
+ *          from RAM; data should come from RAM copies (see bare_logstore).
+ *          The FLASH_Ops_t table lets storage layers run on a host-side flash image.
+ *******************************************************************************************/
+
+#ifndef BARE_FLASH_H_
+#define BARE_FLASH_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "flash_registers.h"       // Include flash interface register map
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Flash Configuration
+ *******************************************************************************************/
+#define FLASH_SECTORS 8U /*!< 4 x 16 KB, 1 x 64 KB, 3 x 128 KB */
+
+/*******************************************************************************************
+ * Flash Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Status codes
+ */
+typedef enum
+{
+    FLASH_OK = 0x00U,        /*!< Success */
+    FLASH_BUSY = 0x01U,      /*!< Erase still running */
+    FLASH_ERR_PARAM = 0x02U, /*!< Bad sector, address or alignment */
+    FLASH_ERR_WRP = 0x03U,   /*!< Write protected */
+    FLASH_ERR_PROG = 0x04U,  /*!< Sequence, alignment, parallelism or operation error */
+    FLASH_ERR_VERIFY = 0x05U /*!< Read-back differs from the data programmed */
+} FLASH_Status_t;
+
+/**
+ * @brief Flash access used by storage layers (bare_flash_ops on the target)
+ */
+typedef struct
+{
+    uintptr_t (*sector_addr)(uint8_t sector);  /*!< Address of a sector (memory-mapped) */
+    uint32_t (*sector_size)(uint8_t sector);   /*!< Size of a sector in bytes */
+    FLASH_Status_t (*program)(uintptr_t addr, const uint32_t *words, uint32_t n);
+    FLASH_Status_t (*erase_start)(uint8_t sector); /*!< Start an erase, do not wait */
+    FLASH_Status_t (*erase_poll)(void);            /*!< FLASH_BUSY until the erase ends */
+} FLASH_Ops_t;
+
+extern const FLASH_Ops_t bare_flash_ops;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Address of a sector
+ *
+ * @param sector  Sector number (0-7)
+ * @return uintptr_t First byte of the sector
+ */
+uintptr_t bare_flash_sector_addr(uint8_t sector);
+
+/**
+ * @brief Size of a sector
+ *
+ * @param sector  Sector number (0-7)
+ * @return uint32_t Size in bytes, 0 for an invalid sector
+ */
+uint32_t bare_flash_sector_size(uint8_t sector);
+
+/**
+ * @brief Program words (blocking, a few tens of microseconds per word)
+ *
+ * @param addr    Word-aligned destination, erased beforehand
+ * @param words   Source data
+ * @param n       Number of words
+ * @return FLASH_Status_t FLASH_OK or an error
+ */
+FLASH_Status_t bare_flash_program(uintptr_t addr, const uint32_t *words, uint32_t n);
+
+/**
+ * @brief Start a sector erase and return immediately
+ *
+ * @param sector  Sector number (0-7)
+ * @return FLASH_Status_t FLASH_OK (started) or an error
+ */
+FLASH_Status_t bare_flash_erase_start(uint8_t sector);
+
+/**
+ * @brief Check a running erase
+ *
+ * @return FLASH_Status_t FLASH_BUSY, FLASH_OK (done, caches flushed) or an error
+ */
+FLASH_Status_t bare_flash_erase_poll(void);
+
+/**
+ * @brief Erase a sector and wait for the end
+ *
+ * @param sector  Sector number (0-7)
+ * @return FLASH_Status_t FLASH_OK or an error
+ */
+FLASH_Status_t bare_flash_erase(uint8_t sector);
+
+#endif /* BARE_FLASH_H_ */
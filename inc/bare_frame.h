@@ -0,0 +1,136 @@
+/*******************************************************************************************
+ * @file    bare_frame.h
+ * @author  ka5j
+ * @brief   COBS + CRC-16 packet framing codec (target and host)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Register free and allocation free: the same file (with bare_crc_sw.c) is compiled
+ *          into the firmware and into host-side tools such as tools/frame_codec.c, so both
+ *          ends of a link share one implementation.
+ *
+ *          Wire format of one frame:
+ *              COBS( seq | type | payload[0..n) | crc16_lo | crc16_hi ) 0x00
+ *          The CRC is CRC-16/CCITT-FALSE over seq, type and payload. Encoding streams
+ *          straight from the caller's payload to a byte sink (no staging copy); decoding is
+ *          done in place in the receive buffer, the payload pointer aliases that buffer.
+ *******************************************************************************************/
+
+#ifndef BARE_FRAME_H_
+#define BARE_FRAME_H_
+
+#include <stddef.h> // Include size_t
+#include <stdint.h> // Include standard integer types
+
+/*******************************************************************************************
+ * Frame Configuration Constants
+ *******************************************************************************************/
+#define FRAME_DELIMITER 0x00U    /*!< End-of-frame marker on the wire */
+#define FRAME_HEADER_SIZE 2U     /*!< seq + type */
+#define FRAME_CRC_SIZE 2U        /*!< CRC-16 trailer */
+#define FRAME_OVERHEAD (FRAME_HEADER_SIZE + FRAME_CRC_SIZE)
+
+/** Worst-case encoded size (including delimiter) of a frame with an n byte payload */
+#define FRAME_WIRE_SIZE(n) ((n) + FRAME_OVERHEAD + (((n) + FRAME_OVERHEAD) / 254U) + 2U)
+
+/*******************************************************************************************
+ * Frame Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Codec status
+ */
+typedef enum
+{
+    FRAME_OK = 0x00U,           /*!< Frame valid / complete */
+    FRAME_INCOMPLETE = 0x01U,   /*!< More bytes needed */
+    FRAME_ERR_COBS = 0x02U,     /*!< Malformed COBS encoding */
+    FRAME_ERR_SHORT = 0x03U,    /*!< Shorter than header + CRC */
+    FRAME_ERR_CRC = 0x04U,      /*!< CRC mismatch */
+    FRAME_ERR_OVERFLOW = 0x05U  /*!< Frame larger than the receive buffer */
+} FRAME_Status_t;
+
+/**
+ * @brief Decoded packet, payload points into the receive buffer
+ */
+typedef struct
+{
+    uint8_t seq;      /*!< Sequence number */
+    uint8_t type;     /*!< Application defined packet type */
+    uint8_t *payload; /*!< Payload (aliases the decode buffer) */
+    size_t len;       /*!< Payload length in bytes */
+} FRAME_Packet_t;
+
+/**
+ * @brief Byte-wise frame assembler state
+ */
+typedef struct
+{
+    uint8_t *buf;     /*!< Receive buffer */
+    size_t cap;       /*!< Buffer capacity */
+    size_t len;       /*!< Bytes collected for the current frame */
+    uint8_t overflow; /*!< Current frame exceeded cap, discard until delimiter */
+} FRAME_Rx_t;
+
+/**
+ * @brief Output byte sink used by the encoder (e.g. a UART transmit function)
+ */
+typedef void (*FRAME_Sink_t)(uint8_t byte, void *ctx);
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Encode and emit one complete frame (including the trailing delimiter)
+ *
+ * @param seq      Sequence number
+ * @param type     Packet type
+ * @param payload  Payload bytes (may be NULL when len is 0)
+ * @param len      Payload length
+ * @param sink     Byte sink
+ * @param ctx      Sink context
+ */
+void bare_frame_encode(uint8_t seq, uint8_t type, const void *payload, size_t len,
+                       FRAME_Sink_t sink, void *ctx);
+
+/**
+ * @brief Decode a received frame in place and validate its CRC
+ *
+ * @param buf  Encoded frame without the delimiter, overwritten with the decoded bytes
+ * @param len  Encoded length
+ * @param pkt  Decoded packet, payload points into buf
+ * @return FRAME_Status_t FRAME_OK or an error code
+ */
+FRAME_Status_t bare_frame_decode(uint8_t *buf, size_t len, FRAME_Packet_t *pkt);
+
+/**
+ * @brief Decode a COBS block in place
+ *
+ * @param buf      Encoded bytes without the delimiter, overwritten with decoded bytes
+ * @param len      Encoded length
+ * @param out_len  Decoded length
+ * @return FRAME_Status_t FRAME_OK or FRAME_ERR_COBS
+ */
+FRAME_Status_t bare_frame_cobs_decode(uint8_t *buf, size_t len, size_t *out_len);
+
+/**
+ * @brief Bind a receive buffer to an assembler and reset it
+ *
+ * @param rx   Assembler state
+ * @param buf  Receive buffer (at least FRAME_WIRE_SIZE(max payload) bytes)
+ * @param cap  Buffer capacity
+ */
+void bare_frame_rx_init(FRAME_Rx_t *rx, uint8_t *buf, size_t cap);
+
+/**
+ * @brief Push one received byte into the assembler (ISR safe, no decoding)
+ *
+ * @param rx    Assembler state
+ * @param byte  Received byte
+ * @return FRAME_Status_t FRAME_OK when rx->buf holds a complete encoded frame of
+ *                        rx->len bytes, FRAME_INCOMPLETE, or FRAME_ERR_OVERFLOW
+ */
+FRAME_Status_t bare_frame_rx_push(FRAME_Rx_t *rx, uint8_t byte);
+
+#endif /* BARE_FRAME_H_ */
@@ -159,6 +159,15 @@ void bare_gpio_toggle(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin);
  */
 void bare_gpio_AF(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin);
 
+/**
+ * @brief Select the alternate function number of a pin (AFRL/AFRH)
+ *
+ * @param GPIOx   Pointer to GPIO peripheral
+ * @param pin     GPIO pin number
+ * @param af      Alternate function number (0-15)
+ */
+void bare_gpio_set_AF(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin, uint8_t af);
+
 /**
  * @brief  Enable RCC Clock for a given GPIO port
  * @param  GPIOx: pointer to GPIO peripheral base address
@@ -166,6 +175,6 @@ void bare_gpio_AF(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin);
  *
  * @note   Must be called before accessing GPIO registers.
  */
-static void bare_gpio_enable_clock(GPIO_TypeDef *GPIOx);
+void bare_gpio_enable_clock(GPIO_TypeDef *GPIOx);
 
 #endif /* BARE_GPIO_H_ */
@@ -0,0 +1,208 @@
+/*******************************************************************************************
+ * @file    bare_i2c.h
+ * @author  ka5j
+ * @brief   Bare-metal interrupt/DMA driven I2C1-I2C3 master driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Transactions (write, read, or write-then-read with a repeated start) are queued
+ *          and advanced entirely from the EV/ER interrupts; long reads use DMA. The CPU is
+ *          never blocked waiting on the bus.
+ *
+ *          The state machine lives in the bare_i2c_bus_*() functions, which only touch the
+ *          I2C_TypeDef passed to bare_i2c_bus_init(). On the host, point it at a plain
+ *          I2C_TypeDef, set SR1/SR2 as the peripheral would and call bare_i2c_bus_ev() /
+ *          bare_i2c_bus_er() to step it (leave rx_stream NULL there).
+ *******************************************************************************************/
+
+#ifndef BARE_I2C_H_
+#define BARE_I2C_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "i2c_registers.h"         // Include I2C register map
+#include "dma_registers.h"         // DMA stream definitions
+#include "gpio_registers.h"        // GPIO peripheral definitions
+#include "bare_gpio.h"             // GPIO header file
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * I2C Configuration Constants
+ *******************************************************************************************/
+#ifndef I2C_DMA_THRESHOLD
+#define I2C_DMA_THRESHOLD 4U /*!< Reads of at least this many bytes use DMA */
+#endif
+
+#define I2C_SPEED_STANDARD 100000UL /*!< Standard mode */
+#define I2C_SPEED_FAST 400000UL     /*!< Fast mode (highest rate of I2C1-I2C3) */
+
+/*******************************************************************************************
+ * I2C Configuration Enumerations
+ *******************************************************************************************/
+
+/**
+ * @brief Transaction status
+ */
+typedef enum
+{
+    I2C_OK = 0x00U,       /*!< Completed */
+    I2C_PENDING = 0x01U,  /*!< Queued or in progress */
+    I2C_ERR_NACK = 0x02U, /*!< Address or data not acknowledged */
+    I2C_ERR_ARLO = 0x03U, /*!< Arbitration lost */
+    I2C_ERR_BUS = 0x04U,  /*!< Misplaced START/STOP */
+    I2C_ERR_OVR = 0x05U   /*!< Overrun / underrun */
+} I2C_Status_t;
+
+/**
+ * @brief State machine position
+ */
+typedef enum
+{
+    I2C_STATE_IDLE = 0x00U,  /*!< No transaction */
+    I2C_STATE_START = 0x01U, /*!< START requested, waiting for SB */
+    I2C_STATE_ADDR = 0x02U,  /*!< Address sent, waiting for ADDR */
+    I2C_STATE_TX = 0x03U,    /*!< Writing data bytes */
+    I2C_STATE_RX = 0x04U,    /*!< Reading data bytes (interrupts) */
+    I2C_STATE_RX_DMA = 0x05U /*!< Reading data bytes (DMA) */
+} I2C_State_t;
+
+/**
+ * @brief GPIO pin reference
+ */
+typedef struct
+{
+    GPIO_TypeDef *port; /*!< GPIO port */
+    GPIO_Pins_t pin;    /*!< Pin number */
+} I2C_Pin_t;
+
+/**
+ * @brief Bus configuration
+ */
+typedef struct
+{
+    I2C_Pin_t scl;     /*!< Clock pin */
+    I2C_Pin_t sda;     /*!< Data pin */
+    uint8_t af;        /*!< Alternate function (AF4, AF9 for some I2C2/I2C3 SDA pins) */
+    uint32_t speed_hz; /*!< Target SCL rate, up to I2C_SPEED_FAST */
+    uint8_t use_dma;   /*!< 1 = use the RX DMA stream for long reads */
+} I2C_Config_t;
+
+/**
+ * @brief Completion callback, executed in interrupt context
+ */
+typedef void (*I2C_Callback_t)(I2C_Status_t status, void *ctx);
+
+/**
+ * @brief Queued transaction (caller owned, must stay valid until its callback)
+ *
+ * tx_len bytes are written, then rx_len bytes are read after a repeated start.
+ * Either length may be zero; both zero is an address probe.
+ */
+typedef struct I2C_Transaction
+{
+    uint8_t addr;                    /*!< 7-bit device address */
+    const uint8_t *tx;               /*!< Bytes to write */
+    uint16_t tx_len;                 /*!< Number of bytes to write */
+    uint8_t *rx;                     /*!< Read buffer */
+    uint16_t rx_len;                 /*!< Number of bytes to read */
+    I2C_Callback_t done;             /*!< Optional completion callback */
+    void *ctx;                       /*!< Callback context */
+    volatile I2C_Status_t status;    /*!< I2C_PENDING until finished */
+    struct I2C_Transaction *next;    /*!< Queue link (managed by the driver) */
+} I2C_Transaction_t;
+
+/**
+ * @brief Per-bus state machine
+ */
+typedef struct
+{
+    I2C_TypeDef *regs;             /*!< Peripheral (or simulated register block) */
+    DMA_Stream_TypeDef *rx_stream; /*!< RX DMA stream, NULL for interrupt-only reads */
+    volatile I2C_State_t state;    /*!< Current state */
+    uint8_t reading;               /*!< 1 while in the read phase */
+    uint16_t idx;                  /*!< Bytes done in the current phase */
+    I2C_Transaction_t *cur;        /*!< Transaction on the bus */
+    I2C_Transaction_t *head;       /*!< Pending transactions */
+    I2C_Transaction_t *tail;
+} I2C_Bus_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Initialize an I2C instance as master, recovering a stuck bus first
+ *
+ * @param I2Cx  Pointer to I2C peripheral (I2C1-I2C3)
+ * @param cfg   Bus configuration
+ * @return uint32_t Actual SCL frequency in Hz
+ */
+uint32_t bare_i2c_init(I2C_TypeDef *I2Cx, const I2C_Config_t *cfg);
+
+/**
+ * @brief Queue a transaction; starts immediately if the bus is idle
+ *
+ * @param I2Cx  Pointer to I2C peripheral
+ * @param t     Transaction
+ */
+void bare_i2c_submit(I2C_TypeDef *I2Cx, I2C_Transaction_t *t);
+
+/**
+ * @brief Check whether a transaction is on the bus or queued
+ *
+ * @param I2Cx  Pointer to I2C peripheral
+ * @return uint8_t 1 if busy, 0 if idle
+ */
+uint8_t bare_i2c_busy(I2C_TypeDef *I2Cx);
+
+/**
+ * @brief Free a bus held low by a slave: clock SCL by hand until SDA releases, send a
+ *        STOP, then reset and re-enable the peripheral
+ *
+ * @param I2Cx  Pointer to I2C peripheral (must have been initialized)
+ * @return uint8_t 1 if SDA is released, 0 if still stuck
+ */
+uint8_t bare_i2c_recover(I2C_TypeDef *I2Cx);
+
+/**
+ * @brief Compute CCR/TRISE for a bus speed
+ *
+ * @param pclk1     APB1 clock in Hz
+ * @param speed_hz  Target SCL rate (clamped to I2C_SPEED_FAST)
+ * @param ccr       Output: CCR register value
+ * @param trise     Output: TRISE register value
+ * @return uint32_t Actual SCL frequency in Hz
+ */
+uint32_t bare_i2c_timing(uint32_t pclk1, uint32_t speed_hz, uint32_t *ccr, uint32_t *trise);
+
+/**
+ * @brief Reset a state machine and attach it to a register block (no clocks, pins or NVIC)
+ *
+ * @param bus        State machine
+ * @param regs       Peripheral or simulated register block
+ * @param rx_stream  RX DMA stream or NULL
+ */
+void bare_i2c_bus_init(I2C_Bus_t *bus, I2C_TypeDef *regs, DMA_Stream_TypeDef *rx_stream);
+
+/**
+ * @brief Queue a transaction on a state machine
+ *
+ * @param bus  State machine
+ * @param t    Transaction
+ */
+void bare_i2c_bus_submit(I2C_Bus_t *bus, I2C_Transaction_t *t);
+
+/**
+ * @brief Advance the state machine on an event interrupt (SB/ADDR/BTF/TXE/RXNE)
+ *
+ * @param bus  State machine
+ */
+void bare_i2c_bus_ev(I2C_Bus_t *bus);
+
+/**
+ * @brief Handle an error interrupt (AF/ARLO/BERR/OVR), failing the current transaction
+ *
+ * @param bus  State machine
+ */
+void bare_i2c_bus_er(I2C_Bus_t *bus);
+
+#endif /* BARE_I2C_H_ */
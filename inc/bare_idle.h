@@ -0,0 +1,130 @@
+/*******************************************************************************************
+ * @file    bare_idle.h
+ * @author  ka5j
+ * @brief   Tickless idle manager: SysTick suppression, sleep and stop mode entry
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The module owns SysTick as a periodic tick. When the application has nothing to
+ *          do until a known tick, SysTick is reloaded to expire at that tick (up to its
+ *          24-bit range) and the core sleeps through the ticks in between; on any wake the
+ *          tick count is corrected from the counter and the periodic tick resumes.
+ *
+ *          With no deadline and stop mode allowed, the MCU enters stop mode with the
+ *          low-power regulator. Only EXTI lines (pins, RTC, ...) wake it, SysTick does not
+ *          run, so the tick count is frozen for that time. Clocks come back on HSI; the
+ *          wake hook is where the application restores its clock setup.
+ *
+ *          The vector stays with the application, so it can also carry a profiler
+ *          trampoline or its own tick work; it only has to count the tick:
+ *
+ *              void SysTick_Handler(void) { bare_idle_tick(); ... }
+ *
+ *          The handler of the EXTI line that ends stop mode calls bare_idle_wake_mark()
+ *          first, which timestamps the wake-up for stop_wake_max.
+ *******************************************************************************************/
+
+#ifndef BARE_IDLE_H_
+#define BARE_IDLE_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Idle Configuration Constants
+ *******************************************************************************************/
+
+#define IDLE_FOREVER 0xFFFFFFFFUL /*!< No pending deadline */
+
+/*******************************************************************************************
+ * Idle Types
+ *******************************************************************************************/
+
+/**
+ * @brief Hook without arguments
+ */
+typedef void (*IDLE_Hook_t)(void);
+
+/**
+ * @brief Idle manager configuration
+ */
+typedef struct
+{
+    uint32_t tick_hz;      /*!< Periodic tick rate */
+    uint8_t allow_stop;    /*!< 1 = use stop mode when there is no deadline */
+    IDLE_Hook_t wake_hook; /*!< Run after stop mode, before interrupts are taken (may be NULL) */
+} IDLE_Config_t;
+
+/**
+ * @brief Idle statistics
+ */
+typedef struct
+{
+    uint32_t sleeps;         /*!< Tickless sleeps entered */
+    uint32_t early_wakes;    /*!< Sleeps ended by another interrupt before the deadline */
+    uint32_t stops;          /*!< Stop mode entries */
+    uint32_t idle_ticks;     /*!< Ticks spent in tickless sleep (residency numerator) */
+    uint32_t latency_last;   /*!< HCLK cycles from deadline expiry to code running again */
+    uint32_t latency_max;    /*!< Worst latency_last */
+    uint32_t stop_wake_max;  /*!< Worst HCLK cycles from stop exit to the wake-up handler */
+} IDLE_Stats_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Start the periodic tick from SysTick (HCLK) and clear the statistics
+ *
+ * @param cfg  Configuration (copied)
+ */
+void bare_idle_init(const IDLE_Config_t *cfg);
+
+/**
+ * @brief Current tick count
+ *
+ * @return uint32_t Ticks since bare_idle_init()
+ */
+uint32_t bare_idle_now(void);
+
+/**
+ * @brief Idle until a tick is reached or an interrupt needs attention
+ *
+ * Call from the main loop once the event queue is empty. Deadlines further than the
+ * SysTick range are split: the caller simply loops. Returns after every wake, so the
+ * caller re-checks its queue.
+ *
+ * @param deadline  Absolute tick (bare_idle_now() based) or IDLE_FOREVER
+ */
+void bare_idle_until(uint32_t deadline);
+
+/**
+ * @brief Count one tick (call from the application's SysTick_Handler)
+ *
+ * Also the end of a tickless sleep that reached its deadline: the wake leaves that
+ * tick to the pending SysTick interrupt.
+ */
+void bare_idle_tick(void);
+
+/**
+ * @brief Timestamp the wake-up from stop mode (call first in the wake-up handler)
+ *
+ * Ends the stop_wake_max measurement begun when the core left stop mode, so it covers
+ * the clock start-up, the wake hook, the tick restart and the interrupt entry. Calls
+ * outside a wake-up from stop are ignored.
+ */
+void bare_idle_wake_mark(void);
+
+/**
+ * @brief Copy the idle statistics
+ *
+ * @param out  Destination
+ */
+void bare_idle_get_stats(IDLE_Stats_t *out);
+
+/**
+ * @brief Clear the idle statistics
+ */
+void bare_idle_reset_stats(void);
+
+#endif /* BARE_IDLE_H_ */
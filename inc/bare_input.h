@@ -0,0 +1,167 @@
+/*******************************************************************************************
+ * @file    bare_input.h
+ * @author  ka5j
+ * @brief   Bit-parallel input debouncing and matrix keypad scanning for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    bare_input_tick() is called from a periodic timer interrupt (e.g. 1-5 ms from
+ *          a TIM2-TIM5 update handler). Each tick reads whole ports through IDR and
+ *          debounces all 16 pins at once with a 2-bit vertical counter: a pin changes
+ *          state after 4 consecutive samples at the new level. Matrix rows are driven one per tick
+ *          through BSRR; the columns are read on the next tick, after they have settled.
+ *          Debounced edges are posted to an event queue read with bare_input_get().
+ *******************************************************************************************/
+
+#ifndef BARE_INPUT_H_
+#define BARE_INPUT_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "gpio_registers.h"        // Include GPIO register map
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Input Configuration
+ *******************************************************************************************/
+#define INPUT_MAX_PORTS 4U    /*!< Directly sampled ports */
+#define INPUT_MAX_ROWS 8U     /*!< Matrix rows */
+#define INPUT_QUEUE_SIZE 32U  /*!< Pending edge events (power of 2) */
+
+#define INPUT_SRC_MATRIX 0x80U /*!< Event source flag: matrix row in the low bits */
+
+/*******************************************************************************************
+ * Input Types
+ *******************************************************************************************/
+
+/**
+ * @brief Vertical counter state of 16 inputs
+ *
+ * @note  Bit n of cnt0/cnt1 is the 2-bit count of differing samples of input n; it
+ *        resets to 0 whenever the sample equals the debounced state, and the state
+ *        toggles on the 4th differing sample in a row. All-zero is the reset state.
+ */
+typedef struct
+{
+    uint16_t state; /*!< Debounced level (1 = active) */
+    uint16_t cnt0;  /*!< Counter bit 0 */
+    uint16_t cnt1;  /*!< Counter bit 1 */
+} INPUT_Debounce_t;
+
+/**
+ * @brief One directly sampled port
+ */
+typedef struct
+{
+    GPIO_TypeDef *port;  /*!< GPIOA ... GPIOH, pins configured by the application */
+    uint16_t mask;       /*!< Pins reported */
+    uint16_t active_low; /*!< Pins whose active level is low (pull-up + switch to GND) */
+} INPUT_Port_t;
+
+/**
+ * @brief Row/column key matrix
+ *
+ * @note  Rows are open-drain outputs, driven low one at a time; columns are inputs with
+ *        pull-ups. A pressed key pulls its column low while its row is selected.
+ */
+typedef struct
+{
+    GPIO_TypeDef *row_port; /*!< Port of the row pins */
+    uint16_t row_mask;      /*!< Row pins, lowest pin = row 0 (at most INPUT_MAX_ROWS) */
+    GPIO_TypeDef *col_port; /*!< Port of the column pins */
+    uint16_t col_mask;      /*!< Column pins */
+} INPUT_Matrix_t;
+
+/**
+ * @brief Input engine configuration
+ */
+typedef struct
+{
+    const INPUT_Port_t *ports;    /*!< Sampled ports, may be NULL */
+    uint8_t nports;               /*!< Number of entries in ports */
+    const INPUT_Matrix_t *matrix; /*!< Key matrix, NULL if none */
+} INPUT_Config_t;
+
+/**
+ * @brief Debounced edge
+ */
+typedef struct
+{
+    uint32_t tick;  /*!< bare_input_tick() count when the edge was accepted */
+    uint8_t source; /*!< Port index, or INPUT_SRC_MATRIX | row */
+    uint8_t pin;    /*!< Pin number (column pin number for the matrix) */
+    uint8_t active; /*!< 1 = pressed / asserted, 0 = released */
+} INPUT_Event_t;
+
+/**
+ * @brief Status codes
+ */
+typedef enum
+{
+    INPUT_OK = 0x00U,        /*!< Success */
+    INPUT_ERR_PARAM = 0x01U  /*!< Too many ports or rows, NULL port */
+} INPUT_Status_t;
+
+/*******************************************************************************************
+ * Debounce Core
+ *******************************************************************************************/
+
+/**
+ * @brief Debounce 16 inputs in parallel (pure function, no hardware access)
+ *
+ * @param db      Counter state, zero-initialized for all inputs inactive
+ * @param sample  Raw sample (1 = active)
+ * @return uint16_t Inputs whose debounced state toggled on this sample
+ */
+static inline uint16_t bare_input_debounce(INPUT_Debounce_t *db, uint16_t sample)
+{
+    uint16_t delta = (uint16_t)(sample ^ db->state);
+    uint16_t toggle;
+
+    db->cnt0 = (uint16_t)(~db->cnt0 & delta);
+    db->cnt1 = (uint16_t)(db->cnt0 ^ (~db->cnt1 & delta));
+    toggle = (uint16_t)(delta & ~(db->cnt0 | db->cnt1));
+    db->state ^= toggle;
+    return toggle;
+}
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Start the engine: reset the debounce state and set up the matrix pins
+ *
+ * @param cfg     Configuration (referenced, must stay valid)
+ * @return INPUT_Status_t INPUT_OK or INPUT_ERR_PARAM
+ */
+INPUT_Status_t bare_input_init(const INPUT_Config_t *cfg);
+
+/**
+ * @brief Sample all ports and one matrix row (call from a periodic interrupt)
+ */
+void bare_input_tick(void);
+
+/**
+ * @brief Take the oldest edge event
+ *
+ * @param ev      Receives the event
+ * @return uint8_t 1 if an event was returned, 0 if the queue is empty
+ */
+uint8_t bare_input_get(INPUT_Event_t *ev);
+
+/**
+ * @brief Debounced level of a port (1 = active)
+ *
+ * @param source  Port index, or INPUT_SRC_MATRIX | row for the columns of a matrix row
+ * @return uint16_t Debounced pins
+ */
+uint16_t bare_input_state(uint8_t source);
+
+/**
+ * @brief Events dropped because the queue was full
+ *
+ * @return uint32_t Dropped event count
+ */
+uint32_t bare_input_dropped(void);
+
+#endif /* BARE_INPUT_H_ */
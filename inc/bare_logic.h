@@ -0,0 +1,125 @@
+/*******************************************************************************************
+ * @file    bare_logic.h
+ * @author  ka5j
+ * @brief   GPIO logic analyzer: timer-paced DMA capture of a whole port (STM32F446RE)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    TIM8 update events pace DMA2 Stream 1 (channel 7), which copies the port's IDR
+ *          into a circular RAM buffer. Only DMA2 can reach the AHB1 GPIO ports, and only
+ *          TIM1/TIM8 request DMA2, so the stream is shared with ADC3 and SPI4 TX. The
+ *          trigger is searched in software, one half buffer at a time from the DMA
+ *          half/complete interrupts; the scan costs a few cycles per sample, so rates up
+ *          to a few MHz are sustained at 180 MHz. Sample n is taken at n / rate seconds.
+ *          bare_logic_dump() streams the capture run-length encoded over USART2 for
+ *          tools/logic_vcd.py.
+ *******************************************************************************************/
+
+#ifndef BARE_LOGIC_H_
+#define BARE_LOGIC_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "gpio_registers.h"        // Include GPIO register map
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Logic Analyzer Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Trigger condition, evaluated on (sample & trig_mask)
+ */
+typedef enum
+{
+    LOGIC_TRIG_NONE = 0x00U,    /*!< Capture starts immediately, no pre-trigger */
+    LOGIC_TRIG_PATTERN = 0x01U, /*!< Masked sample equals trig_value */
+    LOGIC_TRIG_RISING = 0x02U,  /*!< Any masked pin goes 0 -> 1 */
+    LOGIC_TRIG_FALLING = 0x03U, /*!< Any masked pin goes 1 -> 0 */
+    LOGIC_TRIG_CHANGE = 0x04U   /*!< Any masked pin changes */
+} LOGIC_Trigger_t;
+
+/**
+ * @brief Capture state
+ */
+typedef enum
+{
+    LOGIC_IDLE = 0x00U,      /*!< Not started or stopped */
+    LOGIC_ARMED = 0x01U,     /*!< Sampling, waiting for the trigger */
+    LOGIC_TRIGGERED = 0x02U, /*!< Trigger seen, filling the post-trigger part */
+    LOGIC_DONE = 0x03U,      /*!< Capture complete, ready to dump */
+    LOGIC_OVERRUN = 0x04U    /*!< Trigger scan or DMA fell behind, capture invalid */
+} LOGIC_State_t;
+
+/**
+ * @brief Status codes
+ */
+typedef enum
+{
+    LOGIC_OK = 0x00U,        /*!< Success */
+    LOGIC_ERR_PARAM = 0x01U, /*!< Bad buffer length, rate or pre-trigger */
+    LOGIC_ERR_BUSY = 0x02U   /*!< A capture is running */
+} LOGIC_Status_t;
+
+/**
+ * @brief Capture configuration
+ */
+typedef struct
+{
+    GPIO_TypeDef *port;      /*!< Port sampled (pins configured by the application) */
+    uint16_t channels;       /*!< Pins reported by the dump */
+    uint32_t rate_hz;        /*!< Requested sample rate */
+    uint16_t *buf;           /*!< Sample buffer in SRAM */
+    uint16_t len;            /*!< Samples in buf, even, 4-65534 */
+    uint16_t pre_trigger;    /*!< Samples kept before the trigger, at most len / 2 */
+    LOGIC_Trigger_t trigger; /*!< Trigger condition */
+    uint16_t trig_mask;      /*!< Pins the trigger looks at */
+    uint16_t trig_value;     /*!< Pattern for LOGIC_TRIG_PATTERN */
+} LOGIC_Config_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Arm a capture
+ *
+ * @param cfg     Configuration (referenced until the capture is dumped or stopped)
+ * @return LOGIC_Status_t LOGIC_OK, LOGIC_ERR_PARAM or LOGIC_ERR_BUSY
+ */
+LOGIC_Status_t bare_logic_start(const LOGIC_Config_t *cfg);
+
+/**
+ * @brief Abort a capture (the buffer keeps whatever was sampled)
+ */
+void bare_logic_stop(void);
+
+/**
+ * @brief Current capture state
+ *
+ * @return LOGIC_State_t State
+ */
+LOGIC_State_t bare_logic_state(void);
+
+/**
+ * @brief Sample rate actually programmed (timer clock / integer divisor)
+ *
+ * @return uint32_t Rate in Hz, 0 before the first start
+ */
+uint32_t bare_logic_rate(void);
+
+/**
+ * @brief Position of the trigger sample in the finished capture
+ *
+ * @return uint32_t Sample index from the start of the capture window
+ */
+uint32_t bare_logic_trigger_index(void);
+
+/**
+ * @brief Stream a finished capture over USART2, run-length encoded
+ *
+ * @note  Format: "LOGIC <rate_hz> <channels hex> <samples> <trigger index>", then one
+ *        "<value hex> <run length>" line per run, then "END". Blocks while sending.
+ */
+void bare_logic_dump(void);
+
+#endif /* BARE_LOGIC_H_ */
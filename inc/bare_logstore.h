@@ -0,0 +1,155 @@
+/*******************************************************************************************
+ * @file    bare_logstore.h
+ * @author  ka5j
+ * @brief   Append-only, wear-leveled record store in internal flash
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    A ring of flash sectors holds tagged records; nothing is ever rewritten in place.
+ *          - Config tags (0 .. LOGSTORE_TAGS-1): the latest record of each tag is the
+ *            current value, located through a RAM index and kept alive across rotations.
+ *          - Log tags (LOGSTORE_TAGS .. 0xFE): history only, dropped when their sector is
+ *            reclaimed, so the oldest entries go first.
+ *          Appends are collected in a RAM buffer and programmed as whole 32-bit words by
+ *          bare_logstore_flush(). When the open sector is full the next (erased) sector is
+ *          opened, live config records of the oldest sector are copied forward and that
+ *          sector is erased in the background by bare_logstore_poll().
+ *
+ *          On-flash format (little-endian words):
+ *          - Sector header: LOGSTORE_MAGIC, sequence number (increments per rotation)
+ *          - Record: header word tag[7:0] | length[15:8] | CRC-16/CCITT[31:16] over the
+ *            tag, length and data bytes, then the data padded with 0xFF to a word.
+ *          An erased word ends a sector. A record with a bad CRC was torn by a reset while
+ *          programming; the next mount writes a resync marker after it and appending
+ *          continues behind the marker, which later scans skip to.
+ *
+ *          All flash access goes through FLASH_Ops_t, so the format and the recovery can be
+ *          exercised on a host against a RAM or file-backed (mmap) flash image.
+ *******************************************************************************************/
+
+#ifndef BARE_LOGSTORE_H_
+#define BARE_LOGSTORE_H_
+
+#include "bare_flash.h" // Include flash access table
+#include <stdint.h>     // Include standard integer types
+
+/*******************************************************************************************
+ * Log Store Configuration
+ *******************************************************************************************/
+#define LOGSTORE_TAGS 32U           /*!< Config tags with a RAM index entry */
+#define LOGSTORE_DATA_MAX 252U      /*!< Largest record payload in bytes */
+#define LOGSTORE_BUF_WORDS 64U      /*!< RAM write buffer, holds at least one full record */
+#define LOGSTORE_MAGIC 0x4C4F4731UL /*!< "LOG1": sector in use */
+
+/*******************************************************************************************
+ * Log Store Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Status codes
+ */
+typedef enum
+{
+    LOGSTORE_OK = 0x00U,            /*!< Success */
+    LOGSTORE_ERR_PARAM = 0x01U,     /*!< Bad configuration, tag or length */
+    LOGSTORE_ERR_NOT_FOUND = 0x02U, /*!< No record with this tag */
+    LOGSTORE_ERR_FULL = 0x03U,      /*!< Live records do not fit in one sector */
+    LOGSTORE_ERR_FLASH = 0x04U      /*!< Program or erase failed */
+} LOGSTORE_Status_t;
+
+/**
+ * @brief Sector ring in flash
+ */
+typedef struct
+{
+    const FLASH_Ops_t *flash; /*!< &bare_flash_ops on the target */
+    uint8_t first_sector;     /*!< First sector of the ring */
+    uint8_t sectors;          /*!< Sectors in the ring (>= 2, one is kept erased) */
+} LOGSTORE_Config_t;
+
+/**
+ * @brief Record visitor for bare_logstore_foreach()
+ *
+ * @param tag     Record tag
+ * @param data    Payload (in flash, valid during the call)
+ * @param len     Payload length in bytes
+ * @param ctx     User context
+ */
+typedef void (*LOGSTORE_Visit_t)(uint8_t tag, const void *data, uint8_t len, void *ctx);
+
+/**
+ * @brief Counters
+ */
+typedef struct
+{
+    uint32_t appended;  /*!< Records appended */
+    uint32_t flushes;   /*!< Buffer flushes that programmed words */
+    uint32_t rotations; /*!< Sectors opened */
+    uint32_t erases;    /*!< Sector erases completed */
+    uint32_t torn;      /*!< Torn records found at mount */
+} LOGSTORE_Stats_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Mount the store: scan the ring, rebuild the index and recover from a reset
+ *
+ * Formats the ring when no sector holds the magic. An interrupted rotation is completed.
+ *
+ * @param cfg     Sector ring (copied)
+ * @return LOGSTORE_Status_t LOGSTORE_OK or an error
+ */
+LOGSTORE_Status_t bare_logstore_init(const LOGSTORE_Config_t *cfg);
+
+/**
+ * @brief Append a record to the RAM buffer (programmed when the buffer fills or on flush)
+ *
+ * @param tag     Config tag (< LOGSTORE_TAGS) or log tag (< 0xFF)
+ * @param data    Payload
+ * @param len     Payload length (<= LOGSTORE_DATA_MAX)
+ * @return LOGSTORE_Status_t LOGSTORE_OK or an error
+ */
+LOGSTORE_Status_t bare_logstore_append(uint8_t tag, const void *data, uint8_t len);
+
+/**
+ * @brief Read the latest record of a config tag
+ *
+ * @param tag     Config tag
+ * @param buf     Destination
+ * @param size    Destination size, longer records are truncated
+ * @param len     Receives the stored length (may be NULL)
+ * @return LOGSTORE_Status_t LOGSTORE_OK, LOGSTORE_ERR_NOT_FOUND or LOGSTORE_ERR_PARAM
+ */
+LOGSTORE_Status_t bare_logstore_read(uint8_t tag, void *buf, uint8_t size, uint8_t *len);
+
+/**
+ * @brief Visit every stored record, oldest first (flushes the buffer first)
+ *
+ * @param visit   Called once per record
+ * @param ctx     User context
+ * @return LOGSTORE_Status_t LOGSTORE_OK or the flush error
+ */
+LOGSTORE_Status_t bare_logstore_foreach(LOGSTORE_Visit_t visit, void *ctx);
+
+/**
+ * @brief Program the buffered records
+ *
+ * @return LOGSTORE_Status_t LOGSTORE_OK or LOGSTORE_ERR_FLASH
+ */
+LOGSTORE_Status_t bare_logstore_flush(void);
+
+/**
+ * @brief Advance background erases (call from the main loop)
+ */
+void bare_logstore_poll(void);
+
+/**
+ * @brief Log store counters
+ *
+ * @return const LOGSTORE_Stats_t* Counters
+ */
+const LOGSTORE_Stats_t *bare_logstore_stats(void);
+
+#endif /* BARE_LOGSTORE_H_ */
@@ -0,0 +1,99 @@
+/*******************************************************************************************
+ * @file    bare_packet.h
+ * @author  ka5j
+ * @brief   Framed packet transport over USART2 for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Sends and receives bare_frame packets (COBS + CRC-16, sequence numbered).
+ *          Received bytes are written by the USART2 interrupt directly into a pool buffer
+ *          and decoded in place, so a payload is never copied after leaving the data
+ *          register. Transmission streams the caller's payload through the COBS encoder
+ *          into the interrupt-driven USART2 transmit ring (bare_usart_write()).
+ *******************************************************************************************/
+
+#ifndef BARE_PACKET_H_
+#define BARE_PACKET_H_
+
+#include "bare_frame.h" // Frame codec
+#include <stddef.h>     // Include size_t
+#include <stdint.h>     // Include standard integer types
+
+/*******************************************************************************************
+ * Packet Configuration Constants
+ *******************************************************************************************/
+#ifndef PACKET_MAX_PAYLOAD
+#define PACKET_MAX_PAYLOAD 240U /*!< Largest payload accepted on receive */
+#endif
+
+#ifndef PACKET_POOL_COUNT
+#define PACKET_POOL_COUNT 4U /*!< Receive buffers (one is always owned by the ISR) */
+#endif
+
+#define PACKET_BUFFER_SIZE FRAME_WIRE_SIZE(PACKET_MAX_PAYLOAD)
+
+/*******************************************************************************************
+ * Packet Types
+ *******************************************************************************************/
+
+/**
+ * @brief Link statistics
+ */
+typedef struct
+{
+    uint32_t tx_frames;  /*!< Frames sent */
+    uint32_t rx_frames;  /*!< Valid frames received */
+    uint32_t crc_errors; /*!< Frames rejected by CRC */
+    uint32_t cobs_errors;/*!< Malformed or too short frames */
+    uint32_t overflows;  /*!< Frames longer than PACKET_BUFFER_SIZE */
+    uint32_t dropped;    /*!< Frames lost because no pool buffer was free */
+    uint32_t seq_gaps;   /*!< Packets missing according to sequence numbers */
+} PACKET_Stats_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Initialize USART2 and start interrupt-driven frame reception
+ */
+void bare_packet_init(void);
+
+/**
+ * @brief Send one packet through the USART2 transmit ring
+ *
+ * Returns once the encoded frame is queued; only waits while the ring is full. Blocking
+ * USART2 output (bare_usart_send_char) must not be mixed in while frames are queued.
+ *
+ * @param type     Packet type
+ * @param payload  Payload bytes
+ * @param len      Payload length
+ */
+void bare_packet_send(uint8_t type, const void *payload, size_t len);
+
+/**
+ * @brief Fetch the next received packet
+ *
+ * On FRAME_OK the payload points into a pool buffer that stays owned by the caller until
+ * bare_packet_release(). Invalid frames are counted, released and skipped.
+ *
+ * @param pkt  Received packet
+ * @return FRAME_Status_t FRAME_OK or FRAME_INCOMPLETE if no packet is pending
+ */
+FRAME_Status_t bare_packet_receive(FRAME_Packet_t *pkt);
+
+/**
+ * @brief Return the buffer of a received packet to the pool
+ *
+ * @param pkt  Packet obtained from bare_packet_receive()
+ */
+void bare_packet_release(const FRAME_Packet_t *pkt);
+
+/**
+ * @brief Link statistics
+ *
+ * @return const PACKET_Stats_t* Pointer to the live counters
+ */
+const PACKET_Stats_t *bare_packet_stats(void);
+
+#endif /* BARE_PACKET_H_ */
@@ -0,0 +1,245 @@
+/*******************************************************************************************
+ * @file    bare_periph.h
+ * @author  ka5j
+ * @brief   Peripheral descriptor table: clock gate, IRQ, alternate function and DMA requests
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    One const descriptor per peripheral instance, indexed by PERIPH_Id_t. Clock,
+ *          reset and NVIC setup are table lookups plus one register access, with no
+ *          per-instance branches. Instances of a family sit at a fixed stride, so their
+ *          id is derived from the register block address (bare_periph_gpio() and friends).
+ *
+ *          Peripherals with several vectors (I2C event/error, CAN TX/RX0/RX1/SCE) have
+ *          them consecutive, starting at the descriptor's IRQ.
+ *******************************************************************************************/
+
+#ifndef BARE_PERIPH_H_
+#define BARE_PERIPH_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "rcc_registers.h"         // RCC enable / reset registers
+#include "nvic_registers.h"        // NVIC enable registers
+#include "gpio_registers.h"        // GPIOA_BASE
+#include "tim2_5_registers.h"      // TIM2_BASE
+#include "dma_registers.h"         // DMA stream addresses
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Peripheral Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Peripheral instances (families are contiguous, in address order)
+ */
+typedef enum
+{
+    PERIPH_GPIOA = 0U,
+    PERIPH_GPIOB,
+    PERIPH_GPIOC,
+    PERIPH_GPIOD,
+    PERIPH_GPIOE,
+    PERIPH_GPIOF,
+    PERIPH_GPIOG,
+    PERIPH_GPIOH,
+    PERIPH_CRC,
+    PERIPH_DMA1,
+    PERIPH_DMA2,
+    PERIPH_TIM2,
+    PERIPH_TIM3,
+    PERIPH_TIM4,
+    PERIPH_TIM5,
+    PERIPH_USART2,
+    PERIPH_SPI1,
+    PERIPH_SPI2,
+    PERIPH_SPI3,
+    PERIPH_SPI4,
+    PERIPH_I2C1,
+    PERIPH_I2C2,
+    PERIPH_I2C3,
+    PERIPH_CAN1,
+    PERIPH_CAN2,
+    PERIPH_DAC,
+    PERIPH_ADC1,
+    PERIPH_ADC2,
+    PERIPH_ADC3,
+    PERIPH_PWR,
+    PERIPH_TIM8,
+    PERIPH_COUNT
+} PERIPH_Id_t;
+
+/**
+ * @brief RCC enable register, as a word offset from AHB1ENR (same layout for AHBxRSTR)
+ */
+typedef enum
+{
+    PERIPH_AHB1 = 0U, /*!< AHB1ENR */
+    PERIPH_AHB2 = 1U, /*!< AHB2ENR */
+    PERIPH_AHB3 = 2U, /*!< AHB3ENR */
+    PERIPH_APB1 = 4U, /*!< APB1ENR */
+    PERIPH_APB2 = 5U  /*!< APB2ENR */
+} PERIPH_Bus_t;
+
+#define PERIPH_NO_IRQ 0xFFU /*!< No interrupt vector */
+#define PERIPH_NO_AF 0xFFU  /*!< No alternate function (analog or internal) */
+#define PERIPH_NO_DMA 0x00U /*!< No DMA request */
+
+/** DMA request code: valid bit, controller (1/2), stream (0-7) and channel (0-7) */
+#define PERIPH_DMA(ctrl, stream, ch) \
+    ((uint8_t)(0x80U | (((ctrl) - 1U) << 6) | ((stream) << 3) | (ch)))
+
+/**
+ * @brief Static description of one peripheral instance
+ */
+typedef struct
+{
+    uint32_t base;  /*!< Register block address */
+    uint8_t bus;    /*!< PERIPH_Bus_t of the clock enable / reset bit */
+    uint8_t bit;    /*!< Bit in the enable and reset registers (see bare_periph_reset_bit) */
+    uint8_t irq;    /*!< First NVIC vector, or PERIPH_NO_IRQ */
+    uint8_t af;     /*!< Default GPIO alternate function, or PERIPH_NO_AF */
+    uint8_t dma[2]; /*!< DMA requests: RX/TX, DAC channel 1/2, TIM update; PERIPH_DMA() codes */
+} PERIPH_Desc_t;
+
+extern const PERIPH_Desc_t bare_periph_table[PERIPH_COUNT];
+
+/*******************************************************************************************
+ * API Functions (inline, table lookups)
+ *******************************************************************************************/
+
+/**
+ * @brief Descriptor of a peripheral
+ *
+ * @param id  Peripheral
+ * @return const PERIPH_Desc_t* Descriptor
+ */
+static inline const PERIPH_Desc_t *bare_periph(PERIPH_Id_t id)
+{
+    return &bare_periph_table[id];
+}
+
+/**
+ * @brief Id of a GPIO port from its register block (ports are 0x400 apart)
+ */
+static inline PERIPH_Id_t bare_periph_gpio(const GPIO_TypeDef *GPIOx)
+{
+    return (PERIPH_Id_t)(PERIPH_GPIOA + (((uint32_t)GPIOx - GPIOA_BASE) >> 10));
+}
+
+/**
+ * @brief Id of TIM2-TIM5 from its register block (timers are 0x400 apart)
+ */
+static inline PERIPH_Id_t bare_periph_tim2_5(const TIM2_5_TypeDef *TIMx)
+{
+    return (PERIPH_Id_t)(PERIPH_TIM2 + (((uint32_t)TIMx - TIM2_BASE) >> 10));
+}
+
+/**
+ * @brief Index (0-3) of TIM2-TIM5, for per-timer driver state
+ */
+static inline uint32_t bare_periph_tim2_5_index(const TIM2_5_TypeDef *TIMx)
+{
+    return (uint32_t)bare_periph_tim2_5(TIMx) - (uint32_t)PERIPH_TIM2;
+}
+
+/**
+ * @brief Enable the bus clock of a peripheral
+ */
+static inline void bare_periph_enable_clock(PERIPH_Id_t id)
+{
+    (&RCC->AHB1ENR)[bare_periph_table[id].bus] |= (1UL << bare_periph_table[id].bit);
+}
+
+/**
+ * @brief Disable the bus clock of a peripheral
+ */
+static inline void bare_periph_disable_clock(PERIPH_Id_t id)
+{
+    (&RCC->AHB1ENR)[bare_periph_table[id].bus] &= ~(1UL << bare_periph_table[id].bit);
+}
+
+/**
+ * @brief Whether the bus clock of a peripheral is enabled
+ */
+static inline uint8_t bare_periph_clock_enabled(PERIPH_Id_t id)
+{
+    return ((&RCC->AHB1ENR)[bare_periph_table[id].bus] >> bare_periph_table[id].bit) & 1U;
+}
+
+/**
+ * @brief Reset bit of a peripheral: the enable bit, except ADC2/ADC3 which have no reset
+ *        bit of their own (APB2RSTR bits 9/10 are reserved) and share ADCRST with ADC1
+ */
+static inline uint8_t bare_periph_reset_bit(PERIPH_Id_t id)
+{
+    return ((id == PERIPH_ADC2) || (id == PERIPH_ADC3)) ? bare_periph_table[PERIPH_ADC1].bit
+                                                        : bare_periph_table[id].bit;
+}
+
+/**
+ * @brief Pulse the RCC reset line of a peripheral (all its registers to reset values)
+ *
+ * @note  Resetting any ADC resets all three and the common registers.
+ */
+static inline void bare_periph_reset(PERIPH_Id_t id)
+{
+    uint32_t bit = 1UL << bare_periph_reset_bit(id);
+
+    (&RCC->AHB1RSTR)[bare_periph_table[id].bus] |= bit;
+    (&RCC->AHB1RSTR)[bare_periph_table[id].bus] &= ~bit;
+}
+
+/**
+ * @brief Enable an NVIC vector of a peripheral
+ *
+ * @param id      Peripheral
+ * @param offset  Vector offset from the first one (0 for single-vector peripherals)
+ */
+static inline void bare_periph_enable_irq(PERIPH_Id_t id, uint8_t offset)
+{
+    uint32_t irq = (uint32_t)bare_periph_table[id].irq + offset;
+
+    NVIC->ISER[irq >> 5] = (1UL << (irq & 0x1FU));
+}
+
+/**
+ * @brief Disable an NVIC vector of a peripheral
+ *
+ * @param id      Peripheral
+ * @param offset  Vector offset from the first one
+ */
+static inline void bare_periph_disable_irq(PERIPH_Id_t id, uint8_t offset)
+{
+    uint32_t irq = (uint32_t)bare_periph_table[id].irq + offset;
+
+    NVIC->ICER[irq >> 5] = (1UL << (irq & 0x1FU));
+}
+
+/**
+ * @brief DMA stream of a request slot
+ *
+ * @param id    Peripheral
+ * @param slot  0 or 1 (see PERIPH_Desc_t.dma)
+ * @return DMA_Stream_TypeDef* Stream
+ */
+static inline DMA_Stream_TypeDef *bare_periph_dma_stream(PERIPH_Id_t id, uint8_t slot)
+{
+    uint8_t code = bare_periph_table[id].dma[slot];
+
+    return (DMA_Stream_TypeDef *)DMA_STREAM_BASE((code & 0x40U) ? DMA2_BASE : DMA1_BASE,
+                                                 (code >> 3) & 0x7U);
+}
+
+/**
+ * @brief DMA request channel of a request slot
+ *
+ * @param id    Peripheral
+ * @param slot  0 or 1
+ * @return uint8_t Channel (0-7)
+ */
+static inline uint8_t bare_periph_dma_channel(PERIPH_Id_t id, uint8_t slot)
+{
+    return bare_periph_table[id].dma[slot] & 0x7U;
+}
+
+#endif /* BARE_PERIPH_H_ */
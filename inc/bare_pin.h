@@ -0,0 +1,136 @@
+/*******************************************************************************************
+ * @file    bare_pin.h
+ * @author  ka5j
+ * @brief   Compile-time GPIO pin objects for STM32F446RE (header-only)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Port and pin are bound when the pin is defined, so every operation folds to
+ *          constants: set/clear/write are one immediate store to BSRR, toggle is one ODR
+ *          load plus one BSRR store, and a group of pins on one port is driven by a single
+ *          BSRR store. Pin configuration (mode, speed, pull) still goes through
+ *          bare_gpio_init(). tools/pin_codegen_check.sh verifies the instruction counts.
+ *
+ *              BARE_PIN_DEFINE(led, GPIOA, 5)
+ *              BARE_PIN_GROUP_DEFINE(bus, GPIOC, 0x00FFUL)
+ *
+ *              led_set();
+ *              bus_write(0x5A);
+ *******************************************************************************************/
+
+#ifndef BARE_PIN_H_
+#define BARE_PIN_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "gpio_registers.h"        // Include GPIO register map
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * C Pin Objects
+ *******************************************************************************************/
+
+/**
+ * @brief Define name_set/_clear/_write/_toggle/_read for one pin
+ *
+ * @param name    Prefix of the generated functions
+ * @param GPIOx   GPIO port (GPIOA ... GPIOH)
+ * @param pin     Pin number (0-15), must be a constant
+ */
+#define BARE_PIN_DEFINE(name, GPIOx, pin)                                                     \
+    enum { name##_MASK = (int)(1UL << (pin)) };                                               \
+    static inline void name##_set(void) { (GPIOx)->BSRR = (1UL << (pin)); }                   \
+    static inline void name##_clear(void) { (GPIOx)->BSRR = (1UL << ((pin) + 16U)); }         \
+    static inline void name##_write(uint32_t on)                                              \
+    {                                                                                         \
+        (GPIOx)->BSRR = (1UL << ((pin) + 16U)) >> ((on) ? 16U : 0U);                          \
+    }                                                                                         \
+    static inline void name##_toggle(void)                                                    \
+    {                                                                                         \
+        uint32_t odr = (GPIOx)->ODR;                                                          \
+        (GPIOx)->BSRR = ((odr & (1UL << (pin))) << 16) | (~odr & (1UL << (pin)));             \
+    }                                                                                         \
+    static inline uint32_t name##_read(void) { return ((GPIOx)->IDR >> (pin)) & 1UL; }
+
+/**
+ * @brief Define name_set/_clear/_write/_toggle/_read for several pins of one port
+ *
+ * @param name    Prefix of the generated functions
+ * @param GPIOx   GPIO port (GPIOA ... GPIOH)
+ * @param mask    Pins of the group (bit n = pin n), must be a constant
+ *
+ * @note  name_write(bits) drives every pin of the group in one store: pins whose bit is
+ *        set go high, the others low (BSRR set bits take priority over reset bits).
+ */
+#define BARE_PIN_GROUP_DEFINE(name, GPIOx, mask)                                              \
+    enum { name##_MASK = (int)((mask) & 0xFFFFUL) };                                          \
+    static inline void name##_set(void) { (GPIOx)->BSRR = (mask) & 0xFFFFUL; }                \
+    static inline void name##_clear(void) { (GPIOx)->BSRR = ((mask) & 0xFFFFUL) << 16; }      \
+    static inline void name##_write(uint32_t bits)                                            \
+    {                                                                                         \
+        (GPIOx)->BSRR = (((mask) & 0xFFFFUL) << 16) | ((bits) & (mask) & 0xFFFFUL);           \
+    }                                                                                         \
+    static inline void name##_toggle(void)                                                    \
+    {                                                                                         \
+        uint32_t odr = (GPIOx)->ODR;                                                          \
+        (GPIOx)->BSRR = ((odr & (mask) & 0xFFFFUL) << 16) | (~odr & (mask) & 0xFFFFUL);       \
+    }                                                                                         \
+    static inline uint32_t name##_read(void) { return (GPIOx)->IDR & (mask) & 0xFFFFUL; }
+
+/*******************************************************************************************
+ * C++ Pin Templates
+ *******************************************************************************************/
+#if defined(__cplusplus) && (__cplusplus >= 201703L)
+
+namespace bare
+{
+
+/**
+ * @brief One pin bound at compile time (Base = GPIOx_BASE)
+ */
+template <uintptr_t Base, unsigned Pin>
+struct pin
+{
+    static_assert(Pin < 16U, "GPIO pin out of range");
+
+    static constexpr uintptr_t base = Base;
+    static constexpr uint32_t mask = 1UL << Pin;
+
+    static GPIO_TypeDef *port() { return reinterpret_cast<GPIO_TypeDef *>(Base); }
+    static void set() { port()->BSRR = mask; }
+    static void clear() { port()->BSRR = mask << 16; }
+    static void write(bool on) { port()->BSRR = (mask << 16) >> (on ? 16U : 0U); }
+    static void toggle()
+    {
+        uint32_t odr = port()->ODR;
+        port()->BSRR = ((odr & mask) << 16) | (~odr & mask);
+    }
+    static bool read() { return (port()->IDR & mask) != 0U; }
+};
+
+/**
+ * @brief Several pins of one port merged into single BSRR stores
+ */
+template <typename First, typename... Rest>
+struct pin_group
+{
+    static_assert(((Rest::base == First::base) && ...), "pin_group spans several ports");
+
+    static constexpr uint32_t mask = (First::mask | ... | Rest::mask);
+
+    static GPIO_TypeDef *port() { return reinterpret_cast<GPIO_TypeDef *>(First::base); }
+    static void set() { port()->BSRR = mask; }
+    static void clear() { port()->BSRR = mask << 16; }
+    static void write(uint32_t bits) { port()->BSRR = (mask << 16) | (bits & mask); }
+    static void toggle()
+    {
+        uint32_t odr = port()->ODR;
+        port()->BSRR = ((odr & mask) << 16) | (~odr & mask);
+    }
+    static uint32_t read() { return port()->IDR & mask; }
+};
+
+} // namespace bare
+
+#endif /* __cplusplus */
+
+#endif /* BARE_PIN_H_ */
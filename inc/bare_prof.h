@@ -0,0 +1,107 @@
+/*******************************************************************************************
+ * @file    bare_prof.h
+ * @author  ka5j
+ * @brief   Statistical PC-sampling profiler (TIM2-TIM5 or SysTick sample clock)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Every sample interrupt reads the PC stacked by the exception entry, i.e. the
+ *          instruction that was interrupted, and counts it into a hashed histogram in RAM.
+ *          The histogram is dumped as text over USART2 and symbolized on the host by
+ *          tools/prof_report.py against the firmware ELF.
+ *
+ *          The sample handler has to see the exception frame untouched, so it is a naked
+ *          trampoline generated with BARE_PROF_HANDLER() in the application:
+ *
+ *              BARE_PROF_HANDLER(TIM5_IRQHandler)
+ *
+ *          Code running at the same or higher priority than the sample interrupt is only
+ *          seen once it returns; the sample interrupt is set to the highest priority.
+ *******************************************************************************************/
+
+#ifndef BARE_PROF_H_
+#define BARE_PROF_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "tim2_5_registers.h"      // Timer register structures
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Profiler Configuration Constants
+ *******************************************************************************************/
+
+#define PROF_BUCKETS_LOG2 9U                       /*!< 512 buckets, 4 KiB of RAM */
+#define PROF_BUCKETS (1UL << PROF_BUCKETS_LOG2)    /*!< Histogram size */
+#define PROF_PROBES 8U                             /*!< Linear probes before a sample drops */
+
+/*******************************************************************************************
+ * Profiler Types
+ *******************************************************************************************/
+
+/**
+ * @brief Hook run after each sample, e.g. the application's own SysTick work
+ */
+typedef void (*PROF_Hook_t)(void);
+
+/**
+ * @brief Profiler configuration
+ */
+typedef struct
+{
+    TIM2_5_TypeDef *tim; /*!< Sample timer, or NULL to sample off SysTick */
+    uint32_t rate_hz;    /*!< Sample rate (prime-ish rates avoid locking to periodic code) */
+    uint8_t shift;       /*!< Address granularity: bucket = PC >> shift (1 = per instruction) */
+    PROF_Hook_t hook;    /*!< Called after each sample (may be NULL) */
+} PROF_Config_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Clear the histogram and start sampling
+ *
+ * With a timer, the counter, update interrupt and NVIC line are configured here. With
+ * SysTick, it is reprogrammed at rate_hz from HCLK (its previous use is suspended;
+ * keep it alive through the hook).
+ *
+ * @param cfg  Configuration (copied)
+ */
+void bare_prof_start(const PROF_Config_t *cfg);
+
+/**
+ * @brief Stop sampling; the histogram is kept for dumping
+ */
+void bare_prof_stop(void);
+
+/**
+ * @brief Write the histogram over USART2
+ *
+ * Format: "PROF <samples> <dropped> <shift>", then one "<hex bucket> <count>" line per
+ * used bucket, then "END". Sampling is paused during the dump and resumed afterwards.
+ */
+void bare_prof_dump(void);
+
+/**
+ * @brief Count one sample (called by the BARE_PROF_HANDLER trampoline)
+ *
+ * @param frame  Exception frame: r0, r1, r2, r3, r12, lr, pc, xpsr
+ */
+void bare_prof_sample(const uint32_t *frame);
+
+/**
+ * @brief Define an interrupt handler that samples the interrupted PC
+ *
+ * Picks MSP or PSP from EXC_RETURN and branches to bare_prof_sample() with the frame.
+ */
+#define BARE_PROF_HANDLER(name)                      \
+    __attribute__((naked)) void name(void)           \
+    {                                                \
+        __asm volatile("tst   lr, #4          \n"    \
+                       "ite   eq              \n"    \
+                       "mrseq r0, msp         \n"    \
+                       "mrsne r0, psp         \n"    \
+                       "b     bare_prof_sample\n");  \
+    }
+
+#endif /* BARE_PROF_H_ */
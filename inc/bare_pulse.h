@@ -0,0 +1,126 @@
+/*******************************************************************************************
+ * @file    bare_pulse.h
+ * @author  ka5j
+ * @brief   Hardware-timed delayed pulse generator on TIM2-TIM5 for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The timer runs in one-pulse mode, started by its slave mode controller from a
+ *          trigger input (TI1/TI2 pin, another timer's TRGO via ITRx, or ETR). The output
+ *          channel runs PWM mode 2 with CCRx = delay and ARR = delay + width - 1, so both
+ *          edges are placed by hardware to the timer tick, whatever the CPU is doing.
+ *
+ *          Retrigger and burst modes need the timer interrupt: route TIMx_IRQHandler to
+ *          bare_pulse_irq_handler(). The interrupt only switches modes; it never places
+ *          an edge.
+ *******************************************************************************************/
+
+#ifndef BARE_PULSE_H_
+#define BARE_PULSE_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "tim2_5_registers.h"      // Timer register structures
+#include "gpio_registers.h"        // GPIO peripheral definitions
+#include "bare_gpio.h"             // GPIO header file
+#include "bare_tim2_5.h"           // Timer channel enumeration
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Pulse Configuration Enumerations
+ *******************************************************************************************/
+
+/**
+ * @brief Start trigger (SMCR TS value)
+ *
+ * ITRx sources per slave (RM0390 Table 97): TIM2: ITR0 TIM1, ITR1 TIM8, ITR2 TIM3,
+ * ITR3 TIM4. TIM3: TIM1, TIM2, TIM5, TIM4. TIM4: TIM1, TIM2, TIM3, TIM8.
+ * TIM5: TIM2, TIM3, TIM4, TIM8.
+ */
+typedef enum
+{
+    PULSE_TRIG_ITR0 = 0x00U,     /*!< Internal trigger 0 */
+    PULSE_TRIG_ITR1 = 0x01U,     /*!< Internal trigger 1 */
+    PULSE_TRIG_ITR2 = 0x02U,     /*!< Internal trigger 2 */
+    PULSE_TRIG_ITR3 = 0x03U,     /*!< Internal trigger 3 */
+    PULSE_TRIG_TI1 = 0x05U,      /*!< Channel 1 input pin (filtered) */
+    PULSE_TRIG_TI2 = 0x06U,      /*!< Channel 2 input pin (filtered) */
+    PULSE_TRIG_ETR = 0x07U,      /*!< External trigger pin */
+    PULSE_TRIG_SOFTWARE = 0x0FU  /*!< bare_pulse_fire() only */
+} PULSE_Trigger_t;
+
+/**
+ * @brief Behaviour on triggers
+ */
+typedef enum
+{
+    PULSE_MODE_SINGLE = 0x00U,    /*!< One pulse; triggers during it are ignored */
+    PULSE_MODE_RETRIGGER = 0x01U, /*!< A trigger during the pulse restarts the delay */
+    PULSE_MODE_BURST = 0x02U      /*!< `count` pulses, each delay + width long, per trigger */
+} PULSE_Mode_t;
+
+/**
+ * @brief Pulse generator configuration
+ */
+typedef struct
+{
+    TIM2_5_CHNL_t channel;   /*!< Output channel (not the TIx used as trigger) */
+    GPIO_TypeDef *port;      /*!< Output pin port (NULL: pin routed by the caller) */
+    GPIO_Pins_t pin;         /*!< Output pin */
+    uint8_t active_low;      /*!< 1 = pulse drives the pin low */
+    PULSE_Trigger_t trigger; /*!< Start trigger */
+    uint8_t falling_edge;    /*!< TI1/TI2: 1 = trigger on the falling edge */
+    uint8_t filter;          /*!< TI1/TI2: input filter (ICxF, 0-15) */
+    uint32_t tick_hz;        /*!< Timer tick (resolution of delay and width) */
+    uint32_t delay;          /*!< Ticks from trigger to leading edge (>= 1) */
+    uint32_t width;          /*!< Pulse width in ticks (>= 1) */
+    PULSE_Mode_t mode;       /*!< Trigger behaviour */
+    uint32_t count;          /*!< Pulses per trigger in PULSE_MODE_BURST */
+} PULSE_Config_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Configure a timer as a triggered pulse generator and arm it
+ *
+ * delay + width must fit the counter (65536 ticks for TIM3/TIM4).
+ *
+ * @param TIMx  Pointer to timer peripheral (TIM2-TIM5)
+ * @param cfg   Configuration
+ * @return uint32_t Achieved tick frequency in Hz
+ */
+uint32_t bare_pulse_init(TIM2_5_TypeDef *TIMx, const PULSE_Config_t *cfg);
+
+/**
+ * @brief Change delay and width; takes effect from the next pulse (preloaded)
+ *
+ * @param TIMx   Pointer to timer peripheral
+ * @param delay  Ticks from trigger to leading edge (>= 1)
+ * @param width  Pulse width in ticks (>= 1)
+ */
+void bare_pulse_set_timing(TIM2_5_TypeDef *TIMx, uint32_t delay, uint32_t width);
+
+/**
+ * @brief Start a pulse (or burst) now, as if triggered
+ *
+ * @param TIMx  Pointer to timer peripheral
+ */
+void bare_pulse_fire(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Check whether a pulse or burst is in progress
+ *
+ * @param TIMx  Pointer to timer peripheral
+ * @return uint8_t 1 if the counter is running
+ */
+uint8_t bare_pulse_busy(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Timer interrupt work for retrigger and burst modes
+ *
+ * @param TIMx  Pointer to timer peripheral
+ */
+void bare_pulse_irq_handler(TIM2_5_TypeDef *TIMx);
+
+#endif /* BARE_PULSE_H_ */
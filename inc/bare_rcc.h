@@ -0,0 +1,148 @@
+/*******************************************************************************************
+ * @file    bare_rcc.h
+ * @author  ka5j
+ * @brief   Bare-metal RCC clock tree queries for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Computes the actual bus frequencies from the live RCC configuration so that
+ *          drivers derive baud rates, prescalers and timings from the real clock tree
+ *          instead of a hard-coded 16 MHz.
+ *
+ *          The clock can be switched at run time between fixed profiles. Drivers that derive
+ *          a divisor from a bus clock register a hook, which is called with interrupts
+ *          disabled before the switch (drain) and after it (recompute).
+ *******************************************************************************************/
+
+#ifndef BARE_RCC_H_
+#define BARE_RCC_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "rcc_registers.h"         // Include RCC register map
+#include "board_config.h"          // Oscillator frequencies
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Clock Profile Enumerations and Types
+ *******************************************************************************************/
+
+#define RCC_MAX_HOOKS 8U /*!< Clock change hooks that can be registered */
+
+/**
+ * @brief Clock profiles (PLL from HSI, VDD 2.7-3.6 V)
+ */
+typedef enum
+{
+    RCC_PROFILE_HSI_16MHZ = 0x00U,  /*!< HSI, APB1/APB2 16 MHz, 0 wait states */
+    RCC_PROFILE_PLL_84MHZ = 0x01U,  /*!< PLL, APB1 42 MHz, APB2 84 MHz, 2 wait states, VOS 3 */
+    RCC_PROFILE_PLL_180MHZ = 0x02U, /*!< PLL, APB1 45 MHz, APB2 90 MHz, 5 wait states, over-drive */
+    RCC_PROFILE_COUNT = 0x03U       /*!< Number of profiles */
+} RCC_Profile_t;
+
+/**
+ * @brief Operation status
+ */
+typedef enum
+{
+    RCC_OK = 0x00U,          /*!< Success */
+    RCC_ERR_TIMEOUT = 0x01U, /*!< PLL, over-drive or switch did not get ready (left on HSI) */
+    RCC_ERR_HOOKS = 0x02U    /*!< Hook table full */
+} RCC_Status_t;
+
+/**
+ * @brief Point of a clock switch at which hooks are called
+ */
+typedef enum
+{
+    RCC_CLOCK_PRE = 0x00U, /*!< Old clock still running: finish in-flight transfers */
+    RCC_CLOCK_POST = 0x01U /*!< New clock running: recompute divisors */
+} RCC_ClockPhase_t;
+
+/**
+ * @brief Clock change hook, called with interrupts disabled
+ */
+typedef void (*RCC_ClockHook_t)(RCC_ClockPhase_t phase);
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief System clock frequency (SYSCLK) in Hz
+ *
+ * @return uint32_t Frequency of the source selected by CFGR.SWS
+ */
+uint32_t bare_rcc_get_sysclk(void);
+
+/**
+ * @brief AHB clock frequency (HCLK, core and DWT cycle counter) in Hz
+ *
+ * @return uint32_t SYSCLK divided by the AHB prescaler
+ */
+uint32_t bare_rcc_get_hclk(void);
+
+/**
+ * @brief APB1 peripheral clock frequency (PCLK1) in Hz
+ *
+ * @return uint32_t HCLK divided by the APB1 prescaler
+ */
+uint32_t bare_rcc_get_pclk1(void);
+
+/**
+ * @brief APB2 peripheral clock frequency (PCLK2) in Hz
+ *
+ * @return uint32_t HCLK divided by the APB2 prescaler
+ */
+uint32_t bare_rcc_get_pclk2(void);
+
+/**
+ * @brief Kernel clock of the APB1 timers (TIM2-TIM7, TIM12-TIM14) in Hz
+ *
+ * @return uint32_t PCLK1, doubled when the APB1 prescaler is not 1
+ */
+uint32_t bare_rcc_get_timclk1(void);
+
+/**
+ * @brief Kernel clock of the APB2 timers (TIM1, TIM8-TIM11) in Hz
+ *
+ * @return uint32_t PCLK2, doubled when the APB2 prescaler is not 1
+ */
+uint32_t bare_rcc_get_timclk2(void);
+
+/**
+ * @brief Switch the system clock to a profile and let the drivers follow
+ *
+ * Runs the PRE hooks, moves SYSCLK to HSI, reprograms the PLL, regulator scale,
+ * over-drive, flash wait states and bus prescalers, switches over and runs the POST
+ * hooks, all with interrupts disabled. If the PLL fails, SYSCLK is left on HSI and the
+ * drivers follow it. If SYSCLK cannot be confirmed on HSI at all, the flash latency and
+ * profile are left unchanged and the POST hooks do not run.
+ *
+ * @param profile  Target profile
+ * @return RCC_Status_t RCC_OK or RCC_ERR_TIMEOUT
+ */
+RCC_Status_t bare_rcc_set_profile(RCC_Profile_t profile);
+
+/**
+ * @brief Profile selected by the last bare_rcc_set_profile() (HSI after reset)
+ *
+ * @return RCC_Profile_t Current profile
+ */
+RCC_Profile_t bare_rcc_get_profile(void);
+
+/**
+ * @brief Register a clock change hook (registering the same hook twice is harmless)
+ *
+ * @param hook  Hook called around every profile switch, in registration order
+ * @return RCC_Status_t RCC_OK or RCC_ERR_HOOKS
+ */
+RCC_Status_t bare_rcc_register_hook(RCC_ClockHook_t hook);
+
+/**
+ * @brief Duration of the last profile switch, hooks included
+ *
+ * @return uint32_t Microseconds
+ */
+uint32_t bare_rcc_switch_latency_us(void);
+
+#endif /* BARE_RCC_H_ */
@@ -0,0 +1,120 @@
+/*******************************************************************************************
+ * @file    bare_reg.h
+ * @author  ka5j
+ * @brief   Register field access layer: merge several field updates into one RMW
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    A field update is a 64-bit value (mask in the high word, value in the low
+ *          word) so updates combine with '|' into an integer constant expression. Fields
+ *          are named by the existing bit / _Msk macros of the xxx_registers.h maps; the
+ *          shift comes from the mask's lowest set bit, so no separate _Pos is needed:
+ *
+ *              bare_reg_modify(&USART2->CR1, BARE_FIELD(USART_CR1_TE, 1) |
+ *                                            BARE_FIELD(USART_CR1_RE, 1) |
+ *                                            BARE_FIELD(USART_CR1_UE, 1));
+ *
+ *          compiles to one load and one store. If the combined mask covers all 32 bits
+ *          the load is dropped. Host builds can define BARE_REG_READ / BARE_REG_WRITE
+ *          before including this header to count bus accesses (tests/test_reg_count.c).
+ *******************************************************************************************/
+
+#ifndef BARE_REG_H_
+#define BARE_REG_H_
+
+#include <stdint.h> // Include standard integer types
+
+/*******************************************************************************************
+ * Bus Access Hooks
+ *******************************************************************************************/
+#ifndef BARE_REG_READ
+#define BARE_REG_READ(reg) (*(reg))
+#endif
+
+#ifndef BARE_REG_WRITE
+#define BARE_REG_WRITE(reg, v) (*(reg) = (v))
+#endif
+
+/*******************************************************************************************
+ * Field Definitions
+ *******************************************************************************************/
+
+/**
+ * @brief One or more field updates: mask << 32 | value
+ */
+typedef uint64_t BARE_Field_t;
+
+/**
+ * @brief Lowest set bit of a mask (the field's unit step)
+ */
+#define BARE_FIELD_LSB(mask) ((uint32_t)(mask) & (0U - (uint32_t)(mask)))
+
+/**
+ * @brief Update of one field: value is shifted into place and clipped to the mask
+ */
+#define BARE_FIELD(mask, v)                                                                   \
+    ((((BARE_Field_t)(uint32_t)(mask)) << 32) |                                               \
+     (((uint32_t)(v) * BARE_FIELD_LSB(mask)) & (uint32_t)(mask)))
+
+/**
+ * @brief Update covering every bit: unnamed fields are written as 0
+ */
+#define BARE_FIELD_ALL (((BARE_Field_t)0xFFFFFFFFUL) << 32)
+
+/**
+ * @brief Extract a field's value from a register value
+ */
+#define BARE_FIELD_GET(mask, regval)                                                          \
+    (((uint32_t)(regval) & (uint32_t)(mask)) / BARE_FIELD_LSB(mask))
+
+/*******************************************************************************************
+ * Register Access
+ *******************************************************************************************/
+
+/**
+ * @brief Apply merged field updates: one read and one write, or a pure write if every
+ *        bit is known
+ *
+ * @param reg        Register to update
+ * @param f          Combined BARE_FIELD() updates
+ */
+static inline void bare_reg_modify(volatile uint32_t *reg, BARE_Field_t f)
+{
+    uint32_t mask = (uint32_t)(f >> 32);
+    uint32_t val = (uint32_t)f;
+
+    if (mask == 0xFFFFFFFFUL)
+    {
+        BARE_REG_WRITE(reg, val);
+        return;
+    }
+    if (mask != 0U)
+    {
+        BARE_REG_WRITE(reg, (BARE_REG_READ(reg) & ~mask) | val);
+    }
+}
+
+/**
+ * @brief Write merged field updates with all other bits at 0 (no read)
+ *
+ * @param reg        Register to write
+ * @param f          Combined BARE_FIELD() updates
+ */
+static inline void bare_reg_write(volatile uint32_t *reg, BARE_Field_t f)
+{
+    BARE_REG_WRITE(reg, (uint32_t)f);
+}
+
+/**
+ * @brief Read one field of a register
+ *
+ * @param reg        Register to read
+ * @param mask       Field mask
+ * @return uint32_t Field value, shifted down to bit 0
+ */
+static inline uint32_t bare_reg_get(volatile uint32_t *reg, uint32_t mask)
+{
+    return BARE_FIELD_GET(mask, BARE_REG_READ(reg));
+}
+
+#endif /* BARE_REG_H_ */
@@ -0,0 +1,173 @@
+/*******************************************************************************************
+ * @file    bare_spi.h
+ * @author  ka5j
+ * @brief   Bare-metal SPI1-SPI4 master driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Provides polled transfers for a few bytes, full-duplex DMA transfers for large
+ *          blocks and a transaction queue that toggles chip selects and starts the next
+ *          transfer directly from the DMA interrupt, without relying on STM32 HAL.
+ *******************************************************************************************/
+
+#ifndef BARE_SPI_H_
+#define BARE_SPI_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "spi_registers.h"         // Include SPI register map
+#include "gpio_registers.h"        // GPIO peripheral definitions
+#include "bare_gpio.h"             // GPIO header file
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * SPI Configuration Constants
+ *******************************************************************************************/
+#ifndef SPI_POLL_THRESHOLD
+#define SPI_POLL_THRESHOLD 8U /*!< Queued transfers up to this many frames skip the DMA */
+#endif
+
+/*******************************************************************************************
+ * SPI Configuration Enumerations
+ *******************************************************************************************/
+
+/**
+ * @brief Clock polarity / phase
+ */
+typedef enum
+{
+    SPI_MODE0 = 0x00U, /*!< CPOL = 0, CPHA = 0 */
+    SPI_MODE1 = 0x01U, /*!< CPOL = 0, CPHA = 1 */
+    SPI_MODE2 = 0x02U, /*!< CPOL = 1, CPHA = 0 */
+    SPI_MODE3 = 0x03U  /*!< CPOL = 1, CPHA = 1 */
+} SPI_Mode_t;
+
+/**
+ * @brief Data frame size
+ */
+typedef enum
+{
+    SPI_FRAME_8BIT = 0x00U, /*!< Buffers are uint8_t arrays */
+    SPI_FRAME_16BIT = 0x01U /*!< Buffers are uint16_t arrays */
+} SPI_Frame_t;
+
+/**
+ * @brief Operation status
+ */
+typedef enum
+{
+    SPI_OK = 0x00U,          /*!< Accepted / completed */
+    SPI_BUSY = 0x01U,        /*!< A DMA transfer is in progress */
+    SPI_ERR_OVR = 0x02U,     /*!< Receive overrun, polled transfer abandoned */
+    SPI_ERR_TIMEOUT = 0x03U, /*!< Polled transfer stalled (SPI disabled or mode fault) */
+    SPI_ERR_DMA = 0x04U      /*!< DMA transfer error (queued transactions) */
+} SPI_Status_t;
+
+/**
+ * @brief GPIO pin reference
+ */
+typedef struct
+{
+    GPIO_TypeDef *port; /*!< GPIO port */
+    GPIO_Pins_t pin;    /*!< Pin number */
+} SPI_Pin_t;
+
+/**
+ * @brief Bus configuration
+ */
+typedef struct
+{
+    SPI_Pin_t sck;      /*!< Clock pin */
+    SPI_Pin_t miso;     /*!< Data in (port NULL if unused) */
+    SPI_Pin_t mosi;     /*!< Data out */
+    uint8_t af;         /*!< Alternate function (AF5 SPI1/2/4, AF6 SPI3, see datasheet) */
+    SPI_Mode_t mode;    /*!< Clock polarity / phase */
+    SPI_Frame_t frame;  /*!< Frame size */
+    uint32_t max_hz;    /*!< Highest acceptable SCK frequency */
+    uint8_t lsb_first;  /*!< 1 = LSB first */
+} SPI_Config_t;
+
+/**
+ * @brief Completion callback, executed in DMA interrupt context
+ */
+typedef void (*SPI_Callback_t)(void *ctx);
+
+/**
+ * @brief Queued transaction (caller owned, must stay valid until its callback)
+ */
+typedef struct SPI_Transaction
+{
+    GPIO_TypeDef *cs_port;        /*!< Chip select port (NULL: no chip select) */
+    GPIO_Pins_t cs_pin;           /*!< Chip select pin, active low */
+    uint8_t keep_cs;              /*!< 1 = keep CS asserted into the next transaction */
+    const void *tx;               /*!< Data to send (NULL: send 0xFF / 0xFFFF) */
+    void *rx;                     /*!< Received data (NULL: discard) */
+    uint16_t len;                 /*!< Number of frames */
+    SPI_Callback_t done;          /*!< Optional completion callback */
+    void *ctx;                    /*!< Callback context */
+    SPI_Status_t status;          /*!< Result, set before the callback runs */
+    struct SPI_Transaction *next; /*!< Queue link (managed by the driver) */
+} SPI_Transaction_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Initialize an SPI instance as master
+ *
+ * @param SPIx  Pointer to SPI peripheral (SPI1-SPI4)
+ * @param cfg   Bus configuration
+ * @return uint32_t Actual SCK frequency in Hz
+ */
+uint32_t bare_spi_init(SPI_TypeDef *SPIx, const SPI_Config_t *cfg);
+
+/**
+ * @brief Configure a chip-select pin as push-pull output, deasserted (high)
+ *
+ * @param GPIOx  Pointer to GPIO peripheral
+ * @param pin    GPIO pin number
+ */
+void bare_spi_cs_init(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin);
+
+/**
+ * @brief Polled full-duplex transfer (for a handful of frames)
+ *
+ * @param SPIx  Pointer to SPI peripheral
+ * @param tx    Data to send (NULL: all ones)
+ * @param rx    Receive buffer (NULL: discard)
+ * @param len   Number of frames
+ * @return SPI_Status_t SPI_OK, SPI_ERR_OVR or SPI_ERR_TIMEOUT
+ */
+SPI_Status_t bare_spi_transfer(SPI_TypeDef *SPIx, const void *tx, void *rx, uint16_t len);
+
+/**
+ * @brief Start a full-duplex DMA transfer
+ *
+ * @param SPIx  Pointer to SPI peripheral
+ * @param tx    Data to send (NULL: all ones)
+ * @param rx    Receive buffer (NULL: discard)
+ * @param len   Number of frames
+ * @param cb    Completion callback (may be NULL)
+ * @param ctx   Callback context
+ * @return SPI_Status_t SPI_OK or SPI_BUSY
+ */
+SPI_Status_t bare_spi_transfer_dma(SPI_TypeDef *SPIx, const void *tx, void *rx, uint16_t len,
+                                   SPI_Callback_t cb, void *ctx);
+
+/**
+ * @brief Append a transaction to the queue and start it if the bus is idle
+ *
+ * @param SPIx  Pointer to SPI peripheral
+ * @param t     Transaction
+ */
+void bare_spi_submit(SPI_TypeDef *SPIx, SPI_Transaction_t *t);
+
+/**
+ * @brief Check whether a DMA transfer or queued transaction is running
+ *
+ * @param SPIx  Pointer to SPI peripheral
+ * @return uint8_t 1 if busy, 0 if idle
+ */
+uint8_t bare_spi_busy(SPI_TypeDef *SPIx);
+
+#endif /* BARE_SPI_H_ */
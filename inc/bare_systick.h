@@ -19,6 +19,8 @@
  * SysTick Configuration Constants
  *******************************************************************************************/
 #define SYSTICK_1SEC_RELOAD_16MHZ 16000000U  /*!< Reload value for 1s delay at 16 MHz */
+/* After a switch to 84 MHz one second only fits the counter at HCLK / 8 (10.5 M counts),
+ * at 180 MHz not at all (22.5 M counts): see SysTick_Get_Status() */
  
  /*******************************************************************************************
   * SysTick Control Enumerations
@@ -55,6 +57,14 @@
      SYSTICK_RELOAD = SYSTICK_1SEC_RELOAD_16MHZ /*!< Reload value for 1-second delay */
  } SysTick_RVR_t;
  
+ /**
+  * @brief Result of keeping the period across a clock switch
+  */
+ typedef enum {
+     SYSTICK_OK        = 0x00U, /*!< Period kept exactly (to one count) */
+     SYSTICK_ERR_RANGE = 0x01U  /*!< Period does not fit the 24-bit counter, cut short */
+ } SysTick_Status_t;
+ 
  /**
   * @brief SysTick Calibration Clock Source Availability
   */
@@ -78,6 +88,10 @@
  /**
   * @brief Initialize the SysTick timer with configuration options.
   *
+  * The period is kept across bare_rcc_set_profile() switches. It is recomputed from the
+  * value set here (or by SysTick_Set_TIMER()) at each switch; when it does not fit the
+  * counter at HCLK, the HCLK / 8 source is used instead.
+  *
   * @param reload     Reload value for timer (e.g., SYSTICK_RELOAD)
   * @param clk        Clock source selection
   * @param interrupt  Enable or disable SysTick interrupt
@@ -97,5 +111,13 @@
   */
  void SysTick_Set_TIMER(SysTick_RVR_t reload);
  
+ /**
+  * @brief Whether the last clock switch kept the programmed period.
+  *
+  * @return SYSTICK_ERR_RANGE if the period was too long even for HCLK / 8 and was cut
+  *         to the longest one the counter allows
+  */
+ SysTick_Status_t SysTick_Get_Status(void);
+ 
  #endif /* BARE_SYSTICK_H_ */
  
\ No newline at end of file
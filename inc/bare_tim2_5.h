@@ -68,6 +68,33 @@ typedef enum
     TIM2_5_INT_PENDING = 0x01U /*!< Interrupt flag pending */
 } TIM2_5_INTCLEAR_t;
 
+/**
+ * @brief Master mode selection: signal driven onto TRGO (CR2 MMS)
+ */
+typedef enum
+{
+    TIM2_5_TRGO_RESET = 0x00U,         /*!< EGR.UG / slave reset */
+    TIM2_5_TRGO_ENABLE = 0x01U,        /*!< Counter enable (CNT_EN) */
+    TIM2_5_TRGO_UPDATE = 0x02U,        /*!< Update event (one pulse per period) */
+    TIM2_5_TRGO_COMPARE_PULSE = 0x03U, /*!< CC1IF set (capture or compare match) */
+    TIM2_5_TRGO_OC1REF = 0x04U,        /*!< OC1REF level */
+    TIM2_5_TRGO_OC2REF = 0x05U,        /*!< OC2REF level */
+    TIM2_5_TRGO_OC3REF = 0x06U,        /*!< OC3REF level */
+    TIM2_5_TRGO_OC4REF = 0x07U         /*!< OC4REF level */
+} TIM2_5_TRGO_t;
+
+/**
+ * @brief Time base of a timer lent to another driver, see bare_tim2_5_save()
+ */
+typedef struct
+{
+    uint32_t psc;     /*!< PSC */
+    uint32_t arr;     /*!< ARR */
+    uint32_t cr1;     /*!< CR1, counter enable included */
+    uint32_t clk_hz;  /*!< Tracked rate or tick (driver private) */
+    uint8_t clk_mode; /*!< Tracked clock mode (driver private) */
+} TIM2_5_Saved_t;
+
 /*******************************************************************************************
  * API Function Prototypes
  *******************************************************************************************/
@@ -82,6 +109,9 @@ void bare_tim2_5_start(TIM2_5_TypeDef *TIMx);
 /**
  * @brief Set or configure the specified TIM2–TIM5 timer (e.g., prescaler, ARR, PWM mode)
  *
+ * Programs a 1 s update period from the live timer clock through bare_tim2_5_set_rate(),
+ * so it is kept across clock profile switches.
+ *
  * @param TIMx Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
  */
 void bare_tim2_5_set(TIM2_5_TypeDef *TIMx);
@@ -93,4 +123,79 @@ void bare_tim2_5_set(TIM2_5_TypeDef *TIMx);
  */
 void bare_tim2_5_stop(TIM2_5_TypeDef *TIMx);
 
+/**
+ * @brief Enable the timer clock and program PSC/ARR for an update rate
+ *
+ * PSC and ARR are derived from the real APB1 timer clock; the smallest prescaler that
+ * fits ARR in the counter width (16 bits for TIM3/TIM4, 32 bits for TIM2/TIM5) is used
+ * for the best resolution. The counter is not started.
+ *
+ * @param TIMx     Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ * @param rate_hz  Update event frequency in Hz
+ * @return uint32_t Achieved update frequency in Hz
+ */
+uint32_t bare_tim2_5_set_rate(TIM2_5_TypeDef *TIMx, uint32_t rate_hz);
+
+/**
+ * @brief Select the trigger output (TRGO) of a timer
+ *
+ * @param TIMx  Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ * @param mode  Signal routed to TRGO
+ */
+void bare_tim2_5_set_trgo(TIM2_5_TypeDef *TIMx, TIM2_5_TRGO_t mode);
+
+/**
+ * @brief Start the counter only (no NVIC or update interrupt), e.g. as a trigger source
+ *
+ * @param TIMx Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ */
+void bare_tim2_5_enable(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Enable the NVIC interrupt line of a timer
+ *
+ * @param TIMx Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ */
+void bare_tim2_5_enable_interrupt(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Enable the timer clock and set the counter tick (PSC), ARR at full counter width
+ *
+ * @param TIMx     Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ * @param tick_hz  Counter tick frequency in Hz (0 = undivided timer clock)
+ * @return uint32_t Achieved tick frequency in Hz
+ */
+uint32_t bare_tim2_5_set_tick(TIM2_5_TypeDef *TIMx, uint32_t tick_hz);
+
+/**
+ * @brief Route a timer channel to a pin in alternate function mode
+ *
+ * @param TIMx   Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ * @param GPIOx  Pointer to GPIO peripheral
+ * @param pin    GPIO pin number
+ */
+void bare_tim2_5_set_pin(TIM2_5_TypeDef *TIMx, GPIO_TypeDef *GPIOx, GPIO_Pins_t pin);
+
+/**
+ * @brief Save the time base of a timer before running it on a temporary setting
+ *
+ * PSC, ARR and CR1 are saved, and the timer is no longer re-derived on clock profile
+ * switches until bare_tim2_5_restore().
+ *
+ * @param TIMx   Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ * @param saved  Receives the time base
+ */
+void bare_tim2_5_save(TIM2_5_TypeDef *TIMx, TIM2_5_Saved_t *saved);
+
+/**
+ * @brief Restore a time base saved by bare_tim2_5_save()
+ *
+ * PSC is reloaded through UG with the update interrupt held off, which restarts the
+ * counter from 0; CR1 (and with it the counter enable) is then put back.
+ *
+ * @param TIMx   Pointer to timer peripheral (e.g., TIM2, TIM3, etc.)
+ * @param saved  Time base from bare_tim2_5_save()
+ */
+void bare_tim2_5_restore(TIM2_5_TypeDef *TIMx, const TIM2_5_Saved_t *saved);
+
 #endif // BARE_TIM2_5_H_
@@ -0,0 +1,115 @@
+/*******************************************************************************************
+ * @file    bare_timchain.h
+ * @author  ka5j
+ * @brief   TIM2-TIM5 master/slave chaining: cascaded counters and synchronized starts
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    A master drives TRGO (CR2 MMS); a slave picks it up on one of its internal
+ *          trigger inputs (SMCR TS) and reacts according to its slave mode (SMCR SMS).
+ *          Reachable pairs (RM0390 Table 93 and friends):
+ *
+ *            slave TIM2: TIM3, TIM4           slave TIM3: TIM2, TIM4, TIM5
+ *            slave TIM4: TIM2, TIM3           slave TIM5: TIM2, TIM3, TIM4
+ *
+ *          So TIM3 -> TIM2 gives a 48-bit counter, TIM2 -> TIM5 a 64-bit one, and TIM2
+ *          can start every other timer in lock-step.
+ *******************************************************************************************/
+
+#ifndef BARE_TIMCHAIN_H_
+#define BARE_TIMCHAIN_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "tim2_5_registers.h"      // Timer register structures
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Chaining Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief Operation status
+ */
+typedef enum
+{
+    TIMCHAIN_OK = 0x00U,       /*!< Success */
+    TIMCHAIN_ERR_ROUTE = 0x01U /*!< Slave has no internal trigger from that master */
+} TIMCHAIN_Status_t;
+
+/**
+ * @brief What a slave does with its master's trigger
+ */
+typedef enum
+{
+    TIMCHAIN_CLOCK = 0x00U, /*!< Master update clocks the slave (prescaler cascade) */
+    TIMCHAIN_START = 0x01U, /*!< Master counter enable starts the slave */
+    TIMCHAIN_GATE = 0x02U,  /*!< Slave counts while the master counter is enabled */
+    TIMCHAIN_RESET = 0x03U  /*!< Master update resets the slave counter */
+} TIMCHAIN_Link_t;
+
+/**
+ * @brief Two-timer cascaded counter
+ */
+typedef struct
+{
+    TIM2_5_TypeDef *low;  /*!< Ticking timer */
+    TIM2_5_TypeDef *high; /*!< Counts overflows of the low timer */
+    uint8_t low_bits;     /*!< Width of the low counter (16 or 32) */
+    uint32_t tick_hz;     /*!< Achieved tick of the combined counter */
+} TIMCHAIN_Counter_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Connect a slave timer to a master timer
+ *
+ * Programs the master's TRGO and the slave's TS/SMS; neither counter is started.
+ *
+ * @param master  Timer producing TRGO
+ * @param slave   Timer reacting to it
+ * @param link    Slave behaviour
+ * @return TIMCHAIN_Status_t TIMCHAIN_OK or TIMCHAIN_ERR_ROUTE
+ */
+TIMCHAIN_Status_t bare_timchain_link(TIM2_5_TypeDef *master, TIM2_5_TypeDef *slave,
+                                     TIMCHAIN_Link_t link);
+
+/**
+ * @brief Build and start a cascaded free-running counter (48 or 64 bits)
+ *
+ * @param c        Counter object to fill
+ * @param low      Ticking timer
+ * @param high     Overflow counter (TIM2 or TIM5 for the widest range)
+ * @param tick_hz  Requested tick (0 = undivided timer clock)
+ * @return TIMCHAIN_Status_t TIMCHAIN_OK or TIMCHAIN_ERR_ROUTE
+ */
+TIMCHAIN_Status_t bare_timchain_counter_init(TIMCHAIN_Counter_t *c, TIM2_5_TypeDef *low,
+                                             TIM2_5_TypeDef *high, uint32_t tick_hz);
+
+/**
+ * @brief Read the combined counter, safe against a low-counter wrap between the reads
+ *
+ * Callable from any context; no interrupt is involved.
+ *
+ * @param c  Counter object
+ * @return uint64_t Ticks since the counter was started
+ */
+uint64_t bare_timchain_read(const TIMCHAIN_Counter_t *c);
+
+/**
+ * @brief Start several timers on the same timer clock edge
+ *
+ * The slaves are put in trigger mode on the master's counter enable, and the master's
+ * own start is delayed (MSM) to line up with them. All timers must already be
+ * configured (rate, channels) but not running.
+ *
+ * @param master  Timer whose enable starts the others (TIM2 reaches all of them)
+ * @param slaves  Timers to start with it
+ * @param count   Number of slaves
+ * @return TIMCHAIN_Status_t TIMCHAIN_OK, or TIMCHAIN_ERR_ROUTE with nothing started
+ */
+TIMCHAIN_Status_t bare_timchain_sync_start(TIM2_5_TypeDef *master, TIM2_5_TypeDef *const *slaves,
+                                           uint8_t count);
+
+#endif /* BARE_TIMCHAIN_H_ */
@@ -0,0 +1,95 @@
+/*******************************************************************************************
+ * @file    bare_timseq.h
+ * @author  ka5j
+ * @brief   TIM2-TIM5 register frame sequencer using DMA burst (DCR/DMAR)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    A table of frames (for example {ARR, -, CCR1, CCR2, CCR3, CCR4} per step) is
+ *          written by DMA, one whole frame per update event, through the timer's DMAR burst
+ *          window. With ARR and CCR preload enabled the new frame takes effect together at
+ *          the following update, so there is no ISR and no partially updated period.
+ *
+ *          Update DMA requests (RM0390 Table 28, DMA1): TIM2 stream 1 ch3, TIM3 stream 2
+ *          ch5, TIM4 stream 6 ch2, TIM5 stream 0 ch6.
+ *******************************************************************************************/
+
+#ifndef BARE_TIMSEQ_H_
+#define BARE_TIMSEQ_H_
+
+#include "stm32f446re_addresses.h" // Include low-level register definitions
+#include "tim2_5_registers.h"      // Timer register structures
+#include <stdint.h>                // Include standard integer types
+
+/*******************************************************************************************
+ * Sequencer Enumerations and Types
+ *******************************************************************************************/
+
+/**
+ * @brief First register of a frame (DCR DBA: word offset in TIM2_5_TypeDef)
+ *
+ * Frames cover consecutive registers. Offset 0x30 (RCR) is reserved on TIM2-TIM5 and
+ * ignores writes, so a frame from ARR to CCR4 has a padding word in second position.
+ */
+typedef enum
+{
+    TIMSEQ_REG_PSC = 10U,  /*!< Prescaler */
+    TIMSEQ_REG_ARR = 11U,  /*!< Auto-reload */
+    TIMSEQ_REG_RCR = 12U,  /*!< Reserved slot (padding) */
+    TIMSEQ_REG_CCR1 = 13U, /*!< Compare 1 */
+    TIMSEQ_REG_CCR2 = 14U, /*!< Compare 2 */
+    TIMSEQ_REG_CCR3 = 15U, /*!< Compare 3 */
+    TIMSEQ_REG_CCR4 = 16U  /*!< Compare 4 */
+} TIMSEQ_Reg_t;
+
+/**
+ * @brief Completion callback of a one-shot sequence, executed in DMA interrupt context
+ */
+typedef void (*TIMSEQ_Callback_t)(void *ctx);
+
+/**
+ * @brief Sequence description
+ */
+typedef struct
+{
+    TIMSEQ_Reg_t first;      /*!< First register of each frame */
+    uint8_t regs;            /*!< Registers per frame (1-18) */
+    const uint32_t *table;   /*!< frames * regs words, frame after frame */
+    uint16_t frames;         /*!< Number of frames */
+    uint8_t loop;            /*!< 1 = repeat forever (circular DMA) */
+    TIMSEQ_Callback_t done;  /*!< Called after the last frame is written (one-shot only) */
+    void *ctx;               /*!< Callback context */
+} TIMSEQ_Config_t;
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Start writing frames on each update event of a running (or about to run) timer
+ *
+ * Enables ARR preload, and CCR preload on the output channels whose CCRx the frames
+ * write; input capture channels keep their CCMR setting. Frame 0 is written at the first
+ * update after this call and takes effect at the update after that.
+ *
+ * @param TIMx  Pointer to timer peripheral (TIM2-TIM5)
+ * @param cfg   Sequence (table must stay valid while running)
+ */
+void bare_timseq_start(TIM2_5_TypeDef *TIMx, const TIMSEQ_Config_t *cfg);
+
+/**
+ * @brief Stop the sequence; registers keep the last frame written
+ *
+ * @param TIMx  Pointer to timer peripheral
+ */
+void bare_timseq_stop(TIM2_5_TypeDef *TIMx);
+
+/**
+ * @brief Index of the frame being written next
+ *
+ * @param TIMx  Pointer to timer peripheral
+ * @return uint16_t Frame index (frames when a one-shot sequence has finished)
+ */
+uint16_t bare_timseq_position(TIM2_5_TypeDef *TIMx);
+
+#endif /* BARE_TIMSEQ_H_ */
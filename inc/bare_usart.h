@@ -17,6 +17,20 @@
 #include "rcc_registers.h"         // Include RCC definitions for USART clock enable
 #include <stdint.h>                // Include standard integer types
 
+/*******************************************************************************************
+ * USART Configuration
+ *******************************************************************************************/
+#define USART_TX_RING_SIZE 256U /*!< Interrupt-driven transmit ring (power of 2) */
+
+/*******************************************************************************************
+ * USART Types
+ *******************************************************************************************/
+
+/**
+ * @brief Receive callback, executed in USART2 interrupt context for every byte
+ */
+typedef void (*USART_RxCallback_t)(uint8_t byte);
+
 /*******************************************************************************************
  * API Function Prototypes
  *******************************************************************************************/
@@ -43,6 +57,39 @@ void bare_usart_send_char(char c);
  */
 void bare_usart_send_string(const char *str);
 
+/**
+ * @brief Queue bytes for interrupt-driven transmission without waiting
+ *
+ * @param data Bytes to send
+ * @param len  Number of bytes
+ * @return uint16_t Bytes queued (less than len when the ring is full)
+ */
+uint16_t bare_usart_write(const void *data, uint16_t len);
+
+/**
+ * @brief Free space in the transmit ring
+ *
+ * @return uint16_t Bytes bare_usart_write() can accept right now
+ */
+uint16_t bare_usart_tx_free(void);
+
+/**
+ * @brief Change the baud rate (follows clock profile switches like the default rate)
+ *
+ * Waits for the frame in progress to leave. Also usable before bare_usart_init().
+ *
+ * @param baud Rate in bit/s as measured by the local clock (see bare_clkcal_autobaud())
+ * @return uint32_t Rate actually programmed (PCLK1 / BRR), 0 if out of range
+ */
+uint32_t bare_usart_set_baud(uint32_t baud);
+
+/**
+ * @brief Configured baud rate
+ *
+ * @return uint32_t Rate set by bare_usart_set_baud(), 115200 by default
+ */
+uint32_t bare_usart_get_baud(void);
+
 /**
  * @brief Read a single character from USART
  *
@@ -50,4 +97,11 @@ void bare_usart_send_string(const char *str);
  */
 char bare_usart_read_char(void);
 
+/**
+ * @brief Switch reception to interrupt mode and deliver each byte to a callback
+ *
+ * @param cb Callback run from the USART2 interrupt (NULL to return to polling)
+ */
+void bare_usart_set_rx_callback(USART_RxCallback_t cb);
+
 #endif /* BARE_USART_H_ */
@@ -0,0 +1,104 @@
+/*******************************************************************************************
+ * @file    bare_util.h
+ * @author  ka5j
+ * @brief   Small helpers shared by the drivers: critical sections, barrier, decimal output
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The inline assembly is only emitted for ARM targets, so drivers that use these
+ *          helpers still compile into host tests (where the critical section is a no-op).
+ *******************************************************************************************/
+
+#ifndef BARE_UTIL_H_
+#define BARE_UTIL_H_
+
+#include <stdint.h> // Include standard integer types
+
+/*******************************************************************************************
+ * Utility Configuration
+ *******************************************************************************************/
+#define BARE_U32_CHARS 11U /*!< Buffer for bare_fmt_u32(): 10 digits and the terminator */
+
+/*******************************************************************************************
+ * Compiler Barrier
+ *******************************************************************************************/
+
+/** Keep the compiler from moving memory accesses across this point */
+#define BARE_BARRIER() __asm volatile("" ::: "memory")
+
+/*******************************************************************************************
+ * Critical Sections
+ *******************************************************************************************/
+
+/**
+ * @brief Disable interrupts
+ *
+ * @return uint32_t Previous PRIMASK, for bare_irq_restore()
+ */
+static inline uint32_t bare_irq_save(void)
+{
+    uint32_t primask = 0U;
+
+#if defined(__arm__)
+    __asm volatile("mrs %0, primask\n cpsid i" : "=r"(primask)::"memory");
+#endif
+    return primask;
+}
+
+/**
+ * @brief Restore the interrupt state saved by bare_irq_save()
+ *
+ * @param primask  Value returned by bare_irq_save()
+ */
+static inline void bare_irq_restore(uint32_t primask)
+{
+#if defined(__arm__)
+    __asm volatile("msr primask, %0" ::"r"(primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+
+/*******************************************************************************************
+ * Decimal Formatting
+ *******************************************************************************************/
+
+/**
+ * @brief Format an unsigned decimal number
+ *
+ * @param buf  At least BARE_U32_CHARS bytes
+ * @param v    Value
+ * @return char* Start of the NUL-terminated digits inside buf
+ */
+static inline char *bare_fmt_u32(char *buf, uint32_t v)
+{
+    char *p = &buf[BARE_U32_CHARS - 1U];
+
+    *p = '\0';
+    do
+    {
+        *--p = (char)('0' + (v % 10U));
+        v /= 10U;
+    } while (v != 0U);
+    return p;
+}
+
+/*******************************************************************************************
+ * API Function Prototypes
+ *******************************************************************************************/
+
+/**
+ * @brief Write an unsigned decimal number over USART2 (blocking)
+ *
+ * @param v    Value
+ */
+void bare_print_u32(uint32_t v);
+
+/**
+ * @brief Write a signed decimal number over USART2 (blocking)
+ *
+ * @param v    Value
+ */
+void bare_print_i32(int32_t v);
+
+#endif /* BARE_UTIL_H_ */
@@ -0,0 +1,30 @@
+/*******************************************************************************************
+ * @file    board_config.h
+ * @author  ka5j
+ * @brief   STM32F446RE Nucleo board-level configuration
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Oscillator frequencies that cannot be read back from the silicon. Override on
+ *          the compiler command line for custom boards.
+ *******************************************************************************************/
+
+#ifndef BOARD_CONFIG_H_
+#define BOARD_CONFIG_H_
+
+/*******************************************************************************************
+ * Oscillator Frequencies
+ *******************************************************************************************/
+#ifndef HSI_VALUE
+#define HSI_VALUE 16000000UL /*!< Internal high-speed RC oscillator (Hz) */
+#endif
+
+#ifndef HSE_VALUE
+#define HSE_VALUE 8000000UL /*!< HSE bypass from the ST-LINK MCO on Nucleo-64 (Hz) */
+#endif
+
+#ifndef LSE_VALUE
+#define LSE_VALUE 32768UL /*!< Low-speed external crystal (Hz) */
+#endif
+
+#endif /* BOARD_CONFIG_H_ */
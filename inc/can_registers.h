@@ -0,0 +1,125 @@
+/*******************************************************************************************
+ * @file    can_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE bxCAN Device Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for CAN1 and CAN2.
+ *          The 28 filter banks are shared and only exist in the CAN1 register block.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef CAN_REGISTERS_H_
+#define CAN_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * CAN Base Addresses
+ *******************************************************************************************/
+#define CAN1_BASE (APB1PERIPH_BASE + 0x6400UL)
+#define CAN2_BASE (APB1PERIPH_BASE + 0x6800UL)
+
+/*******************************************************************************************
+ * CAN Register Definition (RM0390, Section 30.9)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t TIR;  /*!< TX mailbox identifier register */
+    volatile uint32_t TDTR; /*!< TX mailbox data length control and time stamp register */
+    volatile uint32_t TDLR; /*!< TX mailbox data low register */
+    volatile uint32_t TDHR; /*!< TX mailbox data high register */
+} CAN_TxMailBox_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t RIR;  /*!< RX FIFO mailbox identifier register */
+    volatile uint32_t RDTR; /*!< RX FIFO mailbox data length control and time stamp register */
+    volatile uint32_t RDLR; /*!< RX FIFO mailbox data low register */
+    volatile uint32_t RDHR; /*!< RX FIFO mailbox data high register */
+} CAN_FIFOMailBox_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t FR1; /*!< Filter bank register 1 */
+    volatile uint32_t FR2; /*!< Filter bank register 2 */
+} CAN_FilterRegister_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t MCR;                         /*!< Master control          (0x000) */
+    volatile uint32_t MSR;                         /*!< Master status           (0x004) */
+    volatile uint32_t TSR;                         /*!< Transmit status         (0x008) */
+    volatile uint32_t RF0R;                        /*!< Receive FIFO 0          (0x00C) */
+    volatile uint32_t RF1R;                        /*!< Receive FIFO 1          (0x010) */
+    volatile uint32_t IER;                         /*!< Interrupt enable        (0x014) */
+    volatile uint32_t ESR;                         /*!< Error status            (0x018) */
+    volatile uint32_t BTR;                         /*!< Bit timing              (0x01C) */
+    uint32_t RESERVED0[88];                        /*!< 0x020 - 0x17F */
+    CAN_TxMailBox_TypeDef sTxMailBox[3];           /*!< TX mailboxes            (0x180) */
+    CAN_FIFOMailBox_TypeDef sFIFOMailBox[2];       /*!< RX FIFO output mailboxes (0x1B0) */
+    uint32_t RESERVED1[12];                        /*!< 0x1D0 - 0x1FF */
+    volatile uint32_t FMR;                         /*!< Filter master           (0x200) */
+    volatile uint32_t FM1R;                        /*!< Filter mode             (0x204) */
+    uint32_t RESERVED2;                            /*!< 0x208 */
+    volatile uint32_t FS1R;                        /*!< Filter scale            (0x20C) */
+    uint32_t RESERVED3;                            /*!< 0x210 */
+    volatile uint32_t FFA1R;                       /*!< Filter FIFO assignment  (0x214) */
+    uint32_t RESERVED4;                            /*!< 0x218 */
+    volatile uint32_t FA1R;                        /*!< Filter activation       (0x21C) */
+    uint32_t RESERVED5[8];                         /*!< 0x220 - 0x23F */
+    CAN_FilterRegister_TypeDef sFilterRegister[28]; /*!< Filter banks           (0x240) */
+} CAN_TypeDef;
+
+/*******************************************************************************************
+ * CAN Register Bits
+ *******************************************************************************************/
+#define CAN_MCR_INRQ (1UL << 0)  /*!< Initialization request */
+#define CAN_MCR_SLEEP (1UL << 1) /*!< Sleep mode request */
+#define CAN_MCR_TXFP (1UL << 2)  /*!< TX priority by request order (0: by identifier) */
+#define CAN_MCR_ABOM (1UL << 6)  /*!< Automatic bus-off management */
+#define CAN_MCR_DBF (1UL << 16)  /*!< Freeze during debug */
+
+#define CAN_MSR_INAK (1UL << 0) /*!< Initialization acknowledge */
+#define CAN_MSR_SLAK (1UL << 1) /*!< Sleep acknowledge */
+
+#define CAN_TSR_RQCP(mb) (1UL << ((mb) * 8U))        /*!< Request completed */
+#define CAN_TSR_TXOK(mb) (1UL << (((mb) * 8U) + 1U)) /*!< Transmission OK */
+#define CAN_TSR_ABRQ(mb) (1UL << (((mb) * 8U) + 7U)) /*!< Abort request */
+#define CAN_TSR_TME(mb) (1UL << (26U + (mb)))        /*!< Mailbox empty */
+
+#define CAN_RFR_FMP_Msk 0x3UL    /*!< FIFO message pending count */
+#define CAN_RFR_FULL (1UL << 3)  /*!< FIFO full */
+#define CAN_RFR_FOVR (1UL << 4)  /*!< FIFO overrun */
+#define CAN_RFR_RFOM (1UL << 5)  /*!< Release output mailbox */
+
+#define CAN_IER_TMEIE (1UL << 0)  /*!< TX mailbox empty */
+#define CAN_IER_FMPIE0 (1UL << 1) /*!< FIFO 0 message pending */
+#define CAN_IER_FOVIE0 (1UL << 3) /*!< FIFO 0 overrun */
+#define CAN_IER_FMPIE1 (1UL << 4) /*!< FIFO 1 message pending */
+#define CAN_IER_FOVIE1 (1UL << 6) /*!< FIFO 1 overrun */
+
+#define CAN_BTR_TS1_Pos 16U      /*!< Time segment 1 (tq - 1) */
+#define CAN_BTR_TS2_Pos 20U      /*!< Time segment 2 (tq - 1) */
+#define CAN_BTR_SJW_Pos 24U      /*!< Resynchronization jump width (tq - 1) */
+#define CAN_BTR_LBKM (1UL << 30) /*!< Loop back mode */
+#define CAN_BTR_SILM (1UL << 31) /*!< Silent mode */
+
+#define CAN_TIR_TXRQ (1UL << 0) /*!< Transmit request */
+#define CAN_RIR_RTR (1UL << 1)  /*!< Remote frame (same bit in TIR) */
+#define CAN_RIR_IDE (1UL << 2)  /*!< Extended identifier (same bit in TIR) */
+#define CAN_RIR_EXID_Pos 3U     /*!< Extended identifier */
+#define CAN_RIR_STID_Pos 21U    /*!< Standard identifier */
+
+#define CAN_FMR_FINIT (1UL << 0) /*!< Filter initialization mode */
+#define CAN_FMR_CAN2SB_Pos 8U    /*!< First bank assigned to CAN2 */
+
+/*******************************************************************************************
+ * CAN Peripheral Definitions
+ *******************************************************************************************/
+#define CAN1 ((CAN_TypeDef *)CAN1_BASE)
+#define CAN2 ((CAN_TypeDef *)CAN2_BASE)
+
+#endif /* CAN_REGISTERS_H_ */
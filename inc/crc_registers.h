@@ -0,0 +1,41 @@
+/*******************************************************************************************
+ * @file    crc_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE CRC Calculation Unit Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for the CRC peripheral.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef CRC_REGISTERS_H_
+#define CRC_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * CRC Base Address
+ * Located on the AHB1 peripheral bus
+ *******************************************************************************************/
+#define CRC_BASE (AHB1PERIPH_BASE + 0x3000UL)
+
+/*******************************************************************************************
+ * CRC Register Definition (RM0390, Section 4.4)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t DR;  /*!< Data register (write: feed word, read: result) (offset 0x00) */
+    volatile uint32_t IDR; /*!< Independent data register (8-bit scratch)       (offset 0x04) */
+    volatile uint32_t CR;  /*!< Control register                                (offset 0x08) */
+} CRC_TypeDef;
+
+#define CRC_CR_RESET (1UL << 0) /*!< Reset the CRC unit (DR = 0xFFFFFFFF) */
+
+/*******************************************************************************************
+ * CRC Peripheral Pointer
+ *******************************************************************************************/
+#define CRC ((CRC_TypeDef *)CRC_BASE)
+
+#endif /* CRC_REGISTERS_H_ */
@@ -0,0 +1,67 @@
+/*******************************************************************************************
+ * @file    dac_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE DAC Device Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for the dual-channel DAC.
+ *          Channel 2 control bits are the channel 1 bits shifted left by 16.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef DAC_REGISTERS_H_
+#define DAC_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * DAC Base Address
+ *******************************************************************************************/
+#define DAC_BASE (APB1PERIPH_BASE + 0x7400UL)
+
+/*******************************************************************************************
+ * DAC Register Definition (RM0390, Section 15.5)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t CR;      /*!< Control register                          (offset 0x00) */
+    volatile uint32_t SWTRIGR; /*!< Software trigger register                 (offset 0x04) */
+    volatile uint32_t DHR12R1; /*!< Channel 1 12-bit right-aligned data       (offset 0x08) */
+    volatile uint32_t DHR12L1; /*!< Channel 1 12-bit left-aligned data        (offset 0x0C) */
+    volatile uint32_t DHR8R1;  /*!< Channel 1 8-bit right-aligned data        (offset 0x10) */
+    volatile uint32_t DHR12R2; /*!< Channel 2 12-bit right-aligned data       (offset 0x14) */
+    volatile uint32_t DHR12L2; /*!< Channel 2 12-bit left-aligned data        (offset 0x18) */
+    volatile uint32_t DHR8R2;  /*!< Channel 2 8-bit right-aligned data        (offset 0x1C) */
+    volatile uint32_t DHR12RD; /*!< Dual 12-bit right-aligned data            (offset 0x20) */
+    volatile uint32_t DHR12LD; /*!< Dual 12-bit left-aligned data             (offset 0x24) */
+    volatile uint32_t DHR8RD;  /*!< Dual 8-bit right-aligned data             (offset 0x28) */
+    volatile uint32_t DOR1;    /*!< Channel 1 data output                     (offset 0x2C) */
+    volatile uint32_t DOR2;    /*!< Channel 2 data output                     (offset 0x30) */
+    volatile uint32_t SR;      /*!< Status register                           (offset 0x34) */
+} DAC_TypeDef;
+
+/*******************************************************************************************
+ * DAC Register Bits (channel 1, shift by DAC_CH2_SHIFT for channel 2)
+ *******************************************************************************************/
+#define DAC_CH2_SHIFT 16U
+
+#define DAC_CR_EN (1UL << 0)        /*!< Channel enable */
+#define DAC_CR_BOFF (1UL << 1)      /*!< Output buffer disable */
+#define DAC_CR_TEN (1UL << 2)       /*!< Trigger enable */
+#define DAC_CR_TSEL_Pos 3U          /*!< Trigger selection */
+#define DAC_CR_WAVE_Pos 6U          /*!< Noise / triangle generation */
+#define DAC_CR_MAMP_Pos 8U          /*!< LFSR mask / triangle amplitude */
+#define DAC_CR_DMAEN (1UL << 12)    /*!< DMA enable */
+#define DAC_CR_DMAUDRIE (1UL << 13) /*!< DMA underrun interrupt enable */
+#define DAC_CR_CH_Msk 0xFFFFUL      /*!< All control bits of one channel */
+
+#define DAC_SR_DMAUDR (1UL << 13)   /*!< DMA underrun */
+
+/*******************************************************************************************
+ * DAC Peripheral Definition
+ *******************************************************************************************/
+#define DAC ((DAC_TypeDef *)DAC_BASE)
+
+#endif /* DAC_REGISTERS_H_ */
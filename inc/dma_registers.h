@@ -0,0 +1,113 @@
+/*******************************************************************************************
+ * @file    dma_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE DMA1/DMA2 Device Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for the DMA controllers.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef DMA_REGISTERS_H_
+#define DMA_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * DMA Base Addresses (RM0390, Section 2.2.2)
+ *******************************************************************************************/
+#define DMA1_BASE (AHB1PERIPH_BASE + 0x6000UL)
+#define DMA2_BASE (AHB1PERIPH_BASE + 0x6400UL)
+
+#define DMA_STREAM_OFFSET 0x10UL /*!< Offset of stream 0 from controller base */
+#define DMA_STREAM_STRIDE 0x18UL /*!< Size of one stream register block */
+
+#define DMA_STREAM_BASE(ctrl, n) ((ctrl) + DMA_STREAM_OFFSET + (DMA_STREAM_STRIDE * (n)))
+
+/*******************************************************************************************
+ * DMA Register Definitions
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t LISR;  /*!< Low interrupt status register        (offset 0x00) */
+    volatile uint32_t HISR;  /*!< High interrupt status register       (offset 0x04) */
+    volatile uint32_t LIFCR; /*!< Low interrupt flag clear register    (offset 0x08) */
+    volatile uint32_t HIFCR; /*!< High interrupt flag clear register   (offset 0x0C) */
+} DMA_TypeDef;
+
+typedef struct
+{
+    volatile uint32_t CR;   /*!< Stream configuration register         (offset 0x00) */
+    volatile uint32_t NDTR; /*!< Stream number of data register        (offset 0x04) */
+    volatile uint32_t PAR;  /*!< Stream peripheral address register    (offset 0x08) */
+    volatile uint32_t M0AR; /*!< Stream memory 0 address register      (offset 0x0C) */
+    volatile uint32_t M1AR; /*!< Stream memory 1 address register      (offset 0x10) */
+    volatile uint32_t FCR;  /*!< Stream FIFO control register          (offset 0x14) */
+} DMA_Stream_TypeDef;
+
+/*******************************************************************************************
+ * DMA Stream Configuration Register (SxCR) Bits
+ *******************************************************************************************/
+#define DMA_SxCR_EN (1UL << 0)       /*!< Stream enable */
+#define DMA_SxCR_DMEIE (1UL << 1)    /*!< Direct mode error interrupt enable */
+#define DMA_SxCR_TEIE (1UL << 2)     /*!< Transfer error interrupt enable */
+#define DMA_SxCR_HTIE (1UL << 3)     /*!< Half transfer interrupt enable */
+#define DMA_SxCR_TCIE (1UL << 4)     /*!< Transfer complete interrupt enable */
+#define DMA_SxCR_PFCTRL (1UL << 5)   /*!< Peripheral flow controller */
+#define DMA_SxCR_DIR_Pos 6U          /*!< Data transfer direction */
+#define DMA_SxCR_CIRC (1UL << 8)     /*!< Circular mode */
+#define DMA_SxCR_PINC (1UL << 9)     /*!< Peripheral increment mode */
+#define DMA_SxCR_MINC (1UL << 10)    /*!< Memory increment mode */
+#define DMA_SxCR_PSIZE_Pos 11U       /*!< Peripheral data size */
+#define DMA_SxCR_MSIZE_Pos 13U       /*!< Memory data size */
+#define DMA_SxCR_PL_Pos 16U          /*!< Priority level */
+#define DMA_SxCR_DBM (1UL << 18)     /*!< Double buffer mode */
+#define DMA_SxCR_CT (1UL << 19)      /*!< Current target (double buffer mode) */
+#define DMA_SxCR_PBURST_Pos 21U      /*!< Peripheral burst transfer configuration */
+#define DMA_SxCR_MBURST_Pos 23U      /*!< Memory burst transfer configuration */
+#define DMA_SxCR_CHSEL_Pos 25U       /*!< Channel selection */
+
+/*******************************************************************************************
+ * DMA Stream FIFO Control Register (SxFCR) Bits
+ *******************************************************************************************/
+#define DMA_SxFCR_FTH_Pos 0U         /*!< FIFO threshold selection */
+#define DMA_SxFCR_DMDIS (1UL << 2)   /*!< Direct mode disable */
+#define DMA_SxFCR_FEIE (1UL << 7)    /*!< FIFO error interrupt enable */
+
+/*******************************************************************************************
+ * DMA Interrupt Status Flags (relative to a stream's flag group in LISR/HISR)
+ *******************************************************************************************/
+#define DMA_FLAG_FEIF (1UL << 0)  /*!< FIFO error */
+#define DMA_FLAG_DMEIF (1UL << 2) /*!< Direct mode error */
+#define DMA_FLAG_TEIF (1UL << 3)  /*!< Transfer error */
+#define DMA_FLAG_HTIF (1UL << 4)  /*!< Half transfer */
+#define DMA_FLAG_TCIF (1UL << 5)  /*!< Transfer complete */
+#define DMA_FLAG_ALL (0x3DUL)     /*!< All flags of one stream */
+
+/*******************************************************************************************
+ * DMA Peripheral Definitions
+ *******************************************************************************************/
+#define DMA1 ((DMA_TypeDef *)DMA1_BASE)
+#define DMA2 ((DMA_TypeDef *)DMA2_BASE)
+
+#define DMA1_Stream0 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 0))
+#define DMA1_Stream1 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 1))
+#define DMA1_Stream2 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 2))
+#define DMA1_Stream3 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 3))
+#define DMA1_Stream4 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 4))
+#define DMA1_Stream5 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 5))
+#define DMA1_Stream6 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 6))
+#define DMA1_Stream7 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA1_BASE, 7))
+
+#define DMA2_Stream0 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 0))
+#define DMA2_Stream1 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 1))
+#define DMA2_Stream2 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 2))
+#define DMA2_Stream3 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 3))
+#define DMA2_Stream4 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 4))
+#define DMA2_Stream5 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 5))
+#define DMA2_Stream6 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 6))
+#define DMA2_Stream7 ((DMA_Stream_TypeDef *)DMA_STREAM_BASE(DMA2_BASE, 7))
+
+#endif /* DMA_REGISTERS_H_ */
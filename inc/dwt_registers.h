@@ -0,0 +1,49 @@
+/*******************************************************************************************
+ * @file    dwt_registers.h
+ * @author  ka5j
+ * @brief   Cortex-M4 DWT (Data Watchpoint and Trace) Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    This file defines memory-mapped register access for the DWT cycle/event
+ *          counters and the CoreDebug DEMCR register that gates them.
+ *          Assumes 32-bit ARM Cortex-M4 platform with no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef DWT_REGISTERS_H_
+#define DWT_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h" // Must define CORTEX_M4_PERIPH_BASE
+
+/*******************************************************************************************
+ * DWT / CoreDebug Base Addresses (ARMv7-M Architecture Reference Manual, C1.8)
+ *******************************************************************************************/
+#define DWT_BASE (CORTEX_M4_PERIPH_BASE + 0x1000UL)
+#define DEMCR_ADDR (CORTEX_M4_PERIPH_BASE + 0xEDFCUL)
+
+/*******************************************************************************************
+ * DWT Register Structure
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t CTRL;     /*!< Control register                      (offset 0x00) */
+    volatile uint32_t CYCCNT;   /*!< Cycle count register                  (offset 0x04) */
+    volatile uint32_t CPICNT;   /*!< Extra cycles per instruction count    (offset 0x08) */
+    volatile uint32_t EXCCNT;   /*!< Exception overhead count              (offset 0x0C) */
+    volatile uint32_t SLEEPCNT; /*!< Sleep count                           (offset 0x10) */
+    volatile uint32_t LSUCNT;   /*!< Load-store unit count                 (offset 0x14) */
+    volatile uint32_t FOLDCNT;  /*!< Folded instruction count              (offset 0x18) */
+    const volatile uint32_t PCSR; /*!< Program counter sample register     (offset 0x1C) */
+} DWT_TypeDef;
+
+#define DWT_CTRL_CYCCNTENA (1UL << 0) /*!< Enable CYCCNT */
+#define DEMCR_TRCENA (1UL << 24)      /*!< Enable DWT and ITM */
+
+/*******************************************************************************************
+ * DWT Peripheral Pointers
+ *******************************************************************************************/
+#define DWT ((DWT_TypeDef *)DWT_BASE)
+#define DEMCR (*(volatile uint32_t *)DEMCR_ADDR)
+
+#endif /* DWT_REGISTERS_H_ */
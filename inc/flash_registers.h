@@ -0,0 +1,79 @@
+/*******************************************************************************************
+ * @file    flash_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE Flash Interface Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for the embedded flash interface
+ *          (access control, program/erase control and option bytes).
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef FLASH_REGISTERS_H_
+#define FLASH_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * Flash Interface Base Address
+ *******************************************************************************************/
+#define FLASH_R_BASE (AHB1PERIPH_BASE + 0x3C00UL)
+#define FLASH_MEM_BASE 0x08000000UL /*!< Main memory, sector 0 */
+
+/*******************************************************************************************
+ * Flash Interface Register Definition (RM0390, Section 3.8)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t ACR;     /*!< Access control register                   (offset 0x00) */
+    volatile uint32_t KEYR;    /*!< Key register                              (offset 0x04) */
+    volatile uint32_t OPTKEYR; /*!< Option key register                       (offset 0x08) */
+    volatile uint32_t SR;      /*!< Status register                           (offset 0x0C) */
+    volatile uint32_t CR;      /*!< Control register                          (offset 0x10) */
+    volatile uint32_t OPTCR;   /*!< Option control register                   (offset 0x14) */
+} FLASH_TypeDef;
+
+/*******************************************************************************************
+ * Flash Interface Register Bits
+ *******************************************************************************************/
+#define FLASH_ACR_LATENCY_Msk (0xFUL << 0) /*!< Wait states */
+#define FLASH_ACR_PRFTEN (1UL << 8)        /*!< Prefetch enable */
+#define FLASH_ACR_ICEN (1UL << 9)          /*!< Instruction cache enable */
+#define FLASH_ACR_DCEN (1UL << 10)         /*!< Data cache enable */
+#define FLASH_ACR_ICRST (1UL << 11)        /*!< Instruction cache reset */
+#define FLASH_ACR_DCRST (1UL << 12)        /*!< Data cache reset */
+
+#define FLASH_KEY1 0x45670123UL            /*!< First KEYR unlock word */
+#define FLASH_KEY2 0xCDEF89ABUL            /*!< Second KEYR unlock word */
+
+#define FLASH_SR_EOP (1UL << 0)            /*!< End of operation (EOPIE set) */
+#define FLASH_SR_OPERR (1UL << 1)          /*!< Operation error */
+#define FLASH_SR_WRPERR (1UL << 4)         /*!< Write protection error */
+#define FLASH_SR_PGAERR (1UL << 5)         /*!< Programming alignment error */
+#define FLASH_SR_PGPERR (1UL << 6)         /*!< Programming parallelism error */
+#define FLASH_SR_PGSERR (1UL << 7)         /*!< Programming sequence error */
+#define FLASH_SR_RDERR (1UL << 8)          /*!< PCROP read error */
+#define FLASH_SR_BSY (1UL << 16)           /*!< Operation in progress */
+#define FLASH_SR_ERRORS (FLASH_SR_OPERR | FLASH_SR_WRPERR | FLASH_SR_PGAERR | \
+                         FLASH_SR_PGPERR | FLASH_SR_PGSERR | FLASH_SR_RDERR)
+
+#define FLASH_CR_PG (1UL << 0)             /*!< Programming */
+#define FLASH_CR_SER (1UL << 1)            /*!< Sector erase */
+#define FLASH_CR_MER (1UL << 2)            /*!< Mass erase */
+#define FLASH_CR_SNB_Pos 3U                /*!< Sector number */
+#define FLASH_CR_SNB_Msk (0xFUL << 3)
+#define FLASH_CR_PSIZE_Msk (0x3UL << 8)    /*!< Program size */
+#define FLASH_CR_PSIZE_X32 (0x2UL << 8)    /*!< 32-bit parallelism (VDD 2.7-3.6 V) */
+#define FLASH_CR_STRT (1UL << 16)          /*!< Start erase */
+#define FLASH_CR_EOPIE (1UL << 24)         /*!< End of operation interrupt enable */
+#define FLASH_CR_ERRIE (1UL << 25)         /*!< Error interrupt enable */
+#define FLASH_CR_LOCK (1UL << 31)          /*!< CR locked until the key sequence */
+
+/*******************************************************************************************
+ * Flash Interface Peripheral Definition
+ *******************************************************************************************/
+#define FLASH ((FLASH_TypeDef *)FLASH_R_BASE)
+
+#endif /* FLASH_REGISTERS_H_ */
@@ -0,0 +1,85 @@
+/*******************************************************************************************
+ * @file    i2c_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE I2C Device Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for I2C1-I2C3.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef I2C_REGISTERS_H_
+#define I2C_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * I2C Base Addresses
+ *******************************************************************************************/
+#define I2C1_BASE (APB1PERIPH_BASE + 0x5400UL)
+#define I2C2_BASE (APB1PERIPH_BASE + 0x5800UL)
+#define I2C3_BASE (APB1PERIPH_BASE + 0x5C00UL)
+
+/*******************************************************************************************
+ * I2C Register Definition (RM0390, Section 27.6)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t CR1;   /*!< Control register 1                      (offset 0x00) */
+    volatile uint32_t CR2;   /*!< Control register 2                      (offset 0x04) */
+    volatile uint32_t OAR1;  /*!< Own address register 1                  (offset 0x08) */
+    volatile uint32_t OAR2;  /*!< Own address register 2                  (offset 0x0C) */
+    volatile uint32_t DR;    /*!< Data register                           (offset 0x10) */
+    volatile uint32_t SR1;   /*!< Status register 1                       (offset 0x14) */
+    volatile uint32_t SR2;   /*!< Status register 2                       (offset 0x18) */
+    volatile uint32_t CCR;   /*!< Clock control register                  (offset 0x1C) */
+    volatile uint32_t TRISE; /*!< Rise time register                      (offset 0x20) */
+    volatile uint32_t FLTR;  /*!< Noise filter register                   (offset 0x24) */
+} I2C_TypeDef;
+
+/*******************************************************************************************
+ * I2C Register Bits
+ *******************************************************************************************/
+#define I2C_CR1_PE (1UL << 0)     /*!< Peripheral enable */
+#define I2C_CR1_START (1UL << 8)  /*!< Start generation */
+#define I2C_CR1_STOP (1UL << 9)   /*!< Stop generation */
+#define I2C_CR1_ACK (1UL << 10)   /*!< Acknowledge enable */
+#define I2C_CR1_POS (1UL << 11)   /*!< ACK applies to the next byte */
+#define I2C_CR1_SWRST (1UL << 15) /*!< Software reset */
+
+#define I2C_CR2_FREQ_Msk 0x3FUL     /*!< Peripheral clock in MHz */
+#define I2C_CR2_ITERREN (1UL << 8)  /*!< Error interrupt enable */
+#define I2C_CR2_ITEVTEN (1UL << 9)  /*!< Event interrupt enable */
+#define I2C_CR2_ITBUFEN (1UL << 10) /*!< Buffer (TXE/RXNE) interrupt enable */
+#define I2C_CR2_DMAEN (1UL << 11)   /*!< DMA requests enable */
+#define I2C_CR2_LAST (1UL << 12)    /*!< Next DMA EOT is the last transfer (NACK) */
+
+#define I2C_SR1_SB (1UL << 0)       /*!< Start bit generated */
+#define I2C_SR1_ADDR (1UL << 1)     /*!< Address sent */
+#define I2C_SR1_BTF (1UL << 2)      /*!< Byte transfer finished */
+#define I2C_SR1_STOPF (1UL << 4)    /*!< Stop detected (slave) */
+#define I2C_SR1_RXNE (1UL << 6)     /*!< Data register not empty */
+#define I2C_SR1_TXE (1UL << 7)      /*!< Data register empty */
+#define I2C_SR1_BERR (1UL << 8)     /*!< Bus error */
+#define I2C_SR1_ARLO (1UL << 9)     /*!< Arbitration lost */
+#define I2C_SR1_AF (1UL << 10)      /*!< Acknowledge failure */
+#define I2C_SR1_OVR (1UL << 11)     /*!< Overrun / underrun */
+#define I2C_SR1_TIMEOUT (1UL << 14) /*!< SCL low timeout */
+
+#define I2C_SR2_MSL (1UL << 0)  /*!< Master mode */
+#define I2C_SR2_BUSY (1UL << 1) /*!< Bus busy */
+#define I2C_SR2_TRA (1UL << 2)  /*!< Transmitter */
+
+#define I2C_CCR_DUTY (1UL << 14) /*!< Fast mode duty cycle 16/9 */
+#define I2C_CCR_FS (1UL << 15)   /*!< Fast mode */
+
+/*******************************************************************************************
+ * I2C Peripheral Definitions
+ *******************************************************************************************/
+#define I2C1 ((I2C_TypeDef *)I2C1_BASE)
+#define I2C2 ((I2C_TypeDef *)I2C2_BASE)
+#define I2C3 ((I2C_TypeDef *)I2C3_BASE)
+
+#endif /* I2C_REGISTERS_H_ */
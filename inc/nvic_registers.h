@@ -18,7 +18,7 @@
 /*******************************************************************************************
  * NVIC Base Address (ARM-defined for Cortex-M4)
  *******************************************************************************************/
-#define NVIC_BASE (CORTEX_M4_PERIPH_BASE + 0x0100UL)
+#define NVIC_BASE (CORTEX_M4_PERIPH_BASE + 0xE100UL)
 
 /*******************************************************************************************
  * NVIC Register Structure (simplified to core features)
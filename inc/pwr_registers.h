@@ -0,0 +1,60 @@
+/*******************************************************************************************
+ * @file    pwr_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE PWR Device Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for the power controller.
+ *          The PWR clock is enabled by RCC APB1ENR bit 28.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef PWR_REGISTERS_H_
+#define PWR_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * PWR Base Address
+ *******************************************************************************************/
+#define PWR_BASE (APB1PERIPH_BASE + 0x7000UL)
+
+/*******************************************************************************************
+ * PWR Register Definition (RM0390, Section 5.4)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t CR;  /*!< Power control register                    (offset 0x00) */
+    volatile uint32_t CSR; /*!< Power control/status register             (offset 0x04) */
+} PWR_TypeDef;
+
+/*******************************************************************************************
+ * PWR Register Bits
+ *******************************************************************************************/
+#define PWR_CR_LPDS (1UL << 0)     /*!< Low-power regulator in stop mode */
+#define PWR_CR_PDDS (1UL << 1)     /*!< Standby instead of stop on deep sleep */
+#define PWR_CR_CWUF (1UL << 2)     /*!< Clear wakeup flag */
+#define PWR_CR_CSBF (1UL << 3)     /*!< Clear standby flag */
+#define PWR_CR_DBP (1UL << 8)      /*!< Backup domain write access */
+#define PWR_CR_FPDS (1UL << 9)     /*!< Flash power-down in stop mode */
+#define PWR_CR_LPUDS (1UL << 10)   /*!< Low-power regulator in under-drive stop */
+#define PWR_CR_MRUDS (1UL << 11)   /*!< Main regulator in under-drive stop */
+#define PWR_CR_VOS_Pos 14U         /*!< Regulator voltage scaling */
+#define PWR_CR_VOS_Msk (0x3UL << 14)
+#define PWR_CR_ODEN (1UL << 16)    /*!< Over-drive enable */
+#define PWR_CR_ODSWEN (1UL << 17)  /*!< Over-drive switching enable */
+
+#define PWR_CSR_WUF (1UL << 0)     /*!< Wakeup flag */
+#define PWR_CSR_SBF (1UL << 1)     /*!< Standby flag */
+#define PWR_CSR_VOSRDY (1UL << 14) /*!< Voltage scaling ready */
+#define PWR_CSR_ODRDY (1UL << 16)  /*!< Over-drive ready */
+#define PWR_CSR_ODSWRDY (1UL << 17) /*!< Over-drive switching ready */
+
+/*******************************************************************************************
+ * PWR Peripheral Definition
+ *******************************************************************************************/
+#define PWR ((PWR_TypeDef *)PWR_BASE)
+
+#endif /* PWR_REGISTERS_H_ */
@@ -63,4 +63,18 @@ typedef struct {
 
 #define RCC                       ((RCC_TypeDef *) RCC_BASE)
 
+/*******************************************************************************************
+ * RCC Register Bits
+ *******************************************************************************************/
+#define RCC_CR_HSION              (1UL << 0)   /*!< HSI oscillator enable */
+#define RCC_CR_HSIRDY             (1UL << 1)   /*!< HSI oscillator ready */
+#define RCC_CR_HSITRIM_Pos        3U           /*!< HSI trimming, added to HSICAL (16 = none) */
+#define RCC_CR_HSITRIM_Msk        (0x1FUL << 3)
+#define RCC_CR_HSICAL_Pos         8U           /*!< HSI factory calibration */
+#define RCC_CR_HSICAL_Msk         (0xFFUL << 8)
+
+#define RCC_BDCR_LSEON            (1UL << 0)   /*!< LSE oscillator enable */
+#define RCC_BDCR_LSERDY           (1UL << 1)   /*!< LSE oscillator ready */
+#define RCC_BDCR_LSEBYP           (1UL << 2)   /*!< LSE bypass (external clock on OSC32_IN) */
+
 #endif
\ No newline at end of file
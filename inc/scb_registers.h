@@ -0,0 +1,60 @@
+/*******************************************************************************************
+ * @file    scb_registers.h
+ * @author  ka5j
+ * @brief   Cortex-M4 System Control Block Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for the SCB (sleep control, system
+ *          handler priorities, pending bits and fault status).
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef SCB_REGISTERS_H_
+#define SCB_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h" // Must define CORTEX_M4_PERIPH_BASE
+
+/*******************************************************************************************
+ * SCB Base Address (ARMv7-M Architecture Reference Manual, B3.2.2)
+ *******************************************************************************************/
+#define SCB_BASE (CORTEX_M4_PERIPH_BASE + 0xED00UL)
+
+/*******************************************************************************************
+ * SCB Register Structure
+ *******************************************************************************************/
+typedef struct
+{
+    const volatile uint32_t CPUID; /*!< CPUID base register                  (offset 0x00) */
+    volatile uint32_t ICSR;        /*!< Interrupt control and state          (offset 0x04) */
+    volatile uint32_t VTOR;        /*!< Vector table offset                  (offset 0x08) */
+    volatile uint32_t AIRCR;       /*!< Application interrupt and reset ctrl (offset 0x0C) */
+    volatile uint32_t SCR;         /*!< System control register              (offset 0x10) */
+    volatile uint32_t CCR;         /*!< Configuration and control            (offset 0x14) */
+    volatile uint8_t SHP[12];      /*!< System handler priorities 4-15       (offset 0x18) */
+    volatile uint32_t SHCSR;       /*!< System handler control and state     (offset 0x24) */
+    volatile uint32_t CFSR;        /*!< Configurable fault status            (offset 0x28) */
+    volatile uint32_t HFSR;        /*!< HardFault status                     (offset 0x2C) */
+    volatile uint32_t DFSR;        /*!< Debug fault status                   (offset 0x30) */
+    volatile uint32_t MMFAR;       /*!< MemManage fault address              (offset 0x34) */
+    volatile uint32_t BFAR;        /*!< BusFault address                     (offset 0x38) */
+    volatile uint32_t AFSR;        /*!< Auxiliary fault status               (offset 0x3C) */
+} SCB_TypeDef;
+
+/*******************************************************************************************
+ * SCB Register Bits
+ *******************************************************************************************/
+#define SCB_ICSR_PENDSTCLR (1UL << 25) /*!< Clear pending SysTick */
+#define SCB_ICSR_PENDSTSET (1UL << 26) /*!< SysTick pending */
+
+#define SCB_SCR_SLEEPONEXIT (1UL << 1) /*!< Sleep again on return to thread mode */
+#define SCB_SCR_SLEEPDEEP (1UL << 2)   /*!< WFI/WFE enter deep sleep (stop/standby) */
+#define SCB_SCR_SEVONPEND (1UL << 4)   /*!< Pending interrupts wake WFE */
+
+/*******************************************************************************************
+ * SCB Peripheral Definition
+ *******************************************************************************************/
+#define SCB ((SCB_TypeDef *)SCB_BASE)
+
+#endif /* SCB_REGISTERS_H_ */
@@ -0,0 +1,71 @@
+/*******************************************************************************************
+ * @file    spi_registers.h
+ * @author  ka5j
+ * @brief   STM32F446RE SPI Device Memory-Mapped Register Definitions (Bare Metal)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Only memory-mapped register definitions for SPI1-SPI4.
+ *          This file assumes a 32-bit embedded platform and no CMSIS dependency.
+ *******************************************************************************************/
+
+#ifndef SPI_REGISTERS_H_
+#define SPI_REGISTERS_H_
+
+#include <stdint.h>
+#include "stm32f446re_addresses.h"
+
+/*******************************************************************************************
+ * SPI Base Addresses
+ *******************************************************************************************/
+#define SPI1_BASE (APB2PERIPH_BASE + 0x3000UL)
+#define SPI2_BASE (APB1PERIPH_BASE + 0x3800UL)
+#define SPI3_BASE (APB1PERIPH_BASE + 0x3C00UL)
+#define SPI4_BASE (APB2PERIPH_BASE + 0x3400UL)
+
+/*******************************************************************************************
+ * SPI Register Definition (RM0390, Section 26.7)
+ *******************************************************************************************/
+typedef struct
+{
+    volatile uint32_t CR1;     /*!< Control register 1                    (offset 0x00) */
+    volatile uint32_t CR2;     /*!< Control register 2                    (offset 0x04) */
+    volatile uint32_t SR;      /*!< Status register                       (offset 0x08) */
+    volatile uint32_t DR;      /*!< Data register                         (offset 0x0C) */
+    volatile uint32_t CRCPR;   /*!< CRC polynomial register               (offset 0x10) */
+    volatile uint32_t RXCRCR;  /*!< RX CRC register                       (offset 0x14) */
+    volatile uint32_t TXCRCR;  /*!< TX CRC register                       (offset 0x18) */
+    volatile uint32_t I2SCFGR; /*!< I2S configuration register            (offset 0x1C) */
+    volatile uint32_t I2SPR;   /*!< I2S prescaler register                (offset 0x20) */
+} SPI_TypeDef;
+
+/*******************************************************************************************
+ * SPI Register Bits
+ *******************************************************************************************/
+#define SPI_CR1_CPHA (1UL << 0)     /*!< Clock phase */
+#define SPI_CR1_CPOL (1UL << 1)     /*!< Clock polarity */
+#define SPI_CR1_MSTR (1UL << 2)     /*!< Master selection */
+#define SPI_CR1_BR_Pos 3U           /*!< Baud rate control (fPCLK / 2^(BR+1)) */
+#define SPI_CR1_SPE (1UL << 6)      /*!< SPI enable */
+#define SPI_CR1_LSBFIRST (1UL << 7) /*!< Frame format */
+#define SPI_CR1_SSI (1UL << 8)      /*!< Internal slave select */
+#define SPI_CR1_SSM (1UL << 9)      /*!< Software slave management */
+#define SPI_CR1_DFF (1UL << 11)     /*!< Data frame format (16-bit) */
+
+#define SPI_CR2_RXDMAEN (1UL << 0)  /*!< RX buffer DMA enable */
+#define SPI_CR2_TXDMAEN (1UL << 1)  /*!< TX buffer DMA enable */
+
+#define SPI_SR_RXNE (1UL << 0)      /*!< Receive buffer not empty */
+#define SPI_SR_TXE (1UL << 1)       /*!< Transmit buffer empty */
+#define SPI_SR_OVR (1UL << 6)       /*!< Overrun flag */
+#define SPI_SR_BSY (1UL << 7)       /*!< Busy flag */
+
+/*******************************************************************************************
+ * SPI Peripheral Definitions
+ *******************************************************************************************/
+#define SPI1 ((SPI_TypeDef *)SPI1_BASE)
+#define SPI2 ((SPI_TypeDef *)SPI2_BASE)
+#define SPI3 ((SPI_TypeDef *)SPI3_BASE)
+#define SPI4 ((SPI_TypeDef *)SPI4_BASE)
+
+#endif /* SPI_REGISTERS_H_ */
@@ -28,4 +28,11 @@
 #define AHB2PERIPH_BASE           (0x50000000UL)
 #define AHB3PERIPH_BASE           (0x60000000UL)
 
+ /*******************************************************************************************
+ * Memory and Bit-Band Base Addresses
+ *******************************************************************************************/
+#define SRAM1_BASE                (0x20000000UL)
+#define SRAM_BB_BASE              (0x22000000UL) /*!< Bit-band alias of 0x20000000-0x200FFFFF */
+#define PERIPH_BB_BASE            (0x42000000UL) /*!< Bit-band alias of 0x40000000-0x400FFFFF */
+
 #endif /* STM32F446RE_REGISTERS_H_ */
\ No newline at end of file
@@ -27,6 +27,15 @@ typedef struct {
     const volatile uint32_t CALIB;/*!< Calibration Register (read-only) */
 } SysTick_TypeDef;
 
+/*******************************************************************************************
+ * SysTick Register Bits
+ *******************************************************************************************/
+#define SYSTICK_CSR_ENABLE        (1UL << 0)   /*!< Counter enable */
+#define SYSTICK_CSR_TICKINT       (1UL << 1)   /*!< Interrupt on reaching 0 */
+#define SYSTICK_CSR_CLKSOURCE     (1UL << 2)   /*!< Processor clock (HCLK) */
+#define SYSTICK_CSR_COUNTFLAG     (1UL << 16)  /*!< Reached 0 since last read */
+#define SYSTICK_RVR_MAX           0x00FFFFFFUL /*!< 24-bit counter */
+
 #define SYSTICK                   ((SysTick_TypeDef *) SYSTICK_BASE)
 
 #endif
\ No newline at end of file
@@ -22,6 +22,7 @@
  #define TIM3_BASE     (APB1PERIPH_BASE + 0x0400UL)
  #define TIM4_BASE     (APB1PERIPH_BASE + 0x0800UL)
  #define TIM5_BASE     (APB1PERIPH_BASE + 0x0C00UL)
+ #define TIM8_BASE     (APB2PERIPH_BASE + 0x0400UL) /*!< Advanced timer, same time-base layout */
  
  /*******************************************************************************************
   * TIM Register Layout (Applies to TIM2–TIM5)
@@ -47,8 +48,54 @@
      volatile uint32_t BDTR;    /*!< Break and dead-time register */
      volatile uint32_t DCR;     /*!< DMA control register */
      volatile uint32_t DMAR;    /*!< DMA address for full transfer */
+     volatile uint32_t OR;      /*!< Option register (TIM2 ITR1, TIM5 TI4 remap) */
  } TIM2_5_TypeDef;
  
+ /*******************************************************************************************
+  * TIM Register Bits
+  *******************************************************************************************/
+ #define TIM_CR1_CEN       (1UL << 0)   /*!< Counter enable */
+ #define TIM_CR1_UDIS      (1UL << 1)   /*!< Update disable */
+ #define TIM_CR1_URS       (1UL << 2)   /*!< Only overflow raises UIF / update DMA */
+ #define TIM_CR1_OPM       (1UL << 3)   /*!< One-pulse mode: stop at the next update */
+ #define TIM_CR1_ARPE      (1UL << 7)   /*!< ARR preload */
+
+ #define TIM_CR2_MMS_Pos   4U           /*!< Master mode selection (TRGO) */
+ #define TIM_CR2_MMS_Msk   (0x7UL << 4)
+
+ #define TIM_SMCR_SMS_Msk  (0x7UL << 0) /*!< Slave mode selection */
+ #define TIM_SMCR_TS_Pos   4U           /*!< Trigger selection */
+ #define TIM_SMCR_TS_Msk   (0x7UL << 4)
+ #define TIM_SMCR_MSM      (1UL << 7)   /*!< Master/slave mode (delay TRGI for sync) */
+
+ #define TIM_SMS_DISABLED  0x0UL        /*!< Internal clock */
+ #define TIM_SMS_RESET     0x4UL        /*!< Trigger reinitializes the counter */
+ #define TIM_SMS_GATED     0x5UL        /*!< Counter runs while trigger is high */
+ #define TIM_SMS_TRIGGER   0x6UL        /*!< Trigger starts the counter */
+ #define TIM_SMS_EXTCLK1   0x7UL        /*!< Trigger rising edges clock the counter */
+
+ #define TIM_DIER_UIE      (1UL << 0)   /*!< Update interrupt */
+ #define TIM_DIER_TIE      (1UL << 6)   /*!< Trigger interrupt */
+ #define TIM_DIER_UDE      (1UL << 8)   /*!< Update DMA request */
+
+ #define TIM_SR_UIF        (1UL << 0)   /*!< Update interrupt flag */
+ #define TIM_SR_TIF        (1UL << 6)   /*!< Trigger interrupt flag */
+
+ #define TIM_EGR_UG        (1UL << 0)   /*!< Update generation */
+
+ #define TIM_OCM_PWM1      0x6UL        /*!< Active while CNT < CCR */
+ #define TIM_OCM_PWM2      0x7UL        /*!< Active while CNT >= CCR */
+ #define TIM_CCMR_OCPE     (1UL << 3)   /*!< Output compare preload (per channel byte) */
+ #define TIM_CCMR_CCS_Msk  0x3UL        /*!< Channel byte: 00 output, else input (CCxS) */
+ #define TIM_CCMR_CCS_TI   0x1UL        /*!< Channel byte: input capture from its own TIx */
+ #define TIM_CCMR_ICPSC_Pos 2U          /*!< Channel byte: capture every 1, 2, 4, 8 events */
+
+ #define TIM5_OR_TI4_RMP_Pos 6U         /*!< TIM5 CH4 input: 0 pin, 1 LSI, 2 LSE, 3 RTC WKUP */
+ #define TIM5_OR_TI4_RMP_Msk (0x3UL << 6)
+
+ #define TIM_DCR_DBA_Pos   0U           /*!< DMA base address (register index) */
+ #define TIM_DCR_DBL_Pos   8U           /*!< DMA burst length - 1 */
+
  /*******************************************************************************************
   * TIM Peripheral Definitions
   *******************************************************************************************/
@@ -56,6 +103,7 @@
  #define TIM3    ((TIM2_5_TypeDef *) TIM3_BASE)
  #define TIM4    ((TIM2_5_TypeDef *) TIM4_BASE)
  #define TIM5    ((TIM2_5_TypeDef *) TIM5_BASE)
+ #define TIM8    ((TIM2_5_TypeDef *) TIM8_BASE) /*!< Time base, update DMA on DMA2 only */
  
  #endif /* TIM_REGISTERS_H_ */
  
\ No newline at end of file
@@ -39,6 +39,26 @@ typedef struct
     volatile uint32_t GTPR; /*!< Guard time and prescaler register        */
 } USART_TypeDef;
 
+/*******************************************************************************************
+ * USART Register Bits
+ *******************************************************************************************/
+#define USART_SR_RXNE    (1UL << 5)  /*!< Read data register not empty */
+#define USART_SR_TC      (1UL << 6)  /*!< Transmission complete */
+#define USART_SR_TXE     (1UL << 7)  /*!< Transmit data register empty */
+
+#define USART_CR1_RE     (1UL << 2)  /*!< Receiver enable */
+#define USART_CR1_TE     (1UL << 3)  /*!< Transmitter enable */
+#define USART_CR1_RXNEIE (1UL << 5)  /*!< RXNE interrupt enable */
+#define USART_CR1_TCIE   (1UL << 6)  /*!< Transmission complete interrupt enable */
+#define USART_CR1_TXEIE  (1UL << 7)  /*!< TXE interrupt enable */
+#define USART_CR1_PCE    (1UL << 10) /*!< Parity control enable */
+#define USART_CR1_M      (1UL << 12) /*!< Word length (9 data bits) */
+#define USART_CR1_UE     (1UL << 13) /*!< USART enable */
+#define USART_CR1_OVER8  (1UL << 15) /*!< Oversampling by 8 */
+
+#define USART_CR3_DMAR   (1UL << 6)  /*!< DMA enable receiver */
+#define USART_CR3_DMAT   (1UL << 7)  /*!< DMA enable transmitter */
+
 /*******************************************************************************************
  * USART Peripheral Definitions
  *******************************************************************************************/
@@ -0,0 +1,420 @@
+/*******************************************************************************************
+ * @file    bare_adc.c
+ * @author  ka5j
+ * @brief   Bare-metal ADC1/ADC2/ADC3 driver implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Each scan sequence produces `count` DMA transfers into a circular buffer of
+ *          two blocks. The DMA half-transfer and transfer-complete interrupts hand the
+ *          finished block to the application while the other one is being filled.
+ *          An ADC overrun (DMA not serviced in time) is recovered in the ADC interrupt.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "adc_registers.h"
+#include "bare_adc.h"
+#include "bare_dma.h"
+#include "bare_gpio.h"
+#include "bare_rcc.h"
+#include "bare_tim2_5.h"
+#include "bare_periph.h"
+#include "bare_bitband.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define ADC_COUNT 3U
+#define ADC_STAB_US 3U /*!< t_STAB: power-up time after ADON (DS10693, max) */
+
+/** Pin of each external channel (channels 0-3 and 10-13 are shared by all three ADCs) */
+static const struct
+{
+    GPIO_TypeDef *port;
+    GPIO_Pins_t pin;
+} adc_channel_pins[16] = {
+    {GPIOA, GPIO_PIN0}, {GPIOA, GPIO_PIN1}, {GPIOA, GPIO_PIN2}, {GPIOA, GPIO_PIN3},
+    {GPIOA, GPIO_PIN4}, {GPIOA, GPIO_PIN5}, {GPIOA, GPIO_PIN6}, {GPIOA, GPIO_PIN7},
+    {GPIOB, GPIO_PIN0}, {GPIOB, GPIO_PIN1}, {GPIOC, GPIO_PIN0}, {GPIOC, GPIO_PIN1},
+    {GPIOC, GPIO_PIN2}, {GPIOC, GPIO_PIN3}, {GPIOC, GPIO_PIN4}, {GPIOC, GPIO_PIN5}};
+
+/** Descriptor of an ADC: clock gate, shared vector, DMA2 stream avoiding the CRC stream 0 */
+#define ADC_PERIPH(idx) ((PERIPH_Id_t)(PERIPH_ADC1 + (idx)))
+#define ADC_STREAM(idx) bare_periph_dma_stream(ADC_PERIPH(idx), 0U)
+
+/** EXTSEL code of each ADC_Trigger_t (RM0390 Section 13.13.3) */
+static const uint8_t adc_extsel[] = {0U, 0x6U, 0x8U, 0x9U, 0xAU};
+
+/** Runtime state of each ADC */
+typedef struct
+{
+    const ADC_Config_t *cfg;
+    volatile uint32_t errors;
+    uint32_t samples; /*!< DMA buffer length (two blocks) */
+} adc_state_t;
+
+static adc_state_t adc_state[ADC_COUNT];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Wait t_STAB after ADON before the first conversion (at least one cycle per count)
+ */
+static void adc_wait_stab(void)
+{
+    volatile uint32_t n = (bare_rcc_get_hclk() / 1000000U + 1U) * ADC_STAB_US;
+
+    while (n--)
+        ;
+}
+
+/**
+ * @brief  Index (0-2) of an ADC, instances are 0x100 apart
+ */
+static uint32_t adc_index(ADC_TypeDef *ADCx)
+{
+    return ((uint32_t)ADCx - ADC1_BASE) >> 8;
+}
+
+/**
+ * @brief  Enable the ADC clock and pick the fastest legal ADCCLK prescaler
+ */
+static void adc_enable_clock(ADC_TypeDef *ADCx)
+{
+    uint32_t pclk2 = bare_rcc_get_pclk2();
+    uint32_t pre = 0U; // /2, /4, /6, /8
+
+    bare_periph_enable_clock(ADC_PERIPH(adc_index(ADCx)));
+
+    while ((pre < 3U) && ((pclk2 / ((pre + 1U) * 2U)) > ADC_MAX_CLOCK))
+    {
+        pre++;
+    }
+    ADC_COMMON->CCR = (ADC_COMMON->CCR & ~(0x3UL << ADC_CCR_ADCPRE_Pos)) |
+                      (pre << ADC_CCR_ADCPRE_Pos);
+}
+
+/**
+ * @brief  Route a channel to its pin in analog mode, or enable the internal source
+ */
+static void adc_channel_setup(ADC_Channel_t channel)
+{
+    if (channel < 16U)
+    {
+        bare_gpio_init(adc_channel_pins[channel].port, adc_channel_pins[channel].pin,
+                       GPIO_MODE_ANALOG, GPIO_OTYPE_PP, GPIO_SPEED_LOW, GPIO_NOPULL);
+    }
+    else if (channel == ADC_CHANNEL_VBAT)
+    {
+        ADC_COMMON->CCR |= ADC_CCR_VBATE;
+    }
+    else
+    {
+        ADC_COMMON->CCR |= ADC_CCR_TSVREFE;
+    }
+}
+
+/**
+ * @brief  Program the sampling time of one channel
+ */
+static void adc_set_sample_time(ADC_TypeDef *ADCx, ADC_Channel_t channel, ADC_SampleTime_t smp)
+{
+    if (channel < 10U)
+    {
+        ADCx->SMPR2 = (ADCx->SMPR2 & ~(0x7UL << (3U * channel))) |
+                      ((uint32_t)smp << (3U * channel));
+    }
+    else
+    {
+        ADCx->SMPR1 = (ADCx->SMPR1 & ~(0x7UL << (3U * (channel - 10U)))) |
+                      ((uint32_t)smp << (3U * (channel - 10U)));
+    }
+}
+
+/**
+ * @brief  Compose SQR1-SQR3 for a sequence and write each register once
+ */
+static void adc_set_sequence(ADC_TypeDef *ADCx, const ADC_Channel_t *channels, uint8_t count)
+{
+    uint32_t sqr[3] = {0U, 0U, 0U}; // SQR3 (1-6), SQR2 (7-12), SQR1 (13-16)
+    uint8_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        sqr[i / 6U] |= ((uint32_t)channels[i] & 0x1FU) << (5U * (i % 6U));
+    }
+    sqr[2] |= ((uint32_t)(count - 1U) << ADC_SQR1_L_Pos);
+
+    ADCx->SQR3 = sqr[0];
+    ADCx->SQR2 = sqr[1];
+    ADCx->SQR1 = sqr[2];
+}
+
+/**
+ * @brief  Timer driving a trigger, NULL for software
+ */
+static TIM2_5_TypeDef *adc_trigger_timer(ADC_Trigger_t trigger)
+{
+    switch (trigger)
+    {
+    case ADC_TRIG_TIM2_TRGO:
+        return TIM2;
+    case ADC_TRIG_TIM3_TRGO:
+        return TIM3;
+    case ADC_TRIG_TIM4_CC4:
+        return TIM4;
+    case ADC_TRIG_TIM5_CC1:
+        return TIM5;
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief  Configure the trigger timer: one rising edge per sequence period
+ */
+static void adc_trigger_setup(ADC_Trigger_t trigger, uint32_t rate_hz)
+{
+    TIM2_5_TypeDef *TIMx = adc_trigger_timer(trigger);
+
+    if (TIMx == NULL)
+    {
+        return;
+    }
+
+    bare_tim2_5_set_rate(TIMx, rate_hz);
+
+    if (trigger == ADC_TRIG_TIM4_CC4)
+    {
+        /* PWM mode 1 on CH4, compare edge mid-period */
+        TIMx->CCMR2 = (TIMx->CCMR2 & ~(0x7UL << 12)) | (0x6UL << 12); // OC4M = 110
+        TIMx->CCR4 = (TIMx->ARR / 2U) + 1U;
+        TIMx->CCER |= (1 << 12); // CC4E
+    }
+    else if (trigger == ADC_TRIG_TIM5_CC1)
+    {
+        TIMx->CCMR1 = (TIMx->CCMR1 & ~(0x7UL << 4)) | (0x6UL << 4); // OC1M = 110
+        TIMx->CCR1 = (TIMx->ARR / 2U) + 1U;
+        TIMx->CCER |= (1 << 0); // CC1E
+    }
+    else
+    {
+        bare_tim2_5_set_trgo(TIMx, TIM2_5_TRGO_UPDATE);
+    }
+}
+
+/**
+ * @brief  DMA event handler: deliver completed blocks
+ */
+static void adc_dma_event(uint32_t events, void *ctx)
+{
+    adc_state_t *st = (adc_state_t *)ctx;
+    const ADC_Config_t *cfg = st->cfg;
+
+    if (events & DMA_EVENT_ERROR)
+    {
+        st->errors++;
+    }
+    if (events & DMA_EVENT_HALF)
+    {
+        cfg->cb(cfg->buffer, cfg->frames_per_block, cfg->ctx);
+    }
+    if (events & DMA_EVENT_COMPLETE)
+    {
+        cfg->cb(cfg->buffer + (st->samples / 2U), cfg->frames_per_block, cfg->ctx);
+    }
+}
+
+/**
+ * @brief  Arm the DMA stream of an ADC over its whole double block
+ */
+static void adc_dma_arm(ADC_TypeDef *ADCx)
+{
+    uint32_t idx = adc_index(ADCx);
+
+    bare_dma_start(ADC_STREAM(idx), (uint32_t)&ADCx->DR,
+                   (uint32_t)adc_state[idx].cfg->buffer, 0U,
+                   (uint16_t)adc_state[idx].samples);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Configure an ADC for DMA-driven scanning
+ * @param  ADCx Pointer to ADC peripheral
+ * @param  cfg  Scan configuration
+ */
+void bare_adc_init(ADC_TypeDef *ADCx, const ADC_Config_t *cfg)
+{
+    uint32_t idx = adc_index(ADCx);
+    uint32_t cr2;
+    uint8_t i;
+    DMA_Config_t dma = {
+        .channel = bare_periph_dma_channel(ADC_PERIPH(idx), 0U),
+        .dir = DMA_DIR_PERIPH_TO_MEM,
+        .psize = DMA_SIZE_HALFWORD,
+        .msize = DMA_SIZE_HALFWORD,
+        .pinc = 0U,
+        .minc = 1U,
+        .circular = 1U,
+        .priority = DMA_PRIORITY_HIGH,
+        .fifo = DMA_FIFO_DIRECT,
+        .half_irq = 1U,
+        .complete_irq = 1U,
+    };
+
+    adc_state[idx].cfg = cfg;
+    adc_state[idx].errors = 0U;
+    adc_state[idx].samples = 2U * cfg->frames_per_block * cfg->count;
+
+    adc_enable_clock(ADCx);
+    ADCx->CR2 = 0U; // ADON = 0 while configuring
+
+    for (i = 0U; i < cfg->count; i++)
+    {
+        adc_channel_setup(cfg->channels[i]);
+        adc_set_sample_time(ADCx, cfg->channels[i], cfg->sample_time);
+    }
+    adc_set_sequence(ADCx, cfg->channels, cfg->count);
+
+    ADCx->CR1 = ADC_CR1_SCAN | ADC_CR1_OVRIE |
+                ((uint32_t)cfg->resolution << ADC_CR1_RES_Pos);
+
+    /* Circular DMA keeps requesting (DDS); a trigger starts a whole sequence */
+    cr2 = ADC_CR2_ADON | ADC_CR2_DMA | ADC_CR2_DDS;
+    if (cfg->trigger == ADC_TRIG_SOFTWARE)
+    {
+        cr2 |= ADC_CR2_CONT;
+    }
+    else
+    {
+        cr2 |= ((uint32_t)adc_extsel[cfg->trigger] << ADC_CR2_EXTSEL_Pos) |
+               (0x1UL << ADC_CR2_EXTEN_Pos); // Rising edge
+    }
+    ADCx->CR2 = cr2;
+    adc_wait_stab(); // No conversion may start before t_STAB
+
+    adc_trigger_setup(cfg->trigger, cfg->rate_hz);
+
+    bare_dma_config(ADC_STREAM(idx), &dma);
+    bare_dma_set_callback(ADC_STREAM(idx), adc_dma_event, &adc_state[idx]);
+
+    bare_periph_enable_irq(ADC_PERIPH(idx), 0U); // ADC1/2/3 share one vector
+}
+
+/**
+ * @brief  Start scanning
+ * @param  ADCx Pointer to ADC peripheral
+ */
+void bare_adc_start(ADC_TypeDef *ADCx)
+{
+    const ADC_Config_t *cfg = adc_state[adc_index(ADCx)].cfg;
+    TIM2_5_TypeDef *TIMx = adc_trigger_timer(cfg->trigger);
+
+    adc_dma_arm(ADCx);
+    ADCx->SR = 0U;
+
+    if (TIMx == NULL)
+    {
+        ADCx->CR2 |= ADC_CR2_SWSTART;
+    }
+    else
+    {
+        bare_tim2_5_enable(TIMx);
+    }
+}
+
+/**
+ * @brief  Stop scanning and the trigger timer
+ * @param  ADCx Pointer to ADC peripheral
+ */
+void bare_adc_stop(ADC_TypeDef *ADCx)
+{
+    uint32_t idx = adc_index(ADCx);
+    TIM2_5_TypeDef *TIMx = adc_trigger_timer(adc_state[idx].cfg->trigger);
+
+    if (TIMx != NULL)
+    {
+        bare_bitband_clear(&TIMx->CR1, TIM_CR1_CEN); // Disable counter
+    }
+    ADCx->CR2 &= ~(ADC_CR2_CONT | ADC_CR2_DMA);
+    bare_dma_stop(ADC_STREAM(idx));
+}
+
+/**
+ * @brief  Single blocking conversion of one channel
+ * @param  ADCx    Pointer to ADC peripheral
+ * @param  channel Channel to convert
+ * @retval Conversion result
+ */
+uint16_t bare_adc_read(ADC_TypeDef *ADCx, ADC_Channel_t channel)
+{
+    if (!(ADCx->CR2 & ADC_CR2_ADON))
+    {
+        adc_enable_clock(ADCx);
+        adc_channel_setup(channel);
+        ADCx->CR2 = ADC_CR2_ADON;
+        adc_wait_stab();
+    }
+
+    ADCx->SQR1 = 0U; // L = 0: one conversion
+    ADCx->SQR3 = channel;
+    ADCx->CR2 = (ADCx->CR2 & ~(ADC_CR2_CONT | ADC_CR2_DMA)) | ADC_CR2_SWSTART;
+
+    while (!(ADCx->SR & ADC_SR_EOC))
+        ; // Wait for end of conversion
+    return (uint16_t)ADCx->DR;
+}
+
+/**
+ * @brief  Number of DMA errors / overruns since bare_adc_init()
+ * @param  ADCx Pointer to ADC peripheral
+ * @retval Error count
+ */
+uint32_t bare_adc_errors(ADC_TypeDef *ADCx)
+{
+    return adc_state[adc_index(ADCx)].errors;
+}
+
+/*******************************************************************************************
+ *                               Interrupt Service Routines
+ *******************************************************************************************/
+
+/**
+ * @brief  ADC1/2/3 global interrupt: recover from overrun by re-arming DMA
+ *
+ * @note   On overrun the ADC stops issuing DMA requests (RM0390 Section 13.8.1); the
+ *         sequence restarts from the first channel and buffer position.
+ */
+void ADC_IRQHandler(void)
+{
+    static ADC_TypeDef *const adcs[ADC_COUNT] = {ADC1, ADC2, ADC3};
+    uint32_t i;
+
+    for (i = 0U; i < ADC_COUNT; i++)
+    {
+        ADC_TypeDef *ADCx = adcs[i];
+
+        if ((adc_state[i].cfg == NULL) || !(ADCx->SR & ADC_SR_OVR))
+        {
+            continue;
+        }
+
+        adc_state[i].errors++;
+        ADCx->CR2 &= ~ADC_CR2_DMA;
+        bare_dma_stop(ADC_STREAM(i));
+        adc_dma_arm(ADCx);
+        ADCx->SR = ~ADC_SR_OVR;
+        ADCx->CR2 |= ADC_CR2_DMA;
+
+        if (adc_state[i].cfg->trigger == ADC_TRIG_SOFTWARE)
+        {
+            ADCx->CR2 |= ADC_CR2_SWSTART;
+        }
+    }
+}
@@ -0,0 +1,524 @@
+/*******************************************************************************************
+ * @file    bare_can.c
+ * @author  ka5j
+ * @brief   Bare-metal bxCAN (CAN1/CAN2) driver implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Transmit: the controller runs with TXFP = 0, so the mailboxes themselves arbitrate
+ *          by identifier. The software queue is kept sorted the same way. When all three
+ *          mailboxes are busy and a frame outranks the lowest one, that mailbox is aborted
+ *          and its frame requeued, so a late urgent frame never waits behind two low
+ *          priority ones. Frames with the same identifier are never in two mailboxes at once,
+ *          which keeps them in submission order.
+ *
+ *          Receive: RX0 and RX1 both write the ring; they must share an NVIC priority (the
+ *          reset default) so they never preempt each other.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "can_registers.h"
+#include "bare_can.h"
+#include "bare_gpio.h"
+#include "bare_rcc.h"
+#include "bare_periph.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define CAN_COUNT 2U
+#define CAN_MAILBOXES 3U
+#define CAN_INIT_SPIN 100000U /*!< Bound on INAK handshakes */
+
+/** Controller, its descriptor (clock gate, TX/RX0/RX1 vectors) and filter banks */
+static const struct
+{
+    CAN_TypeDef *can;
+    PERIPH_Id_t id;
+    uint8_t first_bank;  /*!< First filter bank owned */
+} can_hw[CAN_COUNT] = {
+    {CAN1, PERIPH_CAN1, 0U},
+    {CAN2, PERIPH_CAN2, CAN_BANKS_PER_CONTROLLER},
+};
+
+/** Runtime state of each controller */
+typedef struct
+{
+    CAN_Frame_t ring[CAN_RX_RING_SIZE];             /*!< Received frames */
+    volatile uint32_t rx_head;                      /*!< Written by the RX interrupts */
+    volatile uint32_t rx_tail;                      /*!< Written by the reader */
+    CAN_Frame_t queue[CAN_TX_QUEUE_SIZE + CAN_MAILBOXES]; /*!< Sorted, room for requeues */
+    uint32_t queued;                                /*!< Frames in queue */
+    CAN_Frame_t mailbox[CAN_MAILBOXES];             /*!< Copy of each loaded mailbox */
+    uint8_t loaded[CAN_MAILBOXES];                  /*!< Mailbox holds a frame */
+    uint8_t aborting[CAN_MAILBOXES];                /*!< Abort requested */
+    CAN_Stats_t stats;
+} can_state_t;
+
+static can_state_t can_state[CAN_COUNT];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Index of a controller in can_hw / can_state
+ */
+static inline uint32_t can_index(CAN_TypeDef *CANx)
+{
+    return (CANx == CAN2) ? 1U : 0U;
+}
+
+/**
+ * @brief  Arbitration key: lower wins on the bus (standard beats extended on equal base ID)
+ */
+static inline uint32_t can_key(const CAN_Frame_t *f)
+{
+    if (f->ide)
+    {
+        return ((f->id & CAN_EXT_ID_MASK) << 1) | 1U;
+    }
+    return (f->id & CAN_STD_ID_MASK) << 19;
+}
+
+/**
+ * @brief  Insert into the sorted queue; ahead of equal keys for requeued frames
+ */
+static void can_queue_insert(can_state_t *st, const CAN_Frame_t *f, uint8_t ahead)
+{
+    uint32_t k = can_key(f);
+    uint32_t i = st->queued;
+
+    while ((i > 0U) && ((can_key(&st->queue[i - 1U]) > k) ||
+                        (ahead && (can_key(&st->queue[i - 1U]) == k))))
+    {
+        st->queue[i] = st->queue[i - 1U];
+        i--;
+    }
+    st->queue[i] = *f;
+    st->queued++;
+}
+
+/**
+ * @brief  Remove the queue head
+ */
+static void can_queue_pop(can_state_t *st)
+{
+    uint32_t i;
+
+    st->queued--;
+    for (i = 0U; i < st->queued; i++)
+    {
+        st->queue[i] = st->queue[i + 1U];
+    }
+}
+
+/**
+ * @brief  Write a frame into a TX mailbox and request transmission
+ */
+static void can_mailbox_load(CAN_TxMailBox_TypeDef *mb, const CAN_Frame_t *f)
+{
+    mb->TDTR = (f->dlc > 8U) ? 8U : f->dlc;
+    mb->TDLR = (uint32_t)f->data[0] | ((uint32_t)f->data[1] << 8) |
+               ((uint32_t)f->data[2] << 16) | ((uint32_t)f->data[3] << 24);
+    mb->TDHR = (uint32_t)f->data[4] | ((uint32_t)f->data[5] << 8) |
+               ((uint32_t)f->data[6] << 16) | ((uint32_t)f->data[7] << 24);
+    mb->TIR = (f->ide ? (((f->id & CAN_EXT_ID_MASK) << CAN_RIR_EXID_Pos) | CAN_RIR_IDE)
+                      : ((f->id & CAN_STD_ID_MASK) << CAN_RIR_STID_Pos)) |
+              (f->rtr ? CAN_RIR_RTR : 0U) | CAN_TIR_TXRQ;
+}
+
+/**
+ * @brief  Retire finished mailboxes and refill them from the queue (interrupts masked)
+ */
+static void can_tx_service(uint32_t idx)
+{
+    CAN_TypeDef *CANx = can_hw[idx].can;
+    can_state_t *st = &can_state[idx];
+    uint32_t tsr = CANx->TSR;
+    uint32_t m;
+
+    /* 1. Completed or aborted mailboxes */
+    for (m = 0U; m < CAN_MAILBOXES; m++)
+    {
+        if (tsr & CAN_TSR_RQCP(m))
+        {
+            CANx->TSR = CAN_TSR_RQCP(m); // rc_w1, also clears TXOK/ALST/TERR
+            if (st->loaded[m])
+            {
+                if (tsr & CAN_TSR_TXOK(m))
+                {
+                    st->stats.tx_frames++;
+                }
+                else
+                {
+                    st->stats.tx_aborts++;
+                    can_queue_insert(st, &st->mailbox[m], 1U);
+                }
+                st->loaded[m] = 0U;
+                st->aborting[m] = 0U;
+            }
+        }
+    }
+
+    /* 2. Refill, highest priority first */
+    while (st->queued > 0U)
+    {
+        uint32_t k = can_key(&st->queue[0]);
+        uint32_t free = CAN_MAILBOXES;
+        uint32_t worst = CAN_MAILBOXES;
+        uint8_t same = 0U;
+
+        tsr = CANx->TSR;
+        for (m = 0U; m < CAN_MAILBOXES; m++)
+        {
+            if (st->loaded[m])
+            {
+                uint32_t mk = can_key(&st->mailbox[m]);
+
+                same |= (mk == k);
+                if (!st->aborting[m] &&
+                    ((worst == CAN_MAILBOXES) || (mk > can_key(&st->mailbox[worst]))))
+                {
+                    worst = m;
+                }
+            }
+            else if ((free == CAN_MAILBOXES) && (tsr & CAN_TSR_TME(m)))
+            {
+                free = m;
+            }
+        }
+
+        if (same)
+        {
+            break; // Keep same-ID frames in order
+        }
+
+        if (free < CAN_MAILBOXES)
+        {
+            st->mailbox[free] = st->queue[0];
+            st->loaded[free] = 1U;
+            can_mailbox_load(&CANx->sTxMailBox[free], &st->queue[0]);
+            can_queue_pop(st);
+            continue;
+        }
+
+        if ((worst < CAN_MAILBOXES) && (can_key(&st->mailbox[worst]) > k))
+        {
+            CANx->TSR = CAN_TSR_ABRQ(worst); // Requeued on RQCP unless it already won
+            st->aborting[worst] = 1U;
+        }
+        break;
+    }
+}
+
+/**
+ * @brief  Drain one hardware FIFO into the ring
+ */
+static void can_rx_drain(uint32_t idx, uint32_t fifo)
+{
+    CAN_TypeDef *CANx = can_hw[idx].can;
+    can_state_t *st = &can_state[idx];
+    volatile uint32_t *rfr = fifo ? &CANx->RF1R : &CANx->RF0R;
+    CAN_FIFOMailBox_TypeDef *mb = &CANx->sFIFOMailBox[fifo];
+
+    if (*rfr & CAN_RFR_FOVR)
+    {
+        st->stats.rx_overruns++;
+        *rfr = CAN_RFR_FOVR | CAN_RFR_FULL;
+    }
+
+    while (*rfr & CAN_RFR_FMP_Msk)
+    {
+        uint32_t head = st->rx_head;
+
+        if ((head - st->rx_tail) < CAN_RX_RING_SIZE)
+        {
+            CAN_Frame_t *f = &st->ring[head & (CAN_RX_RING_SIZE - 1U)];
+            uint32_t rir = mb->RIR;
+            uint32_t rdtr = mb->RDTR;
+            uint32_t lo = mb->RDLR;
+            uint32_t hi = mb->RDHR;
+
+            f->ide = (rir & CAN_RIR_IDE) ? 1U : 0U;
+            f->rtr = (rir & CAN_RIR_RTR) ? 1U : 0U;
+            f->id = f->ide ? (rir >> CAN_RIR_EXID_Pos) : (rir >> CAN_RIR_STID_Pos);
+            f->dlc = (uint8_t)(rdtr & 0xFU);
+            f->fmi = (uint8_t)(rdtr >> 8);
+            f->timestamp = (uint16_t)(rdtr >> 16);
+            f->fifo = (uint8_t)fifo;
+            f->data[0] = (uint8_t)lo;
+            f->data[1] = (uint8_t)(lo >> 8);
+            f->data[2] = (uint8_t)(lo >> 16);
+            f->data[3] = (uint8_t)(lo >> 24);
+            f->data[4] = (uint8_t)hi;
+            f->data[5] = (uint8_t)(hi >> 8);
+            f->data[6] = (uint8_t)(hi >> 16);
+            f->data[7] = (uint8_t)(hi >> 24);
+
+            BARE_BARRIER(); // Frame complete before it is published
+            st->rx_head = head + 1U;
+            st->stats.rx_frames++;
+        }
+        else
+        {
+            st->stats.rx_dropped++;
+        }
+
+        *rfr = CAN_RFR_RFOM; // Next message (if any) moves into the output mailbox
+    }
+}
+
+/**
+ * @brief  Request or leave initialization mode and wait for INAK to follow
+ */
+static CAN_Status_t can_set_init(CAN_TypeDef *CANx, uint8_t init)
+{
+    uint32_t spin = CAN_INIT_SPIN;
+
+    if (init)
+    {
+        CANx->MCR = (CANx->MCR & ~CAN_MCR_SLEEP) | CAN_MCR_INRQ;
+    }
+    else
+    {
+        CANx->MCR &= ~CAN_MCR_INRQ; // Completes after 11 recessive bits on the bus
+    }
+
+    while ((((CANx->MSR & CAN_MSR_INAK) != 0U) != (init != 0U)) && --spin)
+        ;
+
+    return spin ? CAN_OK : CAN_ERR_TIMEOUT;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Compute BTR for a bit rate
+ * @param  pclk1        APB1 clock in Hz
+ * @param  bitrate      Bit rate in bit/s
+ * @param  sample_point Sample point in permille
+ * @param  btr          Output: BTR timing fields
+ * @retval 1 on success, 0 if no exact setting exists
+ */
+uint8_t bare_can_timing(uint32_t pclk1, uint32_t bitrate, uint16_t sample_point,
+                        uint32_t *btr)
+{
+    uint32_t tq;
+
+    /* Most quanta per bit first: finest sample point placement and SJW */
+    for (tq = 25U; tq >= 8U; tq--)
+    {
+        uint32_t div = bitrate * tq;
+        uint32_t brp;
+        int32_t ts1;
+        int32_t ts2;
+        uint32_t sjw;
+
+        if ((div == 0U) || ((pclk1 % div) != 0U))
+        {
+            continue;
+        }
+        brp = pclk1 / div;
+        if ((brp == 0U) || (brp > 1024U))
+        {
+            continue;
+        }
+
+        /* Sample point = (1 + TS1) / tq */
+        ts1 = (int32_t)(((sample_point * tq) + 500U) / 1000U) - 1;
+        if (ts1 > 16)
+        {
+            ts1 = 16;
+        }
+        ts2 = (int32_t)tq - 1 - ts1;
+        if (ts2 > 8)
+        {
+            ts2 = 8;
+            ts1 = (int32_t)tq - 9;
+        }
+        if (ts2 < 1)
+        {
+            ts2 = 1;
+            ts1 = (int32_t)tq - 2;
+        }
+        if ((ts1 < 1) || (ts1 > 16))
+        {
+            continue;
+        }
+        sjw = ((uint32_t)ts2 < 4U) ? (uint32_t)ts2 : 4U;
+
+        *btr = (brp - 1U) | ((uint32_t)(ts1 - 1) << CAN_BTR_TS1_Pos) |
+               ((uint32_t)(ts2 - 1) << CAN_BTR_TS2_Pos) | ((sjw - 1U) << CAN_BTR_SJW_Pos);
+        return 1U;
+    }
+
+    return 0U;
+}
+
+/**
+ * @brief  Initialize a controller and bring it onto the bus
+ * @param  CANx Pointer to CAN peripheral
+ * @param  cfg  Controller configuration
+ * @retval CAN_OK, CAN_ERR_TIMING or CAN_ERR_TIMEOUT
+ */
+CAN_Status_t bare_can_init(CAN_TypeDef *CANx, const CAN_Config_t *cfg)
+{
+    uint32_t idx = can_index(CANx);
+    can_state_t *st = &can_state[idx];
+    uint32_t btr;
+    uint32_t m;
+
+    if (!bare_can_timing(bare_rcc_get_pclk1(), cfg->bitrate, cfg->sample_point, &btr))
+    {
+        return CAN_ERR_TIMING;
+    }
+
+    /* 1. Clocks (CAN2 needs CAN1 for the shared filters) and pins */
+    bare_periph_enable_clock(PERIPH_CAN1);
+    bare_periph_enable_clock(can_hw[idx].id);
+    bare_gpio_AF(cfg->rx.port, cfg->rx.pin);
+    bare_gpio_set_AF(cfg->rx.port, cfg->rx.pin, cfg->af);
+    bare_gpio_AF(cfg->tx.port, cfg->tx.pin);
+    bare_gpio_set_AF(cfg->tx.port, cfg->tx.pin, cfg->af);
+
+    /* 2. Configure in initialization mode */
+    if (can_set_init(CANx, 1U) != CAN_OK)
+    {
+        return CAN_ERR_TIMEOUT;
+    }
+    CANx->MCR = CAN_MCR_INRQ | CAN_MCR_ABOM | CAN_MCR_DBF; // TXFP = 0: identifier priority
+    CANx->BTR = btr | (cfg->loopback ? CAN_BTR_LBKM : 0U) | (cfg->silent ? CAN_BTR_SILM : 0U);
+
+    st->rx_head = st->rx_tail = 0U;
+    st->queued = 0U;
+    for (m = 0U; m < CAN_MAILBOXES; m++)
+    {
+        st->loaded[m] = st->aborting[m] = 0U;
+    }
+    st->stats = (CAN_Stats_t){0};
+
+    /* 3. Interrupts */
+    CANx->IER = CAN_IER_TMEIE | CAN_IER_FMPIE0 | CAN_IER_FOVIE0 | CAN_IER_FMPIE1 |
+                CAN_IER_FOVIE1;
+    bare_periph_enable_irq(can_hw[idx].id, 0U); // TX
+    bare_periph_enable_irq(can_hw[idx].id, 1U); // RX0
+    bare_periph_enable_irq(can_hw[idx].id, 2U); // RX1
+
+    /* 4. Join the bus */
+    return can_set_init(CANx, 0U);
+}
+
+/**
+ * @brief  Pack acceptance rules and load them into the controller's filter banks
+ * @param  CANx  Pointer to CAN peripheral
+ * @param  rules Acceptance rules
+ * @param  count Number of rules
+ * @retval CAN_OK or CAN_ERR_FILTERS
+ */
+CAN_Status_t bare_can_set_filters(CAN_TypeDef *CANx, const CAN_FilterRule_t *rules,
+                                  uint32_t count)
+{
+    uint32_t idx = can_index(CANx);
+    uint32_t first = can_hw[idx].first_bank;
+    uint32_t own = ((1UL << CAN_BANKS_PER_CONTROLLER) - 1U) << first;
+    CAN_FilterBank_t banks[CAN_BANKS_PER_CONTROLLER];
+    int32_t n = bare_can_filter_pack(rules, count, banks, CAN_BANKS_PER_CONTROLLER);
+    int32_t i;
+
+    if (n < 0)
+    {
+        return CAN_ERR_FILTERS;
+    }
+
+    /* Filter registers only exist in CAN1; bank writes need FINIT and the bank inactive */
+    CAN1->FMR |= CAN_FMR_FINIT;
+    CAN1->FA1R &= ~own;
+
+    for (i = 0; i < n; i++)
+    {
+        uint32_t b = first + (uint32_t)i;
+        uint32_t bit = 1UL << b;
+
+        CAN1->FM1R = (CAN1->FM1R & ~bit) | ((uint32_t)banks[i].mode << b);
+        CAN1->FS1R = (CAN1->FS1R & ~bit) | ((uint32_t)banks[i].scale << b);
+        CAN1->FFA1R = (CAN1->FFA1R & ~bit) | ((uint32_t)banks[i].fifo << b);
+        CAN1->sFilterRegister[b].FR1 = banks[i].fr1;
+        CAN1->sFilterRegister[b].FR2 = banks[i].fr2;
+        CAN1->FA1R |= bit;
+    }
+
+    CAN1->FMR &= ~CAN_FMR_FINIT;
+    return CAN_OK;
+}
+
+/**
+ * @brief  Queue a frame for transmission
+ * @param  CANx  Pointer to CAN peripheral
+ * @param  frame Frame to send
+ * @retval CAN_OK or CAN_FULL
+ */
+CAN_Status_t bare_can_send(CAN_TypeDef *CANx, const CAN_Frame_t *frame)
+{
+    uint32_t idx = can_index(CANx);
+    can_state_t *st = &can_state[idx];
+    uint32_t primask = bare_irq_save();
+
+    if (st->queued >= CAN_TX_QUEUE_SIZE)
+    {
+        bare_irq_restore(primask);
+        return CAN_FULL;
+    }
+
+    can_queue_insert(st, frame, 0U);
+    can_tx_service(idx);
+    bare_irq_restore(primask);
+    return CAN_OK;
+}
+
+/**
+ * @brief  Take the oldest received frame
+ * @param  CANx  Pointer to CAN peripheral
+ * @param  frame Output frame
+ * @retval 1 if a frame was returned, 0 if the ring is empty
+ */
+uint8_t bare_can_receive(CAN_TypeDef *CANx, CAN_Frame_t *frame)
+{
+    can_state_t *st = &can_state[can_index(CANx)];
+    uint32_t tail = st->rx_tail;
+
+    if (tail == st->rx_head)
+    {
+        return 0U;
+    }
+
+    BARE_BARRIER(); // Read the frame only after seeing the head move
+    *frame = st->ring[tail & (CAN_RX_RING_SIZE - 1U)];
+    BARE_BARRIER();
+    st->rx_tail = tail + 1U;
+    return 1U;
+}
+
+/**
+ * @brief  Read the driver counters
+ * @param  CANx Pointer to CAN peripheral
+ * @param  out  Output counters
+ */
+void bare_can_stats(CAN_TypeDef *CANx, CAN_Stats_t *out)
+{
+    *out = can_state[can_index(CANx)].stats;
+}
+
+/*******************************************************************************************
+ *                              Interrupt Service Routines
+ *******************************************************************************************/
+void CAN1_TX_IRQHandler(void) { can_tx_service(0U); }
+void CAN1_RX0_IRQHandler(void) { can_rx_drain(0U, 0U); }
+void CAN1_RX1_IRQHandler(void) { can_rx_drain(0U, 1U); }
+void CAN2_TX_IRQHandler(void) { can_tx_service(1U); }
+void CAN2_RX0_IRQHandler(void) { can_rx_drain(1U, 0U); }
+void CAN2_RX1_IRQHandler(void) { can_rx_drain(1U, 1U); }
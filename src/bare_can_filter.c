@@ -0,0 +1,313 @@
+/*******************************************************************************************
+ * @file    bare_can_filter.c
+ * @author  ka5j
+ * @brief   bxCAN acceptance filter bank packing implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Packing per FIFO, which is optimal because every bank holds at most four
+ *          standard IDs and rules of other kinds have a fixed cost:
+ *            1. each extended mask rule takes a 32-bit mask bank,
+ *            2. extended IDs pair up in 32-bit list banks; an odd one out takes a
+ *               standard ID as its partner,
+ *            3. standard mask rules pair up in 16-bit mask banks; an odd one out takes a
+ *               standard ID (as a full mask) as its partner,
+ *            4. remaining standard IDs fill 16-bit list banks four at a time.
+ *          Unused slots repeat an entry of the same bank.
+ *******************************************************************************************/
+
+#include "bare_can_filter.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define RIR_RTR (1UL << 1) /*!< RTR bit in the 32-bit filter layout */
+#define RIR_IDE (1UL << 2) /*!< IDE bit in the 32-bit filter layout */
+#define F16_RTR (1UL << 4) /*!< RTR bit in the 16-bit filter layout */
+#define F16_IDE (1UL << 3) /*!< IDE bit in the 16-bit filter layout */
+
+/** Rule classes, in packing order */
+enum
+{
+    KIND_EXT_MASK = 0,
+    KIND_EXT_ID,
+    KIND_STD_MASK,
+    KIND_STD_ID,
+    KIND_COUNT
+};
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Identifier width mask of a rule
+ */
+static inline uint32_t rule_width(const CAN_FilterRule_t *r)
+{
+    return r->ide ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK;
+}
+
+/**
+ * @brief  Rule class
+ */
+static uint32_t rule_kind(const CAN_FilterRule_t *r)
+{
+    uint32_t exact = ((r->mask & rule_width(r)) == rule_width(r));
+
+    if (r->ide)
+    {
+        return exact ? KIND_EXT_ID : KIND_EXT_MASK;
+    }
+    return exact ? KIND_STD_ID : KIND_STD_MASK;
+}
+
+/**
+ * @brief  1 if every frame accepted by rule a is also accepted by rule b
+ */
+static uint32_t rule_covered(const CAN_FilterRule_t *a, const CAN_FilterRule_t *b)
+{
+    uint32_t w = rule_width(a);
+    uint32_t ma = a->mask & w;
+    uint32_t mb = b->mask & w;
+
+    if ((a->ide != b->ide) || (a->fifo != b->fifo))
+    {
+        return 0U;
+    }
+    return ((mb & ~ma) == 0U) && (((a->id ^ b->id) & mb) == 0U);
+}
+
+/** 32-bit layout identifier of a rule */
+static uint32_t f32_id(const CAN_FilterRule_t *r)
+{
+    if (r->ide)
+    {
+        return ((r->id & CAN_EXT_ID_MASK) << 3) | RIR_IDE;
+    }
+    return (r->id & CAN_STD_ID_MASK) << 21;
+}
+
+/** 32-bit layout mask of a rule (IDE always compared, RTR ignored) */
+static uint32_t f32_mask(const CAN_FilterRule_t *r)
+{
+    if (r->ide)
+    {
+        return ((r->mask & CAN_EXT_ID_MASK) << 3) | RIR_IDE;
+    }
+    return ((r->mask & CAN_STD_ID_MASK) << 21) | RIR_IDE;
+}
+
+/** 16-bit layout identifier of a standard rule */
+static uint32_t f16_id(const CAN_FilterRule_t *r)
+{
+    return (r->id & CAN_STD_ID_MASK) << 5;
+}
+
+/** 16-bit layout mask of a standard rule (IDE always compared, RTR ignored) */
+static uint32_t f16_mask(const CAN_FilterRule_t *r)
+{
+    return ((r->mask & CAN_STD_ID_MASK) << 5) | F16_IDE;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Pack rules into the minimum number of filter banks
+ * @param  rules Acceptance rules
+ * @param  count Number of rules
+ * @param  banks Output banks
+ * @param  max   Capacity of banks
+ * @retval Number of banks used, or -1 if they do not fit
+ */
+int32_t bare_can_filter_pack(const CAN_FilterRule_t *rules, uint32_t count,
+                             CAN_FilterBank_t *banks, uint32_t max)
+{
+    uint8_t list[KIND_COUNT][CAN_FILTER_MAX_RULES]; // Rule indices by class
+    uint32_t n[KIND_COUNT];
+    uint32_t used = 0U;
+    uint32_t fifo;
+    uint32_t i;
+    uint32_t j;
+
+    if (count > CAN_FILTER_MAX_RULES)
+    {
+        return -1;
+    }
+
+    for (fifo = 0U; fifo < 2U; fifo++)
+    {
+        uint32_t k;
+        uint32_t s = 0U; // Next standard ID to place
+
+        /* 1. Classify, dropping rules another rule already accepts */
+        for (k = 0U; k < KIND_COUNT; k++)
+        {
+            n[k] = 0U;
+        }
+        for (i = 0U; i < count; i++)
+        {
+            uint32_t drop = 0U;
+
+            if (rules[i].fifo != fifo)
+            {
+                continue;
+            }
+            for (j = 0U; (j < count) && !drop; j++)
+            {
+                if ((j != i) && rule_covered(&rules[i], &rules[j]) &&
+                    (!rule_covered(&rules[j], &rules[i]) || (j < i)))
+                {
+                    drop = 1U;
+                }
+            }
+            if (!drop)
+            {
+                k = rule_kind(&rules[i]);
+                list[k][n[k]++] = (uint8_t)i;
+            }
+        }
+
+        /* 2. Bank count is fixed by the classes, check it before writing anything */
+        {
+            uint32_t se = n[KIND_STD_ID];
+            uint32_t need = n[KIND_EXT_MASK] + ((n[KIND_EXT_ID] + 1U) / 2U) +
+                            ((n[KIND_STD_MASK] + 1U) / 2U);
+
+            se -= ((n[KIND_EXT_ID] & 1U) && se) ? 1U : 0U;
+            se -= ((n[KIND_STD_MASK] & 1U) && se) ? 1U : 0U;
+            need += (se + 3U) / 4U;
+            if ((used + need) > max)
+            {
+                return -1;
+            }
+        }
+
+        /* 3. Extended mask rules: one 32-bit mask bank each */
+        for (i = 0U; i < n[KIND_EXT_MASK]; i++)
+        {
+            CAN_FilterBank_t *b = &banks[used++];
+
+            b->mode = CAN_FILTER_MASK;
+            b->scale = CAN_FILTER_32BIT;
+            b->fifo = (uint8_t)fifo;
+            b->fr1 = f32_id(&rules[list[KIND_EXT_MASK][i]]);
+            b->fr2 = f32_mask(&rules[list[KIND_EXT_MASK][i]]);
+        }
+
+        /* 4. Extended IDs: pairs in 32-bit list banks */
+        for (i = 0U; i < n[KIND_EXT_ID]; i += 2U)
+        {
+            CAN_FilterBank_t *b = &banks[used++];
+
+            b->mode = CAN_FILTER_LIST;
+            b->scale = CAN_FILTER_32BIT;
+            b->fifo = (uint8_t)fifo;
+            b->fr1 = f32_id(&rules[list[KIND_EXT_ID][i]]);
+            if ((i + 1U) < n[KIND_EXT_ID])
+            {
+                b->fr2 = f32_id(&rules[list[KIND_EXT_ID][i + 1U]]);
+            }
+            else if (s < n[KIND_STD_ID])
+            {
+                b->fr2 = f32_id(&rules[list[KIND_STD_ID][s++]]);
+            }
+            else
+            {
+                b->fr2 = b->fr1;
+            }
+        }
+
+        /* 5. Standard mask rules: pairs in 16-bit mask banks */
+        for (i = 0U; i < n[KIND_STD_MASK]; i += 2U)
+        {
+            CAN_FilterBank_t *b = &banks[used++];
+            const CAN_FilterRule_t *r0 = &rules[list[KIND_STD_MASK][i]];
+            const CAN_FilterRule_t *r1 = r0;
+
+            if ((i + 1U) < n[KIND_STD_MASK])
+            {
+                r1 = &rules[list[KIND_STD_MASK][i + 1U]];
+            }
+            else if (s < n[KIND_STD_ID])
+            {
+                r1 = &rules[list[KIND_STD_ID][s++]];
+            }
+
+            b->mode = CAN_FILTER_MASK;
+            b->scale = CAN_FILTER_16BIT;
+            b->fifo = (uint8_t)fifo;
+            b->fr1 = f16_id(r0) | (f16_mask(r0) << 16);
+            b->fr2 = f16_id(r1) | (f16_mask(r1) << 16);
+        }
+
+        /* 6. Remaining standard IDs: four per 16-bit list bank */
+        while (s < n[KIND_STD_ID])
+        {
+            CAN_FilterBank_t *b = &banks[used++];
+            uint32_t v[4];
+
+            for (k = 0U; k < 4U; k++)
+            {
+                v[k] = (s < n[KIND_STD_ID]) ? f16_id(&rules[list[KIND_STD_ID][s++]]) : v[0];
+            }
+
+            b->mode = CAN_FILTER_LIST;
+            b->scale = CAN_FILTER_16BIT;
+            b->fifo = (uint8_t)fifo;
+            b->fr1 = v[0] | (v[1] << 16);
+            b->fr2 = v[2] | (v[3] << 16);
+        }
+    }
+
+    return (int32_t)used;
+}
+
+/**
+ * @brief  Check a frame identifier against a packed bank
+ * @param  bank Filter bank
+ * @param  id   Frame identifier
+ * @param  ide  1 = extended identifier
+ * @param  rtr  1 = remote frame
+ * @retval 1 if the bank accepts the frame
+ */
+uint8_t bare_can_filter_match(const CAN_FilterBank_t *bank, uint32_t id, uint8_t ide,
+                              uint8_t rtr)
+{
+    uint32_t img;
+
+    if (bank->scale == CAN_FILTER_32BIT)
+    {
+        img = ide ? (((id & CAN_EXT_ID_MASK) << 3) | RIR_IDE) : ((id & CAN_STD_ID_MASK) << 21);
+        img |= rtr ? RIR_RTR : 0U;
+
+        if (bank->mode == CAN_FILTER_LIST)
+        {
+            return (img == bank->fr1) || (img == bank->fr2);
+        }
+        return ((img ^ bank->fr1) & bank->fr2) == 0U;
+    }
+
+    /* 16-bit layout: STID[10:0] RTR IDE EXID[17:15] */
+    if (ide)
+    {
+        id &= CAN_EXT_ID_MASK;
+        img = ((id >> 18) << 5) | F16_IDE | ((id >> 15) & 0x7U);
+    }
+    else
+    {
+        img = (id & CAN_STD_ID_MASK) << 5;
+    }
+    img |= rtr ? F16_RTR : 0U;
+
+    if (bank->mode == CAN_FILTER_LIST)
+    {
+        return (img == (bank->fr1 & 0xFFFFU)) || (img == (bank->fr1 >> 16)) ||
+               (img == (bank->fr2 & 0xFFFFU)) || (img == (bank->fr2 >> 16));
+    }
+    return (((img ^ bank->fr1) & (bank->fr1 >> 16) & 0xFFFFU) == 0U) ||
+           (((img ^ bank->fr2) & (bank->fr2 >> 16) & 0xFFFFU) == 0U);
+}
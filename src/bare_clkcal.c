@@ -0,0 +1,515 @@
+/*******************************************************************************************
+ * @file    bare_clkcal.c
+ * @author  ka5j
+ * @brief   HSI trimming and USART baud calibration implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Frequency measurement: the timer runs undivided from TIMCLK1 and captures every
+ *          1, 2, 4 or 8 reference edges (ICxPSC), the largest prescaler that keeps the
+ *          interval between captures under half the counter range, so 16-bit TIM3/TIM4
+ *          can be used with fast references. The first capture only opens the window;
+ *          the tick deltas of the following ones are summed with wrap-around, giving
+ *          ticks per reference period with a resolution of one tick over the whole window
+ *          (1 / 16 s by default: below 1 ppm from 16 MHz).
+ *
+ *          HSITRIM moves the HSI monotonically, so walking it toward the reference and
+ *          stopping at the first sign change (or when the error stops shrinking) finds
+ *          the best step without knowing the step size of the part.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "rcc_registers.h"
+#include "pwr_registers.h"
+#include "tim2_5_registers.h"
+#include "usart_registers.h"
+#include "dwt_registers.h"
+#include "bare_clkcal.h"
+#include "bare_rcc.h"
+#include "bare_dwt.h"
+#include "bare_gpio.h"
+#include "bare_periph.h"
+#include "bare_tim2_5.h"
+#include "bare_usart.h"
+#include "board_config.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define CLKCAL_TRIM_MAX 31U     /*!< HSITRIM is 5 bits */
+#define CLKCAL_LSE_CHANNEL 3U   /*!< TIM5 CH4 (index from 0) */
+#define CLKCAL_TI4_RMP_LSE 2UL  /*!< TIM5_OR TI4_RMP value for LSE */
+#define CLKCAL_SYNC_EDGES 5U    /*!< Falling edges of 'U': start bit, bits 1, 3, 5, 7 */
+#define CLKCAL_SYNC_BITS 8U     /*!< Bit times from the first to the last of them */
+
+/** Capture channel in use */
+typedef struct
+{
+    TIM2_5_TypeDef *tim;
+    uint32_t ch;         /*!< Channel index 0-3 */
+    uint32_t timeout;    /*!< Per-capture timeout in CPU cycles */
+    TIM2_5_Saved_t base; /*!< Time base of the timer's owner */
+    uint32_t ccmr;       /*!< Channel byte of CCMRx before the capture */
+    uint32_t ccer;       /*!< Channel nibble of CCER before the capture */
+} clkcal_capture_t;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Milliseconds to CPU cycles, capped so DWT differences stay unambiguous
+ */
+static uint32_t clkcal_cycles(uint32_t ms)
+{
+    uint64_t cycles = (uint64_t)ms * (bare_rcc_get_hclk() / 1000U);
+
+    return (cycles > 0x7FFFFFFFULL) ? 0x7FFFFFFFUL : (uint32_t)cycles;
+}
+
+/**
+ * @brief  Check whether the APB1 timer clock is derived from HSI
+ */
+static uint8_t clkcal_hsi_clocked(void)
+{
+    uint32_t sws = (RCC->CFGR >> 2) & 0x3UL;
+
+    if (sws == 0x0U)
+    {
+        return 1U; // HSI
+    }
+    if (sws == 0x1U)
+    {
+        return 0U; // HSE
+    }
+    return (RCC->PLLCFGR & (1UL << 22)) ? 0U : 1U; // PLLSRC
+}
+
+/**
+ * @brief  Start the LSE (kept running afterwards) and route it to TIM5 CH4
+ * @retval CLKCAL_OK or CLKCAL_ERR_TIMEOUT
+ */
+static CLKCAL_Status_t clkcal_lse_start(uint32_t timeout)
+{
+    uint32_t t0;
+
+    if (!(RCC->BDCR & RCC_BDCR_LSERDY))
+    {
+        bare_periph_enable_clock(PERIPH_PWR);
+        PWR->CR |= PWR_CR_DBP; // Backup domain write access for BDCR
+        RCC->BDCR |= RCC_BDCR_LSEON;
+
+        t0 = bare_dwt_cycles();
+        while (!(RCC->BDCR & RCC_BDCR_LSERDY))
+        {
+            if ((bare_dwt_cycles() - t0) > timeout)
+            {
+                return CLKCAL_ERR_TIMEOUT;
+            }
+        }
+    }
+
+    bare_periph_enable_clock(bare_periph_tim2_5(TIM5));
+    TIM5->OR = (TIM5->OR & ~TIM5_OR_TI4_RMP_Msk) | (CLKCAL_TI4_RMP_LSE << TIM5_OR_TI4_RMP_Pos);
+    return CLKCAL_OK;
+}
+
+/**
+ * @brief  Drop the capture and overcapture flags of the channel, leaving the others
+ */
+static void clkcal_capture_clear(const clkcal_capture_t *cap)
+{
+    uint32_t flag = 1UL << (cap->ch + 1U); // CCxIF
+
+    cap->tim->SR = ~(flag | (flag << 8)); // rc_w0: CCxIF and CCxOF only
+}
+
+/**
+ * @brief  Run a timer undivided and make one channel capture its own input
+ * @param  psc_field: ICxPSC (capture every 2^psc_field edges)
+ * @param  falling: 1 = capture falling edges
+ * @note   The owner's time base and the channel setup are saved for clkcal_capture_stop().
+ */
+static void clkcal_capture_start(clkcal_capture_t *cap, uint32_t psc_field, uint8_t falling)
+{
+    TIM2_5_TypeDef *TIMx = cap->tim;
+    volatile uint32_t *ccmr = (cap->ch < 2U) ? &TIMx->CCMR1 : &TIMx->CCMR2;
+    uint32_t shift = (cap->ch & 1U) * 8U;
+
+    bare_periph_enable_clock(bare_periph_tim2_5(TIMx));
+    bare_tim2_5_save(TIMx, &cap->base);
+    cap->ccmr = (*ccmr >> shift) & 0xFFUL;
+    cap->ccer = (TIMx->CCER >> (cap->ch * 4U)) & 0xFUL;
+
+    /* Undivided TIMCLK1 at full counter width; UG loads PSC without raising UIF */
+    TIMx->CR1 |= TIM_CR1_URS;
+    TIMx->PSC = 0U;
+    TIMx->ARR = ((TIMx == TIM2) || (TIMx == TIM5)) ? 0xFFFFFFFFUL : 0xFFFFUL;
+    TIMx->EGR = TIM_EGR_UG;
+
+    TIMx->CCER &= ~(0xFUL << (cap->ch * 4U));
+    *ccmr = (*ccmr & ~(0xFFUL << shift)) |
+            ((TIM_CCMR_CCS_TI | (psc_field << TIM_CCMR_ICPSC_Pos)) << shift);
+    TIMx->CCER |= (1UL | (falling ? 2UL : 0UL)) << (cap->ch * 4U); // CCxE, CCxP
+    clkcal_capture_clear(cap);
+    TIMx->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+ * @brief  Hand the timer back: channel setup and time base as saved, TIM5 input remap
+ * @note   Clock gate, NVIC vector, DIER and the other channels were never touched.
+ */
+static void clkcal_capture_stop(const clkcal_capture_t *cap)
+{
+    TIM2_5_TypeDef *TIMx = cap->tim;
+    volatile uint32_t *ccmr = (cap->ch < 2U) ? &TIMx->CCMR1 : &TIMx->CCMR2;
+    uint32_t shift = (cap->ch & 1U) * 8U;
+
+    TIMx->CCER &= ~(0xFUL << (cap->ch * 4U)); // CCxS is only writable with CCxE off
+    *ccmr = (*ccmr & ~(0xFFUL << shift)) | (cap->ccmr << shift);
+    TIMx->CCER |= cap->ccer << (cap->ch * 4U);
+    clkcal_capture_clear(cap); // No stale capture or overcapture left pending
+    bare_tim2_5_restore(TIMx, &cap->base);
+    if (TIMx == TIM5)
+    {
+        TIM5->OR &= ~TIM5_OR_TI4_RMP_Msk;
+    }
+}
+
+/**
+ * @brief  Wait for the next capture
+ * @param  stamp: Receives the captured counter value
+ * @retval CLKCAL_OK, CLKCAL_ERR_TIMEOUT or CLKCAL_ERR_OVERRUN
+ */
+static CLKCAL_Status_t clkcal_capture_wait(const clkcal_capture_t *cap, uint32_t *stamp)
+{
+    TIM2_5_TypeDef *TIMx = cap->tim;
+    uint32_t flag = 1UL << (cap->ch + 1U); // CCxIF
+    uint32_t t0 = bare_dwt_cycles();
+
+    while (!(TIMx->SR & flag))
+    {
+        if ((bare_dwt_cycles() - t0) > cap->timeout)
+        {
+            return CLKCAL_ERR_TIMEOUT;
+        }
+    }
+    *stamp = (&TIMx->CCR1)[cap->ch]; // Reading CCRx clears CCxIF
+
+    if (TIMx->SR & (flag << 8)) // CCxOF: a capture came while CCxIF was still set
+    {
+        TIMx->SR = ~(flag << 8);
+        return CLKCAL_ERR_OVERRUN;
+    }
+    return CLKCAL_OK;
+}
+
+/**
+ * @brief  Timer ticks over a number of reference periods, error in ppm of the nominal clock
+ */
+static CLKCAL_Status_t clkcal_measure(const CLKCAL_Config_t *cfg, int32_t *ppm)
+{
+    clkcal_capture_t cap;
+    uint32_t ref_hz = (cfg->ref_hz != 0U) ? cfg->ref_hz : LSE_VALUE;
+    uint32_t timclk = bare_rcc_get_timclk1();
+    uint32_t periods = (cfg->periods != 0U) ? cfg->periods : (ref_hz / 16U);
+    uint32_t psc_field = 3U;
+    uint32_t range, captures, prev, now, i;
+    uint64_t ticks = 0U;
+    int64_t expected, diff;
+    CLKCAL_Status_t st;
+
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA))
+    {
+        bare_dwt_init();
+    }
+    cap.timeout = clkcal_cycles((cfg->timeout_ms != 0U) ? cfg->timeout_ms : CLKCAL_TIMEOUT_MS);
+
+    if (cfg->ref == CLKCAL_REF_LSE)
+    {
+        cap.tim = TIM5;
+        cap.ch = CLKCAL_LSE_CHANNEL;
+        st = clkcal_lse_start(cap.timeout);
+        if (st != CLKCAL_OK)
+        {
+            return st;
+        }
+    }
+    else
+    {
+        if ((cfg->tim == NULL) || (cfg->port == NULL) || (cfg->channel < CHANNEL1) ||
+            (cfg->channel > CHANNEL4))
+        {
+            return CLKCAL_ERR_PARAM;
+        }
+        cap.tim = cfg->tim;
+        cap.ch = (uint32_t)cfg->channel - 1U;
+        bare_tim2_5_set_pin(cap.tim, cfg->port, cfg->pin);
+    }
+
+    /* Largest edge prescaler whose capture interval stays under half the counter range */
+    range = ((cap.tim == TIM2) || (cap.tim == TIM5)) ? 0xFFFFFFFFUL : 0xFFFFUL;
+    while ((psc_field > 0U) && (((uint64_t)timclk << psc_field) / ref_hz > (range >> 1)))
+    {
+        psc_field--;
+    }
+    if (((uint64_t)timclk << psc_field) / ref_hz > (range >> 1))
+    {
+        return CLKCAL_ERR_PARAM; // Reference too slow for a 16-bit timer
+    }
+    captures = periods >> psc_field;
+    captures = (captures == 0U) ? 1U : captures;
+
+    clkcal_capture_start(&cap, psc_field, 0U);
+    st = clkcal_capture_wait(&cap, &prev); // Opens the window
+    for (i = 0U; (st == CLKCAL_OK) && (i < captures); i++)
+    {
+        st = clkcal_capture_wait(&cap, &now);
+        ticks += (now - prev) & range;
+        prev = now;
+    }
+    clkcal_capture_stop(&cap);
+    if (st != CLKCAL_OK)
+    {
+        return st;
+    }
+
+    /* ticks / (captures << psc) reference periods vs timclk / ref_hz nominal */
+    expected = (int64_t)timclk * (int64_t)(captures << psc_field);
+    diff = ((int64_t)ticks * (int64_t)ref_hz) - expected;
+    *ppm = (int32_t)((diff * 1000) / (expected / 1000));
+    return CLKCAL_OK;
+}
+
+/**
+ * @brief  Program HSITRIM
+ */
+static void clkcal_set_trim(uint32_t trim)
+{
+    RCC->CR = (RCC->CR & ~RCC_CR_HSITRIM_Msk) | (trim << RCC_CR_HSITRIM_Pos);
+}
+
+/**
+ * @brief  Absolute value of an error
+ */
+static inline uint32_t clkcal_abs(int32_t v)
+{
+    return (v < 0) ? (uint32_t)(-v) : (uint32_t)v;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Measure the timer clock against the reference
+ * @param  cfg: Reference configuration
+ * @param  ppm: Receives the error in ppm (positive: clock fast)
+ * @retval CLKCAL_OK or an error
+ */
+CLKCAL_Status_t bare_clkcal_measure(const CLKCAL_Config_t *cfg, int32_t *ppm)
+{
+    if ((cfg == NULL) || (ppm == NULL))
+    {
+        return CLKCAL_ERR_PARAM;
+    }
+    return clkcal_measure(cfg, ppm);
+}
+
+/**
+ * @brief  Trim the HSI toward the reference
+ * @param  cfg: Reference configuration
+ * @param  res: Receives the trim steps and errors
+ * @retval CLKCAL_OK, CLKCAL_ERR_RANGE or a measurement error
+ */
+CLKCAL_Status_t bare_clkcal_trim_hsi(const CLKCAL_Config_t *cfg, CLKCAL_Result_t *res)
+{
+    uint32_t trim, best;
+    int32_t prev, err, best_err;
+    int32_t dir;
+    CLKCAL_Status_t st;
+
+    if ((cfg == NULL) || (res == NULL))
+    {
+        return CLKCAL_ERR_PARAM;
+    }
+    if (!clkcal_hsi_clocked())
+    {
+        return CLKCAL_ERR_SOURCE;
+    }
+
+    trim = (RCC->CR & RCC_CR_HSITRIM_Msk) >> RCC_CR_HSITRIM_Pos;
+    res->initial_trim = (uint8_t)trim;
+    res->trim = (uint8_t)trim;
+    res->steps = 1U;
+
+    st = clkcal_measure(cfg, &err);
+    if (st != CLKCAL_OK)
+    {
+        return st;
+    }
+    res->initial_ppm = err;
+    res->residual_ppm = err;
+
+    best = trim;
+    best_err = err;
+    prev = err;
+    dir = (err > 0) ? -1 : 1; // A higher trim speeds the HSI up
+
+    while (err != 0)
+    {
+        if (((dir < 0) && (trim == 0U)) || ((dir > 0) && (trim == CLKCAL_TRIM_MAX)))
+        {
+            st = CLKCAL_ERR_RANGE;
+            break;
+        }
+        trim = (uint32_t)((int32_t)trim + dir);
+        clkcal_set_trim(trim);
+
+        st = clkcal_measure(cfg, &err);
+        res->steps++;
+        if (st != CLKCAL_OK)
+        {
+            break;
+        }
+        if (clkcal_abs(err) < clkcal_abs(best_err))
+        {
+            best = trim;
+            best_err = err;
+        }
+        if (((err > 0) != (prev > 0)) || (clkcal_abs(err) >= clkcal_abs(prev)))
+        {
+            break; // Crossed the reference, or no longer improving
+        }
+        prev = err;
+    }
+
+    clkcal_set_trim(best);
+    res->trim = (uint8_t)best;
+    res->residual_ppm = best_err;
+    return st;
+}
+
+/**
+ * @brief  Measure a sync character 'U' on PA3 and tune the USART2 baud rate to it
+ * @param  TIMx: TIM2 or TIM5 (CH4 on PA3)
+ * @param  nominal: Expected rate, 0 to accept any
+ * @param  timeout_ms: Time to wait for the sync character
+ * @param  baud: Receives the measured rate (may be NULL)
+ * @retval CLKCAL_OK, CLKCAL_ERR_TIMEOUT, CLKCAL_ERR_RANGE or CLKCAL_ERR_PARAM
+ *
+ * @note   Falling edges are captured into a sliding window of five. The window is
+ *         accepted once its four intervals agree within 1/8 of the shortest one, which
+ *         only the two-bit spacing inside 'U' produces reliably; the nominal rate rejects
+ *         the rarer byte streams with evenly spaced falling edges at other distances.
+ */
+CLKCAL_Status_t bare_clkcal_autobaud(TIM2_5_TypeDef *TIMx, uint32_t nominal,
+                                     uint32_t timeout_ms, uint32_t *baud)
+{
+    clkcal_capture_t cap;
+    uint32_t stamp[CLKCAL_SYNC_EDGES];
+    uint32_t timclk = bare_rcc_get_timclk1();
+    uint32_t limit, t0, count, lo, hi, d, i, rate = 0U;
+    CLKCAL_Status_t st = CLKCAL_ERR_TIMEOUT;
+
+    if ((TIMx != TIM2) && (TIMx != TIM5))
+    {
+        return CLKCAL_ERR_PARAM;
+    }
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA))
+    {
+        bare_dwt_init();
+    }
+
+    cap.tim = TIMx;
+    cap.ch = 3U; // CH4 on PA3 for both timers
+    limit = clkcal_cycles(timeout_ms);
+    count = 0U;
+
+    clkcal_capture_start(&cap, 0U, 1U);
+    bare_tim2_5_set_pin(TIMx, GPIOA, GPIO_PIN3); // PA3 leaves USART2 RX
+    clkcal_capture_clear(&cap);                  // Edge of the pin switch, if any
+
+    t0 = bare_dwt_cycles();
+    while ((bare_dwt_cycles() - t0) < limit)
+    {
+        uint32_t now;
+
+        cap.timeout = limit - (bare_dwt_cycles() - t0);
+        if (clkcal_capture_wait(&cap, &now) != CLKCAL_OK)
+        {
+            count = 0U; // Missed an edge or no activity: start a new window
+            continue;
+        }
+        for (i = 1U; i < CLKCAL_SYNC_EDGES; i++)
+        {
+            stamp[i - 1U] = stamp[i];
+        }
+        stamp[CLKCAL_SYNC_EDGES - 1U] = now;
+        if (++count < CLKCAL_SYNC_EDGES)
+        {
+            continue;
+        }
+
+        lo = 0xFFFFFFFFUL;
+        hi = 0U;
+        for (i = 1U; i < CLKCAL_SYNC_EDGES; i++)
+        {
+            d = stamp[i] - stamp[i - 1U];
+            lo = (d < lo) ? d : lo;
+            hi = (d > hi) ? d : hi;
+        }
+        if ((lo == 0U) || ((hi - lo) > (lo >> 3)))
+        {
+            continue;
+        }
+
+        rate = (uint32_t)(((uint64_t)timclk * CLKCAL_SYNC_BITS +
+                           ((stamp[CLKCAL_SYNC_EDGES - 1U] - stamp[0]) >> 1)) /
+                          (stamp[CLKCAL_SYNC_EDGES - 1U] - stamp[0]));
+        if ((nominal == 0U) ||
+            (((rate > nominal) ? (rate - nominal) : (nominal - rate)) <=
+             (nominal / 100U) * CLKCAL_BAUD_TOL_PCT))
+        {
+            st = CLKCAL_OK;
+            break;
+        }
+    }
+
+    /* Hand PA3 back to USART2 and drop whatever it saw meanwhile (SR then DR read) */
+    clkcal_capture_stop(&cap);
+    bare_gpio_set_AF(GPIOA, GPIO_PIN3, bare_periph(PERIPH_USART2)->af);
+    (void)USART2->SR;
+    (void)USART2->DR;
+
+    if (st != CLKCAL_OK)
+    {
+        return st;
+    }
+    if (baud != NULL)
+    {
+        *baud = rate;
+    }
+    return (bare_usart_set_baud(rate) != 0U) ? CLKCAL_OK : CLKCAL_ERR_RANGE;
+}
+
+/**
+ * @brief  Write a trim outcome over USART2
+ * @param  res: Outcome of bare_clkcal_trim_hsi()
+ */
+void bare_clkcal_report(const CLKCAL_Result_t *res)
+{
+    bare_usart_send_string("HSITRIM ");
+    bare_print_u32(res->initial_trim);
+    bare_usart_send_char(' ');
+    bare_print_u32(res->trim);
+    bare_usart_send_string(" PPM ");
+    bare_print_i32(res->initial_ppm);
+    bare_usart_send_char(' ');
+    bare_print_i32(res->residual_ppm);
+    bare_usart_send_string(" STEPS ");
+    bare_print_u32(res->steps);
+    bare_usart_send_string("\r\n");
+}
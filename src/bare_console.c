@@ -0,0 +1,415 @@
+/*******************************************************************************************
+ * @file    bare_console.c
+ * @author  ka5j
+ * @brief   Non-blocking UART command shell for STM32F446RE (USART2)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The USART2 interrupt only stores the byte (a few instructions); line editing,
+ *          history and dispatch run in bare_console_poll(). Supported keys: printable
+ *          characters, Backspace/DEL, Enter (CR or LF, CR LF counted once), Ctrl-C to drop
+ *          the line, and the VT100 arrow-up / arrow-down sequences for history.
+ *******************************************************************************************/
+
+#include "bare_console.h"
+#include "bare_usart.h"
+#include "bare_util.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+
+#define CONSOLE_FNV_BASIS 2166136261UL
+#define CONSOLE_FNV_PRIME 16777619UL
+
+/** Escape sequence decoder */
+typedef enum
+{
+    ESC_NONE = 0U, /*!< Plain input */
+    ESC_START,     /*!< ESC received */
+    ESC_CSI        /*!< ESC [ received */
+} console_esc_t;
+
+/** Built-in command */
+static void console_help(int argc, char *argv[]);
+
+static const CONSOLE_Command_t console_builtin = {"help", console_help, "List commands"};
+
+/** Console state */
+static struct
+{
+    const CONSOLE_Command_t *cmds;
+    uint8_t ncmds;
+    const char *prompt;
+
+    uint8_t slot[CONSOLE_HASH_SIZE];       /*!< Command index + 1, 0 = empty */
+    uint32_t slot_hash[CONSOLE_HASH_SIZE]; /*!< Full hash of the command in the slot */
+
+    uint8_t rx[CONSOLE_RX_RING_SIZE];
+    volatile uint32_t rx_head;             /*!< Written by the USART2 interrupt */
+    volatile uint32_t rx_tail;             /*!< Written by the poll */
+
+    char line[CONSOLE_LINE_MAX];
+    uint8_t len;
+    char history[CONSOLE_HISTORY][CONSOLE_LINE_MAX];
+    uint8_t hist_count;                    /*!< Valid history entries */
+    uint8_t hist_next;                     /*!< Entry written by the next line */
+    uint8_t hist_pos;                      /*!< Steps back while browsing, 0 = editing */
+    console_esc_t esc;
+    char last;                             /*!< Previous byte, to merge CR LF */
+
+    CONSOLE_Stats_t stats;
+} console;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  FNV-1a hash of a NUL-terminated word
+ */
+static uint32_t console_hash(const char *s)
+{
+    uint32_t h = CONSOLE_FNV_BASIS;
+
+    while (*s != '\0')
+    {
+        h = (h ^ (uint8_t)*s++) * CONSOLE_FNV_PRIME;
+    }
+    return h;
+}
+
+/**
+ * @brief  Command by index; the built-in help follows the user table
+ */
+static const CONSOLE_Command_t *console_cmd(uint32_t idx)
+{
+    return (idx < console.ncmds) ? &console.cmds[idx] : &console_builtin;
+}
+
+/**
+ * @brief  Queue bytes for output, counting what does not fit
+ */
+static void console_write(const char *s, uint16_t n)
+{
+    console.stats.tx_dropped += (uint32_t)(n - bare_usart_write(s, n));
+}
+
+/**
+ * @brief  Receive hook, USART2 interrupt context
+ */
+static void console_rx(uint8_t byte)
+{
+    uint32_t head = console.rx_head;
+
+    if ((head - console.rx_tail) >= CONSOLE_RX_RING_SIZE)
+    {
+        console.stats.rx_dropped++;
+        return;
+    }
+    console.rx[head & (CONSOLE_RX_RING_SIZE - 1U)] = byte;
+    BARE_BARRIER(); // Byte stored before it is published
+    console.rx_head = head + 1U;
+}
+
+/**
+ * @brief  Find a command: one hash, normally one probe, one confirming compare
+ * @retval Command, or NULL if unknown
+ */
+static const CONSOLE_Command_t *console_lookup(const char *word)
+{
+    uint32_t h = console_hash(word);
+    uint32_t i = h & (CONSOLE_HASH_SIZE - 1U);
+
+    while (console.slot[i] != 0U)
+    {
+        if (console.slot_hash[i] == h)
+        {
+            const CONSOLE_Command_t *cmd = console_cmd(console.slot[i] - 1U);
+
+            return (strcmp(cmd->name, word) == 0) ? cmd : NULL;
+        }
+        i = (i + 1U) & (CONSOLE_HASH_SIZE - 1U);
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Redraw the prompt and the current line (after a history recall)
+ */
+static void console_redraw(void)
+{
+    console_write("\r\x1b[K", 4U);
+    bare_console_print(console.prompt);
+    console_write(console.line, console.len);
+}
+
+/**
+ * @brief  Replace the line with a history entry (steps back, 0 = empty line)
+ */
+static void console_recall(uint8_t steps)
+{
+    console.hist_pos = steps;
+    if (steps == 0U)
+    {
+        console.len = 0U;
+    }
+    else
+    {
+        uint32_t idx = (console.hist_next + CONSOLE_HISTORY - steps) % CONSOLE_HISTORY;
+
+        strcpy(console.line, console.history[idx]);
+        console.len = (uint8_t)strlen(console.line);
+    }
+    console_redraw();
+}
+
+/**
+ * @brief  Split the line into words and run the command
+ */
+static void console_execute(void)
+{
+    char *argv[CONSOLE_ARGS_MAX];
+    int argc = 0;
+    char *p = console.line;
+    const CONSOLE_Command_t *cmd;
+
+    console.line[console.len] = '\0';
+    if (console.len != 0U)
+    {
+        strcpy(console.history[console.hist_next], console.line);
+        console.hist_next = (uint8_t)((console.hist_next + 1U) % CONSOLE_HISTORY);
+        if (console.hist_count < CONSOLE_HISTORY)
+        {
+            console.hist_count++;
+        }
+    }
+
+    while ((*p != '\0') && (argc < (int)CONSOLE_ARGS_MAX))
+    {
+        while (*p == ' ')
+        {
+            *p++ = '\0';
+        }
+        if (*p == '\0')
+        {
+            break;
+        }
+        argv[argc++] = p;
+        while ((*p != ' ') && (*p != '\0'))
+        {
+            p++;
+        }
+    }
+
+    if (argc != 0)
+    {
+        console.stats.lines++;
+        cmd = console_lookup(argv[0]);
+        if (cmd != NULL)
+        {
+            cmd->handler(argc, argv);
+        }
+        else
+        {
+            console.stats.unknown++;
+            bare_console_print("unknown command: ");
+            bare_console_print(argv[0]);
+            bare_console_print("\r\n");
+        }
+    }
+
+    console.len = 0U;
+    console.hist_pos = 0U;
+    bare_console_print(console.prompt);
+}
+
+/**
+ * @brief  Line editor: handle one received byte
+ */
+static void console_key(char c)
+{
+    char prev = console.last;
+
+    console.last = c;
+
+    if (console.esc == ESC_START)
+    {
+        console.esc = (c == '[') ? ESC_CSI : ESC_NONE;
+        return;
+    }
+    if (console.esc == ESC_CSI)
+    {
+        console.esc = ESC_NONE;
+        if ((c == 'A') && (console.hist_pos < console.hist_count))
+        {
+            console_recall((uint8_t)(console.hist_pos + 1U)); // Arrow up: older
+        }
+        else if ((c == 'B') && (console.hist_pos != 0U))
+        {
+            console_recall((uint8_t)(console.hist_pos - 1U)); // Arrow down: newer
+        }
+        return;
+    }
+
+    switch (c)
+    {
+    case '\x1b':
+        console.esc = ESC_START;
+        break;
+    case '\r':
+    case '\n':
+        if ((c == '\n') && (prev == '\r'))
+        {
+            break; // Second half of CR LF
+        }
+        bare_console_print("\r\n");
+        console_execute();
+        break;
+    case '\b':
+    case '\x7f':
+        if (console.len != 0U)
+        {
+            console.len--;
+            console_write("\b \b", 3U);
+        }
+        break;
+    case '\x03': // Ctrl-C
+        console.len = 0U;
+        console.hist_pos = 0U;
+        bare_console_print("^C\r\n");
+        bare_console_print(console.prompt);
+        break;
+    default:
+        if ((c >= ' ') && (c <= '~') && (console.len < (CONSOLE_LINE_MAX - 1U)))
+        {
+            console.line[console.len++] = c;
+            console_write(&c, 1U); // Echo
+        }
+        break;
+    }
+}
+
+/**
+ * @brief  Built-in "help": list every command with its description
+ */
+static void console_help(int argc, char *argv[])
+{
+    uint32_t i;
+
+    (void)argc;
+    (void)argv;
+
+    for (i = 0U; i <= console.ncmds; i++)
+    {
+        const CONSOLE_Command_t *cmd = console_cmd(i);
+
+        bare_console_print(cmd->name);
+        bare_console_print(" - ");
+        bare_console_print((cmd->help != NULL) ? cmd->help : "");
+        bare_console_print("\r\n");
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Build the command index, hook USART2 reception and print the prompt
+ * @param  cmds: Command table (referenced, must stay valid)
+ * @param  n: Number of entries
+ * @param  prompt: Prompt string (referenced)
+ * @retval CONSOLE_OK, CONSOLE_ERR_FULL or CONSOLE_ERR_DUPLICATE
+ */
+CONSOLE_Status_t bare_console_init(const CONSOLE_Command_t *cmds, uint8_t n,
+                                   const char *prompt)
+{
+    uint32_t c;
+
+    if (((uint32_t)n + 1U) * 2U > CONSOLE_HASH_SIZE)
+    {
+        return CONSOLE_ERR_FULL; // Keep the index at most half full: short probes
+    }
+
+    memset(&console, 0, sizeof(console));
+    console.cmds = cmds;
+    console.ncmds = n;
+    console.prompt = prompt;
+
+    for (c = 0U; c <= n; c++)
+    {
+        uint32_t h = console_hash(console_cmd(c)->name);
+        uint32_t i = h & (CONSOLE_HASH_SIZE - 1U);
+
+        while (console.slot[i] != 0U)
+        {
+            if (console.slot_hash[i] == h)
+            {
+                console.ncmds = 0U;
+                memset(console.slot, 0, sizeof(console.slot));
+                return CONSOLE_ERR_DUPLICATE;
+            }
+            i = (i + 1U) & (CONSOLE_HASH_SIZE - 1U);
+        }
+        console.slot[i] = (uint8_t)(c + 1U);
+        console.slot_hash[i] = h;
+    }
+
+    bare_usart_set_rx_callback(console_rx);
+    bare_console_print(prompt);
+    return CONSOLE_OK;
+}
+
+/**
+ * @brief  Process up to CONSOLE_POLL_BUDGET received bytes
+ * @retval None
+ */
+void bare_console_poll(void)
+{
+    uint32_t budget = CONSOLE_POLL_BUDGET;
+
+    while ((budget-- != 0U) && (console.rx_tail != console.rx_head))
+    {
+        uint32_t tail = console.rx_tail;
+        char c;
+
+        BARE_BARRIER(); // Read the byte only after seeing the head move
+        c = (char)console.rx[tail & (CONSOLE_RX_RING_SIZE - 1U)];
+        console.rx_tail = tail + 1U;
+        console_key(c);
+    }
+}
+
+/**
+ * @brief  Queue a string for output without waiting
+ * @param  str: NUL-terminated string
+ * @retval None
+ */
+void bare_console_print(const char *str)
+{
+    console_write(str, (uint16_t)strlen(str));
+}
+
+/**
+ * @brief  Queue an unsigned decimal number for output
+ * @param  v: Value
+ * @retval None
+ */
+void bare_console_print_u32(uint32_t v)
+{
+    char buf[BARE_U32_CHARS];
+
+    bare_console_print(bare_fmt_u32(buf, v));
+}
+
+/**
+ * @brief  Console counters
+ * @retval Counters
+ */
+const CONSOLE_Stats_t *bare_console_stats(void)
+{
+    return &console.stats;
+}
@@ -0,0 +1,269 @@
+/*******************************************************************************************
+ * @file    bare_crc.c
+ * @author  ka5j
+ * @brief   Bare-metal CRC calculation unit driver implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The hardware unit processes one 32-bit word per 4 AHB cycles. CRC-32/ISO-HDLC
+ *          is obtained from it by bit-reversing every input word and the final register
+ *          (RBIT on the Cortex-M4). The software paths live in bare_crc_sw.c and take
+ *          over when the unit is busy with a DMA transfer.
+ *
+ *          The hardware unit is a single shared resource: the blocking functions and the
+ *          DMA stream must not be used concurrently from different interrupt levels.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "crc_registers.h"
+#include "bare_crc.h"
+#include "bare_dma.h"
+#include "bare_periph.h"
+
+/*******************************************************************************************
+ *                                Configuration Constants
+ *******************************************************************************************/
+#define CRC_DMA_MAX_CHUNK 0xFFFFUL /*!< NDTR is 16 bits wide */
+
+/*******************************************************************************************
+ *                                  DMA Stream State
+ *******************************************************************************************/
+static struct
+{
+    const uint32_t *next;    /*!< Next word to hand to the DMA */
+    size_t remaining;        /*!< Words not yet programmed into NDTR */
+    CRC_Callback_t cb;       /*!< Completion callback */
+    void *ctx;               /*!< Callback context */
+    volatile uint8_t busy;   /*!< Transfer in progress, unit owned by DMA */
+} crc_dma;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Reverse the bit order of a word (single RBIT instruction on Cortex-M4)
+ */
+static inline uint32_t crc_rbit(uint32_t v)
+{
+#if defined(__ARM_ARCH_7EM__)
+    uint32_t r;
+    __asm volatile("rbit %0, %1" : "=r"(r) : "r"(v));
+    return r;
+#else
+    v = ((v >> 1) & 0x55555555UL) | ((v & 0x55555555UL) << 1);
+    v = ((v >> 2) & 0x33333333UL) | ((v & 0x33333333UL) << 2);
+    v = ((v >> 4) & 0x0F0F0F0FUL) | ((v & 0x0F0F0F0FUL) << 4);
+    v = ((v >> 8) & 0x00FF00FFUL) | ((v & 0x00FF00FFUL) << 8);
+    return (v >> 16) | (v << 16);
+#endif
+}
+
+/**
+ * @brief  Little-endian 32-bit load from any alignment (merged into one LDR on Cortex-M4)
+ */
+static inline uint32_t crc_load_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief  Program the next chunk of the pending DMA transfer
+ */
+static void crc_dma_next_chunk(void)
+{
+    uint16_t n = (crc_dma.remaining > CRC_DMA_MAX_CHUNK) ? (uint16_t)CRC_DMA_MAX_CHUNK
+                                                         : (uint16_t)crc_dma.remaining;
+
+    /* Memory-to-memory: PAR is the source buffer, M0AR the fixed CRC data register */
+    bare_dma_start(BARE_CRC_DMA_STREAM, (uint32_t)crc_dma.next, (uint32_t)&CRC->DR, 0U, n);
+    crc_dma.next += n;
+    crc_dma.remaining -= n;
+}
+
+/**
+ * @brief  DMA stream event handler
+ */
+static void crc_dma_event(uint32_t events, void *ctx)
+{
+    (void)ctx;
+
+    if (events & DMA_EVENT_ERROR)
+    {
+        bare_dma_stop(BARE_CRC_DMA_STREAM);
+        crc_dma.busy = 0U;
+        if (crc_dma.cb != NULL)
+        {
+            crc_dma.cb(CRC_ERROR, 0U, crc_dma.ctx);
+        }
+        return;
+    }
+
+    if (events & DMA_EVENT_COMPLETE)
+    {
+        if (crc_dma.remaining != 0U)
+        {
+            crc_dma_next_chunk();
+            return;
+        }
+
+        crc_dma.busy = 0U;
+        if (crc_dma.cb != NULL)
+        {
+            crc_dma.cb(CRC_OK, CRC->DR, crc_dma.ctx);
+        }
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Enable the CRC peripheral clock and reset the unit
+ */
+void bare_crc_init(void)
+{
+    bare_periph_enable_clock(PERIPH_CRC);
+    bare_crc_reset();
+}
+
+/**
+ * @brief  Reset the CRC unit to 0xFFFFFFFF
+ */
+void bare_crc_reset(void)
+{
+    CRC->CR = CRC_CR_RESET;
+}
+
+/**
+ * @brief  Feed words into the running hardware CRC
+ * @param  words Pointer to 32-bit words
+ * @param  count Number of words
+ * @retval Running CRC value
+ */
+uint32_t bare_crc_feed(const uint32_t *words, size_t count)
+{
+    /* Unrolled so the store stream keeps the AHB write buffer full */
+    while (count >= 4U)
+    {
+        CRC->DR = words[0];
+        CRC->DR = words[1];
+        CRC->DR = words[2];
+        CRC->DR = words[3];
+        words += 4;
+        count -= 4U;
+    }
+
+    while (count--)
+    {
+        CRC->DR = *words++;
+    }
+    return CRC->DR;
+}
+
+/**
+ * @brief  One-shot CRC-32/MPEG-2 of a word buffer
+ * @param  words Pointer to 32-bit words
+ * @param  count Number of words
+ * @retval CRC value
+ */
+uint32_t bare_crc32_stm32(const uint32_t *words, size_t count)
+{
+    if (crc_dma.busy)
+    {
+        return bare_crc32_stm32_sw(BARE_CRC32_STM32_INIT, words, count);
+    }
+
+    bare_crc_reset();
+    return bare_crc_feed(words, count);
+}
+
+/**
+ * @brief  One-shot CRC-32/ISO-HDLC of a byte buffer using the hardware unit
+ * @param  data Pointer to data
+ * @param  len  Length in bytes
+ * @retval CRC value
+ */
+uint32_t bare_crc32(const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    size_t words = len >> 2;
+    uint32_t reg;
+
+    if (crc_dma.busy)
+    {
+        return bare_crc32_sw(BARE_CRC32_INIT, data, len);
+    }
+
+    bare_crc_reset();
+    while (words--)
+    {
+        CRC->DR = crc_rbit(crc_load_le32(p));
+        p += 4;
+    }
+
+    /* Reversed DR is the reflected register state; finish the tail in software */
+    reg = ~crc_rbit(CRC->DR);
+    return bare_crc32_sw(reg, p, len & 0x3U);
+}
+
+/**
+ * @brief  Stream a word buffer through the CRC unit with memory-to-memory DMA
+ * @param  words Word aligned buffer
+ * @param  count Number of words
+ * @param  cb    Completion callback
+ * @param  ctx   Callback context
+ * @retval CRC_OK or CRC_BUSY
+ */
+CRC_Status_t bare_crc_dma_start(const uint32_t *words, size_t count,
+                                CRC_Callback_t cb, void *ctx)
+{
+    const DMA_Config_t cfg = {
+        .channel = 0U,
+        .dir = DMA_DIR_MEM_TO_MEM,
+        .psize = DMA_SIZE_WORD,
+        .msize = DMA_SIZE_WORD,
+        .pinc = 1U,
+        .minc = 0U,
+        .priority = DMA_PRIORITY_LOW,
+        .fifo = DMA_FIFO_HALF, // Memory-to-memory requires FIFO mode
+        .complete_irq = 1U,
+    };
+
+    if (crc_dma.busy)
+    {
+        return CRC_BUSY;
+    }
+
+    bare_crc_reset();
+    if (count == 0U)
+    {
+        if (cb != NULL)
+        {
+            cb(CRC_OK, CRC->DR, ctx);
+        }
+        return CRC_OK;
+    }
+
+    crc_dma.busy = 1U;
+    crc_dma.next = words;
+    crc_dma.remaining = count;
+    crc_dma.cb = cb;
+    crc_dma.ctx = ctx;
+
+    bare_dma_config(BARE_CRC_DMA_STREAM, &cfg);
+    bare_dma_set_callback(BARE_CRC_DMA_STREAM, crc_dma_event, NULL);
+    crc_dma_next_chunk();
+    return CRC_OK;
+}
+
+/**
+ * @brief  Check whether a DMA CRC transfer is in progress
+ * @retval 1 if busy, 0 otherwise
+ */
+uint8_t bare_crc_dma_busy(void)
+{
+    return crc_dma.busy;
+}
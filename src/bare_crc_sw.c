@@ -0,0 +1,565 @@
+/*******************************************************************************************
+ * @file    bare_crc_sw.c
+ * @author  ka5j
+ * @brief   Table-driven software CRC implementations (register free)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Slicing-by-4 tables held in flash (2 x 4 KiB) keep the CRC-32 paths within a
+ *          few cycles per byte. Nothing here touches a peripheral, so this file links into
+ *          host tools and tests on its own (bare_frame, bare_logstore).
+ *******************************************************************************************/
+
+#include "bare_crc_sw.h"
+
+/*******************************************************************************************
+ *                                  Lookup Tables
+ *******************************************************************************************/
+
+/* Reflected CRC-32 (poly 0xEDB88320), slicing-by-4: crc32_ieee_table[k][n] */
+static const uint32_t crc32_ieee_table[4][256] = {
+    {
+        0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU,
+        0xE963A535U, 0x9E6495A3U, 0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U,
+        0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U, 0x1DB71064U, 0x6AB020F2U,
+        0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+        0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U,
+        0xFA0F3D63U, 0x8D080DF5U, 0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U,
+        0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU, 0x35B5A8FAU, 0x42B2986CU,
+        0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+        0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U,
+        0xCFBA9599U, 0xB8BDA50FU, 0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U,
+        0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU, 0x76DC4190U, 0x01DB7106U,
+        0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+        0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU,
+        0x91646C97U, 0xE6635C01U, 0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU,
+        0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U, 0x65B0D9C6U, 0x12B7E950U,
+        0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+        0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U,
+        0xA4D1C46DU, 0xD3D6F4FBU, 0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U,
+        0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U, 0x5005713CU, 0x270241AAU,
+        0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+        0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U,
+        0xB7BD5C3BU, 0xC0BA6CADU, 0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU,
+        0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U, 0xE3630B12U, 0x94643B84U,
+        0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+        0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU,
+        0x196C3671U, 0x6E6B06E7U, 0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU,
+        0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U, 0xD6D6A3E8U, 0xA1D1937EU,
+        0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+        0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U,
+        0x316E8EEFU, 0x4669BE79U, 0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U,
+        0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU, 0xC5BA3BBEU, 0xB2BD0B28U,
+        0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+        0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU,
+        0x72076785U, 0x05005713U, 0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U,
+        0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U, 0x86D3D2D4U, 0xF1D4E242U,
+        0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+        0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U,
+        0x616BFFD3U, 0x166CCF45U, 0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U,
+        0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU, 0xAED16A4AU, 0xD9D65ADCU,
+        0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+        0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U,
+        0x54DE5729U, 0x23D967BFU, 0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U,
+        0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU
+    },
+    {
+        0x00000000U, 0x191B3141U, 0x32366282U, 0x2B2D53C3U, 0x646CC504U, 0x7D77F445U,
+        0x565AA786U, 0x4F4196C7U, 0xC8D98A08U, 0xD1C2BB49U, 0xFAEFE88AU, 0xE3F4D9CBU,
+        0xACB54F0CU, 0xB5AE7E4DU, 0x9E832D8EU, 0x87981CCFU, 0x4AC21251U, 0x53D92310U,
+        0x78F470D3U, 0x61EF4192U, 0x2EAED755U, 0x37B5E614U, 0x1C98B5D7U, 0x05838496U,
+        0x821B9859U, 0x9B00A918U, 0xB02DFADBU, 0xA936CB9AU, 0xE6775D5DU, 0xFF6C6C1CU,
+        0xD4413FDFU, 0xCD5A0E9EU, 0x958424A2U, 0x8C9F15E3U, 0xA7B24620U, 0xBEA97761U,
+        0xF1E8E1A6U, 0xE8F3D0E7U, 0xC3DE8324U, 0xDAC5B265U, 0x5D5DAEAAU, 0x44469FEBU,
+        0x6F6BCC28U, 0x7670FD69U, 0x39316BAEU, 0x202A5AEFU, 0x0B07092CU, 0x121C386DU,
+        0xDF4636F3U, 0xC65D07B2U, 0xED705471U, 0xF46B6530U, 0xBB2AF3F7U, 0xA231C2B6U,
+        0x891C9175U, 0x9007A034U, 0x179FBCFBU, 0x0E848DBAU, 0x25A9DE79U, 0x3CB2EF38U,
+        0x73F379FFU, 0x6AE848BEU, 0x41C51B7DU, 0x58DE2A3CU, 0xF0794F05U, 0xE9627E44U,
+        0xC24F2D87U, 0xDB541CC6U, 0x94158A01U, 0x8D0EBB40U, 0xA623E883U, 0xBF38D9C2U,
+        0x38A0C50DU, 0x21BBF44CU, 0x0A96A78FU, 0x138D96CEU, 0x5CCC0009U, 0x45D73148U,
+        0x6EFA628BU, 0x77E153CAU, 0xBABB5D54U, 0xA3A06C15U, 0x888D3FD6U, 0x91960E97U,
+        0xDED79850U, 0xC7CCA911U, 0xECE1FAD2U, 0xF5FACB93U, 0x7262D75CU, 0x6B79E61DU,
+        0x4054B5DEU, 0x594F849FU, 0x160E1258U, 0x0F152319U, 0x243870DAU, 0x3D23419BU,
+        0x65FD6BA7U, 0x7CE65AE6U, 0x57CB0925U, 0x4ED03864U, 0x0191AEA3U, 0x188A9FE2U,
+        0x33A7CC21U, 0x2ABCFD60U, 0xAD24E1AFU, 0xB43FD0EEU, 0x9F12832DU, 0x8609B26CU,
+        0xC94824ABU, 0xD05315EAU, 0xFB7E4629U, 0xE2657768U, 0x2F3F79F6U, 0x362448B7U,
+        0x1D091B74U, 0x04122A35U, 0x4B53BCF2U, 0x52488DB3U, 0x7965DE70U, 0x607EEF31U,
+        0xE7E6F3FEU, 0xFEFDC2BFU, 0xD5D0917CU, 0xCCCBA03DU, 0x838A36FAU, 0x9A9107BBU,
+        0xB1BC5478U, 0xA8A76539U, 0x3B83984BU, 0x2298A90AU, 0x09B5FAC9U, 0x10AECB88U,
+        0x5FEF5D4FU, 0x46F46C0EU, 0x6DD93FCDU, 0x74C20E8CU, 0xF35A1243U, 0xEA412302U,
+        0xC16C70C1U, 0xD8774180U, 0x9736D747U, 0x8E2DE606U, 0xA500B5C5U, 0xBC1B8484U,
+        0x71418A1AU, 0x685ABB5BU, 0x4377E898U, 0x5A6CD9D9U, 0x152D4F1EU, 0x0C367E5FU,
+        0x271B2D9CU, 0x3E001CDDU, 0xB9980012U, 0xA0833153U, 0x8BAE6290U, 0x92B553D1U,
+        0xDDF4C516U, 0xC4EFF457U, 0xEFC2A794U, 0xF6D996D5U, 0xAE07BCE9U, 0xB71C8DA8U,
+        0x9C31DE6BU, 0x852AEF2AU, 0xCA6B79EDU, 0xD37048ACU, 0xF85D1B6FU, 0xE1462A2EU,
+        0x66DE36E1U, 0x7FC507A0U, 0x54E85463U, 0x4DF36522U, 0x02B2F3E5U, 0x1BA9C2A4U,
+        0x30849167U, 0x299FA026U, 0xE4C5AEB8U, 0xFDDE9FF9U, 0xD6F3CC3AU, 0xCFE8FD7BU,
+        0x80A96BBCU, 0x99B25AFDU, 0xB29F093EU, 0xAB84387FU, 0x2C1C24B0U, 0x350715F1U,
+        0x1E2A4632U, 0x07317773U, 0x4870E1B4U, 0x516BD0F5U, 0x7A468336U, 0x635DB277U,
+        0xCBFAD74EU, 0xD2E1E60FU, 0xF9CCB5CCU, 0xE0D7848DU, 0xAF96124AU, 0xB68D230BU,
+        0x9DA070C8U, 0x84BB4189U, 0x03235D46U, 0x1A386C07U, 0x31153FC4U, 0x280E0E85U,
+        0x674F9842U, 0x7E54A903U, 0x5579FAC0U, 0x4C62CB81U, 0x8138C51FU, 0x9823F45EU,
+        0xB30EA79DU, 0xAA1596DCU, 0xE554001BU, 0xFC4F315AU, 0xD7626299U, 0xCE7953D8U,
+        0x49E14F17U, 0x50FA7E56U, 0x7BD72D95U, 0x62CC1CD4U, 0x2D8D8A13U, 0x3496BB52U,
+        0x1FBBE891U, 0x06A0D9D0U, 0x5E7EF3ECU, 0x4765C2ADU, 0x6C48916EU, 0x7553A02FU,
+        0x3A1236E8U, 0x230907A9U, 0x0824546AU, 0x113F652BU, 0x96A779E4U, 0x8FBC48A5U,
+        0xA4911B66U, 0xBD8A2A27U, 0xF2CBBCE0U, 0xEBD08DA1U, 0xC0FDDE62U, 0xD9E6EF23U,
+        0x14BCE1BDU, 0x0DA7D0FCU, 0x268A833FU, 0x3F91B27EU, 0x70D024B9U, 0x69CB15F8U,
+        0x42E6463BU, 0x5BFD777AU, 0xDC656BB5U, 0xC57E5AF4U, 0xEE530937U, 0xF7483876U,
+        0xB809AEB1U, 0xA1129FF0U, 0x8A3FCC33U, 0x9324FD72U
+    },
+    {
+        0x00000000U, 0x01C26A37U, 0x0384D46EU, 0x0246BE59U, 0x0709A8DCU, 0x06CBC2EBU,
+        0x048D7CB2U, 0x054F1685U, 0x0E1351B8U, 0x0FD13B8FU, 0x0D9785D6U, 0x0C55EFE1U,
+        0x091AF964U, 0x08D89353U, 0x0A9E2D0AU, 0x0B5C473DU, 0x1C26A370U, 0x1DE4C947U,
+        0x1FA2771EU, 0x1E601D29U, 0x1B2F0BACU, 0x1AED619BU, 0x18ABDFC2U, 0x1969B5F5U,
+        0x1235F2C8U, 0x13F798FFU, 0x11B126A6U, 0x10734C91U, 0x153C5A14U, 0x14FE3023U,
+        0x16B88E7AU, 0x177AE44DU, 0x384D46E0U, 0x398F2CD7U, 0x3BC9928EU, 0x3A0BF8B9U,
+        0x3F44EE3CU, 0x3E86840BU, 0x3CC03A52U, 0x3D025065U, 0x365E1758U, 0x379C7D6FU,
+        0x35DAC336U, 0x3418A901U, 0x3157BF84U, 0x3095D5B3U, 0x32D36BEAU, 0x331101DDU,
+        0x246BE590U, 0x25A98FA7U, 0x27EF31FEU, 0x262D5BC9U, 0x23624D4CU, 0x22A0277BU,
+        0x20E69922U, 0x2124F315U, 0x2A78B428U, 0x2BBADE1FU, 0x29FC6046U, 0x283E0A71U,
+        0x2D711CF4U, 0x2CB376C3U, 0x2EF5C89AU, 0x2F37A2ADU, 0x709A8DC0U, 0x7158E7F7U,
+        0x731E59AEU, 0x72DC3399U, 0x7793251CU, 0x76514F2BU, 0x7417F172U, 0x75D59B45U,
+        0x7E89DC78U, 0x7F4BB64FU, 0x7D0D0816U, 0x7CCF6221U, 0x798074A4U, 0x78421E93U,
+        0x7A04A0CAU, 0x7BC6CAFDU, 0x6CBC2EB0U, 0x6D7E4487U, 0x6F38FADEU, 0x6EFA90E9U,
+        0x6BB5866CU, 0x6A77EC5BU, 0x68315202U, 0x69F33835U, 0x62AF7F08U, 0x636D153FU,
+        0x612BAB66U, 0x60E9C151U, 0x65A6D7D4U, 0x6464BDE3U, 0x662203BAU, 0x67E0698DU,
+        0x48D7CB20U, 0x4915A117U, 0x4B531F4EU, 0x4A917579U, 0x4FDE63FCU, 0x4E1C09CBU,
+        0x4C5AB792U, 0x4D98DDA5U, 0x46C49A98U, 0x4706F0AFU, 0x45404EF6U, 0x448224C1U,
+        0x41CD3244U, 0x400F5873U, 0x4249E62AU, 0x438B8C1DU, 0x54F16850U, 0x55330267U,
+        0x5775BC3EU, 0x56B7D609U, 0x53F8C08CU, 0x523AAABBU, 0x507C14E2U, 0x51BE7ED5U,
+        0x5AE239E8U, 0x5B2053DFU, 0x5966ED86U, 0x58A487B1U, 0x5DEB9134U, 0x5C29FB03U,
+        0x5E6F455AU, 0x5FAD2F6DU, 0xE1351B80U, 0xE0F771B7U, 0xE2B1CFEEU, 0xE373A5D9U,
+        0xE63CB35CU, 0xE7FED96BU, 0xE5B86732U, 0xE47A0D05U, 0xEF264A38U, 0xEEE4200FU,
+        0xECA29E56U, 0xED60F461U, 0xE82FE2E4U, 0xE9ED88D3U, 0xEBAB368AU, 0xEA695CBDU,
+        0xFD13B8F0U, 0xFCD1D2C7U, 0xFE976C9EU, 0xFF5506A9U, 0xFA1A102CU, 0xFBD87A1BU,
+        0xF99EC442U, 0xF85CAE75U, 0xF300E948U, 0xF2C2837FU, 0xF0843D26U, 0xF1465711U,
+        0xF4094194U, 0xF5CB2BA3U, 0xF78D95FAU, 0xF64FFFCDU, 0xD9785D60U, 0xD8BA3757U,
+        0xDAFC890EU, 0xDB3EE339U, 0xDE71F5BCU, 0xDFB39F8BU, 0xDDF521D2U, 0xDC374BE5U,
+        0xD76B0CD8U, 0xD6A966EFU, 0xD4EFD8B6U, 0xD52DB281U, 0xD062A404U, 0xD1A0CE33U,
+        0xD3E6706AU, 0xD2241A5DU, 0xC55EFE10U, 0xC49C9427U, 0xC6DA2A7EU, 0xC7184049U,
+        0xC25756CCU, 0xC3953CFBU, 0xC1D382A2U, 0xC011E895U, 0xCB4DAFA8U, 0xCA8FC59FU,
+        0xC8C97BC6U, 0xC90B11F1U, 0xCC440774U, 0xCD866D43U, 0xCFC0D31AU, 0xCE02B92DU,
+        0x91AF9640U, 0x906DFC77U, 0x922B422EU, 0x93E92819U, 0x96A63E9CU, 0x976454ABU,
+        0x9522EAF2U, 0x94E080C5U, 0x9FBCC7F8U, 0x9E7EADCFU, 0x9C381396U, 0x9DFA79A1U,
+        0x98B56F24U, 0x99770513U, 0x9B31BB4AU, 0x9AF3D17DU, 0x8D893530U, 0x8C4B5F07U,
+        0x8E0DE15EU, 0x8FCF8B69U, 0x8A809DECU, 0x8B42F7DBU, 0x89044982U, 0x88C623B5U,
+        0x839A6488U, 0x82580EBFU, 0x801EB0E6U, 0x81DCDAD1U, 0x8493CC54U, 0x8551A663U,
+        0x8717183AU, 0x86D5720DU, 0xA9E2D0A0U, 0xA820BA97U, 0xAA6604CEU, 0xABA46EF9U,
+        0xAEEB787CU, 0xAF29124BU, 0xAD6FAC12U, 0xACADC625U, 0xA7F18118U, 0xA633EB2FU,
+        0xA4755576U, 0xA5B73F41U, 0xA0F829C4U, 0xA13A43F3U, 0xA37CFDAAU, 0xA2BE979DU,
+        0xB5C473D0U, 0xB40619E7U, 0xB640A7BEU, 0xB782CD89U, 0xB2CDDB0CU, 0xB30FB13BU,
+        0xB1490F62U, 0xB08B6555U, 0xBBD72268U, 0xBA15485FU, 0xB853F606U, 0xB9919C31U,
+        0xBCDE8AB4U, 0xBD1CE083U, 0xBF5A5EDAU, 0xBE9834EDU
+    },
+    {
+        0x00000000U, 0xB8BC6765U, 0xAA09C88BU, 0x12B5AFEEU, 0x8F629757U, 0x37DEF032U,
+        0x256B5FDCU, 0x9DD738B9U, 0xC5B428EFU, 0x7D084F8AU, 0x6FBDE064U, 0xD7018701U,
+        0x4AD6BFB8U, 0xF26AD8DDU, 0xE0DF7733U, 0x58631056U, 0x5019579FU, 0xE8A530FAU,
+        0xFA109F14U, 0x42ACF871U, 0xDF7BC0C8U, 0x67C7A7ADU, 0x75720843U, 0xCDCE6F26U,
+        0x95AD7F70U, 0x2D111815U, 0x3FA4B7FBU, 0x8718D09EU, 0x1ACFE827U, 0xA2738F42U,
+        0xB0C620ACU, 0x087A47C9U, 0xA032AF3EU, 0x188EC85BU, 0x0A3B67B5U, 0xB28700D0U,
+        0x2F503869U, 0x97EC5F0CU, 0x8559F0E2U, 0x3DE59787U, 0x658687D1U, 0xDD3AE0B4U,
+        0xCF8F4F5AU, 0x7733283FU, 0xEAE41086U, 0x525877E3U, 0x40EDD80DU, 0xF851BF68U,
+        0xF02BF8A1U, 0x48979FC4U, 0x5A22302AU, 0xE29E574FU, 0x7F496FF6U, 0xC7F50893U,
+        0xD540A77DU, 0x6DFCC018U, 0x359FD04EU, 0x8D23B72BU, 0x9F9618C5U, 0x272A7FA0U,
+        0xBAFD4719U, 0x0241207CU, 0x10F48F92U, 0xA848E8F7U, 0x9B14583DU, 0x23A83F58U,
+        0x311D90B6U, 0x89A1F7D3U, 0x1476CF6AU, 0xACCAA80FU, 0xBE7F07E1U, 0x06C36084U,
+        0x5EA070D2U, 0xE61C17B7U, 0xF4A9B859U, 0x4C15DF3CU, 0xD1C2E785U, 0x697E80E0U,
+        0x7BCB2F0EU, 0xC377486BU, 0xCB0D0FA2U, 0x73B168C7U, 0x6104C729U, 0xD9B8A04CU,
+        0x446F98F5U, 0xFCD3FF90U, 0xEE66507EU, 0x56DA371BU, 0x0EB9274DU, 0xB6054028U,
+        0xA4B0EFC6U, 0x1C0C88A3U, 0x81DBB01AU, 0x3967D77FU, 0x2BD27891U, 0x936E1FF4U,
+        0x3B26F703U, 0x839A9066U, 0x912F3F88U, 0x299358EDU, 0xB4446054U, 0x0CF80731U,
+        0x1E4DA8DFU, 0xA6F1CFBAU, 0xFE92DFECU, 0x462EB889U, 0x549B1767U, 0xEC277002U,
+        0x71F048BBU, 0xC94C2FDEU, 0xDBF98030U, 0x6345E755U, 0x6B3FA09CU, 0xD383C7F9U,
+        0xC1366817U, 0x798A0F72U, 0xE45D37CBU, 0x5CE150AEU, 0x4E54FF40U, 0xF6E89825U,
+        0xAE8B8873U, 0x1637EF16U, 0x048240F8U, 0xBC3E279DU, 0x21E91F24U, 0x99557841U,
+        0x8BE0D7AFU, 0x335CB0CAU, 0xED59B63BU, 0x55E5D15EU, 0x47507EB0U, 0xFFEC19D5U,
+        0x623B216CU, 0xDA874609U, 0xC832E9E7U, 0x708E8E82U, 0x28ED9ED4U, 0x9051F9B1U,
+        0x82E4565FU, 0x3A58313AU, 0xA78F0983U, 0x1F336EE6U, 0x0D86C108U, 0xB53AA66DU,
+        0xBD40E1A4U, 0x05FC86C1U, 0x1749292FU, 0xAFF54E4AU, 0x322276F3U, 0x8A9E1196U,
+        0x982BBE78U, 0x2097D91DU, 0x78F4C94BU, 0xC048AE2EU, 0xD2FD01C0U, 0x6A4166A5U,
+        0xF7965E1CU, 0x4F2A3979U, 0x5D9F9697U, 0xE523F1F2U, 0x4D6B1905U, 0xF5D77E60U,
+        0xE762D18EU, 0x5FDEB6EBU, 0xC2098E52U, 0x7AB5E937U, 0x680046D9U, 0xD0BC21BCU,
+        0x88DF31EAU, 0x3063568FU, 0x22D6F961U, 0x9A6A9E04U, 0x07BDA6BDU, 0xBF01C1D8U,
+        0xADB46E36U, 0x15080953U, 0x1D724E9AU, 0xA5CE29FFU, 0xB77B8611U, 0x0FC7E174U,
+        0x9210D9CDU, 0x2AACBEA8U, 0x38191146U, 0x80A57623U, 0xD8C66675U, 0x607A0110U,
+        0x72CFAEFEU, 0xCA73C99BU, 0x57A4F122U, 0xEF189647U, 0xFDAD39A9U, 0x45115ECCU,
+        0x764DEE06U, 0xCEF18963U, 0xDC44268DU, 0x64F841E8U, 0xF92F7951U, 0x41931E34U,
+        0x5326B1DAU, 0xEB9AD6BFU, 0xB3F9C6E9U, 0x0B45A18CU, 0x19F00E62U, 0xA14C6907U,
+        0x3C9B51BEU, 0x842736DBU, 0x96929935U, 0x2E2EFE50U, 0x2654B999U, 0x9EE8DEFCU,
+        0x8C5D7112U, 0x34E11677U, 0xA9362ECEU, 0x118A49ABU, 0x033FE645U, 0xBB838120U,
+        0xE3E09176U, 0x5B5CF613U, 0x49E959FDU, 0xF1553E98U, 0x6C820621U, 0xD43E6144U,
+        0xC68BCEAAU, 0x7E37A9CFU, 0xD67F4138U, 0x6EC3265DU, 0x7C7689B3U, 0xC4CAEED6U,
+        0x591DD66FU, 0xE1A1B10AU, 0xF3141EE4U, 0x4BA87981U, 0x13CB69D7U, 0xAB770EB2U,
+        0xB9C2A15CU, 0x017EC639U, 0x9CA9FE80U, 0x241599E5U, 0x36A0360BU, 0x8E1C516EU,
+        0x866616A7U, 0x3EDA71C2U, 0x2C6FDE2CU, 0x94D3B949U, 0x090481F0U, 0xB1B8E695U,
+        0xA30D497BU, 0x1BB12E1EU, 0x43D23E48U, 0xFB6E592DU, 0xE9DBF6C3U, 0x516791A6U,
+        0xCCB0A91FU, 0x740CCE7AU, 0x66B96194U, 0xDE0506F1U
+    }
+};
+
+/* Non-reflected CRC-32 (poly 0x04C11DB7), slicing-by-4: crc32_mpeg2_table[k][n] */
+static const uint32_t crc32_mpeg2_table[4][256] = {
+    {
+        0x00000000U, 0x04C11DB7U, 0x09823B6EU, 0x0D4326D9U, 0x130476DCU, 0x17C56B6BU,
+        0x1A864DB2U, 0x1E475005U, 0x2608EDB8U, 0x22C9F00FU, 0x2F8AD6D6U, 0x2B4BCB61U,
+        0x350C9B64U, 0x31CD86D3U, 0x3C8EA00AU, 0x384FBDBDU, 0x4C11DB70U, 0x48D0C6C7U,
+        0x4593E01EU, 0x4152FDA9U, 0x5F15ADACU, 0x5BD4B01BU, 0x569796C2U, 0x52568B75U,
+        0x6A1936C8U, 0x6ED82B7FU, 0x639B0DA6U, 0x675A1011U, 0x791D4014U, 0x7DDC5DA3U,
+        0x709F7B7AU, 0x745E66CDU, 0x9823B6E0U, 0x9CE2AB57U, 0x91A18D8EU, 0x95609039U,
+        0x8B27C03CU, 0x8FE6DD8BU, 0x82A5FB52U, 0x8664E6E5U, 0xBE2B5B58U, 0xBAEA46EFU,
+        0xB7A96036U, 0xB3687D81U, 0xAD2F2D84U, 0xA9EE3033U, 0xA4AD16EAU, 0xA06C0B5DU,
+        0xD4326D90U, 0xD0F37027U, 0xDDB056FEU, 0xD9714B49U, 0xC7361B4CU, 0xC3F706FBU,
+        0xCEB42022U, 0xCA753D95U, 0xF23A8028U, 0xF6FB9D9FU, 0xFBB8BB46U, 0xFF79A6F1U,
+        0xE13EF6F4U, 0xE5FFEB43U, 0xE8BCCD9AU, 0xEC7DD02DU, 0x34867077U, 0x30476DC0U,
+        0x3D044B19U, 0x39C556AEU, 0x278206ABU, 0x23431B1CU, 0x2E003DC5U, 0x2AC12072U,
+        0x128E9DCFU, 0x164F8078U, 0x1B0CA6A1U, 0x1FCDBB16U, 0x018AEB13U, 0x054BF6A4U,
+        0x0808D07DU, 0x0CC9CDCAU, 0x7897AB07U, 0x7C56B6B0U, 0x71159069U, 0x75D48DDEU,
+        0x6B93DDDBU, 0x6F52C06CU, 0x6211E6B5U, 0x66D0FB02U, 0x5E9F46BFU, 0x5A5E5B08U,
+        0x571D7DD1U, 0x53DC6066U, 0x4D9B3063U, 0x495A2DD4U, 0x44190B0DU, 0x40D816BAU,
+        0xACA5C697U, 0xA864DB20U, 0xA527FDF9U, 0xA1E6E04EU, 0xBFA1B04BU, 0xBB60ADFCU,
+        0xB6238B25U, 0xB2E29692U, 0x8AAD2B2FU, 0x8E6C3698U, 0x832F1041U, 0x87EE0DF6U,
+        0x99A95DF3U, 0x9D684044U, 0x902B669DU, 0x94EA7B2AU, 0xE0B41DE7U, 0xE4750050U,
+        0xE9362689U, 0xEDF73B3EU, 0xF3B06B3BU, 0xF771768CU, 0xFA325055U, 0xFEF34DE2U,
+        0xC6BCF05FU, 0xC27DEDE8U, 0xCF3ECB31U, 0xCBFFD686U, 0xD5B88683U, 0xD1799B34U,
+        0xDC3ABDEDU, 0xD8FBA05AU, 0x690CE0EEU, 0x6DCDFD59U, 0x608EDB80U, 0x644FC637U,
+        0x7A089632U, 0x7EC98B85U, 0x738AAD5CU, 0x774BB0EBU, 0x4F040D56U, 0x4BC510E1U,
+        0x46863638U, 0x42472B8FU, 0x5C007B8AU, 0x58C1663DU, 0x558240E4U, 0x51435D53U,
+        0x251D3B9EU, 0x21DC2629U, 0x2C9F00F0U, 0x285E1D47U, 0x36194D42U, 0x32D850F5U,
+        0x3F9B762CU, 0x3B5A6B9BU, 0x0315D626U, 0x07D4CB91U, 0x0A97ED48U, 0x0E56F0FFU,
+        0x1011A0FAU, 0x14D0BD4DU, 0x19939B94U, 0x1D528623U, 0xF12F560EU, 0xF5EE4BB9U,
+        0xF8AD6D60U, 0xFC6C70D7U, 0xE22B20D2U, 0xE6EA3D65U, 0xEBA91BBCU, 0xEF68060BU,
+        0xD727BBB6U, 0xD3E6A601U, 0xDEA580D8U, 0xDA649D6FU, 0xC423CD6AU, 0xC0E2D0DDU,
+        0xCDA1F604U, 0xC960EBB3U, 0xBD3E8D7EU, 0xB9FF90C9U, 0xB4BCB610U, 0xB07DABA7U,
+        0xAE3AFBA2U, 0xAAFBE615U, 0xA7B8C0CCU, 0xA379DD7BU, 0x9B3660C6U, 0x9FF77D71U,
+        0x92B45BA8U, 0x9675461FU, 0x8832161AU, 0x8CF30BADU, 0x81B02D74U, 0x857130C3U,
+        0x5D8A9099U, 0x594B8D2EU, 0x5408ABF7U, 0x50C9B640U, 0x4E8EE645U, 0x4A4FFBF2U,
+        0x470CDD2BU, 0x43CDC09CU, 0x7B827D21U, 0x7F436096U, 0x7200464FU, 0x76C15BF8U,
+        0x68860BFDU, 0x6C47164AU, 0x61043093U, 0x65C52D24U, 0x119B4BE9U, 0x155A565EU,
+        0x18197087U, 0x1CD86D30U, 0x029F3D35U, 0x065E2082U, 0x0B1D065BU, 0x0FDC1BECU,
+        0x3793A651U, 0x3352BBE6U, 0x3E119D3FU, 0x3AD08088U, 0x2497D08DU, 0x2056CD3AU,
+        0x2D15EBE3U, 0x29D4F654U, 0xC5A92679U, 0xC1683BCEU, 0xCC2B1D17U, 0xC8EA00A0U,
+        0xD6AD50A5U, 0xD26C4D12U, 0xDF2F6BCBU, 0xDBEE767CU, 0xE3A1CBC1U, 0xE760D676U,
+        0xEA23F0AFU, 0xEEE2ED18U, 0xF0A5BD1DU, 0xF464A0AAU, 0xF9278673U, 0xFDE69BC4U,
+        0x89B8FD09U, 0x8D79E0BEU, 0x803AC667U, 0x84FBDBD0U, 0x9ABC8BD5U, 0x9E7D9662U,
+        0x933EB0BBU, 0x97FFAD0CU, 0xAFB010B1U, 0xAB710D06U, 0xA6322BDFU, 0xA2F33668U,
+        0xBCB4666DU, 0xB8757BDAU, 0xB5365D03U, 0xB1F740B4U
+    },
+    {
+        0x00000000U, 0xD219C1DCU, 0xA0F29E0FU, 0x72EB5FD3U, 0x452421A9U, 0x973DE075U,
+        0xE5D6BFA6U, 0x37CF7E7AU, 0x8A484352U, 0x5851828EU, 0x2ABADD5DU, 0xF8A31C81U,
+        0xCF6C62FBU, 0x1D75A327U, 0x6F9EFCF4U, 0xBD873D28U, 0x10519B13U, 0xC2485ACFU,
+        0xB0A3051CU, 0x62BAC4C0U, 0x5575BABAU, 0x876C7B66U, 0xF58724B5U, 0x279EE569U,
+        0x9A19D841U, 0x4800199DU, 0x3AEB464EU, 0xE8F28792U, 0xDF3DF9E8U, 0x0D243834U,
+        0x7FCF67E7U, 0xADD6A63BU, 0x20A33626U, 0xF2BAF7FAU, 0x8051A829U, 0x524869F5U,
+        0x6587178FU, 0xB79ED653U, 0xC5758980U, 0x176C485CU, 0xAAEB7574U, 0x78F2B4A8U,
+        0x0A19EB7BU, 0xD8002AA7U, 0xEFCF54DDU, 0x3DD69501U, 0x4F3DCAD2U, 0x9D240B0EU,
+        0x30F2AD35U, 0xE2EB6CE9U, 0x9000333AU, 0x4219F2E6U, 0x75D68C9CU, 0xA7CF4D40U,
+        0xD5241293U, 0x073DD34FU, 0xBABAEE67U, 0x68A32FBBU, 0x1A487068U, 0xC851B1B4U,
+        0xFF9ECFCEU, 0x2D870E12U, 0x5F6C51C1U, 0x8D75901DU, 0x41466C4CU, 0x935FAD90U,
+        0xE1B4F243U, 0x33AD339FU, 0x04624DE5U, 0xD67B8C39U, 0xA490D3EAU, 0x76891236U,
+        0xCB0E2F1EU, 0x1917EEC2U, 0x6BFCB111U, 0xB9E570CDU, 0x8E2A0EB7U, 0x5C33CF6BU,
+        0x2ED890B8U, 0xFCC15164U, 0x5117F75FU, 0x830E3683U, 0xF1E56950U, 0x23FCA88CU,
+        0x1433D6F6U, 0xC62A172AU, 0xB4C148F9U, 0x66D88925U, 0xDB5FB40DU, 0x094675D1U,
+        0x7BAD2A02U, 0xA9B4EBDEU, 0x9E7B95A4U, 0x4C625478U, 0x3E890BABU, 0xEC90CA77U,
+        0x61E55A6AU, 0xB3FC9BB6U, 0xC117C465U, 0x130E05B9U, 0x24C17BC3U, 0xF6D8BA1FU,
+        0x8433E5CCU, 0x562A2410U, 0xEBAD1938U, 0x39B4D8E4U, 0x4B5F8737U, 0x994646EBU,
+        0xAE893891U, 0x7C90F94DU, 0x0E7BA69EU, 0xDC626742U, 0x71B4C179U, 0xA3AD00A5U,
+        0xD1465F76U, 0x035F9EAAU, 0x3490E0D0U, 0xE689210CU, 0x94627EDFU, 0x467BBF03U,
+        0xFBFC822BU, 0x29E543F7U, 0x5B0E1C24U, 0x8917DDF8U, 0xBED8A382U, 0x6CC1625EU,
+        0x1E2A3D8DU, 0xCC33FC51U, 0x828CD898U, 0x50951944U, 0x227E4697U, 0xF067874BU,
+        0xC7A8F931U, 0x15B138EDU, 0x675A673EU, 0xB543A6E2U, 0x08C49BCAU, 0xDADD5A16U,
+        0xA83605C5U, 0x7A2FC419U, 0x4DE0BA63U, 0x9FF97BBFU, 0xED12246CU, 0x3F0BE5B0U,
+        0x92DD438BU, 0x40C48257U, 0x322FDD84U, 0xE0361C58U, 0xD7F96222U, 0x05E0A3FEU,
+        0x770BFC2DU, 0xA5123DF1U, 0x189500D9U, 0xCA8CC105U, 0xB8679ED6U, 0x6A7E5F0AU,
+        0x5DB12170U, 0x8FA8E0ACU, 0xFD43BF7FU, 0x2F5A7EA3U, 0xA22FEEBEU, 0x70362F62U,
+        0x02DD70B1U, 0xD0C4B16DU, 0xE70BCF17U, 0x35120ECBU, 0x47F95118U, 0x95E090C4U,
+        0x2867ADECU, 0xFA7E6C30U, 0x889533E3U, 0x5A8CF23FU, 0x6D438C45U, 0xBF5A4D99U,
+        0xCDB1124AU, 0x1FA8D396U, 0xB27E75ADU, 0x6067B471U, 0x128CEBA2U, 0xC0952A7EU,
+        0xF75A5404U, 0x254395D8U, 0x57A8CA0BU, 0x85B10BD7U, 0x383636FFU, 0xEA2FF723U,
+        0x98C4A8F0U, 0x4ADD692CU, 0x7D121756U, 0xAF0BD68AU, 0xDDE08959U, 0x0FF94885U,
+        0xC3CAB4D4U, 0x11D37508U, 0x63382ADBU, 0xB121EB07U, 0x86EE957DU, 0x54F754A1U,
+        0x261C0B72U, 0xF405CAAEU, 0x4982F786U, 0x9B9B365AU, 0xE9706989U, 0x3B69A855U,
+        0x0CA6D62FU, 0xDEBF17F3U, 0xAC544820U, 0x7E4D89FCU, 0xD39B2FC7U, 0x0182EE1BU,
+        0x7369B1C8U, 0xA1707014U, 0x96BF0E6EU, 0x44A6CFB2U, 0x364D9061U, 0xE45451BDU,
+        0x59D36C95U, 0x8BCAAD49U, 0xF921F29AU, 0x2B383346U, 0x1CF74D3CU, 0xCEEE8CE0U,
+        0xBC05D333U, 0x6E1C12EFU, 0xE36982F2U, 0x3170432EU, 0x439B1CFDU, 0x9182DD21U,
+        0xA64DA35BU, 0x74546287U, 0x06BF3D54U, 0xD4A6FC88U, 0x6921C1A0U, 0xBB38007CU,
+        0xC9D35FAFU, 0x1BCA9E73U, 0x2C05E009U, 0xFE1C21D5U, 0x8CF77E06U, 0x5EEEBFDAU,
+        0xF33819E1U, 0x2121D83DU, 0x53CA87EEU, 0x81D34632U, 0xB61C3848U, 0x6405F994U,
+        0x16EEA647U, 0xC4F7679BU, 0x79705AB3U, 0xAB699B6FU, 0xD982C4BCU, 0x0B9B0560U,
+        0x3C547B1AU, 0xEE4DBAC6U, 0x9CA6E515U, 0x4EBF24C9U
+    },
+    {
+        0x00000000U, 0x01D8AC87U, 0x03B1590EU, 0x0269F589U, 0x0762B21CU, 0x06BA1E9BU,
+        0x04D3EB12U, 0x050B4795U, 0x0EC56438U, 0x0F1DC8BFU, 0x0D743D36U, 0x0CAC91B1U,
+        0x09A7D624U, 0x087F7AA3U, 0x0A168F2AU, 0x0BCE23ADU, 0x1D8AC870U, 0x1C5264F7U,
+        0x1E3B917EU, 0x1FE33DF9U, 0x1AE87A6CU, 0x1B30D6EBU, 0x19592362U, 0x18818FE5U,
+        0x134FAC48U, 0x129700CFU, 0x10FEF546U, 0x112659C1U, 0x142D1E54U, 0x15F5B2D3U,
+        0x179C475AU, 0x1644EBDDU, 0x3B1590E0U, 0x3ACD3C67U, 0x38A4C9EEU, 0x397C6569U,
+        0x3C7722FCU, 0x3DAF8E7BU, 0x3FC67BF2U, 0x3E1ED775U, 0x35D0F4D8U, 0x3408585FU,
+        0x3661ADD6U, 0x37B90151U, 0x32B246C4U, 0x336AEA43U, 0x31031FCAU, 0x30DBB34DU,
+        0x269F5890U, 0x2747F417U, 0x252E019EU, 0x24F6AD19U, 0x21FDEA8CU, 0x2025460BU,
+        0x224CB382U, 0x23941F05U, 0x285A3CA8U, 0x2982902FU, 0x2BEB65A6U, 0x2A33C921U,
+        0x2F388EB4U, 0x2EE02233U, 0x2C89D7BAU, 0x2D517B3DU, 0x762B21C0U, 0x77F38D47U,
+        0x759A78CEU, 0x7442D449U, 0x714993DCU, 0x70913F5BU, 0x72F8CAD2U, 0x73206655U,
+        0x78EE45F8U, 0x7936E97FU, 0x7B5F1CF6U, 0x7A87B071U, 0x7F8CF7E4U, 0x7E545B63U,
+        0x7C3DAEEAU, 0x7DE5026DU, 0x6BA1E9B0U, 0x6A794537U, 0x6810B0BEU, 0x69C81C39U,
+        0x6CC35BACU, 0x6D1BF72BU, 0x6F7202A2U, 0x6EAAAE25U, 0x65648D88U, 0x64BC210FU,
+        0x66D5D486U, 0x670D7801U, 0x62063F94U, 0x63DE9313U, 0x61B7669AU, 0x606FCA1DU,
+        0x4D3EB120U, 0x4CE61DA7U, 0x4E8FE82EU, 0x4F5744A9U, 0x4A5C033CU, 0x4B84AFBBU,
+        0x49ED5A32U, 0x4835F6B5U, 0x43FBD518U, 0x4223799FU, 0x404A8C16U, 0x41922091U,
+        0x44996704U, 0x4541CB83U, 0x47283E0AU, 0x46F0928DU, 0x50B47950U, 0x516CD5D7U,
+        0x5305205EU, 0x52DD8CD9U, 0x57D6CB4CU, 0x560E67CBU, 0x54679242U, 0x55BF3EC5U,
+        0x5E711D68U, 0x5FA9B1EFU, 0x5DC04466U, 0x5C18E8E1U, 0x5913AF74U, 0x58CB03F3U,
+        0x5AA2F67AU, 0x5B7A5AFDU, 0xEC564380U, 0xED8EEF07U, 0xEFE71A8EU, 0xEE3FB609U,
+        0xEB34F19CU, 0xEAEC5D1BU, 0xE885A892U, 0xE95D0415U, 0xE29327B8U, 0xE34B8B3FU,
+        0xE1227EB6U, 0xE0FAD231U, 0xE5F195A4U, 0xE4293923U, 0xE640CCAAU, 0xE798602DU,
+        0xF1DC8BF0U, 0xF0042777U, 0xF26DD2FEU, 0xF3B57E79U, 0xF6BE39ECU, 0xF766956BU,
+        0xF50F60E2U, 0xF4D7CC65U, 0xFF19EFC8U, 0xFEC1434FU, 0xFCA8B6C6U, 0xFD701A41U,
+        0xF87B5DD4U, 0xF9A3F153U, 0xFBCA04DAU, 0xFA12A85DU, 0xD743D360U, 0xD69B7FE7U,
+        0xD4F28A6EU, 0xD52A26E9U, 0xD021617CU, 0xD1F9CDFBU, 0xD3903872U, 0xD24894F5U,
+        0xD986B758U, 0xD85E1BDFU, 0xDA37EE56U, 0xDBEF42D1U, 0xDEE40544U, 0xDF3CA9C3U,
+        0xDD555C4AU, 0xDC8DF0CDU, 0xCAC91B10U, 0xCB11B797U, 0xC978421EU, 0xC8A0EE99U,
+        0xCDABA90CU, 0xCC73058BU, 0xCE1AF002U, 0xCFC25C85U, 0xC40C7F28U, 0xC5D4D3AFU,
+        0xC7BD2626U, 0xC6658AA1U, 0xC36ECD34U, 0xC2B661B3U, 0xC0DF943AU, 0xC10738BDU,
+        0x9A7D6240U, 0x9BA5CEC7U, 0x99CC3B4EU, 0x981497C9U, 0x9D1FD05CU, 0x9CC77CDBU,
+        0x9EAE8952U, 0x9F7625D5U, 0x94B80678U, 0x9560AAFFU, 0x97095F76U, 0x96D1F3F1U,
+        0x93DAB464U, 0x920218E3U, 0x906BED6AU, 0x91B341EDU, 0x87F7AA30U, 0x862F06B7U,
+        0x8446F33EU, 0x859E5FB9U, 0x8095182CU, 0x814DB4ABU, 0x83244122U, 0x82FCEDA5U,
+        0x8932CE08U, 0x88EA628FU, 0x8A839706U, 0x8B5B3B81U, 0x8E507C14U, 0x8F88D093U,
+        0x8DE1251AU, 0x8C39899DU, 0xA168F2A0U, 0xA0B05E27U, 0xA2D9ABAEU, 0xA3010729U,
+        0xA60A40BCU, 0xA7D2EC3BU, 0xA5BB19B2U, 0xA463B535U, 0xAFAD9698U, 0xAE753A1FU,
+        0xAC1CCF96U, 0xADC46311U, 0xA8CF2484U, 0xA9178803U, 0xAB7E7D8AU, 0xAAA6D10DU,
+        0xBCE23AD0U, 0xBD3A9657U, 0xBF5363DEU, 0xBE8BCF59U, 0xBB8088CCU, 0xBA58244BU,
+        0xB831D1C2U, 0xB9E97D45U, 0xB2275EE8U, 0xB3FFF26FU, 0xB19607E6U, 0xB04EAB61U,
+        0xB545ECF4U, 0xB49D4073U, 0xB6F4B5FAU, 0xB72C197DU
+    },
+    {
+        0x00000000U, 0xDC6D9AB7U, 0xBC1A28D9U, 0x6077B26EU, 0x7CF54C05U, 0xA098D6B2U,
+        0xC0EF64DCU, 0x1C82FE6BU, 0xF9EA980AU, 0x258702BDU, 0x45F0B0D3U, 0x999D2A64U,
+        0x851FD40FU, 0x59724EB8U, 0x3905FCD6U, 0xE5686661U, 0xF7142DA3U, 0x2B79B714U,
+        0x4B0E057AU, 0x97639FCDU, 0x8BE161A6U, 0x578CFB11U, 0x37FB497FU, 0xEB96D3C8U,
+        0x0EFEB5A9U, 0xD2932F1EU, 0xB2E49D70U, 0x6E8907C7U, 0x720BF9ACU, 0xAE66631BU,
+        0xCE11D175U, 0x127C4BC2U, 0xEAE946F1U, 0x3684DC46U, 0x56F36E28U, 0x8A9EF49FU,
+        0x961C0AF4U, 0x4A719043U, 0x2A06222DU, 0xF66BB89AU, 0x1303DEFBU, 0xCF6E444CU,
+        0xAF19F622U, 0x73746C95U, 0x6FF692FEU, 0xB39B0849U, 0xD3ECBA27U, 0x0F812090U,
+        0x1DFD6B52U, 0xC190F1E5U, 0xA1E7438BU, 0x7D8AD93CU, 0x61082757U, 0xBD65BDE0U,
+        0xDD120F8EU, 0x017F9539U, 0xE417F358U, 0x387A69EFU, 0x580DDB81U, 0x84604136U,
+        0x98E2BF5DU, 0x448F25EAU, 0x24F89784U, 0xF8950D33U, 0xD1139055U, 0x0D7E0AE2U,
+        0x6D09B88CU, 0xB164223BU, 0xADE6DC50U, 0x718B46E7U, 0x11FCF489U, 0xCD916E3EU,
+        0x28F9085FU, 0xF49492E8U, 0x94E32086U, 0x488EBA31U, 0x540C445AU, 0x8861DEEDU,
+        0xE8166C83U, 0x347BF634U, 0x2607BDF6U, 0xFA6A2741U, 0x9A1D952FU, 0x46700F98U,
+        0x5AF2F1F3U, 0x869F6B44U, 0xE6E8D92AU, 0x3A85439DU, 0xDFED25FCU, 0x0380BF4BU,
+        0x63F70D25U, 0xBF9A9792U, 0xA31869F9U, 0x7F75F34EU, 0x1F024120U, 0xC36FDB97U,
+        0x3BFAD6A4U, 0xE7974C13U, 0x87E0FE7DU, 0x5B8D64CAU, 0x470F9AA1U, 0x9B620016U,
+        0xFB15B278U, 0x277828CFU, 0xC2104EAEU, 0x1E7DD419U, 0x7E0A6677U, 0xA267FCC0U,
+        0xBEE502ABU, 0x6288981CU, 0x02FF2A72U, 0xDE92B0C5U, 0xCCEEFB07U, 0x108361B0U,
+        0x70F4D3DEU, 0xAC994969U, 0xB01BB702U, 0x6C762DB5U, 0x0C019FDBU, 0xD06C056CU,
+        0x3504630DU, 0xE969F9BAU, 0x891E4BD4U, 0x5573D163U, 0x49F12F08U, 0x959CB5BFU,
+        0xF5EB07D1U, 0x29869D66U, 0xA6E63D1DU, 0x7A8BA7AAU, 0x1AFC15C4U, 0xC6918F73U,
+        0xDA137118U, 0x067EEBAFU, 0x660959C1U, 0xBA64C376U, 0x5F0CA517U, 0x83613FA0U,
+        0xE3168DCEU, 0x3F7B1779U, 0x23F9E912U, 0xFF9473A5U, 0x9FE3C1CBU, 0x438E5B7CU,
+        0x51F210BEU, 0x8D9F8A09U, 0xEDE83867U, 0x3185A2D0U, 0x2D075CBBU, 0xF16AC60CU,
+        0x911D7462U, 0x4D70EED5U, 0xA81888B4U, 0x74751203U, 0x1402A06DU, 0xC86F3ADAU,
+        0xD4EDC4B1U, 0x08805E06U, 0x68F7EC68U, 0xB49A76DFU, 0x4C0F7BECU, 0x9062E15BU,
+        0xF0155335U, 0x2C78C982U, 0x30FA37E9U, 0xEC97AD5EU, 0x8CE01F30U, 0x508D8587U,
+        0xB5E5E3E6U, 0x69887951U, 0x09FFCB3FU, 0xD5925188U, 0xC910AFE3U, 0x157D3554U,
+        0x750A873AU, 0xA9671D8DU, 0xBB1B564FU, 0x6776CCF8U, 0x07017E96U, 0xDB6CE421U,
+        0xC7EE1A4AU, 0x1B8380FDU, 0x7BF43293U, 0xA799A824U, 0x42F1CE45U, 0x9E9C54F2U,
+        0xFEEBE69CU, 0x22867C2BU, 0x3E048240U, 0xE26918F7U, 0x821EAA99U, 0x5E73302EU,
+        0x77F5AD48U, 0xAB9837FFU, 0xCBEF8591U, 0x17821F26U, 0x0B00E14DU, 0xD76D7BFAU,
+        0xB71AC994U, 0x6B775323U, 0x8E1F3542U, 0x5272AFF5U, 0x32051D9BU, 0xEE68872CU,
+        0xF2EA7947U, 0x2E87E3F0U, 0x4EF0519EU, 0x929DCB29U, 0x80E180EBU, 0x5C8C1A5CU,
+        0x3CFBA832U, 0xE0963285U, 0xFC14CCEEU, 0x20795659U, 0x400EE437U, 0x9C637E80U,
+        0x790B18E1U, 0xA5668256U, 0xC5113038U, 0x197CAA8FU, 0x05FE54E4U, 0xD993CE53U,
+        0xB9E47C3DU, 0x6589E68AU, 0x9D1CEBB9U, 0x4171710EU, 0x2106C360U, 0xFD6B59D7U,
+        0xE1E9A7BCU, 0x3D843D0BU, 0x5DF38F65U, 0x819E15D2U, 0x64F673B3U, 0xB89BE904U,
+        0xD8EC5B6AU, 0x0481C1DDU, 0x18033FB6U, 0xC46EA501U, 0xA419176FU, 0x78748DD8U,
+        0x6A08C61AU, 0xB6655CADU, 0xD612EEC3U, 0x0A7F7474U, 0x16FD8A1FU, 0xCA9010A8U,
+        0xAAE7A2C6U, 0x768A3871U, 0x93E25E10U, 0x4F8FC4A7U, 0x2FF876C9U, 0xF395EC7EU,
+        0xEF171215U, 0x337A88A2U, 0x530D3ACCU, 0x8F60A07BU
+    }
+};
+
+/* CRC-16 poly 0x1021, not reflected */
+static const uint16_t crc16_ccitt_table[256] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+    0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+    0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+    0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+    0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+    0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+    0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+    0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+    0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+    0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+    0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+    0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+    0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+    0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+    0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+    0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+    0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+    0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+    0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+    0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+    0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+    0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+    0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+    0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+    0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+    0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+    0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+    0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
+
+/* CRC-16 poly 0x8005, reflected (0xA001) */
+static const uint16_t crc16_modbus_table[256] = {
+    0x0000U, 0xC0C1U, 0xC181U, 0x0140U, 0xC301U, 0x03C0U, 0x0280U, 0xC241U,
+    0xC601U, 0x06C0U, 0x0780U, 0xC741U, 0x0500U, 0xC5C1U, 0xC481U, 0x0440U,
+    0xCC01U, 0x0CC0U, 0x0D80U, 0xCD41U, 0x0F00U, 0xCFC1U, 0xCE81U, 0x0E40U,
+    0x0A00U, 0xCAC1U, 0xCB81U, 0x0B40U, 0xC901U, 0x09C0U, 0x0880U, 0xC841U,
+    0xD801U, 0x18C0U, 0x1980U, 0xD941U, 0x1B00U, 0xDBC1U, 0xDA81U, 0x1A40U,
+    0x1E00U, 0xDEC1U, 0xDF81U, 0x1F40U, 0xDD01U, 0x1DC0U, 0x1C80U, 0xDC41U,
+    0x1400U, 0xD4C1U, 0xD581U, 0x1540U, 0xD701U, 0x17C0U, 0x1680U, 0xD641U,
+    0xD201U, 0x12C0U, 0x1380U, 0xD341U, 0x1100U, 0xD1C1U, 0xD081U, 0x1040U,
+    0xF001U, 0x30C0U, 0x3180U, 0xF141U, 0x3300U, 0xF3C1U, 0xF281U, 0x3240U,
+    0x3600U, 0xF6C1U, 0xF781U, 0x3740U, 0xF501U, 0x35C0U, 0x3480U, 0xF441U,
+    0x3C00U, 0xFCC1U, 0xFD81U, 0x3D40U, 0xFF01U, 0x3FC0U, 0x3E80U, 0xFE41U,
+    0xFA01U, 0x3AC0U, 0x3B80U, 0xFB41U, 0x3900U, 0xF9C1U, 0xF881U, 0x3840U,
+    0x2800U, 0xE8C1U, 0xE981U, 0x2940U, 0xEB01U, 0x2BC0U, 0x2A80U, 0xEA41U,
+    0xEE01U, 0x2EC0U, 0x2F80U, 0xEF41U, 0x2D00U, 0xEDC1U, 0xEC81U, 0x2C40U,
+    0xE401U, 0x24C0U, 0x2580U, 0xE541U, 0x2700U, 0xE7C1U, 0xE681U, 0x2640U,
+    0x2200U, 0xE2C1U, 0xE381U, 0x2340U, 0xE101U, 0x21C0U, 0x2080U, 0xE041U,
+    0xA001U, 0x60C0U, 0x6180U, 0xA141U, 0x6300U, 0xA3C1U, 0xA281U, 0x6240U,
+    0x6600U, 0xA6C1U, 0xA781U, 0x6740U, 0xA501U, 0x65C0U, 0x6480U, 0xA441U,
+    0x6C00U, 0xACC1U, 0xAD81U, 0x6D40U, 0xAF01U, 0x6FC0U, 0x6E80U, 0xAE41U,
+    0xAA01U, 0x6AC0U, 0x6B80U, 0xAB41U, 0x6900U, 0xA9C1U, 0xA881U, 0x6840U,
+    0x7800U, 0xB8C1U, 0xB981U, 0x7940U, 0xBB01U, 0x7BC0U, 0x7A80U, 0xBA41U,
+    0xBE01U, 0x7EC0U, 0x7F80U, 0xBF41U, 0x7D00U, 0xBDC1U, 0xBC81U, 0x7C40U,
+    0xB401U, 0x74C0U, 0x7580U, 0xB541U, 0x7700U, 0xB7C1U, 0xB681U, 0x7640U,
+    0x7200U, 0xB2C1U, 0xB381U, 0x7340U, 0xB101U, 0x71C0U, 0x7080U, 0xB041U,
+    0x5000U, 0x90C1U, 0x9181U, 0x5140U, 0x9301U, 0x53C0U, 0x5280U, 0x9241U,
+    0x9601U, 0x56C0U, 0x5780U, 0x9741U, 0x5500U, 0x95C1U, 0x9481U, 0x5440U,
+    0x9C01U, 0x5CC0U, 0x5D80U, 0x9D41U, 0x5F00U, 0x9FC1U, 0x9E81U, 0x5E40U,
+    0x5A00U, 0x9AC1U, 0x9B81U, 0x5B40U, 0x9901U, 0x59C0U, 0x5880U, 0x9841U,
+    0x8801U, 0x48C0U, 0x4980U, 0x8941U, 0x4B00U, 0x8BC1U, 0x8A81U, 0x4A40U,
+    0x4E00U, 0x8EC1U, 0x8F81U, 0x4F40U, 0x8D01U, 0x4DC0U, 0x4C80U, 0x8C41U,
+    0x4400U, 0x84C1U, 0x8581U, 0x4540U, 0x8701U, 0x47C0U, 0x4680U, 0x8641U,
+    0x8201U, 0x42C0U, 0x4380U, 0x8341U, 0x4100U, 0x81C1U, 0x8081U, 0x4040U
+};
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Little-endian 32-bit load from any alignment (merged into one LDR on Cortex-M4)
+ */
+static inline uint32_t crc_load_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief  Update a reflected CRC-32 register (no pre/post inversion)
+ */
+static uint32_t crc32_ieee_update(uint32_t reg, const uint8_t *p, size_t len)
+{
+    while (len >= 4U)
+    {
+        reg ^= crc_load_le32(p);
+        reg = crc32_ieee_table[3][reg & 0xFFU] ^
+              crc32_ieee_table[2][(reg >> 8) & 0xFFU] ^
+              crc32_ieee_table[1][(reg >> 16) & 0xFFU] ^
+              crc32_ieee_table[0][reg >> 24];
+        p += 4;
+        len -= 4U;
+    }
+
+    while (len--)
+    {
+        reg = (reg >> 8) ^ crc32_ieee_table[0][(reg ^ *p++) & 0xFFU];
+    }
+    return reg;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  CRC-32/MPEG-2 of a word buffer, bit-exact with the peripheral
+ * @param  crc   Previous value
+ * @param  words Pointer to 32-bit words
+ * @param  count Number of words
+ * @retval Updated CRC value
+ */
+uint32_t bare_crc32_stm32_sw(uint32_t crc, const uint32_t *words, size_t count)
+{
+    while (count--)
+    {
+        crc ^= *words++;
+        crc = crc32_mpeg2_table[3][crc >> 24] ^
+              crc32_mpeg2_table[2][(crc >> 16) & 0xFFU] ^
+              crc32_mpeg2_table[1][(crc >> 8) & 0xFFU] ^
+              crc32_mpeg2_table[0][crc & 0xFFU];
+    }
+    return crc;
+}
+
+/**
+ * @brief  CRC-32/ISO-HDLC of a byte buffer
+ * @param  crc  Previous result
+ * @param  data Pointer to data
+ * @param  len  Length in bytes
+ * @retval Updated CRC value
+ */
+uint32_t bare_crc32_sw(uint32_t crc, const void *data, size_t len)
+{
+    return ~crc32_ieee_update(~crc, (const uint8_t *)data, len);
+}
+
+/**
+ * @brief  CRC-16/CCITT of a byte buffer
+ * @param  crc  Previous value
+ * @param  data Pointer to data
+ * @param  len  Length in bytes
+ * @retval Updated CRC value
+ */
+uint16_t bare_crc16_ccitt(uint16_t crc, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+
+    while (len--)
+    {
+        crc = (uint16_t)((crc << 8) ^ crc16_ccitt_table[(crc >> 8) ^ *p++]);
+    }
+    return crc;
+}
+
+/**
+ * @brief  CRC-16/MODBUS of a byte buffer
+ * @param  crc  Previous value
+ * @param  data Pointer to data
+ * @param  len  Length in bytes
+ * @retval Updated CRC value
+ */
+uint16_t bare_crc16_modbus(uint16_t crc, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+
+    while (len--)
+    {
+        crc = (uint16_t)((crc >> 8) ^ crc16_modbus_table[(crc ^ *p++) & 0xFFU]);
+    }
+    return crc;
+}
@@ -0,0 +1,360 @@
+/*******************************************************************************************
+ * @file    bare_ctrl.c
+ * @author  ka5j
+ * @brief   Fixed-rate control loop runner on TIM2-TIM5 with timing statistics
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Statistics are written by the timer interrupt only. Readers use a sequence
+ *          counter (odd while an update is in progress) instead of masking the interrupt,
+ *          so reading them never adds jitter to the loop.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "tim2_5_registers.h"
+#include "nvic_registers.h"
+#include "dwt_registers.h"
+#include "bare_ctrl.h"
+#include "bare_tim2_5.h"
+#include "bare_dwt.h"
+#include "bare_rcc.h"
+#include "bare_usart.h"
+#include "bare_periph.h"
+#include "bare_bitband.h"
+#include "bare_util.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define CTRL_COUNT 4U
+
+/** Runner state per timer */
+typedef struct
+{
+    CTRL_Config_t cfg;
+    CTRL_Stats_t stats;
+    volatile uint32_t seq;  /*!< Odd while the interrupt updates stats */
+    volatile uint8_t reset; /*!< Clear stats at the next activation */
+    uint8_t primed;         /*!< A previous start time is valid */
+} ctrl_state_t;
+
+static ctrl_state_t ctrl_state[CTRL_COUNT];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Log2 histogram bin of a cycle count
+ */
+static inline uint32_t ctrl_bin(uint32_t v)
+{
+    uint32_t bin = (v == 0U) ? 0U : (32U - (uint32_t)__builtin_clz(v));
+
+    return (bin < CTRL_HIST_BINS) ? bin : (CTRL_HIST_BINS - 1U);
+}
+
+/**
+ * @brief  Nominal period in CPU cycles from the programmed PSC/ARR and the live clocks
+ */
+static void ctrl_update_period(ctrl_state_t *st)
+{
+    TIM2_5_TypeDef *TIMx = st->cfg.tim;
+    uint64_t ticks = (uint64_t)(TIMx->PSC + 1U) * ((uint64_t)TIMx->ARR + 1U);
+
+    st->stats.period_cycles = (uint32_t)((ticks * bare_rcc_get_hclk()) / bare_rcc_get_timclk1());
+    st->stats.rate_hz = bare_rcc_get_timclk1() / (uint32_t)ticks;
+    st->primed = 0U; // The interval across the change is not measured
+}
+
+/**
+ * @brief  Clock change hook: periods in cycles change with HCLK (PSC/ARR follow in TIM2-5)
+ */
+static void ctrl_clock_hook(RCC_ClockPhase_t phase)
+{
+    uint32_t i;
+
+    if (phase != RCC_CLOCK_POST)
+    {
+        return;
+    }
+    for (i = 0U; i < CTRL_COUNT; i++)
+    {
+        if (ctrl_state[i].cfg.step != NULL)
+        {
+            ctrl_update_period(&ctrl_state[i]);
+        }
+    }
+}
+
+/**
+ * @brief  Print a histogram as space-separated counts
+ */
+static void ctrl_print_hist(const uint32_t *hist)
+{
+    uint32_t i;
+
+    for (i = 0U; i < CTRL_HIST_BINS; i++)
+    {
+        bare_usart_send_char(' ');
+        bare_print_u32(hist[i]);
+    }
+    bare_usart_send_string("\r\n");
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Configure the timer for the loop rate and start calling the step
+ * @param  cfg: Configuration
+ * @retval Achieved loop rate in Hz, 0 on a bad configuration
+ */
+uint32_t bare_ctrl_start(const CTRL_Config_t *cfg)
+{
+    ctrl_state_t *st;
+    uint8_t irq;
+
+    if ((cfg == NULL) || (cfg->step == NULL) || (cfg->rate_hz == 0U))
+    {
+        return 0U;
+    }
+    st = &ctrl_state[bare_periph_tim2_5_index(cfg->tim)];
+    irq = bare_periph(bare_periph_tim2_5(cfg->tim))->irq;
+
+    bare_ctrl_stop(cfg->tim);
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA))
+    {
+        bare_dwt_init();
+    }
+
+    memset(st, 0, sizeof(*st));
+    st->cfg = *cfg;
+    st->stats.exec_min = 0xFFFFFFFFUL;
+    bare_tim2_5_set_rate(cfg->tim, cfg->rate_hz); // Registers the TIM2-5 clock hook first
+    ctrl_update_period(st);
+    bare_rcc_register_hook(ctrl_clock_hook);
+
+    NVIC->IP[irq] = (uint8_t)((cfg->priority & 0x0FU) << 4);
+    bare_tim2_5_enable_interrupt(cfg->tim);
+    bare_bitband_set(&cfg->tim->DIER, TIM_DIER_UIE);
+    bare_bitband_set(&cfg->tim->CR1, TIM_CR1_CEN);
+    return st->stats.rate_hz;
+}
+
+/**
+ * @brief  Stop the loop and its timer
+ * @param  TIMx: Timer of the loop
+ * @retval None
+ */
+void bare_ctrl_stop(TIM2_5_TypeDef *TIMx)
+{
+    ctrl_state_t *st = &ctrl_state[bare_periph_tim2_5_index(TIMx)];
+
+    if (st->cfg.step != NULL)
+    {
+        bare_bitband_clear(&TIMx->DIER, TIM_DIER_UIE);
+        bare_tim2_5_stop(TIMx);
+        st->cfg.step = NULL;
+    }
+}
+
+/**
+ * @brief  Take a consistent copy of the statistics
+ * @param  TIMx: Timer of the loop
+ * @param  out: Receives the statistics
+ * @retval None
+ */
+void bare_ctrl_get_stats(TIM2_5_TypeDef *TIMx, CTRL_Stats_t *out)
+{
+    ctrl_state_t *st = &ctrl_state[bare_periph_tim2_5_index(TIMx)];
+    uint32_t seq;
+
+    do
+    {
+        seq = st->seq;
+        BARE_BARRIER();
+        *out = st->stats;
+        BARE_BARRIER();
+    } while ((seq & 1U) || (seq != st->seq));
+}
+
+/**
+ * @brief  Clear the statistics at the next activation
+ * @param  TIMx: Timer of the loop
+ * @retval None
+ */
+void bare_ctrl_reset_stats(TIM2_5_TypeDef *TIMx)
+{
+    ctrl_state[bare_periph_tim2_5_index(TIMx)].reset = 1U;
+}
+
+/**
+ * @brief  Write the statistics over USART2
+ * @param  TIMx: Timer of the loop
+ * @retval None
+ */
+void bare_ctrl_dump(TIM2_5_TypeDef *TIMx)
+{
+    CTRL_Stats_t s;
+
+    bare_ctrl_get_stats(TIMx, &s);
+
+    bare_usart_send_string("CTRL ");
+    bare_print_u32(s.rate_hz);
+    bare_usart_send_char(' ');
+    bare_print_u32(s.period_cycles);
+    bare_usart_send_char(' ');
+    bare_print_u32(s.activations);
+    bare_usart_send_char(' ');
+    bare_print_u32(s.overruns);
+    bare_usart_send_char(' ');
+    bare_print_u32(s.missed);
+    bare_usart_send_string("\r\nEXEC ");
+    bare_print_u32((s.activations != 0U) ? s.exec_min : 0U);
+    bare_usart_send_char(' ');
+    bare_print_u32(s.exec_max);
+    ctrl_print_hist(s.exec_hist);
+    bare_usart_send_string("JITTER ");
+    bare_print_u32(s.jitter_max);
+    ctrl_print_hist(s.jitter_hist);
+    bare_usart_send_string("END\r\n");
+}
+
+/**
+ * @brief  PID reset for a bumpless start
+ * @param  pid: Controller
+ * @param  measurement: Current measurement
+ * @param  output: Output currently applied
+ * @retval None
+ */
+void bare_ctrl_pid_reset(CTRL_PidQ15_t *pid, q15_t measurement, q15_t output)
+{
+    pid->integ = (int32_t)output * 65536;
+    pid->prev_meas = measurement;
+}
+
+/**
+ * @brief  One PID step
+ * @note   Terms are summed in 64 bits at q15 << 16 scale, so only the final output is
+ *         clamped and no intermediate sum can wrap.
+ * @param  pid: Controller
+ * @param  setpoint: Setpoint
+ * @param  measurement: Measurement
+ * @retval Output within [out_min, out_max]
+ */
+q15_t bare_ctrl_pid_q15(CTRL_PidQ15_t *pid, q15_t setpoint, q15_t measurement)
+{
+    int32_t e = (int32_t)setpoint - measurement;
+    int32_t dm = (int32_t)measurement - pid->prev_meas;
+    int64_t lo = (int64_t)pid->out_min * 65536;
+    int64_t hi = (int64_t)pid->out_max * 65536;
+    int64_t pd, di, integ, u;
+
+    // q15 x q15 = q30, one more bit gives the q15 << 16 scale of the integrator
+    pd = ((int64_t)pid->kp << (pid->shift + 1U)) * e;
+    pd -= ((int64_t)pid->kd << (pid->shift + 1U)) * dm;
+    di = ((int64_t)pid->ki << (pid->shift + 1U)) * e;
+
+    integ = pid->integ + di;
+    u = pd + integ;
+    if ((u > hi) && (di > 0))
+    {
+        // Saturating: integrate up to the limit, never further in than it already was
+        integ = ((hi - pd) > pid->integ) ? (hi - pd) : pid->integ;
+        u = pd + integ;
+    }
+    else if ((u < lo) && (di < 0))
+    {
+        integ = ((lo - pd) < pid->integ) ? (lo - pd) : pid->integ;
+        u = pd + integ;
+    }
+    integ = (integ > hi) ? hi : ((integ < lo) ? lo : integ);
+    u = (u > hi) ? hi : ((u < lo) ? lo : u);
+
+    pid->integ = (int32_t)integ;
+    pid->prev_meas = measurement;
+    return (q15_t)(u >> 16);
+}
+
+/*******************************************************************************************
+ *                              Interrupt Service Routines
+ *******************************************************************************************/
+
+/**
+ * @brief  Timer update interrupt work: timestamp, run the step, record timing
+ * @param  TIMx: Timer of the loop
+ * @retval None
+ */
+void bare_ctrl_irq_handler(TIM2_5_TypeDef *TIMx)
+{
+    uint32_t t0 = bare_dwt_cycles();
+    ctrl_state_t *st = &ctrl_state[bare_periph_tim2_5_index(TIMx)];
+    CTRL_Stats_t *s = &st->stats;
+    uint32_t t1, exec;
+
+    TIMx->SR = ~TIM_SR_UIF; // rc_w0
+    if (st->cfg.step == NULL)
+    {
+        return;
+    }
+
+    st->cfg.step(st->cfg.ctx, t0);
+    t1 = bare_dwt_cycles();
+
+    st->seq++;
+    BARE_BARRIER();
+
+    if (st->reset)
+    {
+        uint32_t rate = s->rate_hz;
+        uint32_t period = s->period_cycles;
+
+        memset(s, 0, sizeof(*s));
+        s->rate_hz = rate;
+        s->period_cycles = period;
+        s->exec_min = 0xFFFFFFFFUL;
+        st->reset = 0U;
+    }
+
+    if (st->primed)
+    {
+        uint32_t interval = t0 - s->last_start;
+        uint32_t period = s->period_cycles;
+        uint32_t dev = (interval > period) ? (interval - period) : (period - interval);
+
+        if (interval > (period + (period >> 1)))
+        {
+            s->missed += ((interval + (period >> 1)) / period) - 1U; // Rare path only
+        }
+        s->jitter_hist[ctrl_bin(dev)]++;
+        if (dev > s->jitter_max)
+        {
+            s->jitter_max = dev;
+        }
+    }
+
+    exec = t1 - t0;
+    s->exec_hist[ctrl_bin(exec)]++;
+    if (exec < s->exec_min)
+    {
+        s->exec_min = exec;
+    }
+    if (exec > s->exec_max)
+    {
+        s->exec_max = exec;
+    }
+    if (TIMx->SR & TIM_SR_UIF)
+    {
+        s->overruns++; // Next period already started
+    }
+    s->activations++;
+    s->last_start = t0;
+    st->primed = 1U;
+
+    BARE_BARRIER();
+    st->seq++;
+}
@@ -0,0 +1,298 @@
+/*******************************************************************************************
+ * @file    bare_dac.c
+ * @author  ka5j
+ * @brief   Bare-metal DAC channel 1/2 driver implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Each trigger moves DHR to DOR and raises a DMA request that loads the next
+ *          sample into DHR, so the DMA always runs one sample ahead. A DMA underrun (request
+ *          not served before the next trigger) stops the requests; it is recovered in the
+ *          TIM6_DAC interrupt by re-arming the stream.
+ *
+ *          DMA1 stream 5 / 6 channel 7 serve DAC channel 1 / 2 (RM0390 Table 28).
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "dac_registers.h"
+#include "bare_dac.h"
+#include "bare_dma.h"
+#include "bare_gpio.h"
+#include "bare_tim2_5.h"
+#include "bare_periph.h"
+#include "bare_bitband.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define DAC_CHANNELS 2U
+/** Output pin of each channel (PA4, PA5); DMA requests come from the DAC descriptor */
+static const GPIO_Pins_t dac_pins[DAC_CHANNELS] = {GPIO_PIN4, GPIO_PIN5};
+
+#define DAC_STREAM(ch) bare_periph_dma_stream(PERIPH_DAC, (uint8_t)(ch))
+
+/** Runtime state of each channel */
+typedef struct
+{
+    const DAC_StreamConfig_t *cfg;
+    volatile uint32_t underruns;
+    TIM2_5_TypeDef *timer; /*!< Sample clock in use, NULL when idle */
+} dac_state_t;
+
+static dac_state_t dac_state[DAC_CHANNELS];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Timer behind a trigger
+ */
+static TIM2_5_TypeDef *dac_trigger_timer(DAC_Trigger_t trigger)
+{
+    switch (trigger)
+    {
+    case DAC_TRIG_TIM2_TRGO:
+        return TIM2;
+    case DAC_TRIG_TIM4_TRGO:
+        return TIM4;
+    default:
+        return TIM5;
+    }
+}
+
+/**
+ * @brief  Program the trigger timer: one TRGO pulse per update
+ */
+static uint32_t dac_trigger_setup(DAC_Channel_t ch, DAC_Trigger_t trigger, uint32_t rate_hz)
+{
+    TIM2_5_TypeDef *TIMx = dac_trigger_timer(trigger);
+    uint32_t actual = bare_tim2_5_set_rate(TIMx, rate_hz);
+
+    bare_tim2_5_set_trgo(TIMx, TIM2_5_TRGO_UPDATE);
+    dac_state[ch].timer = TIMx;
+    return actual;
+}
+
+/**
+ * @brief  Replace the control bits of one channel
+ */
+static inline void dac_set_cr(DAC_Channel_t ch, uint32_t bits)
+{
+    uint32_t shift = (uint32_t)ch * DAC_CH2_SHIFT;
+
+    DAC->CR = (DAC->CR & ~(DAC_CR_CH_Msk << shift)) | (bits << shift);
+}
+
+/**
+ * @brief  Control bits of one channel
+ */
+static inline uint32_t dac_get_cr(DAC_Channel_t ch)
+{
+    return (DAC->CR >> ((uint32_t)ch * DAC_CH2_SHIFT)) & DAC_CR_CH_Msk;
+}
+
+/**
+ * @brief  12-bit right-aligned holding register of a channel
+ */
+static inline volatile uint32_t *dac_dhr(DAC_Channel_t ch)
+{
+    return (ch == DAC_CHANNEL1) ? &DAC->DHR12R1 : &DAC->DHR12R2;
+}
+
+/**
+ * @brief  Arm the DMA stream over the whole double block
+ */
+static void dac_dma_arm(DAC_Channel_t ch)
+{
+    const DAC_StreamConfig_t *cfg = dac_state[ch].cfg;
+
+    bare_dma_start(DAC_STREAM(ch), (uint32_t)dac_dhr(ch), (uint32_t)cfg->buffer, 0U,
+                   (uint16_t)(2U * cfg->samples_per_block));
+}
+
+/**
+ * @brief  DMA event handler: hand the block just played back for refilling
+ */
+static void dac_dma_event(uint32_t events, void *ctx)
+{
+    dac_state_t *st = (dac_state_t *)ctx;
+    const DAC_StreamConfig_t *cfg = st->cfg;
+
+    if (cfg->cb == NULL)
+    {
+        return;
+    }
+    if (events & DMA_EVENT_HALF)
+    {
+        cfg->cb(cfg->buffer, cfg->samples_per_block, cfg->ctx);
+    }
+    if (events & DMA_EVENT_COMPLETE)
+    {
+        cfg->cb(cfg->buffer + cfg->samples_per_block, cfg->samples_per_block, cfg->ctx);
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Enable a channel for static output
+ * @param  ch       Channel
+ * @param  buffered 1 = output buffer on
+ */
+void bare_dac_init(DAC_Channel_t ch, uint8_t buffered)
+{
+    bare_periph_enable_clock(PERIPH_DAC);
+    bare_gpio_init(GPIOA, dac_pins[ch], GPIO_MODE_ANALOG, GPIO_OTYPE_PP, GPIO_SPEED_LOW,
+                   GPIO_NOPULL);
+
+    dac_set_cr(ch, DAC_CR_EN | (buffered ? 0U : DAC_CR_BOFF));
+}
+
+/**
+ * @brief  Write a 12-bit value
+ * @param  ch    Channel
+ * @param  value 0-4095
+ */
+void bare_dac_write(DAC_Channel_t ch, uint16_t value)
+{
+    *dac_dhr(ch) = value & 0xFFFU;
+}
+
+/**
+ * @brief  Configure timer-triggered DMA streaming
+ * @param  ch  Channel
+ * @param  cfg Streaming configuration
+ * @retval Achieved sample rate in Hz
+ */
+uint32_t bare_dac_stream_init(DAC_Channel_t ch, const DAC_StreamConfig_t *cfg)
+{
+    DMA_Config_t dma = {
+        .channel = bare_periph_dma_channel(PERIPH_DAC, (uint8_t)ch),
+        .dir = DMA_DIR_MEM_TO_PERIPH,
+        .psize = DMA_SIZE_HALFWORD,
+        .msize = DMA_SIZE_HALFWORD,
+        .pinc = 0U,
+        .minc = 1U,
+        .circular = 1U,
+        .priority = DMA_PRIORITY_HIGH,
+        .fifo = DMA_FIFO_DIRECT,
+        .half_irq = (cfg->cb != NULL),
+        .complete_irq = (cfg->cb != NULL),
+    };
+
+    dac_state[ch].cfg = cfg;
+    dac_state[ch].underruns = 0U;
+
+    /* Keep EN/BOFF, select the trigger, no generator */
+    dac_set_cr(ch, (dac_get_cr(ch) & (DAC_CR_EN | DAC_CR_BOFF)) | DAC_CR_TEN |
+                       ((uint32_t)cfg->trigger << DAC_CR_TSEL_Pos) | DAC_CR_DMAUDRIE);
+
+    bare_dma_config(DAC_STREAM(ch), &dma);
+    bare_dma_set_callback(DAC_STREAM(ch), dac_dma_event, &dac_state[ch]);
+    bare_periph_enable_irq(PERIPH_DAC, 0U); // TIM6_DAC: underrun
+
+    return dac_trigger_setup(ch, cfg->trigger, cfg->rate_hz);
+}
+
+/**
+ * @brief  Start streaming
+ * @param  ch Channel
+ */
+void bare_dac_stream_start(DAC_Channel_t ch)
+{
+    uint32_t shift = (uint32_t)ch * DAC_CH2_SHIFT;
+
+    /* No DHR preload: the first trigger repeats the current output and fetches sample 0,
+       which the second trigger outputs. A preload of sample 0 would play it twice. */
+    DAC->SR = (DAC_SR_DMAUDR << shift);
+    dac_dma_arm(ch);
+    bare_bitband_set(&DAC->CR, DAC_CR_DMAEN << shift);
+    bare_tim2_5_enable(dac_state[ch].timer);
+}
+
+/**
+ * @brief  Stop streaming and the sample timer
+ * @param  ch Channel
+ */
+void bare_dac_stream_stop(DAC_Channel_t ch)
+{
+    if (dac_state[ch].timer != NULL)
+    {
+        bare_bitband_clear(&dac_state[ch].timer->CR1, TIM_CR1_CEN); // Disable counter
+    }
+    bare_bitband_clear(&DAC->CR, DAC_CR_DMAEN << ((uint32_t)ch * DAC_CH2_SHIFT));
+    bare_dma_stop(DAC_STREAM(ch));
+}
+
+/**
+ * @brief  Run the built-in noise or triangle generator
+ * @param  ch        Channel
+ * @param  wave      Generator
+ * @param  amplitude 0-11
+ * @param  offset    Base value
+ * @param  trigger   Step clock
+ * @param  rate_hz   Step rate
+ * @retval Achieved step rate in Hz
+ */
+uint32_t bare_dac_wave(DAC_Channel_t ch, DAC_Wave_t wave, uint8_t amplitude, uint16_t offset,
+                       DAC_Trigger_t trigger, uint32_t rate_hz)
+{
+    uint32_t actual;
+
+    if (amplitude > 11U)
+    {
+        amplitude = 11U;
+    }
+
+    dac_set_cr(ch, (dac_get_cr(ch) & (DAC_CR_EN | DAC_CR_BOFF)) | DAC_CR_TEN |
+                       ((uint32_t)trigger << DAC_CR_TSEL_Pos) |
+                       ((uint32_t)wave << DAC_CR_WAVE_Pos) |
+                       ((uint32_t)amplitude << DAC_CR_MAMP_Pos));
+    bare_dac_write(ch, offset);
+
+    actual = dac_trigger_setup(ch, trigger, rate_hz);
+    bare_tim2_5_enable(dac_state[ch].timer);
+    return actual;
+}
+
+/**
+ * @brief  Number of DMA underruns recovered
+ * @param  ch Channel
+ * @retval Underrun count
+ */
+uint32_t bare_dac_underruns(DAC_Channel_t ch)
+{
+    return dac_state[ch].underruns;
+}
+
+/*******************************************************************************************
+ *                              Interrupt Service Routines
+ *******************************************************************************************/
+
+/**
+ * @brief  DAC underrun: re-arm DMA from the start of the buffer (TIM6 is not used here)
+ */
+void TIM6_DAC_IRQHandler(void)
+{
+    uint32_t ch;
+
+    for (ch = 0U; ch < DAC_CHANNELS; ch++)
+    {
+        uint32_t shift = ch * DAC_CH2_SHIFT;
+
+        if (DAC->SR & (DAC_SR_DMAUDR << shift))
+        {
+            bare_bitband_clear(&DAC->CR, DAC_CR_DMAEN << shift); // Other channel untouched
+            DAC->SR = (DAC_SR_DMAUDR << shift);
+            bare_dma_stop(DAC_STREAM(ch));
+            dac_state[ch].underruns++;
+
+            dac_dma_arm((DAC_Channel_t)ch);
+            bare_bitband_set(&DAC->CR, DAC_CR_DMAEN << shift);
+        }
+    }
+}
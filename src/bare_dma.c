@@ -0,0 +1,333 @@
+/*******************************************************************************************
+ * @file    bare_dma.c
+ * @author  ka5j
+ * @brief   Bare-metal DMA1/DMA2 stream driver implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Owns the 16 DMA stream interrupt vectors and dispatches them to the callbacks
+ *          registered by the peripheral drivers (CRC, ADC, SPI, ...).
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "dma_registers.h"
+#include "bare_dma.h"
+#include "bare_periph.h"
+#include "nvic_registers.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define DMA_STREAM_COUNT 16U /*!< 8 streams on each of the two controllers */
+
+/** Bit offset of each stream's flag group inside LISR/HISR (streams n and n+4 share) */
+static const uint8_t dma_flag_shift[4] = {0U, 6U, 16U, 22U};
+
+/** NVIC interrupt number of each stream, DMA1 streams 0-7 then DMA2 streams 0-7 */
+static const uint8_t dma_irq_number[DMA_STREAM_COUNT] = {
+    11U, 12U, 13U, 14U, 15U, 16U, 17U, 47U,
+    56U, 57U, 58U, 59U, 60U, 68U, 69U, 70U};
+
+/** Registered stream callbacks */
+static struct
+{
+    DMA_Callback_t cb;
+    void *ctx;
+} dma_handlers[DMA_STREAM_COUNT];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Controller owning a stream (controller bases are 0x400 aligned)
+ */
+static DMA_TypeDef *dma_controller(DMA_Stream_TypeDef *stream)
+{
+    return (DMA_TypeDef *)((uint32_t)stream & ~0x3FFUL);
+}
+
+/**
+ * @brief  Stream number (0-7) within its controller
+ */
+static uint32_t dma_stream_number(DMA_Stream_TypeDef *stream)
+{
+    return (((uint32_t)stream & 0x3FFUL) - DMA_STREAM_OFFSET) / DMA_STREAM_STRIDE;
+}
+
+/**
+ * @brief  Global stream index (0-15) used for the callback and IRQ tables
+ */
+static uint32_t dma_stream_index(DMA_Stream_TypeDef *stream)
+{
+    uint32_t index = dma_stream_number(stream);
+
+    if (dma_controller(stream) == DMA2)
+    {
+        index += 8U;
+    }
+    return index;
+}
+
+/**
+ * @brief  Status flags whose interrupt is enabled on a stream
+ *
+ * @note   DMEIE..TCIE (CR bits 1-4) sit one bit below DMEIF..TCIF in the flag group.
+ */
+static inline uint32_t dma_enabled_flags(DMA_Stream_TypeDef *stream)
+{
+    uint32_t enabled = (stream->CR & (DMA_SxCR_DMEIE | DMA_SxCR_TEIE | DMA_SxCR_HTIE |
+                                      DMA_SxCR_TCIE)) << 1;
+
+    if (stream->FCR & DMA_SxFCR_FEIE)
+    {
+        enabled |= DMA_FLAG_FEIF;
+    }
+    return enabled;
+}
+
+/**
+ * @brief  Dispatch the interrupt of one stream to its callback
+ */
+static void dma_irq_dispatch(DMA_Stream_TypeDef *stream)
+{
+    uint32_t index = dma_stream_index(stream);
+    uint32_t flags = bare_dma_get_flags(stream);
+    uint32_t events = 0U;
+
+    bare_dma_clear_flags(stream, flags);
+
+    /* Flags latch whether or not their interrupt is enabled (FEIF in particular can
+     * latch on a FIFO-mode stream without any data being lost); report enabled ones only */
+    flags &= dma_enabled_flags(stream);
+
+    if (flags & DMA_FLAG_HTIF)
+    {
+        events |= DMA_EVENT_HALF;
+    }
+    if (flags & DMA_FLAG_TCIF)
+    {
+        events |= DMA_EVENT_COMPLETE;
+    }
+    if (flags & (DMA_FLAG_TEIF | DMA_FLAG_DMEIF | DMA_FLAG_FEIF))
+    {
+        events |= DMA_EVENT_ERROR;
+    }
+
+    if ((events != 0U) && (dma_handlers[index].cb != NULL))
+    {
+        dma_handlers[index].cb(events, dma_handlers[index].ctx);
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Enable the RCC clock of the controller owning a stream
+ * @param  stream Pointer to DMA stream
+ */
+void bare_dma_enable_clock(DMA_Stream_TypeDef *stream)
+{
+    bare_periph_enable_clock((dma_controller(stream) == DMA1) ? PERIPH_DMA1 : PERIPH_DMA2);
+}
+
+/**
+ * @brief  Configure a DMA stream
+ * @param  stream Pointer to DMA stream
+ * @param  cfg    Stream configuration
+ *
+ * @note   The whole CR is composed locally and written once; the stream is left disabled.
+ */
+void bare_dma_config(DMA_Stream_TypeDef *stream, const DMA_Config_t *cfg)
+{
+    uint32_t cr = 0U;
+    uint32_t fcr = 0U;
+
+    bare_dma_enable_clock(stream);
+    bare_dma_stop(stream);
+
+    cr |= ((uint32_t)(cfg->channel & 0x7U) << DMA_SxCR_CHSEL_Pos);
+    cr |= ((uint32_t)(cfg->dir & 0x3U) << DMA_SxCR_DIR_Pos);
+    cr |= ((uint32_t)(cfg->psize & 0x3U) << DMA_SxCR_PSIZE_Pos);
+    cr |= ((uint32_t)(cfg->msize & 0x3U) << DMA_SxCR_MSIZE_Pos);
+    cr |= ((uint32_t)(cfg->priority & 0x3U) << DMA_SxCR_PL_Pos);
+
+    if (cfg->pinc)
+    {
+        cr |= DMA_SxCR_PINC;
+    }
+    if (cfg->minc)
+    {
+        cr |= DMA_SxCR_MINC;
+    }
+    if (cfg->circular || cfg->double_buffer)
+    {
+        cr |= DMA_SxCR_CIRC;
+    }
+    if (cfg->double_buffer)
+    {
+        cr |= DMA_SxCR_DBM;
+    }
+    if (cfg->half_irq)
+    {
+        cr |= DMA_SxCR_HTIE;
+    }
+    if (cfg->complete_irq)
+    {
+        cr |= DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+    }
+
+    if (cfg->fifo != DMA_FIFO_DIRECT)
+    {
+        /* Bursts are only legal with the FIFO enabled */
+        cr |= ((uint32_t)(cfg->pburst & 0x3U) << DMA_SxCR_PBURST_Pos);
+        cr |= ((uint32_t)(cfg->mburst & 0x3U) << DMA_SxCR_MBURST_Pos);
+        fcr = DMA_SxFCR_DMDIS | ((uint32_t)(cfg->fifo - 1U) << DMA_SxFCR_FTH_Pos);
+    }
+    else if (cfg->complete_irq)
+    {
+        cr |= DMA_SxCR_DMEIE;
+    }
+
+    stream->FCR = fcr;
+    stream->CR = cr;
+}
+
+/**
+ * @brief  Register the event callback of a stream
+ * @param  stream Pointer to DMA stream
+ * @param  cb     Callback, NULL to detach
+ * @param  ctx    User context
+ */
+void bare_dma_set_callback(DMA_Stream_TypeDef *stream, DMA_Callback_t cb, void *ctx)
+{
+    uint32_t index = dma_stream_index(stream);
+    uint32_t irq = dma_irq_number[index];
+
+    dma_handlers[index].cb = cb;
+    dma_handlers[index].ctx = ctx;
+
+    if (cb != NULL)
+    {
+        NVIC->ISER[irq >> 5] = (1UL << (irq & 0x1FU));
+    }
+    else
+    {
+        NVIC->ICER[irq >> 5] = (1UL << (irq & 0x1FU));
+    }
+}
+
+/**
+ * @brief  Program addresses and count, then enable the stream
+ * @param  stream Pointer to DMA stream
+ * @param  par    Peripheral (or memory-to-memory source) address
+ * @param  m0ar   Memory 0 (or memory-to-memory destination) address
+ * @param  m1ar   Memory 1 address, double buffer mode only
+ * @param  count  Number of data items
+ */
+void bare_dma_start(DMA_Stream_TypeDef *stream, uint32_t par, uint32_t m0ar,
+                    uint32_t m1ar, uint16_t count)
+{
+    /* Stale flags must be cleared before the stream can be enabled */
+    bare_dma_clear_flags(stream, DMA_FLAG_ALL);
+
+    stream->PAR = par;
+    stream->M0AR = m0ar;
+    if (stream->CR & DMA_SxCR_DBM)
+    {
+        stream->M1AR = m1ar;
+    }
+    stream->NDTR = count;
+    stream->CR |= DMA_SxCR_EN;
+}
+
+/**
+ * @brief  Disable a stream and wait for the current transfer to drain
+ * @param  stream Pointer to DMA stream
+ */
+void bare_dma_stop(DMA_Stream_TypeDef *stream)
+{
+    stream->CR &= ~DMA_SxCR_EN;
+    while (stream->CR & DMA_SxCR_EN)
+        ; // EN reads back 1 until the last beat has completed
+    bare_dma_clear_flags(stream, DMA_FLAG_ALL);
+}
+
+/**
+ * @brief  Read the status flags of a stream
+ * @param  stream Pointer to DMA stream
+ * @retval DMA_FLAG_* bits
+ */
+uint32_t bare_dma_get_flags(DMA_Stream_TypeDef *stream)
+{
+    DMA_TypeDef *dma = dma_controller(stream);
+    uint32_t n = dma_stream_number(stream);
+    uint32_t isr = (n < 4U) ? dma->LISR : dma->HISR;
+
+    return (isr >> dma_flag_shift[n & 0x3U]) & DMA_FLAG_ALL;
+}
+
+/**
+ * @brief  Clear status flags of a stream
+ * @param  stream Pointer to DMA stream
+ * @param  flags  DMA_FLAG_* bits to clear
+ */
+void bare_dma_clear_flags(DMA_Stream_TypeDef *stream, uint32_t flags)
+{
+    DMA_TypeDef *dma = dma_controller(stream);
+    uint32_t n = dma_stream_number(stream);
+    uint32_t mask = (flags & DMA_FLAG_ALL) << dma_flag_shift[n & 0x3U];
+
+    if (n < 4U)
+    {
+        dma->LIFCR = mask;
+    }
+    else
+    {
+        dma->HIFCR = mask;
+    }
+}
+
+/**
+ * @brief  Number of data items still to be transferred
+ * @param  stream Pointer to DMA stream
+ * @retval NDTR value
+ */
+uint16_t bare_dma_remaining(DMA_Stream_TypeDef *stream)
+{
+    return (uint16_t)stream->NDTR;
+}
+
+/**
+ * @brief  Memory target currently in use in double buffer mode
+ * @param  stream Pointer to DMA stream
+ * @retval 0 = M0AR, 1 = M1AR
+ */
+uint8_t bare_dma_current_target(DMA_Stream_TypeDef *stream)
+{
+    return (stream->CR & DMA_SxCR_CT) ? 1U : 0U;
+}
+
+/*******************************************************************************************
+ *                               Interrupt Service Routines
+ *******************************************************************************************/
+void DMA1_Stream0_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream0); }
+void DMA1_Stream1_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream1); }
+void DMA1_Stream2_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream2); }
+void DMA1_Stream3_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream3); }
+void DMA1_Stream4_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream4); }
+void DMA1_Stream5_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream5); }
+void DMA1_Stream6_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream6); }
+void DMA1_Stream7_IRQHandler(void) { dma_irq_dispatch(DMA1_Stream7); }
+
+void DMA2_Stream0_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream0); }
+void DMA2_Stream1_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream1); }
+void DMA2_Stream2_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream2); }
+void DMA2_Stream3_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream3); }
+void DMA2_Stream4_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream4); }
+void DMA2_Stream5_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream5); }
+void DMA2_Stream6_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream6); }
+void DMA2_Stream7_IRQHandler(void) { dma_irq_dispatch(DMA2_Stream7); }
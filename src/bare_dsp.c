@@ -0,0 +1,573 @@
+/*******************************************************************************************
+ * @file    bare_dsp.c
+ * @author  ka5j
+ * @brief   Fixed-point block filtering kernels implementation (Cortex-M4 DSP extension)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The dsp_* helpers below are the only place where instruction selection
+ *          happens: inline assembly on a DSP-capable core, exact C emulation elsewhere.
+ *          Packed pairs are little-endian: bits 15:0 hold element 0, bits 31:16 element 1.
+ *******************************************************************************************/
+
+#include "bare_dsp.h"
+#include <string.h>
+
+/*******************************************************************************************
+ *                              SIMD Instruction Helpers
+ *******************************************************************************************/
+
+/**
+ * @brief  Load two adjacent q15 values as one packed word (halfword alignment is enough)
+ */
+static inline uint32_t dsp_read_q15x2(const q15_t *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v)); // Single LDR, the M4 allows unaligned word loads
+    return v;
+}
+
+/**
+ * @brief  Store one packed word as two adjacent q15 values
+ */
+static inline void dsp_write_q15x2(q15_t *p, uint32_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * @brief  Pack two q15 values, a in the low half
+ */
+static inline uint32_t dsp_pack(q15_t lo, q15_t hi)
+{
+    return ((uint32_t)(uint16_t)hi << 16) | (uint16_t)lo;
+}
+
+#if defined(__ARM_FEATURE_DSP)
+
+/** SMUAD: x.lo * y.lo + x.hi * y.hi (32-bit, wraps) */
+static inline int32_t dsp_smuad(uint32_t x, uint32_t y)
+{
+    int32_t r;
+    __asm("smuad %0, %1, %2" : "=r"(r) : "r"(x), "r"(y));
+    return r;
+}
+
+/** SMLAD: acc + x.lo * y.lo + x.hi * y.hi (32-bit, wraps) */
+static inline int32_t dsp_smlad(uint32_t x, uint32_t y, int32_t acc)
+{
+    int32_t r;
+    __asm("smlad %0, %1, %2, %3" : "=r"(r) : "r"(x), "r"(y), "r"(acc));
+    return r;
+}
+
+/** SMLALD: acc + x.lo * y.lo + x.hi * y.hi (64-bit) */
+static inline int64_t dsp_smlald(uint32_t x, uint32_t y, int64_t acc)
+{
+    uint32_t lo = (uint32_t)acc;
+    uint32_t hi = (uint32_t)((uint64_t)acc >> 32);
+    __asm("smlald %0, %1, %2, %3" : "+r"(lo), "+r"(hi) : "r"(x), "r"(y));
+    return (int64_t)(((uint64_t)hi << 32) | lo);
+}
+
+/** QADD16: saturating add of both halves */
+static inline uint32_t dsp_qadd16(uint32_t x, uint32_t y)
+{
+    uint32_t r;
+    __asm("qadd16 %0, %1, %2" : "=r"(r) : "r"(x), "r"(y));
+    return r;
+}
+
+#else /* Portable emulation, bit-exact with the instructions above */
+
+static inline int32_t dsp_lo(uint32_t x) { return (int16_t)(x & 0xFFFFU); }
+static inline int32_t dsp_hi(uint32_t x) { return (int16_t)(x >> 16); }
+
+static inline int32_t dsp_smuad(uint32_t x, uint32_t y)
+{
+    return (int32_t)((uint32_t)(dsp_lo(x) * dsp_lo(y)) + (uint32_t)(dsp_hi(x) * dsp_hi(y)));
+}
+
+static inline int32_t dsp_smlad(uint32_t x, uint32_t y, int32_t acc)
+{
+    return (int32_t)((uint32_t)acc + (uint32_t)dsp_smuad(x, y));
+}
+
+static inline int64_t dsp_smlald(uint32_t x, uint32_t y, int64_t acc)
+{
+    return acc + (int64_t)(dsp_lo(x) * dsp_lo(y)) + (int64_t)(dsp_hi(x) * dsp_hi(y));
+}
+
+static inline uint32_t dsp_qadd16(uint32_t x, uint32_t y)
+{
+    int32_t lo = dsp_lo(x) + dsp_lo(y);
+    int32_t hi = dsp_hi(x) + dsp_hi(y);
+
+    lo = (lo > 32767) ? 32767 : ((lo < -32768) ? -32768 : lo);
+    hi = (hi > 32767) ? 32767 : ((hi < -32768) ? -32768 : hi);
+    return dsp_pack((q15_t)lo, (q15_t)hi);
+}
+
+#endif /* __ARM_FEATURE_DSP */
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Saturate to q15 (SSAT #16 on the M4)
+ */
+static inline q15_t dsp_sat16(int64_t v)
+{
+    return (q15_t)((v > 32767) ? 32767 : ((v < -32768) ? -32768 : v));
+}
+
+/**
+ * @brief  Saturate to q31
+ */
+static inline q31_t dsp_sat32(int64_t v)
+{
+    return (q31_t)((v > INT32_MAX) ? INT32_MAX : ((v < INT32_MIN) ? INT32_MIN : v));
+}
+
+/**
+ * @brief  q15 dot product of taps coefficients with a sample window, four taps per pass
+ */
+static inline int64_t dsp_dot_q15(const q15_t *c, const q15_t *x, uint32_t taps)
+{
+    int64_t acc = 0;
+
+    while (taps >= 4U)
+    {
+        acc = dsp_smlald(dsp_read_q15x2(c), dsp_read_q15x2(x), acc);
+        acc = dsp_smlald(dsp_read_q15x2(c + 2), dsp_read_q15x2(x + 2), acc);
+        c += 4;
+        x += 4;
+        taps -= 4U;
+    }
+    if (taps >= 2U)
+    {
+        acc = dsp_smlald(dsp_read_q15x2(c), dsp_read_q15x2(x), acc);
+        c += 2;
+        x += 2;
+        taps -= 2U;
+    }
+    if (taps != 0U)
+    {
+        acc += (int32_t)c[0] * x[0];
+    }
+    return acc;
+}
+
+/**
+ * @brief  Scalar q15 dot product (reference)
+ */
+static int64_t dsp_dot_q15_ref(const q15_t *c, const q15_t *x, uint32_t taps)
+{
+    int64_t acc = 0;
+    uint32_t k;
+
+    for (k = 0U; k < taps; k++)
+    {
+        acc += (int64_t)c[k] * x[k];
+    }
+    return acc;
+}
+
+/*******************************************************************************************
+ *                            Public API Functions - Initialisation
+ *******************************************************************************************/
+
+/**
+ * @brief  Initialise a q15 FIR and clear its history
+ */
+void bare_dsp_fir_q15_init(DSP_FirQ15_t *f, const q15_t *coeffs, uint16_t num_taps, q15_t *state)
+{
+    f->coeffs = coeffs;
+    f->state = state;
+    f->num_taps = num_taps;
+    memset(state, 0, (num_taps - 1U) * sizeof(q15_t));
+}
+
+/**
+ * @brief  Initialise a q31 FIR and clear its history
+ */
+void bare_dsp_fir_q31_init(DSP_FirQ31_t *f, const q31_t *coeffs, uint16_t num_taps, q31_t *state)
+{
+    f->coeffs = coeffs;
+    f->state = state;
+    f->num_taps = num_taps;
+    memset(state, 0, (num_taps - 1U) * sizeof(q31_t));
+}
+
+/**
+ * @brief  Initialise a q15 FIR decimator and clear its history
+ */
+void bare_dsp_decim_q15_init(DSP_DecimQ15_t *d, uint8_t factor, const q15_t *coeffs,
+                             uint16_t num_taps, q15_t *state)
+{
+    d->factor = factor;
+    bare_dsp_fir_q15_init(&d->fir, coeffs, num_taps, state);
+}
+
+/**
+ * @brief  Initialise a q15 biquad cascade and clear its state
+ */
+void bare_dsp_biquad_q15_init(DSP_BiquadQ15_t *f, uint8_t stages, const q15_t *coeffs,
+                              q15_t *state, uint8_t post_shift)
+{
+    f->coeffs = coeffs;
+    f->state = state;
+    f->stages = stages;
+    f->post_shift = post_shift;
+    memset(state, 0, 4U * stages * sizeof(q15_t));
+}
+
+/**
+ * @brief  Initialise a moving average and clear its window
+ */
+void bare_dsp_movavg_q15_init(DSP_MovAvgQ15_t *f, uint8_t log2_len, q15_t *state)
+{
+    f->state = state;
+    f->sum = 0;
+    f->log2_len = log2_len;
+    memset(state, 0, (1UL << log2_len) * sizeof(q15_t));
+}
+
+/*******************************************************************************************
+ *                               Public API Functions - FIR
+ *******************************************************************************************/
+
+/**
+ * @brief  q15 FIR filter
+ * @param  f   Instance
+ * @param  in  Input block
+ * @param  out Output block (may not alias in)
+ * @param  n   Block length
+ */
+void bare_dsp_fir_q15(DSP_FirQ15_t *f, const q15_t *in, q15_t *out, uint32_t n)
+{
+    uint32_t hist = f->num_taps - 1U;
+    uint32_t i;
+
+    memcpy(f->state + hist, in, n * sizeof(q15_t));
+    for (i = 0U; i < n; i++)
+    {
+        out[i] = dsp_sat16(dsp_dot_q15(f->coeffs, f->state + i, f->num_taps) >> 15);
+    }
+    memmove(f->state, f->state + n, hist * sizeof(q15_t));
+}
+
+/**
+ * @brief  q15 FIR filter, scalar reference
+ */
+void bare_dsp_fir_q15_ref(DSP_FirQ15_t *f, const q15_t *in, q15_t *out, uint32_t n)
+{
+    uint32_t hist = f->num_taps - 1U;
+    uint32_t i;
+
+    memcpy(f->state + hist, in, n * sizeof(q15_t));
+    for (i = 0U; i < n; i++)
+    {
+        out[i] = dsp_sat16(dsp_dot_q15_ref(f->coeffs, f->state + i, f->num_taps) >> 15);
+    }
+    memmove(f->state, f->state + n, hist * sizeof(q15_t));
+}
+
+/**
+ * @brief  q31 FIR filter, two outputs share every coefficient load
+ * @param  f   Instance
+ * @param  in  Input block
+ * @param  out Output block
+ * @param  n   Block length
+ */
+void bare_dsp_fir_q31(DSP_FirQ31_t *f, const q31_t *in, q31_t *out, uint32_t n)
+{
+    uint32_t taps = f->num_taps;
+    uint32_t hist = taps - 1U;
+    uint32_t i = 0U;
+    uint32_t k;
+
+    memcpy(f->state + hist, in, n * sizeof(q31_t));
+
+    for (; (i + 1U) < n; i += 2U)
+    {
+        const q31_t *x = f->state + i;
+        int64_t acc0 = 0;
+        int64_t acc1 = 0;
+        q31_t xk = x[0];
+
+        for (k = 0U; k < taps; k++)
+        {
+            q31_t c = f->coeffs[k];
+            q31_t xn = x[k + 1U];
+
+            acc0 += (int64_t)c * xk;
+            acc1 += (int64_t)c * xn;
+            xk = xn;
+        }
+        out[i] = dsp_sat32(acc0 >> 31);
+        out[i + 1U] = dsp_sat32(acc1 >> 31);
+    }
+
+    if (i < n)
+    {
+        int64_t acc = 0;
+
+        for (k = 0U; k < taps; k++)
+        {
+            acc += (int64_t)f->coeffs[k] * f->state[i + k];
+        }
+        out[i] = dsp_sat32(acc >> 31);
+    }
+
+    memmove(f->state, f->state + n, hist * sizeof(q31_t));
+}
+
+/**
+ * @brief  q31 FIR filter, scalar reference
+ */
+void bare_dsp_fir_q31_ref(DSP_FirQ31_t *f, const q31_t *in, q31_t *out, uint32_t n)
+{
+    uint32_t hist = f->num_taps - 1U;
+    uint32_t i, k;
+
+    memcpy(f->state + hist, in, n * sizeof(q31_t));
+    for (i = 0U; i < n; i++)
+    {
+        int64_t acc = 0;
+
+        for (k = 0U; k < f->num_taps; k++)
+        {
+            acc += (int64_t)f->coeffs[k] * f->state[i + k];
+        }
+        out[i] = dsp_sat32(acc >> 31);
+    }
+    memmove(f->state, f->state + n, hist * sizeof(q31_t));
+}
+
+/**
+ * @brief  q15 FIR decimator, keeps the last output of every group of factor samples
+ * @param  d   Instance
+ * @param  in  Input block (n multiple of factor)
+ * @param  out Output block (n / factor samples)
+ * @param  n   Input block length
+ */
+void bare_dsp_decim_q15(DSP_DecimQ15_t *d, const q15_t *in, q15_t *out, uint32_t n)
+{
+    DSP_FirQ15_t *f = &d->fir;
+    uint32_t hist = f->num_taps - 1U;
+    uint32_t i;
+
+    memcpy(f->state + hist, in, n * sizeof(q15_t));
+    for (i = d->factor - 1U; i < n; i += d->factor)
+    {
+        *out++ = dsp_sat16(dsp_dot_q15(f->coeffs, f->state + i, f->num_taps) >> 15);
+    }
+    memmove(f->state, f->state + n, hist * sizeof(q15_t));
+}
+
+/**
+ * @brief  q15 FIR decimator, scalar reference
+ */
+void bare_dsp_decim_q15_ref(DSP_DecimQ15_t *d, const q15_t *in, q15_t *out, uint32_t n)
+{
+    DSP_FirQ15_t *f = &d->fir;
+    uint32_t hist = f->num_taps - 1U;
+    uint32_t i;
+
+    memcpy(f->state + hist, in, n * sizeof(q15_t));
+    for (i = 0U; i < n; i++)
+    {
+        if ((i % d->factor) == (d->factor - 1U))
+        {
+            *out++ = dsp_sat16(dsp_dot_q15_ref(f->coeffs, f->state + i, f->num_taps) >> 15);
+        }
+    }
+    memmove(f->state, f->state + n, hist * sizeof(q15_t));
+}
+
+/*******************************************************************************************
+ *                              Public API Functions - IIR
+ *******************************************************************************************/
+
+/**
+ * @brief  q15 direct form I biquad cascade
+ * @param  f   Instance
+ * @param  in  Input block
+ * @param  out Output block (may alias in)
+ * @param  n   Block length
+ *
+ * @note   Per sample and stage: SMUAD + SMLAD + one MAC, the packed histories stay in
+ *         registers for the whole block.
+ */
+void bare_dsp_biquad_q15(DSP_BiquadQ15_t *f, const q15_t *in, q15_t *out, uint32_t n)
+{
+    const q15_t *src = in;
+    uint32_t shift = 15U - f->post_shift;
+    uint8_t s;
+    uint32_t i;
+
+    for (s = 0U; s < f->stages; s++)
+    {
+        const q15_t *c = f->coeffs + (5U * s);
+        q15_t *st = f->state + (4U * s);
+        int32_t b0 = c[0];
+        uint32_t b12 = dsp_read_q15x2(&c[1]);
+        uint32_t a12 = dsp_read_q15x2(&c[3]);
+        uint32_t x12 = dsp_read_q15x2(&st[0]);
+        uint32_t y12 = dsp_read_q15x2(&st[2]);
+
+        for (i = 0U; i < n; i++)
+        {
+            q15_t x0 = src[i];
+            int32_t acc = dsp_smuad(b12, x12);
+            q15_t y0;
+
+            acc = dsp_smlad(a12, y12, acc);
+            acc = (int32_t)((uint32_t)acc + (uint32_t)(b0 * x0));
+            y0 = dsp_sat16(acc >> shift);
+
+            x12 = (x12 << 16) | (uint16_t)x0; // {x1, x2} <- {x0, x1} (PKHBT)
+            y12 = (y12 << 16) | (uint16_t)y0;
+            out[i] = y0;
+        }
+
+        dsp_write_q15x2(&st[0], x12);
+        dsp_write_q15x2(&st[2], y12);
+        src = out;
+    }
+}
+
+/**
+ * @brief  q15 direct form I biquad cascade, scalar reference (same 32-bit wrap-around)
+ */
+void bare_dsp_biquad_q15_ref(DSP_BiquadQ15_t *f, const q15_t *in, q15_t *out, uint32_t n)
+{
+    const q15_t *src = in;
+    uint32_t shift = 15U - f->post_shift;
+    uint8_t s;
+    uint32_t i;
+
+    for (s = 0U; s < f->stages; s++)
+    {
+        const q15_t *c = f->coeffs + (5U * s);
+        q15_t *st = f->state + (4U * s);
+
+        for (i = 0U; i < n; i++)
+        {
+            q15_t x0 = src[i];
+            uint32_t acc = (uint32_t)(c[0] * x0) + (uint32_t)(c[1] * st[0]) +
+                           (uint32_t)(c[2] * st[1]) + (uint32_t)(c[3] * st[2]) +
+                           (uint32_t)(c[4] * st[3]);
+            q15_t y0 = dsp_sat16((int32_t)acc >> shift);
+
+            st[1] = st[0];
+            st[0] = x0;
+            st[3] = st[2];
+            st[2] = y0;
+            out[i] = y0;
+        }
+        src = out;
+    }
+}
+
+/*******************************************************************************************
+ *                          Public API Functions - Moving Average
+ *******************************************************************************************/
+
+/**
+ * @brief  q15 moving average with a running window sum
+ * @param  f   Instance
+ * @param  in  Input block
+ * @param  out Output block
+ * @param  n   Block length
+ */
+void bare_dsp_movavg_q15(DSP_MovAvgQ15_t *f, const q15_t *in, q15_t *out, uint32_t n)
+{
+    uint32_t len = 1UL << f->log2_len;
+    q15_t *w = f->state;
+    int32_t sum = f->sum;
+    uint32_t i;
+
+    memcpy(w + len, in, n * sizeof(q15_t));
+    for (i = 0U; i < n; i++)
+    {
+        sum += w[len + i] - w[i]; // Newest in, oldest out
+        out[i] = (q15_t)(sum >> f->log2_len);
+    }
+    memmove(w, w + n, len * sizeof(q15_t));
+    f->sum = sum;
+}
+
+/**
+ * @brief  q15 moving average, scalar reference (full window sum per sample)
+ */
+void bare_dsp_movavg_q15_ref(DSP_MovAvgQ15_t *f, const q15_t *in, q15_t *out, uint32_t n)
+{
+    uint32_t len = 1UL << f->log2_len;
+    q15_t *w = f->state;
+    int32_t sum = 0;
+    uint32_t i, k;
+
+    memcpy(w + len, in, n * sizeof(q15_t));
+    for (i = 0U; i < n; i++)
+    {
+        sum = 0;
+        for (k = 1U; k <= len; k++)
+        {
+            sum += w[i + k];
+        }
+        out[i] = (q15_t)(sum >> f->log2_len);
+    }
+    memmove(w, w + n, len * sizeof(q15_t));
+    if (n != 0U)
+    {
+        f->sum = sum;
+    }
+}
+
+/*******************************************************************************************
+ *                           Public API Functions - Vector Ops
+ *******************************************************************************************/
+
+/**
+ * @brief  Saturating add of two q15 blocks
+ * @param  a   First block
+ * @param  b   Second block
+ * @param  out Result block (may alias a or b)
+ * @param  n   Block length
+ */
+void bare_dsp_add_q15(const q15_t *a, const q15_t *b, q15_t *out, uint32_t n)
+{
+    while (n >= 4U)
+    {
+        uint32_t r0 = dsp_qadd16(dsp_read_q15x2(a), dsp_read_q15x2(b));
+        uint32_t r1 = dsp_qadd16(dsp_read_q15x2(a + 2), dsp_read_q15x2(b + 2));
+
+        dsp_write_q15x2(out, r0);
+        dsp_write_q15x2(out + 2, r1);
+        a += 4;
+        b += 4;
+        out += 4;
+        n -= 4U;
+    }
+    while (n--)
+    {
+        *out++ = dsp_sat16((int32_t)*a++ + *b++);
+    }
+}
+
+/**
+ * @brief  Saturating add of two q15 blocks, scalar reference
+ */
+void bare_dsp_add_q15_ref(const q15_t *a, const q15_t *b, q15_t *out, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        out[i] = dsp_sat16((int32_t)a[i] + b[i]);
+    }
+}
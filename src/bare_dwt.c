@@ -0,0 +1,25 @@
+/*******************************************************************************************
+ * @file    bare_dwt.c
+ * @author  ka5j
+ * @brief   Bare-metal DWT cycle counter implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "dwt_registers.h"
+#include "bare_dwt.h"
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Enable trace and start the DWT cycle counter from zero
+ */
+void bare_dwt_init(void)
+{
+    DEMCR |= DEMCR_TRCENA;          // DWT is gated by the trace enable
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA;
+}
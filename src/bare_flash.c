@@ -0,0 +1,242 @@
+/*******************************************************************************************
+ * @file    bare_flash.c
+ * @author  ka5j
+ * @brief   Bare-metal embedded flash program/erase driver for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    CR is unlocked only for the duration of an operation. After programming or
+ *          erasing, the flash data (and instruction) caches are reset so no stale line
+ *          is served for the changed area.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "flash_registers.h"
+#include "bare_flash.h"
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Unlock CR with the key sequence (no-op if already unlocked)
+ */
+static void flash_unlock(void)
+{
+    if (FLASH->CR & FLASH_CR_LOCK)
+    {
+        FLASH->KEYR = FLASH_KEY1;
+        FLASH->KEYR = FLASH_KEY2;
+    }
+}
+
+/**
+ * @brief  Relock CR
+ */
+static void flash_lock(void)
+{
+    FLASH->CR |= FLASH_CR_LOCK;
+}
+
+/**
+ * @brief  Map SR error flags to a status and clear them
+ */
+static FLASH_Status_t flash_check(void)
+{
+    uint32_t sr = FLASH->SR;
+
+    FLASH->SR = FLASH_SR_ERRORS | FLASH_SR_EOP; // rc_w1
+    if (sr & FLASH_SR_WRPERR)
+    {
+        return FLASH_ERR_WRP;
+    }
+    if (sr & FLASH_SR_ERRORS)
+    {
+        return FLASH_ERR_PROG;
+    }
+    return FLASH_OK;
+}
+
+/**
+ * @brief  Reset the flash caches: the changed area must be fetched again
+ */
+static void flash_flush_caches(void)
+{
+    uint32_t acr = FLASH->ACR;
+    uint32_t off = acr & ~(FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+
+    FLASH->ACR = off; // Caches must be disabled to be reset
+    FLASH->ACR = off | FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+    FLASH->ACR = off;
+    FLASH->ACR = acr & ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Address of a sector
+ * @param  sector: Sector number (0-7)
+ * @retval First byte of the sector
+ */
+uintptr_t bare_flash_sector_addr(uint8_t sector)
+{
+    if (sector < 4U)
+    {
+        return FLASH_MEM_BASE + ((uint32_t)sector << 14); // 16 KB
+    }
+    if (sector == 4U)
+    {
+        return FLASH_MEM_BASE + 0x10000UL; // 64 KB
+    }
+    return FLASH_MEM_BASE + 0x20000UL + ((uint32_t)(sector - 5U) << 17); // 128 KB
+}
+
+/**
+ * @brief  Size of a sector
+ * @param  sector: Sector number (0-7)
+ * @retval Size in bytes, 0 for an invalid sector
+ */
+uint32_t bare_flash_sector_size(uint8_t sector)
+{
+    if (sector < 4U)
+    {
+        return 0x4000UL;
+    }
+    if (sector == 4U)
+    {
+        return 0x10000UL;
+    }
+    return (sector < FLASH_SECTORS) ? 0x20000UL : 0U;
+}
+
+/**
+ * @brief  Program words (blocking)
+ * @param  addr: Word-aligned destination, erased beforehand
+ * @param  words: Source data
+ * @param  n: Number of words
+ * @retval FLASH_OK or an error
+ */
+FLASH_Status_t bare_flash_program(uintptr_t addr, const uint32_t *words, uint32_t n)
+{
+    volatile uint32_t *dst = (volatile uint32_t *)addr;
+    FLASH_Status_t status = FLASH_OK;
+    uint32_t i;
+
+    if ((addr & 3U) || (addr < FLASH_MEM_BASE) ||
+        ((addr + 4U * n) > (bare_flash_sector_addr(FLASH_SECTORS - 1U) +
+                            bare_flash_sector_size(FLASH_SECTORS - 1U))))
+    {
+        return FLASH_ERR_PARAM;
+    }
+
+    while (bare_flash_erase_poll() == FLASH_BUSY)
+        ; // A background erase must finish first
+    (void)flash_check();
+
+    flash_unlock();
+    FLASH->CR = FLASH_CR_PSIZE_X32 | FLASH_CR_PG;
+    for (i = 0U; (i < n) && (status == FLASH_OK); i++)
+    {
+        dst[i] = words[i];
+        while (FLASH->SR & FLASH_SR_BSY)
+            ;
+        status = flash_check();
+    }
+    FLASH->CR = 0U;
+    flash_lock();
+    flash_flush_caches();
+
+    for (i = 0U; (i < n) && (status == FLASH_OK); i++)
+    {
+        if (dst[i] != words[i])
+        {
+            status = FLASH_ERR_VERIFY;
+        }
+    }
+    return status;
+}
+
+/**
+ * @brief  Start a sector erase and return immediately
+ * @param  sector: Sector number (0-7)
+ * @retval FLASH_OK (started), FLASH_BUSY or an error
+ */
+FLASH_Status_t bare_flash_erase_start(uint8_t sector)
+{
+    if (sector >= FLASH_SECTORS)
+    {
+        return FLASH_ERR_PARAM;
+    }
+    if (FLASH->SR & FLASH_SR_BSY)
+    {
+        return FLASH_BUSY;
+    }
+    (void)flash_check();
+
+    flash_unlock();
+    FLASH->CR = FLASH_CR_PSIZE_X32 | FLASH_CR_SER | ((uint32_t)sector << FLASH_CR_SNB_Pos);
+    FLASH->CR |= FLASH_CR_STRT;
+    return FLASH_OK;
+}
+
+/**
+ * @brief  Check a running erase
+ * @retval FLASH_BUSY, FLASH_OK (done, caches flushed) or an error
+ */
+FLASH_Status_t bare_flash_erase_poll(void)
+{
+    FLASH_Status_t status;
+
+    if (FLASH->SR & FLASH_SR_BSY)
+    {
+        return FLASH_BUSY;
+    }
+    if (!(FLASH->CR & FLASH_CR_SER))
+    {
+        return FLASH_OK; // No erase pending
+    }
+
+    status = flash_check();
+    FLASH->CR = 0U;
+    flash_lock();
+    flash_flush_caches();
+    return status;
+}
+
+/**
+ * @brief  Erase a sector and wait for the end
+ * @param  sector: Sector number (0-7)
+ * @retval FLASH_OK or an error
+ */
+FLASH_Status_t bare_flash_erase(uint8_t sector)
+{
+    FLASH_Status_t status = bare_flash_erase_start(sector);
+
+    while (status == FLASH_BUSY)
+    {
+        status = bare_flash_erase_start(sector); // Earlier erase still running
+    }
+    if (status != FLASH_OK)
+    {
+        return status;
+    }
+    do
+    {
+        status = bare_flash_erase_poll();
+    } while (status == FLASH_BUSY);
+    return status;
+}
+
+/*******************************************************************************************
+ *                                 Storage Binding
+ *******************************************************************************************/
+
+const FLASH_Ops_t bare_flash_ops = {
+    .sector_addr = bare_flash_sector_addr,
+    .sector_size = bare_flash_sector_size,
+    .program = bare_flash_program,
+    .erase_start = bare_flash_erase_start,
+    .erase_poll = bare_flash_erase_poll,
+};
@@ -0,0 +1,266 @@
+/*******************************************************************************************
+ * @file    bare_frame.c
+ * @author  ka5j
+ * @brief   COBS + CRC-16 packet framing codec implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    COBS (Consistent Overhead Byte Stuffing) removes every 0x00 from the frame so
+ *          the delimiter is unambiguous, at a cost of one byte per 254. The encoder reads
+ *          header, payload and CRC as three segments, so the payload is never copied.
+ *******************************************************************************************/
+
+#include "bare_frame.h"
+#include "bare_crc_sw.h"
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define COBS_MAX_RUN 254U /*!< Longest run of non-zero bytes in one COBS block */
+
+/** Read cursor over a list of byte segments */
+typedef struct
+{
+    const uint8_t *const *data; /*!< Segment start pointers */
+    const size_t *len;          /*!< Segment lengths */
+    size_t count;               /*!< Number of segments */
+    size_t seg;                 /*!< Current segment */
+    size_t off;                 /*!< Offset in current segment */
+} frame_cursor_t;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Skip exhausted segments, returns 0 at the end of the data
+ */
+static int cursor_valid(frame_cursor_t *c)
+{
+    while ((c->seg < c->count) && (c->off >= c->len[c->seg]))
+    {
+        c->seg++;
+        c->off = 0U;
+    }
+    return (c->seg < c->count);
+}
+
+/**
+ * @brief  COBS encode a segment list to a sink, followed by the frame delimiter
+ */
+static void cobs_encode(frame_cursor_t *c, FRAME_Sink_t sink, void *ctx)
+{
+    for (;;)
+    {
+        frame_cursor_t scan = *c;
+        uint32_t run = 0U;
+        uint32_t i;
+        uint8_t zero = 0U;
+
+        /* Look ahead for the length of the next non-zero run */
+        while ((run < COBS_MAX_RUN) && cursor_valid(&scan))
+        {
+            if (scan.data[scan.seg][scan.off] == 0U)
+            {
+                zero = 1U;
+                break;
+            }
+            scan.off++;
+            run++;
+        }
+
+        sink((uint8_t)(run + 1U), ctx);
+        for (i = 0U; i < run; i++)
+        {
+            cursor_valid(c);
+            sink(c->data[c->seg][c->off++], ctx);
+        }
+
+        if (zero)
+        {
+            cursor_valid(c);
+            c->off++; // Zero is implied by the code byte
+        }
+        else if (run < COBS_MAX_RUN)
+        {
+            break; // End of data
+        }
+    }
+    sink(FRAME_DELIMITER, ctx);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Encode and emit one complete frame
+ * @param  seq     Sequence number
+ * @param  type    Packet type
+ * @param  payload Payload bytes
+ * @param  len     Payload length
+ * @param  sink    Byte sink
+ * @param  ctx     Sink context
+ */
+void bare_frame_encode(uint8_t seq, uint8_t type, const void *payload, size_t len,
+                       FRAME_Sink_t sink, void *ctx)
+{
+    uint8_t header[FRAME_HEADER_SIZE];
+    uint8_t trailer[FRAME_CRC_SIZE];
+    uint16_t crc;
+    const uint8_t *data[3];
+    size_t lens[3];
+    frame_cursor_t cursor;
+
+    header[0] = seq;
+    header[1] = type;
+
+    crc = bare_crc16_ccitt(BARE_CRC16_CCITT_INIT, header, FRAME_HEADER_SIZE);
+    crc = bare_crc16_ccitt(crc, payload, len);
+    trailer[0] = (uint8_t)(crc & 0xFFU);
+    trailer[1] = (uint8_t)(crc >> 8);
+
+    data[0] = header;
+    lens[0] = FRAME_HEADER_SIZE;
+    data[1] = (const uint8_t *)payload;
+    lens[1] = len;
+    data[2] = trailer;
+    lens[2] = FRAME_CRC_SIZE;
+
+    cursor.data = data;
+    cursor.len = lens;
+    cursor.count = 3U;
+    cursor.seg = 0U;
+    cursor.off = 0U;
+
+    cobs_encode(&cursor, sink, ctx);
+}
+
+/**
+ * @brief  Decode a COBS block in place
+ * @param  buf     Encoded bytes, overwritten with decoded bytes
+ * @param  len     Encoded length
+ * @param  out_len Decoded length
+ * @retval FRAME_OK or FRAME_ERR_COBS
+ *
+ * @note   The write index always trails the read index by at least one code byte, so
+ *         decoding in place never overwrites unread input.
+ */
+FRAME_Status_t bare_frame_cobs_decode(uint8_t *buf, size_t len, size_t *out_len)
+{
+    size_t in = 0U;
+    size_t out = 0U;
+    uint8_t prev = 0xFFU;
+
+    while (in < len)
+    {
+        uint8_t code = buf[in++];
+        uint8_t k;
+
+        if ((code == 0U) || ((size_t)(code - 1U) > (len - in)))
+        {
+            return FRAME_ERR_COBS;
+        }
+
+        if (prev != 0xFFU)
+        {
+            buf[out++] = 0U; // Implied zero between blocks
+        }
+
+        for (k = 1U; k < code; k++)
+        {
+            if (buf[in] == 0U)
+            {
+                return FRAME_ERR_COBS;
+            }
+            buf[out++] = buf[in++];
+        }
+        prev = code;
+    }
+
+    *out_len = out;
+    return FRAME_OK;
+}
+
+/**
+ * @brief  Decode a received frame in place and validate its CRC
+ * @param  buf Encoded frame without the delimiter
+ * @param  len Encoded length
+ * @param  pkt Decoded packet
+ * @retval FRAME_OK or an error code
+ */
+FRAME_Status_t bare_frame_decode(uint8_t *buf, size_t len, FRAME_Packet_t *pkt)
+{
+    size_t n;
+    uint16_t crc;
+
+    if (bare_frame_cobs_decode(buf, len, &n) != FRAME_OK)
+    {
+        return FRAME_ERR_COBS;
+    }
+    if (n < FRAME_OVERHEAD)
+    {
+        return FRAME_ERR_SHORT;
+    }
+
+    n -= FRAME_CRC_SIZE;
+    crc = bare_crc16_ccitt(BARE_CRC16_CCITT_INIT, buf, n);
+    if ((buf[n] != (uint8_t)(crc & 0xFFU)) || (buf[n + 1U] != (uint8_t)(crc >> 8)))
+    {
+        return FRAME_ERR_CRC;
+    }
+
+    pkt->seq = buf[0];
+    pkt->type = buf[1];
+    pkt->payload = &buf[FRAME_HEADER_SIZE];
+    pkt->len = n - FRAME_HEADER_SIZE;
+    return FRAME_OK;
+}
+
+/**
+ * @brief  Bind a receive buffer to an assembler and reset it
+ * @param  rx  Assembler state
+ * @param  buf Receive buffer
+ * @param  cap Buffer capacity
+ */
+void bare_frame_rx_init(FRAME_Rx_t *rx, uint8_t *buf, size_t cap)
+{
+    rx->buf = buf;
+    rx->cap = cap;
+    rx->len = 0U;
+    rx->overflow = 0U;
+}
+
+/**
+ * @brief  Push one received byte into the assembler
+ * @param  rx   Assembler state
+ * @param  byte Received byte
+ * @retval FRAME_OK (frame complete), FRAME_INCOMPLETE or FRAME_ERR_OVERFLOW
+ *
+ * @note   After FRAME_OK the caller owns rx->buf and must call bare_frame_rx_init()
+ *         (typically with a fresh buffer) before pushing the next byte.
+ */
+FRAME_Status_t bare_frame_rx_push(FRAME_Rx_t *rx, uint8_t byte)
+{
+    if (byte == FRAME_DELIMITER)
+    {
+        if (rx->overflow)
+        {
+            rx->len = 0U;
+            rx->overflow = 0U;
+            return FRAME_ERR_OVERFLOW;
+        }
+        /* Back-to-back delimiters are idle fill, not empty frames */
+        return (rx->len != 0U) ? FRAME_OK : FRAME_INCOMPLETE;
+    }
+
+    if (rx->len < rx->cap)
+    {
+        rx->buf[rx->len++] = byte;
+    }
+    else
+    {
+        rx->overflow = 1U;
+    }
+    return FRAME_INCOMPLETE;
+}
@@ -13,43 +13,24 @@
  #include "gpio_registers.h"
  #include "bare_gpio.h"
  #include "rcc_registers.h"
+ #include "bare_periph.h"
 
 /*******************************************************************************************
- *                               Internal Helper Functions
+ *                               Public API Functions
  *******************************************************************************************/
 
 /**
  * @brief  Enable RCC Clock for a given GPIO port
  * @param  GPIOx: pointer to GPIO peripheral base address
  * @retval None
- * 
+ *
  * @note   Must be called before accessing GPIO registers.
  */
-static void bare_gpio_enable_clock(GPIO_TypeDef *GPIOx)
+void bare_gpio_enable_clock(GPIO_TypeDef *GPIOx)
 {
-    if (GPIOx == GPIOA) {
-        RCC->AHB1ENR |= (1 << 0);
-    } else if (GPIOx == GPIOB) {
-        RCC->AHB1ENR |= (1 << 1);
-    } else if (GPIOx == GPIOC) {
-        RCC->AHB1ENR |= (1 << 2);
-    } else if (GPIOx == GPIOD) {
-        RCC->AHB1ENR |= (1 << 3);
-    } else if (GPIOx == GPIOE) {
-        RCC->AHB1ENR |= (1 << 4);
-    } else if (GPIOx == GPIOF) {
-        RCC->AHB1ENR |= (1 << 5);
-    } else if (GPIOx == GPIOG) {
-        RCC->AHB1ENR |= (1 << 6);
-    } else if (GPIOx == GPIOH) {
-        RCC->AHB1ENR |= (1 << 7);
-    }
+    bare_periph_enable_clock(bare_periph_gpio(GPIOx));
 }
 
-/*******************************************************************************************
- *                               Public API Functions
- *******************************************************************************************/
-
 /**
  * @brief  Initialize a GPIO pin
  * @param  GPIOx: pointer to GPIO peripheral base address
@@ -144,4 +125,23 @@ void bare_gpio_AF(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin){
 
     /* 4. Configure pull-up/pull-down resistors */
     GPIOx->PUPDR &= ~(0x3U << (pin * 2)); // no pull-up/pull-down  
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Select the alternate function number of a pin
+ *
+ * @param GPIOx   Pointer to GPIO peripheral
+ * @param pin     GPIO pin number
+ * @param af      Alternate function number (0-15)
+ */
+void bare_gpio_set_AF(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin, uint8_t af)
+{
+    if (pin <= 7)
+    {
+        GPIOx->AFRL = (GPIOx->AFRL & ~(0xFU << (4 * pin))) | ((af & 0xFU) << (4 * pin));
+    }
+    else
+    {
+        GPIOx->AFRH = (GPIOx->AFRH & ~(0xFU << (4 * (pin - 8)))) | ((af & 0xFU) << (4 * (pin - 8)));
+    }
+}
@@ -0,0 +1,671 @@
+/*******************************************************************************************
+ * @file    bare_i2c.c
+ * @author  ka5j
+ * @brief   Bare-metal interrupt/DMA driven I2C1-I2C3 master driver implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Master receiver follows RM0390 Section 27.3.3 for 1, 2 and N > 2 bytes:
+ *          ACK is cleared (with POS for two bytes) before ADDR is released so that the last
+ *          byte is NACKed, and the final bytes are collected on BTF so the STOP lands in time.
+ *          DMA reads use LAST so the hardware NACKs the final byte itself.
+ *
+ *          RX DMA streams (RM0390 Table 28): I2C1 DMA1 S0 ch1, I2C2 DMA1 S3 ch7,
+ *          I2C3 DMA1 S2 ch3. I2C2/I2C3 share streams with SPI2/SPI3 RX; disable use_dma if
+ *          both are needed.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "i2c_registers.h"
+#include "bare_i2c.h"
+#include "bare_dma.h"
+#include "bare_gpio.h"
+#include "bare_rcc.h"
+#include "bare_periph.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define I2C_COUNT 3U
+#define I2C_STOP_SPIN 10000U /*!< Bound on waiting for a previous STOP to go out */
+
+/** Instance and its descriptor (clock gate, event/error vectors, RX DMA request) */
+static const struct
+{
+    I2C_TypeDef *i2c;
+    PERIPH_Id_t id;
+} i2c_hw[I2C_COUNT] = {
+    {I2C1, PERIPH_I2C1},
+    {I2C2, PERIPH_I2C2},
+    {I2C3, PERIPH_I2C3},
+};
+
+/** Runtime state and saved configuration of each instance */
+static struct
+{
+    I2C_Bus_t bus;
+    I2C_Pin_t scl;
+    I2C_Pin_t sda;
+    uint8_t af;
+    uint32_t cr2;   /*!< FREQ field */
+    uint32_t ccr;   /*!< Clock control */
+    uint32_t trise; /*!< Rise time */
+} i2c_state[I2C_COUNT];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Index of an I2C instance in i2c_hw / i2c_state
+ */
+static uint32_t i2c_index(I2C_TypeDef *I2Cx)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (I2C_COUNT - 1U); i++)
+    {
+        if (i2c_hw[i].i2c == I2Cx)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief  Clear ADDR (read SR1 then SR2)
+ */
+static inline void i2c_clear_addr(I2C_TypeDef *I2Cx)
+{
+    (void)I2Cx->SR1;
+    (void)I2Cx->SR2;
+}
+
+/**
+ * @brief  Start the next queued transaction or go idle
+ */
+static void i2c_next(I2C_Bus_t *bus)
+{
+    I2C_TypeDef *I2Cx = bus->regs;
+    I2C_Transaction_t *t;
+    uint32_t spin = I2C_STOP_SPIN;
+    uint32_t primask = bare_irq_save();
+
+    t = bus->head;
+    if (t != NULL)
+    {
+        bus->head = t->next;
+        if (bus->head == NULL)
+        {
+            bus->tail = NULL;
+        }
+    }
+    bus->cur = t;
+    if (t == NULL)
+    {
+        bus->state = I2C_STATE_IDLE;
+    }
+    else
+    {
+        bus->state = I2C_STATE_START;
+    }
+    bare_irq_restore(primask);
+
+    if (t == NULL)
+    {
+        return;
+    }
+
+    bus->idx = 0U;
+    bus->reading = (t->tx_len == 0U) && (t->rx_len > 0U);
+
+    while ((I2Cx->CR1 & I2C_CR1_STOP) && spin--)
+        ; // Previous STOP still being generated
+
+    I2Cx->CR1 |= I2C_CR1_ACK | I2C_CR1_START;
+    I2Cx->CR2 |= I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+}
+
+/**
+ * @brief  Complete the current transaction and move on
+ */
+static void i2c_finish(I2C_Bus_t *bus, I2C_Status_t status)
+{
+    I2C_TypeDef *I2Cx = bus->regs;
+    I2C_Transaction_t *t = bus->cur;
+
+    I2Cx->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN | I2C_CR2_DMAEN |
+                   I2C_CR2_LAST);
+    I2Cx->CR1 &= ~I2C_CR1_POS;
+
+    bus->cur = NULL;
+    if (t != NULL)
+    {
+        t->status = status;
+        if (t->done != NULL)
+        {
+            t->done(status, t->ctx);
+        }
+    }
+    i2c_next(bus);
+}
+
+/**
+ * @brief  EV6: address acknowledged, set up the data phase before releasing ADDR
+ */
+static void i2c_on_addr(I2C_Bus_t *bus, I2C_Transaction_t *t)
+{
+    I2C_TypeDef *I2Cx = bus->regs;
+    uint16_t n = t->rx_len;
+
+    if (!bus->reading)
+    {
+        i2c_clear_addr(I2Cx);
+        if (t->tx_len == 0U)
+        {
+            I2Cx->CR1 |= I2C_CR1_STOP; // Address probe
+            i2c_finish(bus, I2C_OK);
+            return;
+        }
+        bus->state = I2C_STATE_TX;
+        I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+        return;
+    }
+
+    if ((bus->rx_stream != NULL) && (n >= I2C_DMA_THRESHOLD))
+    {
+        bus->state = I2C_STATE_RX_DMA;
+        bare_dma_start(bus->rx_stream, (uint32_t)&I2Cx->DR, (uint32_t)t->rx, 0U, n);
+        I2Cx->CR2 |= I2C_CR2_DMAEN | I2C_CR2_LAST;
+        i2c_clear_addr(I2Cx);
+        return;
+    }
+
+    bus->state = I2C_STATE_RX;
+    if (n == 1U)
+    {
+        I2Cx->CR1 &= ~I2C_CR1_ACK;
+        i2c_clear_addr(I2Cx);
+        I2Cx->CR1 |= I2C_CR1_STOP;
+        I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+    }
+    else if (n == 2U)
+    {
+        I2Cx->CR1 = (I2Cx->CR1 & ~I2C_CR1_ACK) | I2C_CR1_POS;
+        i2c_clear_addr(I2Cx);
+        I2Cx->CR2 &= ~I2C_CR2_ITBUFEN; // Both bytes collected on BTF
+    }
+    else
+    {
+        I2Cx->CR1 |= I2C_CR1_ACK;
+        i2c_clear_addr(I2Cx);
+        I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+    }
+}
+
+/**
+ * @brief  Write phase: feed DR, then restart for the read phase or stop
+ */
+static void i2c_on_tx(I2C_Bus_t *bus, I2C_Transaction_t *t, uint32_t sr1)
+{
+    I2C_TypeDef *I2Cx = bus->regs;
+
+    if (bus->idx < t->tx_len)
+    {
+        I2Cx->DR = t->tx[bus->idx++];
+        return;
+    }
+
+    if (!(sr1 & I2C_SR1_BTF))
+    {
+        I2Cx->CR2 &= ~I2C_CR2_ITBUFEN; // Last byte queued, wait for it to shift out
+        return;
+    }
+
+    if (t->rx_len > 0U)
+    {
+        bus->reading = 1U;
+        bus->idx = 0U;
+        bus->state = I2C_STATE_START;
+        I2Cx->CR1 |= I2C_CR1_ACK | I2C_CR1_START; // Repeated start
+    }
+    else
+    {
+        I2Cx->CR1 |= I2C_CR1_STOP;
+        i2c_finish(bus, I2C_OK);
+    }
+}
+
+/**
+ * @brief  Interrupt driven read phase
+ */
+static void i2c_on_rx(I2C_Bus_t *bus, I2C_Transaction_t *t, uint32_t sr1)
+{
+    I2C_TypeDef *I2Cx = bus->regs;
+    uint16_t rem = (uint16_t)(t->rx_len - bus->idx);
+
+    if ((rem > 3U) || (rem == 1U))
+    {
+        t->rx[bus->idx++] = (uint8_t)I2Cx->DR;
+        if (rem == 1U)
+        {
+            i2c_finish(bus, I2C_OK); // STOP already requested at EV6
+        }
+    }
+    else if (!(sr1 & I2C_SR1_BTF))
+    {
+        I2Cx->CR2 &= ~I2C_CR2_ITBUFEN; // Data N-2 in DR: wait for N-1 in the shifter
+    }
+    else if (rem == 3U)
+    {
+        I2Cx->CR1 &= ~I2C_CR1_ACK; // Byte N will be NACKed
+        t->rx[bus->idx++] = (uint8_t)I2Cx->DR;
+    }
+    else
+    {
+        I2Cx->CR1 |= I2C_CR1_STOP;
+        t->rx[bus->idx++] = (uint8_t)I2Cx->DR;
+        t->rx[bus->idx++] = (uint8_t)I2Cx->DR;
+        i2c_finish(bus, I2C_OK);
+    }
+}
+
+/**
+ * @brief  RX DMA event: transfer complete ends the read
+ */
+static void i2c_dma_event(uint32_t events, void *ctx)
+{
+    I2C_Bus_t *bus = (I2C_Bus_t *)ctx;
+
+    if (bus->state != I2C_STATE_RX_DMA)
+    {
+        return;
+    }
+
+    if (events & DMA_EVENT_COMPLETE)
+    {
+        bus->regs->CR1 |= I2C_CR1_STOP;
+        i2c_finish(bus, I2C_OK);
+    }
+    else if (events & DMA_EVENT_ERROR)
+    {
+        bus->regs->CR1 |= I2C_CR1_STOP;
+        i2c_finish(bus, I2C_ERR_OVR);
+    }
+}
+
+/**
+ * @brief  Bit-banging half period (about 5 us, a 100 kHz SCL)
+ */
+static void i2c_delay_half(void)
+{
+    volatile uint32_t n = bare_rcc_get_hclk() / 800000U;
+
+    while (n--)
+        ;
+}
+
+/*******************************************************************************************
+ *                            State Machine Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Reset a state machine and attach it to a register block
+ * @param  bus       State machine
+ * @param  regs      Peripheral or simulated register block
+ * @param  rx_stream RX DMA stream or NULL
+ */
+void bare_i2c_bus_init(I2C_Bus_t *bus, I2C_TypeDef *regs, DMA_Stream_TypeDef *rx_stream)
+{
+    bus->regs = regs;
+    bus->rx_stream = rx_stream;
+    bus->state = I2C_STATE_IDLE;
+    bus->reading = 0U;
+    bus->idx = 0U;
+    bus->cur = bus->head = bus->tail = NULL;
+}
+
+/**
+ * @brief  Queue a transaction on a state machine
+ * @param  bus State machine
+ * @param  t   Transaction
+ */
+void bare_i2c_bus_submit(I2C_Bus_t *bus, I2C_Transaction_t *t)
+{
+    uint8_t start;
+    uint32_t primask;
+
+    t->status = I2C_PENDING;
+    t->next = NULL;
+
+    primask = bare_irq_save();
+    if (bus->tail != NULL)
+    {
+        bus->tail->next = t;
+    }
+    else
+    {
+        bus->head = t;
+    }
+    bus->tail = t;
+
+    start = (bus->state == I2C_STATE_IDLE);
+    if (start)
+    {
+        bus->state = I2C_STATE_START; // Claim the bus before re-enabling interrupts
+    }
+    bare_irq_restore(primask);
+
+    if (start)
+    {
+        i2c_next(bus);
+    }
+}
+
+/**
+ * @brief  Advance the state machine on an event interrupt
+ * @param  bus State machine
+ */
+void bare_i2c_bus_ev(I2C_Bus_t *bus)
+{
+    I2C_TypeDef *I2Cx = bus->regs;
+    I2C_Transaction_t *t = bus->cur;
+    uint32_t sr1 = I2Cx->SR1;
+
+    if (t == NULL)
+    {
+        I2Cx->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN); // Nothing to drive
+        return;
+    }
+
+    if (sr1 & I2C_SR1_SB)
+    {
+        bus->state = I2C_STATE_ADDR;
+        I2Cx->DR = (uint32_t)(t->addr << 1) | bus->reading; // SR1 read + DR write clears SB
+        return;
+    }
+
+    if (sr1 & I2C_SR1_ADDR)
+    {
+        i2c_on_addr(bus, t);
+        return;
+    }
+
+    if (bus->state == I2C_STATE_TX)
+    {
+        if (sr1 & (I2C_SR1_TXE | I2C_SR1_BTF))
+        {
+            i2c_on_tx(bus, t, sr1);
+        }
+    }
+    else if (bus->state == I2C_STATE_RX)
+    {
+        if (sr1 & (I2C_SR1_RXNE | I2C_SR1_BTF))
+        {
+            i2c_on_rx(bus, t, sr1);
+        }
+    }
+}
+
+/**
+ * @brief  Handle an error interrupt, failing the current transaction
+ * @param  bus State machine
+ */
+void bare_i2c_bus_er(I2C_Bus_t *bus)
+{
+    I2C_TypeDef *I2Cx = bus->regs;
+    uint32_t sr1 = I2Cx->SR1;
+    uint32_t err = sr1 & (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR |
+                          I2C_SR1_TIMEOUT);
+    I2C_Status_t status;
+
+    I2Cx->SR1 = ~err & 0xFFFFUL; // Error flags are rc_w0
+
+    if (err & I2C_SR1_ARLO)
+    {
+        status = I2C_ERR_ARLO; // Bus already released to the winner, no STOP
+    }
+    else
+    {
+        if (err & I2C_SR1_AF)
+        {
+            status = I2C_ERR_NACK;
+        }
+        else if (err & I2C_SR1_OVR)
+        {
+            status = I2C_ERR_OVR;
+        }
+        else
+        {
+            status = I2C_ERR_BUS;
+        }
+        I2Cx->CR1 |= I2C_CR1_STOP;
+    }
+
+    if ((bus->state == I2C_STATE_RX_DMA) && (bus->rx_stream != NULL))
+    {
+        bare_dma_stop(bus->rx_stream);
+    }
+
+    if (bus->cur != NULL)
+    {
+        i2c_finish(bus, status);
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Compute CCR/TRISE for a bus speed
+ * @param  pclk1    APB1 clock in Hz
+ * @param  speed_hz Target SCL rate (clamped to I2C_SPEED_FAST)
+ * @param  ccr      Output: CCR register value
+ * @param  trise    Output: TRISE register value
+ * @retval Actual SCL frequency in Hz
+ *
+ * @note   Rounds CCR up so the bus never runs faster than requested. In fast mode both
+ *         duty cycles (Tlow/Thigh = 2 and 16/9) are tried and the closer one kept.
+ */
+uint32_t bare_i2c_timing(uint32_t pclk1, uint32_t speed_hz, uint32_t *ccr, uint32_t *trise)
+{
+    uint32_t mhz = pclk1 / 1000000U;
+    uint32_t c;
+
+    if (speed_hz > I2C_SPEED_FAST)
+    {
+        speed_hz = I2C_SPEED_FAST;
+    }
+
+    if (speed_hz <= I2C_SPEED_STANDARD)
+    {
+        c = (pclk1 + (2U * speed_hz) - 1U) / (2U * speed_hz);
+        if (c < 4U)
+        {
+            c = 4U;
+        }
+        *ccr = c;
+        *trise = mhz + 1U; // 1000 ns maximum rise time
+        return pclk1 / (2U * c);
+    }
+    else
+    {
+        uint32_t c2 = (pclk1 + (3U * speed_hz) - 1U) / (3U * speed_hz);
+        uint32_t c169 = (pclk1 + (25U * speed_hz) - 1U) / (25U * speed_hz);
+        uint32_t f2;
+        uint32_t f169;
+
+        c2 = (c2 < 1U) ? 1U : c2;
+        c169 = (c169 < 1U) ? 1U : c169;
+        f2 = pclk1 / (3U * c2);
+        f169 = pclk1 / (25U * c169);
+
+        *trise = ((mhz * 300U) / 1000U) + 1U; // 300 ns maximum rise time
+        if (f169 > f2)
+        {
+            *ccr = I2C_CCR_FS | I2C_CCR_DUTY | c169;
+            return f169;
+        }
+        *ccr = I2C_CCR_FS | c2;
+        return f2;
+    }
+}
+
+/**
+ * @brief  Initialize an I2C instance as master
+ * @param  I2Cx Pointer to I2C peripheral
+ * @param  cfg  Bus configuration
+ * @retval Actual SCL frequency in Hz
+ */
+uint32_t bare_i2c_init(I2C_TypeDef *I2Cx, const I2C_Config_t *cfg)
+{
+    uint32_t idx = i2c_index(I2Cx);
+    uint32_t pclk1 = bare_rcc_get_pclk1();
+    uint32_t actual;
+    DMA_Stream_TypeDef *rx_stream = NULL;
+
+    /* 1. Clock and saved configuration */
+    bare_periph_enable_clock(i2c_hw[idx].id);
+
+    i2c_state[idx].scl = cfg->scl;
+    i2c_state[idx].sda = cfg->sda;
+    i2c_state[idx].af = cfg->af;
+    i2c_state[idx].cr2 = (pclk1 / 1000000U) & I2C_CR2_FREQ_Msk;
+    actual = bare_i2c_timing(pclk1, cfg->speed_hz, &i2c_state[idx].ccr, &i2c_state[idx].trise);
+
+    /* 2. Open-drain pins; recovery leaves them in AF mode with the peripheral programmed */
+    bare_gpio_init(cfg->scl.port, cfg->scl.pin, GPIO_MODE_AF, GPIO_OTYPE_OD, GPIO_SPEED_FAST,
+                   GPIO_PULLUP);
+    bare_gpio_init(cfg->sda.port, cfg->sda.pin, GPIO_MODE_AF, GPIO_OTYPE_OD, GPIO_SPEED_FAST,
+                   GPIO_PULLUP);
+    (void)bare_i2c_recover(I2Cx);
+
+    /* 3. DMA stream for long reads */
+    if (cfg->use_dma)
+    {
+        DMA_Config_t rx = {
+            .channel = bare_periph_dma_channel(i2c_hw[idx].id, 0U),
+            .dir = DMA_DIR_PERIPH_TO_MEM,
+            .psize = DMA_SIZE_BYTE,
+            .msize = DMA_SIZE_BYTE,
+            .minc = 1U,
+            .priority = DMA_PRIORITY_HIGH,
+            .fifo = DMA_FIFO_DIRECT,
+            .complete_irq = 1U,
+        };
+
+        rx_stream = bare_periph_dma_stream(i2c_hw[idx].id, 0U);
+        bare_dma_config(rx_stream, &rx);
+        bare_dma_set_callback(rx_stream, i2c_dma_event, &i2c_state[idx].bus);
+    }
+
+    /* 4. State machine and interrupts */
+    bare_i2c_bus_init(&i2c_state[idx].bus, I2Cx, rx_stream);
+    bare_periph_enable_irq(i2c_hw[idx].id, 0U); // Event
+    bare_periph_enable_irq(i2c_hw[idx].id, 1U); // Error
+
+    return actual;
+}
+
+/**
+ * @brief  Queue a transaction
+ * @param  I2Cx Pointer to I2C peripheral
+ * @param  t    Transaction
+ */
+void bare_i2c_submit(I2C_TypeDef *I2Cx, I2C_Transaction_t *t)
+{
+    bare_i2c_bus_submit(&i2c_state[i2c_index(I2Cx)].bus, t);
+}
+
+/**
+ * @brief  Check whether a transaction is on the bus or queued
+ * @param  I2Cx Pointer to I2C peripheral
+ * @retval 1 if busy, 0 if idle
+ */
+uint8_t bare_i2c_busy(I2C_TypeDef *I2Cx)
+{
+    return i2c_state[i2c_index(I2Cx)].bus.state != I2C_STATE_IDLE;
+}
+
+/**
+ * @brief  Free a stuck bus and re-enable the peripheral
+ * @param  I2Cx Pointer to I2C peripheral
+ * @retval 1 if SDA is released, 0 if still stuck
+ */
+uint8_t bare_i2c_recover(I2C_TypeDef *I2Cx)
+{
+    uint32_t idx = i2c_index(I2Cx);
+    I2C_Pin_t scl = i2c_state[idx].scl;
+    I2C_Pin_t sda = i2c_state[idx].sda;
+    uint8_t released;
+    uint32_t i;
+
+    I2Cx->CR1 &= ~I2C_CR1_PE;
+
+    /* 1. Take the pins as open-drain GPIO, both released */
+    bare_gpio_write(scl.port, scl.pin, GPIO_PIN_SET);
+    bare_gpio_write(sda.port, sda.pin, GPIO_PIN_SET);
+    bare_gpio_init(scl.port, scl.pin, GPIO_MODE_OUTPUT, GPIO_OTYPE_OD, GPIO_SPEED_FAST,
+                   GPIO_PULLUP);
+    bare_gpio_init(sda.port, sda.pin, GPIO_MODE_OUTPUT, GPIO_OTYPE_OD, GPIO_SPEED_FAST,
+                   GPIO_PULLUP);
+    i2c_delay_half();
+
+    /* 2. Up to nine clocks let a slave finish the byte it is sending */
+    for (i = 0U; (i < 9U) && (bare_gpio_read(sda.port, sda.pin) == GPIO_PIN_RESET); i++)
+    {
+        bare_gpio_write(scl.port, scl.pin, GPIO_PIN_RESET);
+        i2c_delay_half();
+        bare_gpio_write(scl.port, scl.pin, GPIO_PIN_SET);
+        i2c_delay_half();
+    }
+
+    /* 3. STOP: SDA rises while SCL is high */
+    bare_gpio_write(scl.port, scl.pin, GPIO_PIN_RESET);
+    i2c_delay_half();
+    bare_gpio_write(sda.port, sda.pin, GPIO_PIN_RESET);
+    i2c_delay_half();
+    bare_gpio_write(scl.port, scl.pin, GPIO_PIN_SET);
+    i2c_delay_half();
+    bare_gpio_write(sda.port, sda.pin, GPIO_PIN_SET);
+    i2c_delay_half();
+    released = (bare_gpio_read(sda.port, sda.pin) == GPIO_PIN_SET);
+
+    /* 4. Hand the pins back, still open-drain with pull-up, and reset the peripheral
+     *    (clears a latched BUSY). AFR is set first so the pins never switch to AF0. */
+    bare_gpio_set_AF(scl.port, scl.pin, i2c_state[idx].af);
+    bare_gpio_set_AF(sda.port, sda.pin, i2c_state[idx].af);
+    bare_gpio_init(scl.port, scl.pin, GPIO_MODE_AF, GPIO_OTYPE_OD, GPIO_SPEED_FAST,
+                   GPIO_PULLUP);
+    bare_gpio_init(sda.port, sda.pin, GPIO_MODE_AF, GPIO_OTYPE_OD, GPIO_SPEED_FAST,
+                   GPIO_PULLUP);
+
+    I2Cx->CR1 = I2C_CR1_SWRST;
+    I2Cx->CR1 = 0U;
+    I2Cx->CR2 = i2c_state[idx].cr2;
+    I2Cx->CCR = i2c_state[idx].ccr;
+    I2Cx->TRISE = i2c_state[idx].trise;
+    I2Cx->CR1 = I2C_CR1_PE;
+
+    /* 5. Anything in flight is lost */
+    if (i2c_state[idx].bus.cur != NULL)
+    {
+        i2c_finish(&i2c_state[idx].bus, I2C_ERR_BUS);
+    }
+
+    return released;
+}
+
+/*******************************************************************************************
+ *                              Interrupt Service Routines
+ *******************************************************************************************/
+void I2C1_EV_IRQHandler(void) { bare_i2c_bus_ev(&i2c_state[0].bus); }
+void I2C1_ER_IRQHandler(void) { bare_i2c_bus_er(&i2c_state[0].bus); }
+void I2C2_EV_IRQHandler(void) { bare_i2c_bus_ev(&i2c_state[1].bus); }
+void I2C2_ER_IRQHandler(void) { bare_i2c_bus_er(&i2c_state[1].bus); }
+void I2C3_EV_IRQHandler(void) { bare_i2c_bus_ev(&i2c_state[2].bus); }
+void I2C3_ER_IRQHandler(void) { bare_i2c_bus_er(&i2c_state[2].bus); }
@@ -0,0 +1,276 @@
+/*******************************************************************************************
+ * @file    bare_idle.c
+ * @author  ka5j
+ * @brief   Tickless idle manager implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The sleep is entered with PRIMASK set: a pending interrupt still ends WFI, but
+ *          its handler only runs once the tick count has been corrected and the periodic
+ *          tick reprogrammed. Reading SysTick CSR clears COUNTFLAG, so it is read once.
+ *          The SysTick vector belongs to the application, which calls bare_idle_tick().
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "systick_registers.h"
+#include "scb_registers.h"
+#include "pwr_registers.h"
+#include "bare_periph.h"
+#include "bare_systick.h"
+#include "bare_idle.h"
+#include "bare_rcc.h"
+#include "bare_dwt.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+static IDLE_Config_t idle_cfg;
+static IDLE_Stats_t idle_stats;
+static volatile uint32_t idle_ticks;
+static uint32_t idle_period; /*!< HCLK cycles per tick */
+static uint32_t idle_stop_exit; /*!< DWT cycles when the core left stop mode */
+static volatile uint8_t idle_stop_woke; /*!< Stop exit waiting for bare_idle_wake_mark() */
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Wait for interrupt, with the barriers the architecture asks for
+ */
+static inline void idle_wfi(void)
+{
+#if defined(__arm__)
+    __asm volatile("dsb\n wfi\n isb" ::: "memory");
+#endif
+}
+
+/**
+ * @brief  Restart the periodic tick: first tick after `first` cycles, then every period
+ */
+static void idle_resume_tick(uint32_t first)
+{
+    SysTick_Set_TIMER((SysTick_RVR_t)(first - 1U));
+    SYSTICK->CSR |= SYSTICK_CSR_ENABLE;
+    SYSTICK->RVR = idle_period - 1U; // Taken at the next reload
+}
+
+/**
+ * @brief  Clock change hook: new tick length, restart the current tick
+ */
+static void idle_clock_hook(RCC_ClockPhase_t phase)
+{
+    if (phase == RCC_CLOCK_POST)
+    {
+        idle_period = bare_rcc_get_hclk() / idle_cfg.tick_hz;
+        SysTick_Set_TIMER((SysTick_RVR_t)(idle_period - 1U));
+    }
+}
+
+/**
+ * @brief  Stop mode with the low-power regulator until an EXTI wake-up
+ */
+static void idle_stop(void)
+{
+    SYSTICK->CSR &= ~SYSTICK_CSR_ENABLE;
+
+    PWR->CR &= ~PWR_CR_PDDS;
+    PWR->CR |= PWR_CR_LPDS | PWR_CR_FPDS;
+    SCB->SCR |= SCB_SCR_SLEEPDEEP;
+    idle_wfi();
+    idle_stop_exit = bare_dwt_cycles(); // CYCCNT is stopped with the clocks: first count
+    idle_stop_woke = 1U;                // Measured up to bare_idle_wake_mark()
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP;
+    idle_stats.stops++;
+
+    if (idle_cfg.wake_hook != NULL)
+    {
+        idle_cfg.wake_hook();
+    }
+
+    /* HCLK may differ from before the stop (HSI, or whatever the hook restored) */
+    idle_period = bare_rcc_get_hclk() / idle_cfg.tick_hz;
+    idle_resume_tick(idle_period);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Start the periodic tick and clear the statistics
+ * @param  cfg Configuration
+ */
+void bare_idle_init(const IDLE_Config_t *cfg)
+{
+    idle_cfg = *cfg;
+    idle_ticks = 0U;
+    idle_stop_woke = 0U;
+    bare_idle_reset_stats();
+
+    bare_periph_enable_clock(PERIPH_PWR);
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA))
+    {
+        bare_dwt_init();
+    }
+
+    idle_period = bare_rcc_get_hclk() / idle_cfg.tick_hz;
+    SYSTICK->CSR = 0U;
+    SysTick_Init((SysTick_RVR_t)(idle_period - 1U), SYSTICK_PROCESSOR_CLK,
+                 SYSTICK_ENABLE_INTERRUPT, SYSTICK_CLK_IMPL, SYSTICK_CALIB);
+    bare_rcc_register_hook(idle_clock_hook); // After SysTick's own hook, exact period wins
+}
+
+/**
+ * @brief  Current tick count
+ * @retval Ticks since bare_idle_init()
+ */
+uint32_t bare_idle_now(void)
+{
+    return idle_ticks;
+}
+
+/**
+ * @brief  Idle until a tick is reached or an interrupt needs attention
+ * @param  deadline Absolute tick or IDLE_FOREVER
+ */
+void bare_idle_until(uint32_t deadline)
+{
+    uint32_t primask = bare_irq_save();
+    uint32_t max = SYSTICK_RVR_MAX / idle_period;
+    uint32_t n;
+    uint32_t cvr;
+    uint32_t reload;
+    uint32_t csr;
+    uint32_t first;
+    uint32_t complete;
+
+    if (deadline == IDLE_FOREVER)
+    {
+        if (idle_cfg.allow_stop)
+        {
+            idle_stop();
+            bare_irq_restore(primask);
+            return;
+        }
+        n = max;
+    }
+    else
+    {
+        n = deadline - idle_ticks;
+        if ((int32_t)n <= 0)
+        {
+            bare_irq_restore(primask); // Already due
+            return;
+        }
+        n = (n > max) ? max : n;
+    }
+
+    if (n < 2U)
+    {
+        idle_wfi(); // The next tick is the deadline, plain sleep
+        bare_irq_restore(primask);
+        return;
+    }
+
+    /* Freeze the tick; give up if it expired meanwhile (its handler is pending) */
+    SYSTICK->CSR &= ~SYSTICK_CSR_ENABLE;
+    cvr = SYSTICK->CVR;
+    if ((cvr == 0U) || (SCB->ICSR & SCB_ICSR_PENDSTSET))
+    {
+        SYSTICK->CSR |= SYSTICK_CSR_ENABLE;
+        bare_irq_restore(primask);
+        return;
+    }
+
+    /* Rest of the current tick plus n - 1 whole ticks */
+    reload = cvr + ((n - 1U) * idle_period);
+    SysTick_Set_TIMER((SysTick_RVR_t)reload);
+    SYSTICK->CSR |= SYSTICK_CSR_ENABLE;
+
+    idle_wfi();
+
+    csr = SYSTICK->CSR;
+    SYSTICK->CSR = csr & ~SYSTICK_CSR_ENABLE;
+    idle_stats.sleeps++;
+
+    if (csr & SYSTICK_CSR_COUNTFLAG)
+    {
+        /* Deadline reached; the pending SysTick interrupt accounts for its tick */
+        uint32_t over = reload - SYSTICK->CVR;
+
+        complete = n - 1U;
+        idle_stats.latency_last = over;
+        if (over > idle_stats.latency_max)
+        {
+            idle_stats.latency_max = over;
+        }
+        first = (over < idle_period) ? (idle_period - over) : idle_period;
+    }
+    else
+    {
+        /* Woken early: count the whole ticks slept, finish the one in progress */
+        uint32_t done = (n * idle_period) - SYSTICK->CVR;
+
+        complete = done / idle_period;
+        first = ((complete + 1U) * idle_period) - done;
+        idle_stats.early_wakes++;
+    }
+
+    idle_ticks += complete;
+    idle_stats.idle_ticks += complete;
+    idle_resume_tick(first);
+
+    bare_irq_restore(primask);
+}
+
+/**
+ * @brief  Count one tick (call from the application's SysTick_Handler)
+ */
+void bare_idle_tick(void)
+{
+    idle_ticks++;
+}
+
+/**
+ * @brief  Timestamp the wake-up from stop mode (call first in the wake-up handler)
+ */
+void bare_idle_wake_mark(void)
+{
+    uint32_t cycles;
+
+    if (!idle_stop_woke)
+    {
+        return;
+    }
+    cycles = bare_dwt_cycles() - idle_stop_exit;
+    idle_stop_woke = 0U;
+    if (cycles > idle_stats.stop_wake_max)
+    {
+        idle_stats.stop_wake_max = cycles;
+    }
+}
+
+/**
+ * @brief  Copy the idle statistics
+ * @param  out Destination
+ */
+void bare_idle_get_stats(IDLE_Stats_t *out)
+{
+    uint32_t primask = bare_irq_save();
+
+    *out = idle_stats;
+    bare_irq_restore(primask);
+}
+
+/**
+ * @brief  Clear the idle statistics
+ */
+void bare_idle_reset_stats(void)
+{
+    IDLE_Stats_t zero = {0};
+
+    idle_stats = zero;
+}
@@ -0,0 +1,273 @@
+/*******************************************************************************************
+ * @file    bare_input.c
+ * @author  ka5j
+ * @brief   Bit-parallel input debouncing and matrix keypad scanning for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    One tick costs one IDR read and one debounce step per port, plus one IDR read
+ *          and one BSRR store for the matrix, regardless of how many pins are watched.
+ *          Edges are the only per-pin work. The event queue is single-producer (the tick
+ *          interrupt) / single-consumer (bare_input_get()).
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "gpio_registers.h"
+#include "bare_input.h"
+#include "bare_gpio.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+
+/** Engine state */
+static struct
+{
+    const INPUT_Config_t *cfg;
+    INPUT_Debounce_t port[INPUT_MAX_PORTS];  /*!< One per sampled port */
+    INPUT_Debounce_t row[INPUT_MAX_ROWS];    /*!< Column debounce of each matrix row */
+    uint16_t row_bit[INPUT_MAX_ROWS];        /*!< BSRR bit of each row */
+    uint8_t rows;                            /*!< Rows in the matrix */
+    uint8_t cur_row;                         /*!< Row driven low since the last tick */
+    uint32_t ticks;
+    INPUT_Event_t queue[INPUT_QUEUE_SIZE];
+    volatile uint32_t head;                  /*!< Written by the tick interrupt */
+    volatile uint32_t tail;                  /*!< Written by the reader */
+    volatile uint32_t dropped;
+} input;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Queue one event per toggled pin
+ * @param  source: Port index or INPUT_SRC_MATRIX | row
+ * @param  toggle: Pins whose debounced state changed
+ * @param  state: New debounced state
+ */
+static void input_post(uint8_t source, uint16_t toggle, uint16_t state)
+{
+    while (toggle != 0U)
+    {
+        uint32_t pin = (uint32_t)__builtin_ctz(toggle);
+        uint32_t head = input.head;
+
+        toggle &= (uint16_t)(toggle - 1U);
+        if ((head - input.tail) >= INPUT_QUEUE_SIZE)
+        {
+            input.dropped++;
+            continue;
+        }
+
+        INPUT_Event_t *ev = &input.queue[head & (INPUT_QUEUE_SIZE - 1U)];
+        ev->tick = input.ticks;
+        ev->source = source;
+        ev->pin = (uint8_t)pin;
+        ev->active = (uint8_t)((state >> pin) & 1U);
+
+        BARE_BARRIER(); // Event complete before it is published
+        input.head = head + 1U;
+    }
+}
+
+/**
+ * @brief  Drive one matrix row low and release the others in a single BSRR store
+ * @param  m: Matrix
+ * @param  row: Row to select
+ */
+static inline void input_select_row(const INPUT_Matrix_t *m, uint32_t row)
+{
+    uint32_t bit = input.row_bit[row];
+
+    m->row_port->BSRR = (bit << 16) | (m->row_mask & ~bit);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Start the engine: reset the debounce state and set up the matrix pins
+ * @param  cfg: Configuration (referenced, must stay valid)
+ * @retval INPUT_OK or INPUT_ERR_PARAM
+ *
+ * @note   Call with the tick interrupt stopped. Directly sampled pins keep the mode and
+ *         pull set by the application; only their port clock is enabled here.
+ */
+INPUT_Status_t bare_input_init(const INPUT_Config_t *cfg)
+{
+    const INPUT_Matrix_t *m = cfg->matrix;
+    uint32_t i;
+
+    if ((cfg->nports > INPUT_MAX_PORTS) || ((cfg->nports != 0U) && (cfg->ports == NULL)))
+    {
+        return INPUT_ERR_PARAM;
+    }
+    for (i = 0U; i < cfg->nports; i++)
+    {
+        if (cfg->ports[i].port == NULL)
+        {
+            return INPUT_ERR_PARAM;
+        }
+    }
+
+    input.cfg = NULL;
+    input.rows = 0U;
+    input.cur_row = 0U;
+    input.ticks = 0U;
+    input.head = input.tail = 0U;
+    input.dropped = 0U;
+    for (i = 0U; i < INPUT_MAX_PORTS; i++)
+    {
+        input.port[i] = (INPUT_Debounce_t){0U, 0U, 0U};
+    }
+    for (i = 0U; i < INPUT_MAX_ROWS; i++)
+    {
+        input.row[i] = (INPUT_Debounce_t){0U, 0U, 0U};
+    }
+
+    for (i = 0U; i < cfg->nports; i++)
+    {
+        bare_gpio_enable_clock(cfg->ports[i].port);
+    }
+
+    if (m != NULL)
+    {
+        uint32_t pin;
+
+        if ((m->row_port == NULL) || (m->col_port == NULL) || (m->row_mask == 0U))
+        {
+            return INPUT_ERR_PARAM;
+        }
+        for (pin = 0U; pin < 16U; pin++)
+        {
+            if (m->row_mask & (1UL << pin))
+            {
+                if (input.rows == INPUT_MAX_ROWS)
+                {
+                    return INPUT_ERR_PARAM;
+                }
+                input.row_bit[input.rows++] = (uint16_t)(1UL << pin);
+            }
+        }
+
+        bare_gpio_enable_clock(m->row_port);
+        m->row_port->BSRR = m->row_mask; // Released before the pins become outputs
+        for (pin = 0U; pin < 16U; pin++)
+        {
+            if (m->row_mask & (1UL << pin))
+            {
+                bare_gpio_init(m->row_port, (GPIO_Pins_t)pin, GPIO_MODE_OUTPUT, GPIO_OTYPE_OD,
+                               GPIO_SPEED_LOW, GPIO_NOPULL);
+            }
+            if (m->col_mask & (1UL << pin))
+            {
+                bare_gpio_init(m->col_port, (GPIO_Pins_t)pin, GPIO_MODE_INPUT, GPIO_OTYPE_PP,
+                               GPIO_SPEED_LOW, GPIO_PULLUP);
+            }
+        }
+        input_select_row(m, 0U);
+    }
+
+    input.cfg = cfg;
+    return INPUT_OK;
+}
+
+/**
+ * @brief  Sample all ports and one matrix row (call from a periodic interrupt)
+ * @retval None
+ */
+void bare_input_tick(void)
+{
+    const INPUT_Config_t *cfg = input.cfg;
+    const INPUT_Matrix_t *m;
+    uint16_t toggle;
+    uint32_t i;
+
+    if (cfg == NULL)
+    {
+        return;
+    }
+    input.ticks++;
+
+    for (i = 0U; i < cfg->nports; i++)
+    {
+        const INPUT_Port_t *p = &cfg->ports[i];
+        uint16_t sample = (uint16_t)((p->port->IDR ^ p->active_low) & p->mask);
+
+        toggle = bare_input_debounce(&input.port[i], sample);
+        if (toggle != 0U)
+        {
+            input_post((uint8_t)i, toggle, input.port[i].state);
+        }
+    }
+
+    m = cfg->matrix;
+    if (m != NULL)
+    {
+        uint32_t row = input.cur_row;
+        uint16_t cols = (uint16_t)(~m->col_port->IDR & m->col_mask); // Low = pressed
+
+        toggle = bare_input_debounce(&input.row[row], cols);
+        row = (row + 1U < input.rows) ? row + 1U : 0U;
+        input_select_row(m, row); // Settles until the next tick
+        if (toggle != 0U)
+        {
+            input_post((uint8_t)(INPUT_SRC_MATRIX | input.cur_row), toggle,
+                       input.row[input.cur_row].state);
+        }
+        input.cur_row = (uint8_t)row;
+    }
+}
+
+/**
+ * @brief  Take the oldest edge event
+ * @param  ev: Receives the event
+ * @retval 1 if an event was returned, 0 if the queue is empty
+ */
+uint8_t bare_input_get(INPUT_Event_t *ev)
+{
+    uint32_t tail = input.tail;
+
+    if (tail == input.head)
+    {
+        return 0U;
+    }
+
+    BARE_BARRIER(); // Read the event only after seeing the head move
+    *ev = input.queue[tail & (INPUT_QUEUE_SIZE - 1U)];
+    BARE_BARRIER();
+    input.tail = tail + 1U;
+    return 1U;
+}
+
+/**
+ * @brief  Debounced level of a port (1 = active)
+ * @param  source: Port index, or INPUT_SRC_MATRIX | row
+ * @retval Debounced pins, 0 for an unknown source
+ */
+uint16_t bare_input_state(uint8_t source)
+{
+    if (source & INPUT_SRC_MATRIX)
+    {
+        source &= (uint8_t)~INPUT_SRC_MATRIX;
+        return (source < input.rows) ? input.row[source].state : 0U;
+    }
+    if ((input.cfg == NULL) || (source >= input.cfg->nports))
+    {
+        return 0U;
+    }
+    return input.port[source].state;
+}
+
+/**
+ * @brief  Events dropped because the queue was full
+ * @retval Dropped event count
+ */
+uint32_t bare_input_dropped(void)
+{
+    return input.dropped;
+}
@@ -0,0 +1,365 @@
+/*******************************************************************************************
+ * @file    bare_logic.c
+ * @author  ka5j
+ * @brief   GPIO logic analyzer: timer-paced DMA capture of a whole port (STM32F446RE)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Sample positions are absolute (counted since start) so the trigger and the
+ *          stop point survive buffer wrap-around. The capture is stopped on the first
+ *          half-buffer boundary that leaves at least pre_trigger samples before the
+ *          trigger. The DMA keeps writing for a few samples until the timer is halted;
+ *          NDTR then tells exactly where it stopped, and the window is moved forward
+ *          by that amount, so no sample in the window is stale.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "tim2_5_registers.h"
+#include "bare_logic.h"
+#include "bare_dma.h"
+#include "bare_gpio.h"
+#include "bare_rcc.h"
+#include "bare_usart.h"
+#include "bare_periph.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define LOGIC_TIM TIM8
+#define LOGIC_STREAM bare_periph_dma_stream(PERIPH_TIM8, 1U)
+
+/** Capture state */
+static struct
+{
+    const LOGIC_Config_t *cfg;
+    volatile LOGIC_State_t state;
+    uint32_t done;    /*!< Samples in completed half buffers */
+    uint32_t trig;    /*!< Absolute index of the trigger sample */
+    uint32_t stop_at; /*!< Half-buffer boundary to stop on */
+    uint32_t end;     /*!< Absolute index one past the last sample of the window */
+    uint32_t rate;    /*!< Programmed sample rate */
+    uint16_t prev;    /*!< Last sample of the previous half buffer */
+} logic;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Index of the first sample of a chunk that meets the trigger condition
+ * @param  s: Chunk
+ * @param  n: Samples in the chunk
+ * @retval Index, or n if none
+ */
+static uint32_t logic_find_trigger(const uint16_t *s, uint32_t n)
+{
+    const LOGIC_Config_t *cfg = logic.cfg;
+    uint32_t m = cfg->trig_mask;
+    uint32_t v = cfg->trig_value & m;
+    uint32_t prev = logic.prev;
+    uint32_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        uint32_t cur = s[i];
+        uint32_t hit;
+
+        switch (cfg->trigger)
+        {
+        case LOGIC_TRIG_PATTERN:
+            hit = ((cur & m) == v);
+            break;
+        case LOGIC_TRIG_RISING:
+            hit = (~prev & cur & m);
+            break;
+        case LOGIC_TRIG_FALLING:
+            hit = (prev & ~cur & m);
+            break;
+        default:
+            hit = ((prev ^ cur) & m);
+            break;
+        }
+        if (hit)
+        {
+            return i;
+        }
+        prev = cur;
+    }
+    return n;
+}
+
+/**
+ * @brief  Halt sampling and record where the window ends
+ */
+static void logic_halt(void)
+{
+    uint32_t len = logic.cfg->len;
+    uint32_t written;
+
+    LOGIC_TIM->CR1 &= ~TIM_CR1_CEN; // No more requests
+    LOGIC_TIM->DIER &= ~TIM_DIER_UDE;
+    written = len - bare_dma_remaining(LOGIC_STREAM); // Position in the current lap
+    bare_dma_stop(LOGIC_STREAM);
+    bare_dma_set_callback(LOGIC_STREAM, NULL, NULL);
+
+    /* Samples past the last completed half buffer */
+    logic.end = logic.done + ((written + len - (logic.done % len)) % len);
+}
+
+/**
+ * @brief  DMA event: scan the half buffer just written, stop once enough is captured
+ */
+static void logic_dma_event(uint32_t events, void *ctx)
+{
+    const LOGIC_Config_t *cfg = logic.cfg;
+    uint32_t half = cfg->len / 2U;
+    uint32_t first;
+
+    (void)ctx;
+
+    if ((events & DMA_EVENT_ERROR) ||
+        ((events & (DMA_EVENT_HALF | DMA_EVENT_COMPLETE)) ==
+         (DMA_EVENT_HALF | DMA_EVENT_COMPLETE)))
+    {
+        logic_halt(); // Both halves pending: a chunk was overwritten before the scan
+        logic.state = LOGIC_OVERRUN;
+        return;
+    }
+
+    first = (events & DMA_EVENT_HALF) ? 0U : half;
+    if (logic.state == LOGIC_ARMED)
+    {
+        const uint16_t *chunk = &cfg->buf[first];
+        uint32_t skip = 0U;
+        uint32_t i;
+
+        if (logic.done < cfg->pre_trigger) // Not enough history yet
+        {
+            skip = cfg->pre_trigger - logic.done;
+            skip = (skip < half) ? skip : half;
+            logic.prev = chunk[(skip != 0U) ? skip - 1U : 0U];
+        }
+
+        i = skip + logic_find_trigger(&chunk[skip], half - skip);
+        if (i < half)
+        {
+            logic.trig = logic.done + i;
+            logic.stop_at = ((logic.trig + cfg->len - cfg->pre_trigger) / half) * half;
+            logic.state = LOGIC_TRIGGERED;
+        }
+        logic.prev = chunk[half - 1U];
+    }
+
+    logic.done += half;
+    if ((logic.state == LOGIC_TRIGGERED) && (logic.done >= logic.stop_at))
+    {
+        logic_halt();
+        logic.state = LOGIC_DONE;
+    }
+}
+
+/**
+ * @brief  Print a 16-bit value as 4 hex digits
+ */
+static void logic_print_hex16(uint32_t v)
+{
+    static const char digits[] = "0123456789abcdef";
+    char buf[5];
+    int i;
+
+    for (i = 3; i >= 0; i--)
+    {
+        buf[i] = digits[v & 0xFU];
+        v >>= 4;
+    }
+    buf[4] = '\0';
+    bare_usart_send_string(buf);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Arm a capture
+ * @param  cfg: Configuration (referenced until the capture is dumped or stopped)
+ * @retval LOGIC_OK, LOGIC_ERR_PARAM or LOGIC_ERR_BUSY
+ */
+LOGIC_Status_t bare_logic_start(const LOGIC_Config_t *cfg)
+{
+    DMA_Stream_TypeDef *stream = LOGIC_STREAM;
+    DMA_Config_t dma = {
+        .channel = bare_periph_dma_channel(PERIPH_TIM8, 1U),
+        .dir = DMA_DIR_PERIPH_TO_MEM,
+        .psize = DMA_SIZE_HALFWORD,
+        .msize = DMA_SIZE_HALFWORD,
+        .pinc = 0U,
+        .minc = 1U,
+        .circular = 1U,
+        .priority = DMA_PRIORITY_VERY_HIGH,
+        .fifo = DMA_FIFO_DIRECT,
+        .half_irq = 1U,
+        .complete_irq = 1U,
+    };
+    uint32_t clk = bare_rcc_get_timclk2();
+    uint32_t div;
+    uint32_t psc;
+
+    if ((logic.state == LOGIC_ARMED) || (logic.state == LOGIC_TRIGGERED))
+    {
+        return LOGIC_ERR_BUSY;
+    }
+    if ((cfg->buf == NULL) || (cfg->len < 4U) || (cfg->len & 1U) || (cfg->rate_hz == 0U) ||
+        (cfg->rate_hz > clk / 2U) || (cfg->pre_trigger > cfg->len / 2U))
+    {
+        return LOGIC_ERR_PARAM;
+    }
+
+    /* Update rate = clk / ((PSC + 1) * (ARR + 1)), ARR kept as large as possible */
+    div = (clk + cfg->rate_hz / 2U) / cfg->rate_hz;
+    psc = (div - 1U) >> 16;
+    logic.rate = clk / ((psc + 1U) * (div / (psc + 1U)));
+
+    logic.cfg = cfg;
+    logic.done = 0U;
+    logic.trig = 0U;
+    logic.end = 0U;
+
+    bare_gpio_enable_clock(cfg->port);
+    bare_periph_enable_clock(PERIPH_TIM8);
+    bare_dma_enable_clock(stream);
+
+    LOGIC_TIM->CR1 = TIM_CR1_URS; // Only counter overflow requests DMA
+    LOGIC_TIM->DIER = 0U;
+    LOGIC_TIM->PSC = psc;
+    LOGIC_TIM->ARR = div / (psc + 1U) - 1U;
+    LOGIC_TIM->CNT = 0U;
+    LOGIC_TIM->EGR = TIM_EGR_UG; // Load PSC; no DMA request yet (UDE = 0)
+    LOGIC_TIM->SR = 0U;
+
+    bare_dma_stop(stream);
+    bare_dma_config(stream, &dma);
+    bare_dma_set_callback(stream, logic_dma_event, NULL);
+    bare_dma_start(stream, (uint32_t)&cfg->port->IDR, (uint32_t)cfg->buf, 0U, cfg->len);
+
+    logic.prev = (uint16_t)cfg->port->IDR;
+    if (cfg->trigger == LOGIC_TRIG_NONE)
+    {
+        logic.stop_at = cfg->len;
+        logic.state = LOGIC_TRIGGERED;
+    }
+    else
+    {
+        logic.state = LOGIC_ARMED;
+    }
+
+    LOGIC_TIM->DIER = TIM_DIER_UDE;
+    LOGIC_TIM->CR1 |= TIM_CR1_CEN;
+    return LOGIC_OK;
+}
+
+/**
+ * @brief  Abort a capture (the buffer keeps whatever was sampled)
+ * @retval None
+ */
+void bare_logic_stop(void)
+{
+    if ((logic.state == LOGIC_ARMED) || (logic.state == LOGIC_TRIGGERED))
+    {
+        logic_halt();
+        logic.state = LOGIC_IDLE;
+    }
+}
+
+/**
+ * @brief  Current capture state
+ * @retval State
+ */
+LOGIC_State_t bare_logic_state(void)
+{
+    return logic.state;
+}
+
+/**
+ * @brief  Sample rate actually programmed
+ * @retval Rate in Hz
+ */
+uint32_t bare_logic_rate(void)
+{
+    return logic.rate;
+}
+
+/**
+ * @brief  Position of the trigger sample in the finished capture
+ * @retval Sample index from the start of the capture window
+ */
+uint32_t bare_logic_trigger_index(void)
+{
+    uint32_t start;
+
+    if ((logic.state != LOGIC_DONE) || (logic.cfg == NULL))
+    {
+        return 0U;
+    }
+    start = (logic.end > logic.cfg->len) ? logic.end - logic.cfg->len : 0U;
+    return (logic.trig > start) ? logic.trig - start : 0U; // Overwritten while stopping
+}
+
+/**
+ * @brief  Stream a finished capture over USART2, run-length encoded
+ * @retval None
+ */
+void bare_logic_dump(void)
+{
+    const LOGIC_Config_t *cfg = logic.cfg;
+    uint32_t len;
+    uint32_t start;
+    uint32_t n;
+    uint32_t i;
+    uint32_t run = 0U;
+    uint32_t value = 0U;
+
+    if ((logic.state != LOGIC_DONE) || (cfg == NULL))
+    {
+        return;
+    }
+    len = cfg->len;
+    n = (logic.end < len) ? logic.end : len;
+    start = logic.end - n;
+
+    bare_usart_send_string("LOGIC ");
+    bare_print_u32(logic.rate);
+    bare_usart_send_char(' ');
+    logic_print_hex16(cfg->channels);
+    bare_usart_send_char(' ');
+    bare_print_u32(n);
+    bare_usart_send_char(' ');
+    bare_print_u32(bare_logic_trigger_index());
+    bare_usart_send_string("\r\n");
+
+    for (i = 0U; i < n; i++)
+    {
+        uint32_t s = cfg->buf[(start + i) % len] & cfg->channels;
+
+        if ((run != 0U) && (s != value))
+        {
+            logic_print_hex16(value);
+            bare_usart_send_char(' ');
+            bare_print_u32(run);
+            bare_usart_send_string("\r\n");
+            run = 0U;
+        }
+        value = s;
+        run++;
+    }
+    if (run != 0U)
+    {
+        logic_print_hex16(value);
+        bare_usart_send_char(' ');
+        bare_print_u32(run);
+        bare_usart_send_string("\r\n");
+    }
+    bare_usart_send_string("END\r\n");
+}
@@ -0,0 +1,628 @@
+/*******************************************************************************************
+ * @file    bare_logstore.c
+ * @author  ka5j
+ * @brief   Append-only, wear-leveled record store in internal flash
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Sectors are used in ring order: the open sector is followed by an erased spare,
+ *          which is followed by the oldest sector. A rotation opens the spare, copies the
+ *          live config records out of the oldest sector and queues it for erase, so after
+ *          the erase it is the next spare. A reset during the copy leaves the oldest
+ *          sector intact; the next mount sees it in the spare position and repeats the copy.
+ *******************************************************************************************/
+
+#include "bare_logstore.h"
+#include "bare_crc_sw.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define LOGSTORE_ERASED 0xFFFFFFFFUL
+#define LOGSTORE_RESYNC 0x52C0DEFFUL /*!< Resume marker after a torn record (tag 0xFF) */
+#define LOGSTORE_HDR_WORDS 2U /*!< Magic, sequence */
+#define LOGSTORE_REC_WORDS(len) (1U + (((uint32_t)(len) + 3U) >> 2))
+
+#define LOGSTORE_HDR_TAG(h) ((uint8_t)((h) & 0xFFU))
+#define LOGSTORE_HDR_LEN(h) ((uint8_t)(((h) >> 8) & 0xFFU))
+
+/** Record visitor used by the scanner: record in flash, header word first */
+typedef void (*logstore_rec_fn)(const uint32_t *rec, void *ctx);
+
+/** User visitor and context, passed through the scanner */
+typedef struct
+{
+    LOGSTORE_Visit_t visit;
+    void *ctx;
+} logstore_visitor_t;
+
+/** Store state */
+static struct
+{
+    LOGSTORE_Config_t cfg;
+    uint8_t active;                  /*!< Open sector, index within the ring */
+    uint32_t seq;                    /*!< Sequence number of the open sector */
+    uintptr_t end;                   /*!< End of the open sector */
+    uintptr_t pos;                   /*!< Flash address of buf[0] */
+    uint32_t buf[LOGSTORE_BUF_WORDS];
+    uint32_t used;                   /*!< Buffered words */
+    uintptr_t index[LOGSTORE_TAGS];  /*!< Latest record per config tag, 0 = none */
+    uint32_t dirty;                  /*!< Ring sectors waiting for an erase (bit mask) */
+    int8_t erasing;                  /*!< Ring sector being erased, -1 = none */
+    LOGSTORE_Stats_t stats;
+} ls;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  First byte of a ring sector
+ */
+static uintptr_t logstore_base(uint8_t s)
+{
+    return ls.cfg.flash->sector_addr((uint8_t)(ls.cfg.first_sector + s));
+}
+
+/**
+ * @brief  End (one past the last byte) of a ring sector
+ */
+static uintptr_t logstore_limit(uint8_t s)
+{
+    return logstore_base(s) + ls.cfg.flash->sector_size((uint8_t)(ls.cfg.first_sector + s));
+}
+
+/**
+ * @brief  Check that a flash range is erased
+ */
+static uint8_t logstore_blank(uintptr_t from, uintptr_t to)
+{
+    const uint32_t *w = (const uint32_t *)from;
+
+    for (; (uintptr_t)w < to; w++)
+    {
+        if (*w != LOGSTORE_ERASED)
+        {
+            return 0U;
+        }
+    }
+    return 1U;
+}
+
+/**
+ * @brief  Sector holds the magic and a sequence number
+ */
+static uint8_t logstore_valid(uint8_t s)
+{
+    const uint32_t *hdr = (const uint32_t *)logstore_base(s);
+
+    return (uint8_t)((hdr[0] == LOGSTORE_MAGIC) && (hdr[1] != LOGSTORE_ERASED));
+}
+
+/**
+ * @brief  Record header word: tag, length and CRC-16/CCITT of tag, length and data
+ */
+static uint32_t logstore_header(uint8_t tag, const void *data, uint8_t len)
+{
+    uint8_t tl[2] = {tag, len};
+    uint16_t crc = bare_crc16_ccitt(BARE_CRC16_CCITT_INIT, tl, 2U);
+
+    crc = bare_crc16_ccitt(crc, data, len);
+    return (uint32_t)tag | ((uint32_t)len << 8) | ((uint32_t)crc << 16);
+}
+
+/**
+ * @brief  Record at a flash address, from the RAM buffer if not programmed yet
+ */
+static const uint32_t *logstore_rec(uintptr_t addr)
+{
+    if ((addr >= ls.pos) && (addr < (ls.pos + 4U * ls.used)))
+    {
+        return &ls.buf[(addr - ls.pos) >> 2];
+    }
+    return (const uint32_t *)addr;
+}
+
+/**
+ * @brief  Walk the valid records of a sector
+ * @note   A bad record is skipped if a resync marker follows it somewhere in the sector.
+ * @param  s: Ring sector
+ * @param  fn: Called per record (may be NULL)
+ * @param  ctx: Passed to fn
+ * @param  torn: Set to 1 if the walk stopped on a bad record instead of erased flash
+ * @retval Address after the last valid record
+ */
+static uintptr_t logstore_scan(uint8_t s, logstore_rec_fn fn, void *ctx, uint8_t *torn)
+{
+    uintptr_t addr = logstore_base(s) + 4U * LOGSTORE_HDR_WORDS;
+    uintptr_t limit = logstore_limit(s);
+
+    *torn = 0U;
+    while ((addr + 4U) <= limit)
+    {
+        const uint32_t *rec = (const uint32_t *)addr;
+        uint32_t h = rec[0];
+        uint32_t words = LOGSTORE_REC_WORDS(LOGSTORE_HDR_LEN(h));
+
+        if (h == LOGSTORE_ERASED)
+        {
+            break;
+        }
+        if ((LOGSTORE_HDR_TAG(h) == 0xFFU) || (LOGSTORE_HDR_LEN(h) > LOGSTORE_DATA_MAX) ||
+            ((addr + 4U * words) > limit) ||
+            (logstore_header(LOGSTORE_HDR_TAG(h), &rec[1], LOGSTORE_HDR_LEN(h)) != h))
+        {
+            uintptr_t p = addr;
+
+            while (((p + 4U) <= limit) && (*(const uint32_t *)p != LOGSTORE_RESYNC))
+            {
+                p += 4U;
+            }
+            if ((p + 4U) > limit)
+            {
+                *torn = 1U;
+                break;
+            }
+            addr = p + 4U; // Recovered at mount: records continue after the marker
+            continue;
+        }
+        if (fn != NULL)
+        {
+            fn(rec, ctx);
+        }
+        addr += 4U * words;
+    }
+    return addr;
+}
+
+/**
+ * @brief  Scanner callback: point the index at the newest record of each config tag
+ */
+static void logstore_index_rec(const uint32_t *rec, void *ctx)
+{
+    uint8_t tag = LOGSTORE_HDR_TAG(rec[0]);
+
+    (void)ctx;
+    if (tag < LOGSTORE_TAGS)
+    {
+        ls.index[tag] = (uintptr_t)rec;
+    }
+}
+
+/**
+ * @brief  Finish the running erase and start the next queued one
+ * @retval FLASH_BUSY while an erase runs, otherwise the status of the finished erase
+ */
+static FLASH_Status_t logstore_erase_step(void)
+{
+    FLASH_Status_t status = FLASH_OK;
+    uint8_t s;
+
+    if (ls.erasing >= 0)
+    {
+        status = ls.cfg.flash->erase_poll();
+        if (status == FLASH_BUSY)
+        {
+            return FLASH_BUSY;
+        }
+        if (status == FLASH_OK)
+        {
+            ls.dirty &= ~(1UL << ls.erasing);
+            ls.stats.erases++;
+        }
+        ls.erasing = -1;
+    }
+
+    for (s = 0U; s < ls.cfg.sectors; s++)
+    {
+        if ((ls.dirty & (1UL << s)) &&
+            (ls.cfg.flash->erase_start((uint8_t)(ls.cfg.first_sector + s)) == FLASH_OK))
+        {
+            ls.erasing = (int8_t)s;
+            break;
+        }
+    }
+    return status;
+}
+
+/**
+ * @brief  Wait until a ring sector is erased (blocking)
+ */
+static LOGSTORE_Status_t logstore_erase_wait(uint8_t s)
+{
+    while (ls.dirty & (1UL << s))
+    {
+        FLASH_Status_t status = logstore_erase_step();
+
+        if ((status != FLASH_OK) && (status != FLASH_BUSY))
+        {
+            return LOGSTORE_ERR_FLASH;
+        }
+    }
+    return LOGSTORE_OK;
+}
+
+/**
+ * @brief  Program the sector header and make the sector the open one
+ */
+static LOGSTORE_Status_t logstore_open(uint8_t s, uint32_t seq)
+{
+    uint32_t hdr[LOGSTORE_HDR_WORDS] = {LOGSTORE_MAGIC, seq};
+    uintptr_t base = logstore_base(s);
+
+    if (ls.cfg.flash->program(base, hdr, LOGSTORE_HDR_WORDS) != FLASH_OK)
+    {
+        return LOGSTORE_ERR_FLASH;
+    }
+    ls.active = s;
+    ls.seq = seq;
+    ls.pos = base + 4U * LOGSTORE_HDR_WORDS;
+    ls.end = logstore_limit(s);
+    ls.used = 0U;
+    ls.stats.rotations++;
+    return LOGSTORE_OK;
+}
+
+/**
+ * @brief  Make the open sector writable again after a torn record
+ * @note   The marker goes after the last programmed word, so the next mount skips the
+ *         torn words and finds the records written from now on.
+ */
+static void logstore_resync(uintptr_t bad)
+{
+    const uint32_t marker = LOGSTORE_RESYNC;
+    uintptr_t p = ls.end;
+
+    while ((p > bad) && (*(const uint32_t *)(p - 4U) == LOGSTORE_ERASED))
+    {
+        p -= 4U;
+    }
+    ls.stats.torn++;
+    ls.pos = ls.end;
+    if (((p + 8U) <= ls.end) && (ls.cfg.flash->program(p, &marker, 1U) == FLASH_OK))
+    {
+        ls.pos = p + 4U;
+    }
+}
+
+/**
+ * @brief  Buffer a complete record (header word first) in the open sector
+ * @retval LOGSTORE_ERR_FULL if it does not fit in the open sector
+ */
+static LOGSTORE_Status_t logstore_put(const uint32_t *rec)
+{
+    uint32_t words = LOGSTORE_REC_WORDS(LOGSTORE_HDR_LEN(rec[0]));
+    uint8_t tag = LOGSTORE_HDR_TAG(rec[0]);
+
+    if ((ls.pos + 4U * (ls.used + words)) > ls.end)
+    {
+        return LOGSTORE_ERR_FULL;
+    }
+    if ((ls.used + words) > LOGSTORE_BUF_WORDS)
+    {
+        if (bare_logstore_flush() != LOGSTORE_OK)
+        {
+            return LOGSTORE_ERR_FLASH;
+        }
+    }
+
+    memcpy(&ls.buf[ls.used], rec, 4U * words);
+    if (tag < LOGSTORE_TAGS)
+    {
+        ls.index[tag] = ls.pos + 4U * ls.used;
+    }
+    ls.used += words;
+    return LOGSTORE_OK;
+}
+
+/**
+ * @brief  Copy the live config records of a sector forward and queue it for erase
+ */
+static LOGSTORE_Status_t logstore_reclaim(uint8_t s)
+{
+    LOGSTORE_Status_t status = LOGSTORE_OK;
+    uintptr_t base = logstore_base(s);
+    uintptr_t limit = logstore_limit(s);
+    uint32_t tag;
+
+    for (tag = 0U; (tag < LOGSTORE_TAGS) && (status == LOGSTORE_OK); tag++)
+    {
+        if ((ls.index[tag] >= base) && (ls.index[tag] < limit))
+        {
+            status = logstore_put((const uint32_t *)ls.index[tag]);
+        }
+    }
+    if (status == LOGSTORE_OK)
+    {
+        status = bare_logstore_flush(); // Copies are safe before the erase starts
+    }
+
+    /* On a failed copy the sector may hold the only live config records: keep it, the
+     * next mount finds it in the spare position and repeats the copy */
+    if (status == LOGSTORE_OK)
+    {
+        ls.dirty |= 1UL << s;
+        (void)logstore_erase_step();
+    }
+    return status;
+}
+
+/**
+ * @brief  Close the open sector: open the spare and reclaim the oldest sector
+ */
+static LOGSTORE_Status_t logstore_rotate(void)
+{
+    uint8_t next = (uint8_t)((ls.active + 1U) % ls.cfg.sectors);
+    uint8_t oldest = (uint8_t)((next + 1U) % ls.cfg.sectors);
+    LOGSTORE_Status_t status = bare_logstore_flush();
+
+    if (status == LOGSTORE_OK)
+    {
+        status = logstore_erase_wait(next);
+    }
+    if (status == LOGSTORE_OK)
+    {
+        status = logstore_open(next, ls.seq + 1U);
+    }
+    if (status == LOGSTORE_OK)
+    {
+        status = logstore_reclaim(oldest);
+    }
+    return status;
+}
+
+/**
+ * @brief  Scanner callback for bare_logstore_foreach()
+ */
+static void logstore_visit_rec(const uint32_t *rec, void *ctx)
+{
+    const logstore_visitor_t *v = ctx;
+
+    v->visit(LOGSTORE_HDR_TAG(rec[0]), &rec[1], LOGSTORE_HDR_LEN(rec[0]), v->ctx);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Mount the store: scan the ring, rebuild the index and recover from a reset
+ * @param  cfg: Sector ring (copied)
+ * @retval LOGSTORE_OK or an error
+ */
+LOGSTORE_Status_t bare_logstore_init(const LOGSTORE_Config_t *cfg)
+{
+    uint8_t best = 0xFFU;
+    uint8_t spare;
+    uint8_t torn;
+    uint8_t k;
+
+    if ((cfg == NULL) || (cfg->flash == NULL) || (cfg->sectors < 2U) || (cfg->sectors > 32U))
+    {
+        return LOGSTORE_ERR_PARAM;
+    }
+    memset(&ls, 0, sizeof(ls));
+    ls.cfg = *cfg;
+    ls.erasing = -1;
+
+    // Open sector: the highest sequence number
+    for (k = 0U; k < ls.cfg.sectors; k++)
+    {
+        if (ls.cfg.flash->sector_size((uint8_t)(ls.cfg.first_sector + k)) == 0U)
+        {
+            return LOGSTORE_ERR_PARAM;
+        }
+        if (logstore_valid(k))
+        {
+            uint32_t seq = ((const uint32_t *)logstore_base(k))[1];
+
+            if ((best == 0xFFU) || (seq > ls.seq))
+            {
+                best = k;
+                ls.seq = seq;
+            }
+        }
+        else if (!logstore_blank(logstore_base(k), logstore_limit(k)))
+        {
+            ls.dirty |= 1UL << k; // Foreign data or an interrupted erase
+        }
+    }
+
+    if (best == 0xFFU)
+    {
+        // Empty ring: format
+        if (logstore_erase_wait(0U) != LOGSTORE_OK)
+        {
+            return LOGSTORE_ERR_FLASH;
+        }
+        (void)logstore_erase_step();
+        return logstore_open(0U, 1U);
+    }
+
+    // Index the records, oldest sector first so newer records win
+    spare = (uint8_t)((best + 1U) % ls.cfg.sectors);
+    for (k = 0U; k < ls.cfg.sectors; k++)
+    {
+        uint8_t s = (uint8_t)((spare + k) % ls.cfg.sectors);
+        uintptr_t after;
+
+        if (!logstore_valid(s))
+        {
+            continue;
+        }
+        after = logstore_scan(s, logstore_index_rec, NULL, &torn);
+        if (s == best)
+        {
+            ls.active = best;
+            ls.pos = after;
+            ls.end = logstore_limit(best);
+            if (torn)
+            {
+                logstore_resync(after);
+            }
+            else if (!logstore_blank(after, ls.end))
+            {
+                ls.pos = ls.end; // Foreign data after the records: rotate on next append
+            }
+        }
+    }
+
+    // A valid sector in the spare position: a rotation was interrupted, repeat the copy
+    if (logstore_valid(spare))
+    {
+        LOGSTORE_Status_t status = logstore_reclaim(spare);
+
+        if (status != LOGSTORE_OK)
+        {
+            return status;
+        }
+    }
+    (void)logstore_erase_step();
+    return LOGSTORE_OK;
+}
+
+/**
+ * @brief  Append a record to the RAM buffer
+ * @param  tag: Config tag (< LOGSTORE_TAGS) or log tag (< 0xFF)
+ * @param  data: Payload
+ * @param  len: Payload length (<= LOGSTORE_DATA_MAX)
+ * @retval LOGSTORE_OK or an error
+ */
+LOGSTORE_Status_t bare_logstore_append(uint8_t tag, const void *data, uint8_t len)
+{
+    uint32_t rec[LOGSTORE_REC_WORDS(LOGSTORE_DATA_MAX)];
+    LOGSTORE_Status_t status;
+
+    if ((ls.cfg.flash == NULL) || (tag == 0xFFU) || (len > LOGSTORE_DATA_MAX) ||
+        ((data == NULL) && (len != 0U)))
+    {
+        return LOGSTORE_ERR_PARAM;
+    }
+
+    rec[LOGSTORE_REC_WORDS(len) - 1U] = LOGSTORE_ERASED; // Pad the last word
+    if (len != 0U)
+    {
+        memcpy(&rec[1], data, len);
+    }
+    rec[0] = logstore_header(tag, &rec[1], len);
+
+    status = logstore_put(rec);
+    if (status == LOGSTORE_ERR_FULL)
+    {
+        status = logstore_rotate();
+        if (status == LOGSTORE_OK)
+        {
+            status = logstore_put(rec);
+        }
+    }
+    if (status == LOGSTORE_OK)
+    {
+        ls.stats.appended++;
+    }
+    return status;
+}
+
+/**
+ * @brief  Read the latest record of a config tag
+ * @param  tag: Config tag
+ * @param  buf: Destination
+ * @param  size: Destination size
+ * @param  len: Receives the stored length (may be NULL)
+ * @retval LOGSTORE_OK, LOGSTORE_ERR_NOT_FOUND or LOGSTORE_ERR_PARAM
+ */
+LOGSTORE_Status_t bare_logstore_read(uint8_t tag, void *buf, uint8_t size, uint8_t *len)
+{
+    const uint32_t *rec;
+    uint8_t n;
+
+    if (tag >= LOGSTORE_TAGS)
+    {
+        return LOGSTORE_ERR_PARAM;
+    }
+    if (ls.index[tag] == 0U)
+    {
+        return LOGSTORE_ERR_NOT_FOUND;
+    }
+
+    rec = logstore_rec(ls.index[tag]);
+    n = LOGSTORE_HDR_LEN(rec[0]);
+    memcpy(buf, &rec[1], (n < size) ? n : size);
+    if (len != NULL)
+    {
+        *len = n;
+    }
+    return LOGSTORE_OK;
+}
+
+/**
+ * @brief  Visit every stored record, oldest first
+ * @param  visit: Called once per record
+ * @param  ctx: User context
+ * @retval LOGSTORE_OK or the flush error
+ */
+LOGSTORE_Status_t bare_logstore_foreach(LOGSTORE_Visit_t visit, void *ctx)
+{
+    logstore_visitor_t v = {visit, ctx};
+    LOGSTORE_Status_t status = bare_logstore_flush();
+    uint8_t torn;
+    uint8_t k;
+
+    for (k = 1U; (k <= ls.cfg.sectors) && (status == LOGSTORE_OK); k++)
+    {
+        uint8_t s = (uint8_t)((ls.active + k) % ls.cfg.sectors);
+
+        if (!(ls.dirty & (1UL << s)) && logstore_valid(s))
+        {
+            (void)logstore_scan(s, logstore_visit_rec, &v, &torn);
+        }
+    }
+    return status;
+}
+
+/**
+ * @brief  Program the buffered records
+ * @retval LOGSTORE_OK or LOGSTORE_ERR_FLASH
+ */
+LOGSTORE_Status_t bare_logstore_flush(void)
+{
+    FLASH_Status_t status;
+
+    if (ls.used == 0U)
+    {
+        return LOGSTORE_OK;
+    }
+
+    status = ls.cfg.flash->program(ls.pos, ls.buf, ls.used);
+    ls.pos += 4U * ls.used;
+    ls.used = 0U;
+    ls.stats.flushes++;
+    if (status != FLASH_OK)
+    {
+        ls.pos = ls.end; // Partly programmed: leave the sector
+        return LOGSTORE_ERR_FLASH;
+    }
+    return LOGSTORE_OK;
+}
+
+/**
+ * @brief  Advance background erases
+ * @retval None
+ */
+void bare_logstore_poll(void)
+{
+    if (ls.cfg.flash != NULL)
+    {
+        (void)logstore_erase_step();
+    }
+}
+
+/**
+ * @brief  Log store counters
+ * @retval Counters
+ */
+const LOGSTORE_Stats_t *bare_logstore_stats(void)
+{
+    return &ls.stats;
+}
@@ -0,0 +1,239 @@
+/*******************************************************************************************
+ * @file    bare_packet.c
+ * @author  ka5j
+ * @brief   Framed packet transport over USART2 implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Buffers move between the USART2 interrupt and the main loop through two
+ *          single-producer/single-consumer index rings, so no interrupt masking is needed:
+ *          - ready ring: ISR -> main loop, completed encoded frames
+ *          - free ring:  main loop -> ISR, released buffers
+ *******************************************************************************************/
+
+#include "bare_packet.h"
+#include "bare_frame.h"
+#include "bare_usart.h"
+#include "bare_util.h"
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define PACKET_RING_SIZE 8U /*!< Power of two, greater than PACKET_POOL_COUNT */
+#define PACKET_RING_MASK (PACKET_RING_SIZE - 1U)
+#define PACKET_TX_CHUNK 32U /*!< Encoder output staged per bare_usart_write() call */
+
+typedef struct
+{
+    volatile uint8_t index[PACKET_RING_SIZE]; /*!< Pool buffer index */
+    volatile uint16_t len[PACKET_RING_SIZE];  /*!< Encoded frame length (ready ring) */
+    volatile uint8_t head;                    /*!< Written by producer only */
+    volatile uint8_t tail;                    /*!< Written by consumer only */
+} packet_ring_t;
+
+/** Encoder output on its way into the USART2 transmit ring */
+typedef struct
+{
+    uint8_t buf[PACKET_TX_CHUNK];
+    uint16_t len;
+} packet_tx_t;
+
+/*******************************************************************************************
+ *                                  Internal State
+ *******************************************************************************************/
+static uint8_t packet_pool[PACKET_POOL_COUNT][PACKET_BUFFER_SIZE];
+static packet_ring_t packet_ready;
+static packet_ring_t packet_free;
+static FRAME_Rx_t packet_rx;    /*!< Assembler owned by the ISR */
+static uint8_t packet_rx_index; /*!< Pool buffer currently bound to the assembler */
+static uint8_t packet_tx_seq;
+static uint8_t packet_rx_seq;
+static uint8_t packet_rx_synced; /*!< First valid frame seen, seq_gaps meaningful */
+static PACKET_Stats_t packet_stats;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+static uint8_t ring_empty(const packet_ring_t *r)
+{
+    return (r->head == r->tail);
+}
+
+static void ring_put(packet_ring_t *r, uint8_t index, uint16_t len)
+{
+    uint8_t head = r->head;
+
+    r->index[head] = index;
+    r->len[head] = len;
+    BARE_BARRIER();
+    r->head = (uint8_t)((head + 1U) & PACKET_RING_MASK);
+}
+
+static void ring_get(packet_ring_t *r, uint8_t *index, uint16_t *len)
+{
+    uint8_t tail = r->tail;
+
+    *index = r->index[tail];
+    *len = r->len[tail];
+    BARE_BARRIER();
+    r->tail = (uint8_t)((tail + 1U) & PACKET_RING_MASK);
+}
+
+/**
+ * @brief  Move staged bytes into the transmit ring, waiting only while it is full
+ */
+static void packet_tx_flush(packet_tx_t *tx)
+{
+    uint16_t done = 0U;
+
+    while (done < tx->len)
+    {
+        done += bare_usart_write(&tx->buf[done], (uint16_t)(tx->len - done));
+    }
+    tx->len = 0U;
+}
+
+/**
+ * @brief  Frame encoder sink: stage bytes for the interrupt-driven transmit ring
+ */
+static void packet_tx_sink(uint8_t byte, void *ctx)
+{
+    packet_tx_t *tx = (packet_tx_t *)ctx;
+
+    tx->buf[tx->len++] = byte;
+    if (tx->len == PACKET_TX_CHUNK)
+    {
+        packet_tx_flush(tx);
+    }
+}
+
+/**
+ * @brief  USART2 receive hook: assemble bytes into the bound pool buffer
+ */
+static void packet_rx_byte(uint8_t byte)
+{
+    FRAME_Status_t st = bare_frame_rx_push(&packet_rx, byte);
+    uint16_t unused;
+
+    if (st == FRAME_ERR_OVERFLOW)
+    {
+        packet_stats.overflows++;
+    }
+    else if (st == FRAME_OK)
+    {
+        if (ring_empty(&packet_free))
+        {
+            packet_stats.dropped++; // Main loop holds every buffer, reuse ours
+        }
+        else
+        {
+            ring_put(&packet_ready, packet_rx_index, (uint16_t)packet_rx.len);
+            ring_get(&packet_free, &packet_rx_index, &unused);
+        }
+        bare_frame_rx_init(&packet_rx, packet_pool[packet_rx_index], PACKET_BUFFER_SIZE);
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Initialize USART2 and start interrupt-driven frame reception
+ */
+void bare_packet_init(void)
+{
+    uint8_t i;
+
+    packet_ready.head = packet_ready.tail = 0U;
+    packet_free.head = packet_free.tail = 0U;
+    for (i = 1U; i < PACKET_POOL_COUNT; i++)
+    {
+        ring_put(&packet_free, i, 0U);
+    }
+
+    packet_rx_index = 0U;
+    bare_frame_rx_init(&packet_rx, packet_pool[0], PACKET_BUFFER_SIZE);
+
+    bare_usart_init();
+    bare_usart_set_rx_callback(packet_rx_byte);
+}
+
+/**
+ * @brief  Send one packet
+ * @param  type    Packet type
+ * @param  payload Payload bytes
+ * @param  len     Payload length
+ */
+void bare_packet_send(uint8_t type, const void *payload, size_t len)
+{
+    packet_tx_t tx;
+
+    tx.len = 0U;
+    bare_frame_encode(packet_tx_seq++, type, payload, len, packet_tx_sink, &tx);
+    packet_tx_flush(&tx);
+    packet_stats.tx_frames++;
+}
+
+/**
+ * @brief  Fetch the next received packet
+ * @param  pkt Received packet
+ * @retval FRAME_OK or FRAME_INCOMPLETE
+ */
+FRAME_Status_t bare_packet_receive(FRAME_Packet_t *pkt)
+{
+    while (!ring_empty(&packet_ready))
+    {
+        uint8_t index;
+        uint16_t len;
+        FRAME_Status_t st;
+
+        ring_get(&packet_ready, &index, &len);
+        st = bare_frame_decode(packet_pool[index], len, pkt);
+
+        if (st == FRAME_OK)
+        {
+            if (packet_rx_synced && (pkt->seq != packet_rx_seq))
+            {
+                packet_stats.seq_gaps += (uint8_t)(pkt->seq - packet_rx_seq);
+            }
+            packet_rx_seq = (uint8_t)(pkt->seq + 1U);
+            packet_rx_synced = 1U;
+            packet_stats.rx_frames++;
+            return FRAME_OK;
+        }
+
+        if (st == FRAME_ERR_CRC)
+        {
+            packet_stats.crc_errors++;
+        }
+        else
+        {
+            packet_stats.cobs_errors++;
+        }
+        ring_put(&packet_free, index, 0U);
+    }
+    return FRAME_INCOMPLETE;
+}
+
+/**
+ * @brief  Return the buffer of a received packet to the pool
+ * @param  pkt Packet obtained from bare_packet_receive()
+ */
+void bare_packet_release(const FRAME_Packet_t *pkt)
+{
+    /* The payload sits FRAME_HEADER_SIZE bytes into its pool buffer */
+    uint32_t offset = (uint32_t)((pkt->payload - FRAME_HEADER_SIZE) - &packet_pool[0][0]);
+
+    ring_put(&packet_free, (uint8_t)(offset / PACKET_BUFFER_SIZE), 0U);
+}
+
+/**
+ * @brief  Link statistics
+ * @retval Pointer to the live counters
+ */
+const PACKET_Stats_t *bare_packet_stats(void)
+{
+    return &packet_stats;
+}
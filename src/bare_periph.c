@@ -0,0 +1,94 @@
+/*******************************************************************************************
+ * @file    bare_periph.c
+ * @author  ka5j
+ * @brief   Peripheral descriptor table for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    RCC bits from RM0390 Section 6.3, vectors from Table 38, alternate functions
+ *          from the datasheet AF table and DMA requests from Tables 28/29. Where a request
+ *          can use two streams, the one the driver uses is listed.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "gpio_registers.h"
+#include "crc_registers.h"
+#include "dma_registers.h"
+#include "tim2_5_registers.h"
+#include "usart_registers.h"
+#include "spi_registers.h"
+#include "i2c_registers.h"
+#include "can_registers.h"
+#include "dac_registers.h"
+#include "adc_registers.h"
+#include "pwr_registers.h"
+#include "bare_periph.h"
+
+/*******************************************************************************************
+ *                                Descriptor Table
+ *******************************************************************************************/
+
+const PERIPH_Desc_t bare_periph_table[PERIPH_COUNT] = {
+    [PERIPH_GPIOA] = {GPIOA_BASE, PERIPH_AHB1, 0U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_GPIOB] = {GPIOB_BASE, PERIPH_AHB1, 1U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_GPIOC] = {GPIOC_BASE, PERIPH_AHB1, 2U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_GPIOD] = {GPIOD_BASE, PERIPH_AHB1, 3U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_GPIOE] = {GPIOE_BASE, PERIPH_AHB1, 4U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_GPIOF] = {GPIOF_BASE, PERIPH_AHB1, 5U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_GPIOG] = {GPIOG_BASE, PERIPH_AHB1, 6U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_GPIOH] = {GPIOH_BASE, PERIPH_AHB1, 7U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                      {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_CRC] = {CRC_BASE, PERIPH_AHB1, 12U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                    {PERIPH_NO_DMA, PERIPH_DMA(2, 0, 0)}},
+    [PERIPH_DMA1] = {DMA1_BASE, PERIPH_AHB1, 21U, 11U, PERIPH_NO_AF,
+                     {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_DMA2] = {DMA2_BASE, PERIPH_AHB1, 22U, 56U, PERIPH_NO_AF,
+                     {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_TIM2] = {TIM2_BASE, PERIPH_APB1, 0U, 28U, 1U,
+                     {PERIPH_NO_DMA, PERIPH_DMA(1, 1, 3)}},
+    [PERIPH_TIM3] = {TIM3_BASE, PERIPH_APB1, 1U, 29U, 2U,
+                     {PERIPH_NO_DMA, PERIPH_DMA(1, 2, 5)}},
+    [PERIPH_TIM4] = {TIM4_BASE, PERIPH_APB1, 2U, 30U, 2U,
+                     {PERIPH_NO_DMA, PERIPH_DMA(1, 6, 2)}},
+    [PERIPH_TIM5] = {TIM5_BASE, PERIPH_APB1, 3U, 50U, 2U,
+                     {PERIPH_NO_DMA, PERIPH_DMA(1, 0, 6)}},
+    [PERIPH_USART2] = {USART2_BASE, PERIPH_APB1, 17U, 38U, 7U,
+                       {PERIPH_DMA(1, 5, 4), PERIPH_DMA(1, 6, 4)}},
+    [PERIPH_SPI1] = {SPI1_BASE, PERIPH_APB2, 12U, 35U, 5U,
+                     {PERIPH_DMA(2, 2, 3), PERIPH_DMA(2, 5, 3)}},
+    [PERIPH_SPI2] = {SPI2_BASE, PERIPH_APB1, 14U, 36U, 5U,
+                     {PERIPH_DMA(1, 3, 0), PERIPH_DMA(1, 4, 0)}},
+    [PERIPH_SPI3] = {SPI3_BASE, PERIPH_APB1, 15U, 51U, 6U,
+                     {PERIPH_DMA(1, 2, 0), PERIPH_DMA(1, 7, 0)}},
+    [PERIPH_SPI4] = {SPI4_BASE, PERIPH_APB2, 13U, 84U, 5U,
+                     {PERIPH_DMA(2, 0, 4), PERIPH_DMA(2, 1, 4)}},
+    [PERIPH_I2C1] = {I2C1_BASE, PERIPH_APB1, 21U, 31U, 4U,
+                     {PERIPH_DMA(1, 0, 1), PERIPH_DMA(1, 6, 1)}},
+    [PERIPH_I2C2] = {I2C2_BASE, PERIPH_APB1, 22U, 33U, 4U,
+                     {PERIPH_DMA(1, 3, 7), PERIPH_DMA(1, 7, 7)}},
+    [PERIPH_I2C3] = {I2C3_BASE, PERIPH_APB1, 23U, 72U, 4U,
+                     {PERIPH_DMA(1, 2, 3), PERIPH_DMA(1, 4, 3)}},
+    [PERIPH_CAN1] = {CAN1_BASE, PERIPH_APB1, 25U, 19U, 9U,
+                     {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_CAN2] = {CAN2_BASE, PERIPH_APB1, 26U, 63U, 9U,
+                     {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_DAC] = {DAC_BASE, PERIPH_APB1, 29U, 54U, PERIPH_NO_AF,
+                    {PERIPH_DMA(1, 5, 7), PERIPH_DMA(1, 6, 7)}},
+    [PERIPH_ADC1] = {ADC1_BASE, PERIPH_APB2, 8U, 18U, PERIPH_NO_AF,
+                     {PERIPH_DMA(2, 4, 0), PERIPH_NO_DMA}},
+    [PERIPH_ADC2] = {ADC2_BASE, PERIPH_APB2, 9U, 18U, PERIPH_NO_AF,
+                     {PERIPH_DMA(2, 2, 1), PERIPH_NO_DMA}},
+    [PERIPH_ADC3] = {ADC3_BASE, PERIPH_APB2, 10U, 18U, PERIPH_NO_AF,
+                     {PERIPH_DMA(2, 1, 2), PERIPH_NO_DMA}},
+    [PERIPH_PWR] = {PWR_BASE, PERIPH_APB1, 28U, PERIPH_NO_IRQ, PERIPH_NO_AF,
+                    {PERIPH_NO_DMA, PERIPH_NO_DMA}},
+    [PERIPH_TIM8] = {TIM8_BASE, PERIPH_APB2, 1U, 44U, 3U,
+                     {PERIPH_NO_DMA, PERIPH_DMA(2, 1, 7)}},
+};
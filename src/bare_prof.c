@@ -0,0 +1,223 @@
+/*******************************************************************************************
+ * @file    bare_prof.c
+ * @author  ka5j
+ * @brief   Statistical PC-sampling profiler implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Buckets are keyed by PC >> shift with a multiplicative hash and short linear
+ *          probing. A key of 0 marks an empty bucket (code lives at 0x08000000 and up).
+ *          Samples that find no free bucket within PROF_PROBES are counted as dropped.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "tim2_5_registers.h"
+#include "systick_registers.h"
+#include "nvic_registers.h"
+#include "bare_prof.h"
+#include "bare_tim2_5.h"
+#include "bare_rcc.h"
+#include "bare_usart.h"
+#include "bare_periph.h"
+#include "bare_bitband.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define PROF_HASH_MUL 2654435761UL /*!< Knuth multiplicative hash */
+
+/** One histogram bucket */
+typedef struct
+{
+    uint32_t key;   /*!< PC >> shift, 0 = empty */
+    uint32_t count; /*!< Samples */
+} prof_bucket_t;
+
+static prof_bucket_t prof_hist[PROF_BUCKETS];
+static PROF_Config_t prof_cfg;
+static volatile uint32_t prof_samples;
+static volatile uint32_t prof_dropped;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Enable or disable the sample interrupt source
+ */
+static void prof_set_sampling(uint8_t on)
+{
+    if (prof_cfg.tim != NULL)
+    {
+        if (on)
+        {
+            bare_bitband_set(&prof_cfg.tim->DIER, TIM_DIER_UIE);
+        }
+        else
+        {
+            bare_bitband_clear(&prof_cfg.tim->DIER, TIM_DIER_UIE);
+        }
+    }
+    else if (on)
+    {
+        SYSTICK->CSR |= SYSTICK_CSR_TICKINT;
+    }
+    else
+    {
+        SYSTICK->CSR &= ~SYSTICK_CSR_TICKINT;
+    }
+}
+
+/**
+ * @brief  Print a 32-bit value as 8 hex digits
+ */
+static void prof_print_hex(uint32_t v)
+{
+    static const char digits[] = "0123456789abcdef";
+    char buf[9];
+    int i;
+
+    for (i = 7; i >= 0; i--)
+    {
+        buf[i] = digits[v & 0xFU];
+        v >>= 4;
+    }
+    buf[8] = '\0';
+    bare_usart_send_string(buf);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Clear the histogram and start sampling
+ * @param  cfg Configuration
+ */
+void bare_prof_start(const PROF_Config_t *cfg)
+{
+    uint32_t i;
+
+    bare_prof_stop();
+    prof_cfg = *cfg;
+
+    for (i = 0U; i < PROF_BUCKETS; i++)
+    {
+        prof_hist[i].key = 0U;
+        prof_hist[i].count = 0U;
+    }
+    prof_samples = 0U;
+    prof_dropped = 0U;
+
+    if (prof_cfg.tim != NULL)
+    {
+        uint8_t irq = bare_periph(bare_periph_tim2_5(prof_cfg.tim))->irq;
+
+        bare_tim2_5_set_rate(prof_cfg.tim, prof_cfg.rate_hz);
+        prof_cfg.tim->SR = ~TIM_SR_UIF;
+        NVIC->IP[irq] = 0x00U; // Highest priority: see into other handlers
+        bare_tim2_5_enable_interrupt(prof_cfg.tim);
+        prof_cfg.tim->DIER |= TIM_DIER_UIE;
+        prof_cfg.tim->CR1 |= TIM_CR1_CEN;
+    }
+    else
+    {
+        SYSTICK->CSR = 0U;
+        SYSTICK->RVR = (bare_rcc_get_hclk() / prof_cfg.rate_hz) - 1U;
+        SYSTICK->CVR = 0U;
+        SYSTICK->CSR = SYSTICK_CSR_CLKSOURCE | SYSTICK_CSR_TICKINT | SYSTICK_CSR_ENABLE;
+    }
+}
+
+/**
+ * @brief  Stop sampling
+ */
+void bare_prof_stop(void)
+{
+    if (prof_cfg.tim != NULL)
+    {
+        prof_cfg.tim->DIER &= ~TIM_DIER_UIE;
+        prof_cfg.tim->CR1 &= ~TIM_CR1_CEN;
+    }
+    else if (prof_cfg.rate_hz != 0U)
+    {
+        SYSTICK->CSR &= ~(SYSTICK_CSR_TICKINT | SYSTICK_CSR_ENABLE);
+    }
+}
+
+/**
+ * @brief  Write the histogram over USART2
+ */
+void bare_prof_dump(void)
+{
+    uint32_t i;
+
+    prof_set_sampling(0U);
+
+    bare_usart_send_string("PROF ");
+    bare_print_u32(prof_samples);
+    bare_usart_send_char(' ');
+    bare_print_u32(prof_dropped);
+    bare_usart_send_char(' ');
+    bare_print_u32(prof_cfg.shift);
+    bare_usart_send_string("\r\n");
+
+    for (i = 0U; i < PROF_BUCKETS; i++)
+    {
+        if (prof_hist[i].key != 0U)
+        {
+            prof_print_hex(prof_hist[i].key);
+            bare_usart_send_char(' ');
+            bare_print_u32(prof_hist[i].count);
+            bare_usart_send_string("\r\n");
+        }
+    }
+    bare_usart_send_string("END\r\n");
+
+    prof_set_sampling(1U);
+}
+
+/**
+ * @brief  Count one sample
+ * @param  frame Exception frame of the interrupted context
+ */
+void bare_prof_sample(const uint32_t *frame)
+{
+    uint32_t key = frame[6] >> prof_cfg.shift;
+    uint32_t slot = (key * PROF_HASH_MUL) >> (32U - PROF_BUCKETS_LOG2);
+    uint32_t n;
+
+    if (prof_cfg.tim != NULL)
+    {
+        prof_cfg.tim->SR = ~TIM_SR_UIF;
+    }
+
+    prof_samples++;
+    for (n = 0U; n < PROF_PROBES; n++)
+    {
+        prof_bucket_t *b = &prof_hist[(slot + n) & (PROF_BUCKETS - 1U)];
+
+        if (b->key == key)
+        {
+            b->count++;
+            break;
+        }
+        if (b->key == 0U)
+        {
+            b->key = key;
+            b->count = 1U;
+            break;
+        }
+    }
+    if (n == PROF_PROBES)
+    {
+        prof_dropped++;
+    }
+
+    if (prof_cfg.hook != NULL)
+    {
+        prof_cfg.hook();
+    }
+}
@@ -0,0 +1,219 @@
+/*******************************************************************************************
+ * @file    bare_pulse.c
+ * @author  ka5j
+ * @brief   Hardware-timed delayed pulse generator implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Retrigger: TIM2-TIM5 have no combined reset + trigger slave mode. The timer
+ *          waits in trigger mode (a trigger starts the counter); the trigger interrupt then
+ *          switches it to reset mode, where further triggers restart the count in hardware
+ *          at the exact edge. The update interrupt at the end of the pulse switches back.
+ *          Only a trigger landing inside that interrupt latency is lost.
+ *
+ *          Burst: the counter runs continuously (OPM clear) so the pulses repeat every
+ *          delay + width ticks; the update interrupt sets OPM during the last pulse, so the
+ *          interrupt has a whole pulse period of slack.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "tim2_5_registers.h"
+#include "bare_pulse.h"
+#include "bare_tim2_5.h"
+#include "bare_bitband.h"
+#include "bare_periph.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define PULSE_TIMERS 4U
+
+/** Runtime state of each timer */
+typedef struct
+{
+    PULSE_Mode_t mode;
+    PULSE_Trigger_t trigger;
+    uint32_t count;              /*!< Burst length */
+    volatile uint32_t remaining; /*!< Pulses left in the current burst */
+} pulse_state_t;
+
+static pulse_state_t pulse_state[PULSE_TIMERS];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Select the slave mode, keeping the trigger selection
+ */
+static inline void pulse_set_sms(TIM2_5_TypeDef *TIMx, uint32_t sms)
+{
+    TIMx->SMCR = (TIMx->SMCR & ~TIM_SMCR_SMS_Msk) | sms;
+}
+
+/**
+ * @brief  Configure TI1 or TI2 as a filtered trigger input
+ */
+static void pulse_trigger_input(TIM2_5_TypeDef *TIMx, const PULSE_Config_t *cfg)
+{
+    uint32_t shift = (cfg->trigger == PULSE_TRIG_TI1) ? 0U : 8U; // CC1 or CC2 field of CCMR1
+    uint32_t ccp = (cfg->trigger == PULSE_TRIG_TI1) ? (1UL << 1) : (1UL << 5);
+
+    TIMx->CCMR1 = (TIMx->CCMR1 & ~(0xFFUL << shift)) |
+                  ((0x1UL | ((uint32_t)(cfg->filter & 0xFU) << 4)) << shift); // CCxS = 01
+    TIMx->CCER = cfg->falling_edge ? (TIMx->CCER | ccp) : (TIMx->CCER & ~ccp);
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Configure a timer as a triggered pulse generator
+ * @param  TIMx Pointer to timer peripheral
+ * @param  cfg  Configuration
+ * @retval Achieved tick frequency in Hz
+ */
+uint32_t bare_pulse_init(TIM2_5_TypeDef *TIMx, const PULSE_Config_t *cfg)
+{
+    pulse_state_t *st = &pulse_state[bare_periph_tim2_5_index(TIMx)];
+    uint32_t ch = (uint32_t)cfg->channel - 1U;
+    volatile uint32_t *ccmr = (ch < 2U) ? &TIMx->CCMR1 : &TIMx->CCMR2;
+    uint32_t shift = (ch & 1U) * 8U;
+    uint32_t tick;
+
+    st->mode = cfg->mode;
+    st->trigger = cfg->trigger;
+    st->count = (cfg->count == 0U) ? 1U : cfg->count;
+    st->remaining = st->count;
+
+    /* 1. Tick, counter stopped; URS so only overflows (pulse ends) raise UIF */
+    tick = bare_tim2_5_set_tick(TIMx, cfg->tick_hz);
+    TIMx->CR1 = TIM_CR1_URS | TIM_CR1_ARPE |
+                ((cfg->mode == PULSE_MODE_BURST) && (st->count > 1U) ? 0U : TIM_CR1_OPM);
+    TIMx->CNT = 0U;
+
+    /* 2. Output channel: PWM mode 2, preloaded, optional inversion */
+    *ccmr = (*ccmr & ~(0xFFUL << shift)) | (((TIM_OCM_PWM2 << 4) | TIM_CCMR_OCPE) << shift);
+    TIMx->CCER = (TIMx->CCER & ~(0xFUL << (ch * 4U))) |
+                 ((1UL | (cfg->active_low ? 2UL : 0UL)) << (ch * 4U)); // CCxE, CCxP
+    bare_pulse_set_timing(TIMx, cfg->delay, cfg->width);
+    TIMx->EGR = TIM_EGR_UG; // Load preloaded CCR/ARR now (URS: no UIF)
+
+    if (cfg->port != NULL)
+    {
+        bare_tim2_5_set_pin(TIMx, cfg->port, cfg->pin);
+    }
+
+    /* 3. Trigger: slave trigger mode starts the counter on the selected edge */
+    if (cfg->trigger == PULSE_TRIG_SOFTWARE)
+    {
+        TIMx->SMCR = 0U;
+    }
+    else
+    {
+        if ((cfg->trigger == PULSE_TRIG_TI1) || (cfg->trigger == PULSE_TRIG_TI2))
+        {
+            pulse_trigger_input(TIMx, cfg);
+        }
+        TIMx->SMCR = ((uint32_t)cfg->trigger << TIM_SMCR_TS_Pos) | TIM_SMS_TRIGGER;
+    }
+
+    /* 4. Interrupt work for retrigger / burst */
+    TIMx->SR = 0U;
+    TIMx->DIER = 0U;
+    if ((cfg->mode == PULSE_MODE_RETRIGGER) && (cfg->trigger != PULSE_TRIG_SOFTWARE))
+    {
+        TIMx->DIER = TIM_DIER_TIE | TIM_DIER_UIE;
+        bare_tim2_5_enable_interrupt(TIMx);
+    }
+    else if ((cfg->mode == PULSE_MODE_BURST) && (st->count > 1U))
+    {
+        TIMx->DIER = TIM_DIER_UIE;
+        bare_tim2_5_enable_interrupt(TIMx);
+    }
+
+    return tick;
+}
+
+/**
+ * @brief  Change delay and width from the next pulse
+ * @param  TIMx  Pointer to timer peripheral
+ * @param  delay Ticks from trigger to leading edge
+ * @param  width Pulse width in ticks
+ */
+void bare_pulse_set_timing(TIM2_5_TypeDef *TIMx, uint32_t delay, uint32_t width)
+{
+    delay = (delay == 0U) ? 1U : delay; // CCR = 0 would hold the output active while idle
+    width = (width == 0U) ? 1U : width;
+
+    switch (TIMx->CCER & 0x1111U) // Find the enabled output channel
+    {
+    case 0x0001U:
+        TIMx->CCR1 = delay;
+        break;
+    case 0x0010U:
+        TIMx->CCR2 = delay;
+        break;
+    case 0x0100U:
+        TIMx->CCR3 = delay;
+        break;
+    default:
+        TIMx->CCR4 = delay;
+        break;
+    }
+    TIMx->ARR = delay + width - 1U;
+}
+
+/**
+ * @brief  Start a pulse (or burst) now
+ * @param  TIMx Pointer to timer peripheral
+ */
+void bare_pulse_fire(TIM2_5_TypeDef *TIMx)
+{
+    if (!(TIMx->CR1 & TIM_CR1_CEN))
+    {
+        TIMx->CR1 |= TIM_CR1_CEN;
+    }
+}
+
+/**
+ * @brief  Check whether a pulse or burst is in progress
+ * @param  TIMx Pointer to timer peripheral
+ * @retval 1 if the counter is running
+ */
+uint8_t bare_pulse_busy(TIM2_5_TypeDef *TIMx)
+{
+    return (TIMx->CR1 & TIM_CR1_CEN) ? 1U : 0U;
+}
+
+/**
+ * @brief  Timer interrupt work for retrigger and burst modes
+ * @param  TIMx Pointer to timer peripheral
+ */
+void bare_pulse_irq_handler(TIM2_5_TypeDef *TIMx)
+{
+    pulse_state_t *st = &pulse_state[bare_periph_tim2_5_index(TIMx)];
+    uint32_t sr = TIMx->SR;
+
+    TIMx->SR = ~(sr & (TIM_SR_UIF | TIM_SR_TIF)); // rc_w0
+
+    if (st->mode == PULSE_MODE_RETRIGGER)
+    {
+        /* Running: triggers restart the count. Stopped: a trigger starts it */
+        pulse_set_sms(TIMx, (TIMx->CR1 & TIM_CR1_CEN) ? TIM_SMS_RESET : TIM_SMS_TRIGGER);
+    }
+    else if ((st->mode == PULSE_MODE_BURST) && (sr & TIM_SR_UIF))
+    {
+        if (--st->remaining == 1U)
+        {
+            bare_bitband_set(&TIMx->CR1, TIM_CR1_OPM); // Stop after the pulse now running
+        }
+        else if (st->remaining == 0U)
+        {
+            st->remaining = st->count; // Burst done, wait for the next trigger
+            bare_bitband_clear(&TIMx->CR1, TIM_CR1_OPM);
+        }
+    }
+}
@@ -0,0 +1,383 @@
+/*******************************************************************************************
+ * @file    bare_rcc.c
+ * @author  ka5j
+ * @brief   Bare-metal RCC clock tree queries implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Follows RM0390 Section 6.2: SYSCLK from HSI, HSE or the main PLL (P or R
+ *          output), then the AHB and APB1/APB2 prescalers.
+ *
+ *          Profile switches always pass through HSI, which every wait state and regulator
+ *          setting supports, so the PLL and over-drive can be reprogrammed safely.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "rcc_registers.h"
+#include "bare_rcc.h"
+#include "board_config.h"
+#include "flash_registers.h"
+#include "pwr_registers.h"
+#include "dwt_registers.h"
+#include "bare_dwt.h"
+#include "bare_periph.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define RCC_TIMEOUT 1000000UL        /*!< Ready-flag polling limit */
+#define RCC_PLLM_HSI 8U               /*!< HSI / 8 = 2 MHz PLL input */
+
+/** Clock profile description */
+typedef struct
+{
+    uint32_t hclk;   /*!< Resulting HCLK (Hz) */
+    uint16_t plln;   /*!< PLLN, 0 = run from HSI */
+    uint8_t pllp;    /*!< PLLP field (0: /2, 1: /4) */
+    uint8_t pllq;    /*!< PLLQ */
+    uint8_t vos;     /*!< Regulator scale field (1 = scale 3, 3 = scale 1) */
+    uint8_t od;      /*!< Over-drive */
+    uint8_t ws;      /*!< Flash wait states */
+    uint8_t ppre1;   /*!< APB1 prescaler field */
+    uint8_t ppre2;   /*!< APB2 prescaler field */
+} rcc_profile_t;
+
+static const rcc_profile_t rcc_profiles[RCC_PROFILE_COUNT] = {
+    {16000000UL, 0U, 0U, 0U, 1U, 0U, 0U, 0U, 0U},    // HSI
+    {84000000UL, 168U, 1U, 7U, 1U, 0U, 2U, 4U, 0U},  // VCO 336 MHz, P /4, Q 48 MHz
+    {180000000UL, 180U, 0U, 8U, 3U, 1U, 5U, 5U, 4U}, // VCO 360 MHz, P /2, APB1 /4, APB2 /2
+};
+
+static RCC_ClockHook_t rcc_hooks[RCC_MAX_HOOKS];
+static uint8_t rcc_hook_count;
+static RCC_Profile_t rcc_profile = RCC_PROFILE_HSI_16MHZ;
+static uint32_t rcc_latency_us;
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Wait until (reg & mask) == value
+ * @retval 1 on success, 0 on timeout
+ */
+static uint8_t rcc_wait(volatile uint32_t *reg, uint32_t mask, uint32_t value)
+{
+    uint32_t n;
+
+    for (n = 0U; n < RCC_TIMEOUT; n++)
+    {
+        if ((*reg & mask) == value)
+        {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/**
+ * @brief  Call every registered hook
+ */
+static void rcc_run_hooks(RCC_ClockPhase_t phase)
+{
+    uint8_t i;
+
+    for (i = 0U; i < rcc_hook_count; i++)
+    {
+        rcc_hooks[i](phase);
+    }
+}
+
+/**
+ * @brief  Check that SWS reports HSI as the system clock
+ */
+static inline uint8_t rcc_on_hsi(void)
+{
+    return (RCC->CFGR & (0x3UL << 2)) == 0U;
+}
+
+/**
+ * @brief  Run SYSCLK from HSI with undivided buses, PLL and over-drive off
+ * @retval 1 on success, 0 on timeout
+ */
+static uint8_t rcc_to_hsi(void)
+{
+    RCC->CR |= (1UL << 0); // HSION
+    if (!rcc_wait(&RCC->CR, (1UL << 1), (1UL << 1))) // HSIRDY
+    {
+        return 0U;
+    }
+
+    RCC->CFGR &= ~0x3UL; // SW = HSI
+    if (!rcc_wait(&RCC->CFGR, (0x3UL << 2), 0U)) // SWS
+    {
+        return 0U;
+    }
+    RCC->CFGR &= ~((0xFUL << 4) | (0x7UL << 10) | (0x7UL << 13)); // HPRE, PPRE1, PPRE2 = /1
+
+    PWR->CR &= ~(PWR_CR_ODSWEN | PWR_CR_ODEN);
+    RCC->CR &= ~(1UL << 24); // PLLON
+    return rcc_wait(&RCC->CR, (1UL << 25), 0U); // PLLRDY
+}
+
+/**
+ * @brief  Bring up the PLL of a profile and switch SYSCLK to it
+ * @retval 1 on success, 0 on timeout
+ */
+static uint8_t rcc_to_pll(const rcc_profile_t *p)
+{
+    /* Regulator scale can only change while the PLL is off */
+    PWR->CR = (PWR->CR & ~PWR_CR_VOS_Msk) | ((uint32_t)p->vos << PWR_CR_VOS_Pos);
+
+    RCC->PLLCFGR = (RCC->PLLCFGR & (0x7UL << 28)) | // Keep PLLR
+                   RCC_PLLM_HSI |
+                   ((uint32_t)p->plln << 6) |
+                   ((uint32_t)p->pllp << 16) |
+                   ((uint32_t)p->pllq << 24); // PLLSRC = HSI
+    RCC->CR |= (1UL << 24); // PLLON
+    if (!rcc_wait(&RCC->CR, (1UL << 25), (1UL << 25)))
+    {
+        return 0U;
+    }
+
+    if (p->od)
+    {
+        PWR->CR |= PWR_CR_ODEN;
+        if (!rcc_wait(&PWR->CSR, PWR_CSR_ODRDY, PWR_CSR_ODRDY))
+        {
+            return 0U;
+        }
+        PWR->CR |= PWR_CR_ODSWEN;
+        if (!rcc_wait(&PWR->CSR, PWR_CSR_ODSWRDY, PWR_CSR_ODSWRDY))
+        {
+            return 0U;
+        }
+    }
+
+    /* More wait states before the faster clock arrives */
+    FLASH->ACR = FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN | p->ws;
+    RCC->CFGR = (RCC->CFGR & ~((0x7UL << 10) | (0x7UL << 13) | 0x3UL)) |
+                ((uint32_t)p->ppre1 << 10) | ((uint32_t)p->ppre2 << 13) | 0x2UL; // SW = PLL
+    return rcc_wait(&RCC->CFGR, (0x3UL << 2), (0x2UL << 2));
+}
+
+/** AHB prescaler shift for HPRE values 8-15 (/2 ... /512, /32 does not exist) */
+static const uint8_t rcc_ahb_shift[8] = {1U, 2U, 3U, 4U, 6U, 7U, 8U, 9U};
+
+/**
+ * @brief  Main PLL output frequency
+ * @param  r_output 1 for the R output (SW = 11), 0 for the P output (SW = 10)
+ */
+static uint32_t rcc_pll_output(uint8_t r_output)
+{
+    uint32_t cfgr = RCC->PLLCFGR;
+    uint32_t src = (cfgr & (1UL << 22)) ? HSE_VALUE : HSI_VALUE; // PLLSRC
+    uint32_t m = cfgr & 0x3FUL;                                   // PLLM
+    uint32_t n = (cfgr >> 6) & 0x1FFUL;                           // PLLN
+    uint32_t div;
+
+    if (r_output)
+    {
+        div = (cfgr >> 28) & 0x7UL; // PLLR
+    }
+    else
+    {
+        div = (((cfgr >> 16) & 0x3UL) + 1U) * 2U; // PLLP: 2, 4, 6, 8
+    }
+
+    if ((m == 0U) || (div == 0U))
+    {
+        return 0U; // Invalid configuration
+    }
+
+    /* VCO = src / M * N, computed in 64 bits to keep the fraction of src / M */
+    return (uint32_t)(((uint64_t)src * n) / (m * div));
+}
+
+/**
+ * @brief  Apply an APB prescaler field (PPRE1/PPRE2, 3 bits) to HCLK
+ */
+static uint32_t rcc_apb_clock(uint32_t ppre)
+{
+    uint32_t hclk = bare_rcc_get_hclk();
+
+    return (ppre & 0x4U) ? (hclk >> ((ppre & 0x3U) + 1U)) : hclk;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  System clock frequency
+ * @retval SYSCLK in Hz
+ */
+uint32_t bare_rcc_get_sysclk(void)
+{
+    switch ((RCC->CFGR >> 2) & 0x3UL) // SWS
+    {
+    case 0x1U:
+        return HSE_VALUE;
+    case 0x2U:
+        return rcc_pll_output(0U);
+    case 0x3U:
+        return rcc_pll_output(1U);
+    default:
+        return HSI_VALUE;
+    }
+}
+
+/**
+ * @brief  AHB clock frequency
+ * @retval HCLK in Hz
+ */
+uint32_t bare_rcc_get_hclk(void)
+{
+    uint32_t hpre = (RCC->CFGR >> 4) & 0xFUL;
+    uint32_t sysclk = bare_rcc_get_sysclk();
+
+    return (hpre & 0x8U) ? (sysclk >> rcc_ahb_shift[hpre & 0x7U]) : sysclk;
+}
+
+/**
+ * @brief  APB1 peripheral clock frequency
+ * @retval PCLK1 in Hz
+ */
+uint32_t bare_rcc_get_pclk1(void)
+{
+    return rcc_apb_clock((RCC->CFGR >> 10) & 0x7UL); // PPRE1
+}
+
+/**
+ * @brief  APB2 peripheral clock frequency
+ * @retval PCLK2 in Hz
+ */
+uint32_t bare_rcc_get_pclk2(void)
+{
+    return rcc_apb_clock((RCC->CFGR >> 13) & 0x7UL); // PPRE2
+}
+
+/**
+ * @brief  Kernel clock of the APB1 timers
+ * @retval Timer clock in Hz
+ */
+uint32_t bare_rcc_get_timclk1(void)
+{
+    uint32_t pclk1 = bare_rcc_get_pclk1();
+
+    return (RCC->CFGR & (0x4UL << 10)) ? (pclk1 * 2U) : pclk1;
+}
+
+/**
+ * @brief  Kernel clock of the APB2 timers
+ * @retval Timer clock in Hz
+ */
+uint32_t bare_rcc_get_timclk2(void)
+{
+    uint32_t pclk2 = bare_rcc_get_pclk2();
+
+    return (RCC->CFGR & (0x4UL << 13)) ? (pclk2 * 2U) : pclk2;
+}
+
+/**
+ * @brief  Switch the system clock to a profile and let the drivers follow
+ * @param  profile Target profile
+ * @retval RCC_OK or RCC_ERR_TIMEOUT
+ */
+RCC_Status_t bare_rcc_set_profile(RCC_Profile_t profile)
+{
+    const rcc_profile_t *p = &rcc_profiles[profile];
+    uint32_t primask = bare_irq_save();
+    uint32_t old_mhz = bare_rcc_get_hclk() / 1000000U;
+    uint32_t t0, t1, t2;
+    uint8_t ok;
+
+    if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA))
+    {
+        bare_dwt_init();
+    }
+    bare_periph_enable_clock(PERIPH_PWR);
+
+    t0 = bare_dwt_cycles();
+    rcc_run_hooks(RCC_CLOCK_PRE);
+
+    ok = rcc_to_hsi();
+    if (!rcc_on_hsi())
+    {
+        /* SWS never confirmed HSI: SYSCLK may still be the old, faster clock, so its wait
+         * states, the recorded profile and the drivers' settings all stay as they are */
+        bare_irq_restore(primask);
+        return RCC_ERR_TIMEOUT;
+    }
+    t1 = bare_dwt_cycles();
+
+    if (ok && (p->plln != 0U))
+    {
+        ok = rcc_to_pll(p);
+        if (!ok && !rcc_to_hsi() && !rcc_on_hsi())
+        {
+            bare_irq_restore(primask); // Stuck between clocks: keep the higher latency
+            return RCC_ERR_TIMEOUT;
+        }
+    }
+    if (!ok || (p->plln == 0U))
+    {
+        /* Only now that SWS reports HSI can the flash run without wait states */
+        FLASH->ACR = FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN;
+    }
+    rcc_profile = ok ? profile : RCC_PROFILE_HSI_16MHZ;
+    t2 = bare_dwt_cycles();
+
+    rcc_run_hooks(RCC_CLOCK_POST);
+
+    /* Each segment of the switch counted at the HCLK it ran on */
+    rcc_latency_us = ((t1 - t0) / old_mhz) + ((t2 - t1) / (HSI_VALUE / 1000000U)) +
+                     ((bare_dwt_cycles() - t2) / (bare_rcc_get_hclk() / 1000000U));
+
+    bare_irq_restore(primask);
+    return ok ? RCC_OK : RCC_ERR_TIMEOUT;
+}
+
+/**
+ * @brief  Profile selected by the last bare_rcc_set_profile()
+ * @retval Current profile
+ */
+RCC_Profile_t bare_rcc_get_profile(void)
+{
+    return rcc_profile;
+}
+
+/**
+ * @brief  Register a clock change hook
+ * @param  hook Hook called around every profile switch
+ * @retval RCC_OK or RCC_ERR_HOOKS
+ */
+RCC_Status_t bare_rcc_register_hook(RCC_ClockHook_t hook)
+{
+    uint8_t i;
+
+    for (i = 0U; i < rcc_hook_count; i++)
+    {
+        if (rcc_hooks[i] == hook)
+        {
+            return RCC_OK;
+        }
+    }
+    if (rcc_hook_count >= RCC_MAX_HOOKS)
+    {
+        return RCC_ERR_HOOKS;
+    }
+    rcc_hooks[rcc_hook_count++] = hook;
+    return RCC_OK;
+}
+
+/**
+ * @brief  Duration of the last profile switch, hooks included
+ * @retval Microseconds
+ */
+uint32_t bare_rcc_switch_latency_us(void)
+{
+    return rcc_latency_us;
+}
@@ -0,0 +1,471 @@
+/*******************************************************************************************
+ * @file    bare_spi.c
+ * @author  ka5j
+ * @brief   Bare-metal SPI1-SPI4 master driver implementation for STM32F446RE
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    DMA transfers always run both directions so that completion is signalled by
+ *          the RX stream (the last frame has been clocked in once RX completes). The queue
+ *          engine runs in the RX transfer-complete interrupt: it releases the chip select,
+ *          runs the callback and starts the next transaction in the same handler.
+ *
+ *          Default DMA streams (RM0390 Tables 28/29), change here if they collide:
+ *          SPI1 DMA2 S2/S5 ch3, SPI2 DMA1 S3/S4 ch0, SPI3 DMA1 S2/S7 ch0, SPI4 DMA2 S0/S1 ch4.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "spi_registers.h"
+#include "bare_spi.h"
+#include "bare_dma.h"
+#include "bare_gpio.h"
+#include "bare_rcc.h"
+#include "bare_periph.h"
+#include "bare_util.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define SPI_COUNT 4U
+#define SPI_POLL_SPIN 100000U /*!< Bound on polled loop passes without a frame completing */
+
+/** Instance and its descriptor (clock gate, DMA requests) */
+static const struct
+{
+    SPI_TypeDef *spi;
+    PERIPH_Id_t id;
+} spi_hw[SPI_COUNT] = {
+    {SPI1, PERIPH_SPI1},
+    {SPI2, PERIPH_SPI2},
+    {SPI3, PERIPH_SPI3},
+    {SPI4, PERIPH_SPI4},
+};
+
+#define SPI_RX_STREAM(idx) bare_periph_dma_stream(spi_hw[idx].id, 0U)
+#define SPI_TX_STREAM(idx) bare_periph_dma_stream(spi_hw[idx].id, 1U)
+
+/** Runtime state of each instance */
+typedef struct
+{
+    SPI_TypeDef *spi;
+    uint8_t frame16;            /*!< 16-bit frames */
+    volatile uint8_t busy;      /*!< DMA transfer or queue running */
+    SPI_Callback_t cb;          /*!< Direct DMA transfer callback */
+    void *ctx;                  /*!< Direct DMA transfer context */
+    SPI_Transaction_t *head;    /*!< Pending transactions */
+    SPI_Transaction_t *tail;
+    SPI_Transaction_t *active;  /*!< Transaction owning the DMA */
+} spi_state_t;
+
+static spi_state_t spi_state[SPI_COUNT];
+
+static const uint16_t spi_dummy_tx = 0xFFFFU; /*!< Source when no TX data */
+static uint16_t spi_dummy_rx;                 /*!< Sink when RX data is discarded */
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Index of an SPI instance in spi_hw / spi_state
+ */
+static uint32_t spi_index(SPI_TypeDef *SPIx)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (SPI_COUNT - 1U); i++)
+    {
+        if (spi_hw[i].spi == SPIx)
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief  Drive a chip select (active low) with a single BSRR store
+ */
+static inline void spi_cs(const SPI_Transaction_t *t, uint8_t assert)
+{
+    if (t->cs_port != NULL)
+    {
+        t->cs_port->BSRR = assert ? (1UL << (t->cs_pin + 16U)) : (1UL << t->cs_pin);
+    }
+}
+
+/**
+ * @brief  Program memory increment for a buffer or the fixed dummy word
+ */
+static inline void spi_dma_minc(DMA_Stream_TypeDef *stream, const void *buf)
+{
+    stream->CR = (buf != NULL) ? (stream->CR | DMA_SxCR_MINC) : (stream->CR & ~DMA_SxCR_MINC);
+}
+
+/**
+ * @brief  Launch a full-duplex DMA transfer (streams configured in bare_spi_init)
+ */
+static void spi_dma_launch(uint32_t idx, const void *tx, void *rx, uint16_t len)
+{
+    SPI_TypeDef *SPIx = spi_hw[idx].spi;
+
+    spi_dma_minc(SPI_RX_STREAM(idx), rx);
+    spi_dma_minc(SPI_TX_STREAM(idx), tx);
+
+    /* RX armed first so no received frame can be missed */
+    bare_dma_start(SPI_RX_STREAM(idx), (uint32_t)&SPIx->DR,
+                   (rx != NULL) ? (uint32_t)rx : (uint32_t)&spi_dummy_rx, 0U, len);
+    bare_dma_start(SPI_TX_STREAM(idx), (uint32_t)&SPIx->DR,
+                   (tx != NULL) ? (uint32_t)tx : (uint32_t)&spi_dummy_tx, 0U, len);
+    SPIx->CR2 |= SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN; // TXE raises the first request
+}
+
+/**
+ * @brief  Pop the next queued transaction, clearing busy when the queue is empty
+ */
+static SPI_Transaction_t *spi_queue_pop(spi_state_t *st)
+{
+    uint32_t primask = bare_irq_save();
+    SPI_Transaction_t *t = st->head;
+
+    if (t != NULL)
+    {
+        st->head = t->next;
+        if (st->head == NULL)
+        {
+            st->tail = NULL;
+        }
+    }
+    else
+    {
+        st->busy = 0U;
+    }
+    bare_irq_restore(primask);
+    return t;
+}
+
+/**
+ * @brief  Release the chip select of a finished transaction and notify its owner
+ */
+static void spi_queue_finish(SPI_Transaction_t *t)
+{
+    if (!t->keep_cs)
+    {
+        spi_cs(t, 0U);
+    }
+    if (t->done != NULL)
+    {
+        t->done(t->ctx);
+    }
+}
+
+/**
+ * @brief  Run queued transactions until one needs the DMA or the queue is empty
+ */
+static void spi_queue_run(uint32_t idx)
+{
+    spi_state_t *st = &spi_state[idx];
+    SPI_Transaction_t *t;
+
+    while ((t = spi_queue_pop(st)) != NULL)
+    {
+        spi_cs(t, 1U);
+
+        if (t->len <= SPI_POLL_THRESHOLD)
+        {
+            /* Shorter than the DMA setup cost: clock it out right here */
+            t->status = bare_spi_transfer(st->spi, t->tx, t->rx, t->len);
+            spi_queue_finish(t);
+            continue;
+        }
+
+        st->active = t;
+        spi_dma_launch(idx, t->tx, t->rx, t->len);
+        return;
+    }
+}
+
+/**
+ * @brief  RX stream event: end of a DMA transfer
+ */
+static void spi_dma_event(uint32_t events, void *ctx)
+{
+    spi_state_t *st = (spi_state_t *)ctx;
+    uint32_t idx = (uint32_t)(st - spi_state);
+    SPI_Transaction_t *t = st->active;
+
+    if (!(events & (DMA_EVENT_COMPLETE | DMA_EVENT_ERROR)))
+    {
+        return;
+    }
+
+    st->spi->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+    if (events & DMA_EVENT_ERROR)
+    {
+        bare_dma_stop(SPI_TX_STREAM(idx));
+    }
+
+    if (t != NULL)
+    {
+        st->active = NULL;
+        t->status = (events & DMA_EVENT_ERROR) ? SPI_ERR_DMA : SPI_OK;
+        spi_queue_finish(t);
+        spi_queue_run(idx);
+    }
+    else
+    {
+        st->busy = 0U;
+        if (st->cb != NULL)
+        {
+            st->cb(st->ctx);
+        }
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Initialize an SPI instance as master
+ * @param  SPIx Pointer to SPI peripheral
+ * @param  cfg  Bus configuration
+ * @retval Actual SCK frequency in Hz
+ */
+uint32_t bare_spi_init(SPI_TypeDef *SPIx, const SPI_Config_t *cfg)
+{
+    uint32_t idx = spi_index(SPIx);
+    uint32_t clk;
+    uint32_t br = 0U;
+    DMA_Size_t size = (cfg->frame == SPI_FRAME_16BIT) ? DMA_SIZE_HALFWORD : DMA_SIZE_BYTE;
+    DMA_Config_t rx = {
+        .channel = bare_periph_dma_channel(spi_hw[idx].id, 0U),
+        .dir = DMA_DIR_PERIPH_TO_MEM,
+        .psize = size,
+        .msize = size,
+        .minc = 1U,
+        .priority = DMA_PRIORITY_VERY_HIGH, // RX must win over TX to avoid overrun
+        .fifo = DMA_FIFO_DIRECT,
+        .complete_irq = 1U,
+    };
+    DMA_Config_t tx = rx;
+
+    tx.dir = DMA_DIR_MEM_TO_PERIPH;
+    tx.priority = DMA_PRIORITY_HIGH;
+    tx.complete_irq = 0U;
+
+    /* 1. Clocks */
+    bare_periph_enable_clock(spi_hw[idx].id);
+    clk = (bare_periph(spi_hw[idx].id)->bus == PERIPH_APB2) ? bare_rcc_get_pclk2()
+                                                             : bare_rcc_get_pclk1();
+
+    /* 2. Pins */
+    bare_gpio_AF(cfg->sck.port, cfg->sck.pin);
+    bare_gpio_set_AF(cfg->sck.port, cfg->sck.pin, cfg->af);
+    bare_gpio_AF(cfg->mosi.port, cfg->mosi.pin);
+    bare_gpio_set_AF(cfg->mosi.port, cfg->mosi.pin, cfg->af);
+    if (cfg->miso.port != NULL)
+    {
+        bare_gpio_AF(cfg->miso.port, cfg->miso.pin);
+        bare_gpio_set_AF(cfg->miso.port, cfg->miso.pin, cfg->af);
+    }
+
+    /* 3. Fastest SCK = clk / 2^(BR+1) not above max_hz */
+    while ((br < 7U) && ((clk >> (br + 1U)) > cfg->max_hz))
+    {
+        br++;
+    }
+
+    /* 4. Single write of CR1 with software NSS, then enable */
+    SPIx->CR1 = 0U;
+    SPIx->CR2 = 0U;
+    SPIx->CR1 = SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI | (br << SPI_CR1_BR_Pos) |
+                ((uint32_t)cfg->mode & 0x3U) |
+                ((cfg->frame == SPI_FRAME_16BIT) ? SPI_CR1_DFF : 0U) |
+                (cfg->lsb_first ? SPI_CR1_LSBFIRST : 0U);
+    SPIx->CR1 |= SPI_CR1_SPE;
+
+    /* 5. DMA streams */
+    spi_state[idx].spi = SPIx;
+    spi_state[idx].frame16 = (cfg->frame == SPI_FRAME_16BIT);
+    spi_state[idx].busy = 0U;
+    spi_state[idx].head = spi_state[idx].tail = spi_state[idx].active = NULL;
+
+    bare_dma_config(SPI_RX_STREAM(idx), &rx);
+    bare_dma_config(SPI_TX_STREAM(idx), &tx);
+    bare_dma_set_callback(SPI_RX_STREAM(idx), spi_dma_event, &spi_state[idx]);
+
+    return clk >> (br + 1U);
+}
+
+/**
+ * @brief  Configure a chip-select pin, deasserted
+ * @param  GPIOx Pointer to GPIO peripheral
+ * @param  pin   GPIO pin number
+ */
+void bare_spi_cs_init(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin)
+{
+    GPIOx->BSRR = (1UL << pin); // High before the pin becomes an output
+    bare_gpio_init(GPIOx, pin, GPIO_MODE_OUTPUT, GPIO_OTYPE_PP, GPIO_SPEED_HIGH, GPIO_NOPULL);
+}
+
+/**
+ * @brief  Polled full-duplex transfer
+ * @param  SPIx Pointer to SPI peripheral
+ * @param  tx   Data to send (NULL: all ones)
+ * @param  rx   Receive buffer (NULL: discard)
+ * @param  len  Number of frames
+ * @retval SPI_OK, SPI_ERR_OVR or SPI_ERR_TIMEOUT
+ *
+ * @note   Keeps one frame queued in DR behind the one being shifted, so SCK runs
+ *         back to back without inter-frame gaps. An interrupt that holds the loop off for
+ *         two frames overruns RX: the transfer is then abandoned and OVR cleared.
+ */
+SPI_Status_t bare_spi_transfer(SPI_TypeDef *SPIx, const void *tx, void *rx, uint16_t len)
+{
+    uint8_t frame16 = spi_state[spi_index(SPIx)].frame16;
+    uint16_t sent = 0U;
+    uint16_t recv = 0U;
+    uint32_t spin = SPI_POLL_SPIN;
+    SPI_Status_t status = SPI_OK;
+
+    while (recv < len)
+    {
+        uint32_t sr = SPIx->SR;
+
+        if (sr & SPI_SR_OVR)
+        {
+            status = SPI_ERR_OVR;
+            break;
+        }
+
+        if (--spin == 0U)
+        {
+            status = SPI_ERR_TIMEOUT;
+            break;
+        }
+
+        if ((sent < len) && ((uint16_t)(sent - recv) < 2U) && (sr & SPI_SR_TXE))
+        {
+            uint16_t v = 0xFFFFU;
+
+            if (tx != NULL)
+            {
+                v = frame16 ? ((const uint16_t *)tx)[sent] : ((const uint8_t *)tx)[sent];
+            }
+            SPIx->DR = v;
+            sent++;
+        }
+
+        if (sr & SPI_SR_RXNE)
+        {
+            uint16_t v = (uint16_t)SPIx->DR;
+
+            if (rx != NULL)
+            {
+                if (frame16)
+                {
+                    ((uint16_t *)rx)[recv] = v;
+                }
+                else
+                {
+                    ((uint8_t *)rx)[recv] = (uint8_t)v;
+                }
+            }
+            recv++;
+            spin = SPI_POLL_SPIN;
+        }
+    }
+
+    spin = SPI_POLL_SPIN;
+    while ((SPIx->SR & SPI_SR_BSY) && --spin)
+        ; // Last frame fully shifted out
+
+    if (status != SPI_OK)
+    {
+        (void)SPIx->DR; // DR then SR read clears OVR and drops a stale frame
+        (void)SPIx->SR;
+    }
+    else if (spin == 0U)
+    {
+        status = SPI_ERR_TIMEOUT;
+    }
+    return status;
+}
+
+/**
+ * @brief  Start a full-duplex DMA transfer
+ * @param  SPIx Pointer to SPI peripheral
+ * @param  tx   Data to send (NULL: all ones)
+ * @param  rx   Receive buffer (NULL: discard)
+ * @param  len  Number of frames
+ * @param  cb   Completion callback
+ * @param  ctx  Callback context
+ * @retval SPI_OK or SPI_BUSY
+ */
+SPI_Status_t bare_spi_transfer_dma(SPI_TypeDef *SPIx, const void *tx, void *rx, uint16_t len,
+                                   SPI_Callback_t cb, void *ctx)
+{
+    uint32_t idx = spi_index(SPIx);
+    spi_state_t *st = &spi_state[idx];
+    uint32_t primask = bare_irq_save();
+
+    if (st->busy)
+    {
+        bare_irq_restore(primask);
+        return SPI_BUSY;
+    }
+    st->busy = 1U;
+    bare_irq_restore(primask);
+
+    st->cb = cb;
+    st->ctx = ctx;
+    spi_dma_launch(idx, tx, rx, len);
+    return SPI_OK;
+}
+
+/**
+ * @brief  Append a transaction to the queue and start it if the bus is idle
+ * @param  SPIx Pointer to SPI peripheral
+ * @param  t    Transaction
+ */
+void bare_spi_submit(SPI_TypeDef *SPIx, SPI_Transaction_t *t)
+{
+    uint32_t idx = spi_index(SPIx);
+    spi_state_t *st = &spi_state[idx];
+    uint8_t start;
+    uint32_t primask;
+
+    t->next = NULL;
+
+    primask = bare_irq_save();
+    if (st->tail != NULL)
+    {
+        st->tail->next = t;
+    }
+    else
+    {
+        st->head = t;
+    }
+    st->tail = t;
+
+    start = !st->busy;
+    st->busy = 1U;
+    bare_irq_restore(primask);
+
+    if (start)
+    {
+        spi_queue_run(idx);
+    }
+}
+
+/**
+ * @brief  Check whether a transfer or queued transaction is running
+ * @param  SPIx Pointer to SPI peripheral
+ * @retval 1 if busy, 0 if idle
+ */
+uint8_t bare_spi_busy(SPI_TypeDef *SPIx)
+{
+    return spi_state[spi_index(SPIx)].busy;
+}
@@ -13,6 +13,78 @@
  #include "stm32f446re_addresses.h"  // Low-level register definitions
  #include "systick_registers.h"
  #include "bare_systick.h"
+ #include "bare_rcc.h"
+ #include "bare_reg.h"
+ 
+ /*******************************************************************************************
+  * @brief  Period last set through the API, kept as counts of the clock it was set at, so
+  *         every clock switch recomputes RVR from it rather than from the previous RVR
+  *******************************************************************************************/
+ static uint32_t systick_nominal_counts;  /*!< RVR + 1 as programmed */
+ static uint32_t systick_nominal_hz;      /*!< Counter clock at that time */
+ static SysTick_CSRClk_t systick_clk;     /*!< Source asked for in SysTick_Init() */
+ static SysTick_CSRClk_t systick_clk_now; /*!< Source in use, HCLK / 8 after a fallback */
+ static SysTick_Status_t systick_status = SYSTICK_OK;
+ 
+ /*******************************************************************************************
+  * @brief  Counter clock for a CSR clock source: HCLK, or HCLK / 8 for the external one
+  *******************************************************************************************/
+ static uint32_t systick_source_hz(SysTick_CSRClk_t clk)
+ {
+     uint32_t hclk = bare_rcc_get_hclk();
+ 
+     return (clk == SYSTICK_PROCESSOR_CLK) ? hclk : (hclk / 8U);
+ }
+ 
+ /*******************************************************************************************
+  * @brief  Record the period just programmed as the one to keep across clock switches
+  *******************************************************************************************/
+ static void systick_set_nominal(uint32_t reload)
+ {
+     systick_nominal_counts = reload + 1U;
+     systick_nominal_hz = systick_source_hz(systick_clk_now);
+     systick_status = SYSTICK_OK;
+ }
+ 
+ /*******************************************************************************************
+  * @brief  Clock change hook: recompute the reload so the tick period stays the same
+  *
+  * HCLK is preferred when it was the source asked for. A period too long for the 24-bit
+  * counter at HCLK falls back to HCLK / 8; one too long for that as well is cut to the
+  * longest period and reported by SysTick_Get_Status().
+  *
+  * @param phase      Before or after the switch
+  *******************************************************************************************/
+ static void systick_clock_hook(RCC_ClockPhase_t phase)
+ {
+     SysTick_CSRClk_t clk = systick_clk;
+     uint64_t counts;
+ 
+     if (phase != RCC_CLOCK_POST)
+     {
+         return;
+     }
+ 
+     counts = ((uint64_t)systick_nominal_counts * systick_source_hz(clk)) / systick_nominal_hz;
+     if ((counts > (SYSTICK_RVR_MAX + 1U)) && (clk == SYSTICK_PROCESSOR_CLK))
+     {
+         clk = SYSTICK_EXTERNAL_CLK; // HCLK / 8
+         counts = ((uint64_t)systick_nominal_counts * systick_source_hz(clk)) /
+                  systick_nominal_hz;
+     }
+ 
+     systick_status = SYSTICK_OK;
+     if (counts > (SYSTICK_RVR_MAX + 1U))
+     {
+         counts = SYSTICK_RVR_MAX + 1U;
+         systick_status = SYSTICK_ERR_RANGE;
+     }
+ 
+     SYSTICK->RVR = (uint32_t)(counts - 1U);
+     SYSTICK->CVR = 0;
+     bare_reg_modify(&SYSTICK->CSR, BARE_FIELD(SYSTICK_CSR_CLKSOURCE, clk));
+     systick_clk_now = clk;
+ }
  
  /*******************************************************************************************
   * @brief  Initialize the SysTick timer
@@ -33,13 +105,22 @@
                    SysTick_CALIBCLK_t impl, 
                    SysTick_CALIBFREQ_t calib)
  {
+     (void)impl; // Read-only CALIB information, nothing to configure
+     (void)calib;
+ 
+     systick_clk = clk;
+     systick_clk_now = clk;
+ 
      // Set the reload value and reset current value
      SysTick_Set_TIMER(reload);
  
-     // Configure SysTick Control and Status Register (CSR)
-     SYSTICK->CSR |= (clk << 2);  // Set CLKSOURCE bit to use processor clock
-     SYSTICK->CSR |= (interrupt << 1);  // Enable SysTick interrupt
-     SYSTICK->CSR |= (SYSTICK_ENABLE << 0);      // Enable SysTick timer
+     // Configure SysTick Control and Status Register (CSR) in one store; the only
+     // other bit (COUNTFLAG) is read-only, so nothing is lost by not reading first
+     bare_reg_write(&SYSTICK->CSR, BARE_FIELD(SYSTICK_CSR_CLKSOURCE, clk) |
+                                   BARE_FIELD(SYSTICK_CSR_TICKINT, interrupt) |
+                                   BARE_FIELD(SYSTICK_CSR_ENABLE, SYSTICK_ENABLE));
+ 
+     bare_rcc_register_hook(systick_clock_hook); // Keep the period across clock switches
  }
  
  /*******************************************************************************************
@@ -54,5 +135,16 @@
  {
      SYSTICK->RVR = reload;  // Set reload value
      SYSTICK->CVR = 0;       // Reset current value
+     systick_set_nominal(reload);
+ }
+ 
+ /*******************************************************************************************
+  * @brief  Whether the last clock switch could keep the programmed period
+  *
+  * @return SYSTICK_OK, or SYSTICK_ERR_RANGE when the period did not fit the counter
+  *******************************************************************************************/
+ SysTick_Status_t SysTick_Get_Status(void)
+ {
+     return systick_status;
  }
  
\ No newline at end of file
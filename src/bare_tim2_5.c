@@ -13,43 +13,40 @@
 #include "bare_tim2_5.h"
 #include "rcc_registers.h"
 #include "nvic_registers.h"
+#include "bare_rcc.h"
+#include "bare_periph.h"
+#include "bare_reg.h"
+#include "bare_bitband.h"
 #include <stdint.h>
 
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define TIM2_5_COUNT 4U
+
+/** Clock-derived setting of a timer, re-applied after a clock profile switch */
+typedef enum
+{
+    TIM2_5_CLK_NONE = 0x00U, /*!< Not programmed through set_rate/set_tick */
+    TIM2_5_CLK_RATE = 0x01U, /*!< Update rate (PSC and ARR) */
+    TIM2_5_CLK_TICK = 0x02U  /*!< Counter tick (PSC only) */
+} TIM2_5_ClkMode_t;
+
+static uint8_t tim_clk_mode[TIM2_5_COUNT];
+static uint32_t tim_clk_hz[TIM2_5_COUNT];
+
 /*******************************************************************************************
  *                               Internal Helper Functions
  *******************************************************************************************/
+
+static void tim_track_clock(TIM2_5_TypeDef *TIMx, TIM2_5_ClkMode_t mode, uint32_t hz);
+
 /**
- *
+ * @brief  Select the timer's alternate function on a pin (AF1 for TIM2, AF2 for TIM3-TIM5)
  */
 static void set_gpio_AFR(TIM2_5_TypeDef *TIMx, GPIO_TypeDef *GPIOx, GPIO_Pins_t pin)
 {
-    if (pin <= 7)
-    {
-        if (TIMx == TIM2)
-        {
-            GPIOx->AFRL &= ~(0xF << (4 * pin)); // Clear previous AF
-            GPIOx->AFRL |= (0x1 << (4 * pin));  // Set AF1 (TIM2_CH1)
-        }
-        else
-        {
-            GPIOx->AFRL &= ~(0xF << (4 * pin)); // Clear previous AF
-            GPIOx->AFRL |= (0x2 << (4 * pin));  // Set AF1 (TIM2_CH1)
-        }
-    }
-
-    if (pin > 7)
-    {
-        if (TIMx == TIM2)
-        {
-            GPIOx->AFRH &= ~(0xF << ((4 * pin) - 32)); // Clear previous AF
-            GPIOx->AFRH |= (0x1 << ((4 * pin) - 32));  // Set AF1
-        }
-        else
-        {
-            GPIOx->AFRH &= ~(0xF << ((4 * pin) - 32)); // Clear previous AF
-            GPIOx->AFRH |= (0x2 << ((4 * pin) - 32));  // Set AF2
-        }
-    }
+    bare_gpio_set_AF(GPIOx, pin, bare_periph(bare_periph_tim2_5(TIMx))->af);
 }
 
 /**
@@ -58,22 +55,7 @@ static void set_gpio_AFR(TIM2_5_TypeDef *TIMx, GPIO_TypeDef *GPIOx, GPIO_Pins_t
  */
 static void bare_tim2_5_enable_clock(TIM2_5_TypeDef *TIMx)
 {
-    if (TIMx == TIM2)
-    {
-        RCC->APB1ENR |= (1 << 0);
-    }
-    else if (TIMx == TIM3)
-    {
-        RCC->APB1ENR |= (1 << 1);
-    }
-    else if (TIMx == TIM4)
-    {
-        RCC->APB1ENR |= (1 << 2);
-    }
-    else if (TIMx == TIM5)
-    {
-        RCC->APB1ENR |= (1 << 3);
-    }
+    bare_periph_enable_clock(bare_periph_tim2_5(TIMx));
 }
 
 /**
@@ -82,46 +64,16 @@ static void bare_tim2_5_enable_clock(TIM2_5_TypeDef *TIMx)
  */
 static void bare_tim2_5_disable_clock(TIM2_5_TypeDef *TIMx)
 {
-    if (TIMx == TIM2)
-    {
-        RCC->APB1ENR &= ~(1 << 0);
-    }
-    else if (TIMx == TIM3)
-    {
-        RCC->APB1ENR &= ~(1 << 1);
-    }
-    else if (TIMx == TIM4)
-    {
-        RCC->APB1ENR &= ~(1 << 2);
-    }
-    else if (TIMx == TIM5)
-    {
-        RCC->APB1ENR &= ~(1 << 3);
-    }
+    bare_periph_disable_clock(bare_periph_tim2_5(TIMx));
 }
 
 /**
  * @brief  Enable the NVIC interrupt for the specified timer
  * @param  TIMx Pointer to the TIM2–TIM5 peripheral
  */
-static void bare_tim2_5_enable_interrupt(TIM2_5_TypeDef *TIMx)
+void bare_tim2_5_enable_interrupt(TIM2_5_TypeDef *TIMx)
 {
-    if (TIMx == TIM2)
-    {
-        NVIC->ISER[0] |= (1 << 28);
-    }
-    else if (TIMx == TIM3)
-    {
-        NVIC->ISER[0] |= (1 << 29);
-    }
-    else if (TIMx == TIM4)
-    {
-        NVIC->ISER[0] |= (1 << 30);
-    }
-    else if (TIMx == TIM5)
-    {
-        NVIC->ISER[1] |= (1 << (50 - 32)); // IRQ50 is in ISER1
-    }
+    bare_periph_enable_irq(bare_periph_tim2_5(TIMx), 0U);
 }
 
 /**
@@ -130,24 +82,67 @@ static void bare_tim2_5_enable_interrupt(TIM2_5_TypeDef *TIMx)
  */
 static void bare_tim2_5_disable_interrupt(TIM2_5_TypeDef *TIMx)
 {
-    if (TIMx == TIM2)
-    {
-        NVIC->ICER[0] |= (1 << 28);
-    }
-    else if (TIMx == TIM3)
-    {
-        NVIC->ICER[0] |= (1 << 29);
-    }
-    else if (TIMx == TIM4)
+    bare_periph_disable_irq(bare_periph_tim2_5(TIMx), 0U);
+}
+
+/**
+ * @brief  Clock change hook: re-derive PSC (and ARR for rate mode) of every timer in use
+ *
+ * The counter value survives the switch. TRGO is held on the counter enable level while
+ * UG reloads the prescaler, so a chained slave does not see a spurious update.
+ */
+static void tim_clock_hook(RCC_ClockPhase_t phase)
+{
+    uint32_t i;
+
+    if (phase != RCC_CLOCK_POST)
     {
-        NVIC->ICER[0] |= (1 << 30);
+        return;
     }
-    else if (TIMx == TIM5)
+
+    for (i = 0U; i < TIM2_5_COUNT; i++)
     {
-        NVIC->ICER[1] |= (1 << (50 - 32)); // IRQ50 is in ICER1
+        TIM2_5_TypeDef *TIMx = (TIM2_5_TypeDef *)(TIM2_BASE + (i << 10));
+        uint32_t cnt, cr2, arr;
+
+        if ((tim_clk_mode[i] == TIM2_5_CLK_NONE) ||
+            !bare_periph_clock_enabled((PERIPH_Id_t)(PERIPH_TIM2 + i)))
+        {
+            continue;
+        }
+
+        cnt = TIMx->CNT;
+        cr2 = TIMx->CR2;
+        arr = TIMx->ARR;
+        TIMx->CR2 = (cr2 & ~TIM_CR2_MMS_Msk) | ((uint32_t)TIM2_5_TRGO_ENABLE << TIM_CR2_MMS_Pos);
+
+        if (tim_clk_mode[i] == TIM2_5_CLK_RATE)
+        {
+            bare_tim2_5_set_rate(TIMx, tim_clk_hz[i]);
+        }
+        else
+        {
+            bare_tim2_5_set_tick(TIMx, tim_clk_hz[i]);
+            TIMx->ARR = arr; // Tick users own ARR
+        }
+
+        TIMx->CNT = (cnt <= TIMx->ARR) ? cnt : 0U;
+        TIMx->CR2 = cr2;
     }
 }
 
+/**
+ * @brief  Remember the clock-derived setting of a timer and follow clock switches
+ */
+static void tim_track_clock(TIM2_5_TypeDef *TIMx, TIM2_5_ClkMode_t mode, uint32_t hz)
+{
+    uint32_t i = bare_periph_tim2_5_index(TIMx);
+
+    tim_clk_mode[i] = (uint8_t)mode;
+    tim_clk_hz[i] = hz;
+    bare_rcc_register_hook(tim_clock_hook);
+}
+
 /*******************************************************************************************
  *                               Public API Functions
  *******************************************************************************************/
@@ -158,8 +153,9 @@ static void bare_tim2_5_disable_interrupt(TIM2_5_TypeDef *TIMx)
  */
 void bare_tim2_5_set(TIM2_5_TypeDef *TIMx)
 {
-    TIMx->PSC = TIM2_5_1KHZ_PRESCALER; // Set prescaler for 1 kHz timer tick
-    TIMx->ARR = TIM2_5_1SEC_ARR;       // Set ARR for 1 second interval
+    /* 1 s update period from the live timer clock: PSC and ARR together, since a fixed
+     * 1 kHz tick needs a prescaler above 0xFFFF once the timer clock exceeds 65.5 MHz */
+    (void)bare_tim2_5_set_rate(TIMx, 1U);
 }
 
 /**
@@ -171,8 +167,8 @@ void bare_tim2_5_start(TIM2_5_TypeDef *TIMx)
     bare_tim2_5_enable_clock(TIMx);     // Enable peripheral clock
     bare_tim2_5_enable_interrupt(TIMx); // Enable interrupt in NVIC
     bare_tim2_5_set(TIMx);              // Set prescaler and ARR
-    TIMx->DIER |= (1 << 0);             // Enable update interrupt
-    TIMx->CR1 |= (1 << 0);              // Enable counter
+    bare_bitband_set(&TIMx->DIER, TIM_DIER_UIE); // Enable update interrupt
+    bare_bitband_set(&TIMx->CR1, TIM_CR1_CEN);   // Enable counter
 }
 
 /**
@@ -181,7 +177,138 @@ void bare_tim2_5_start(TIM2_5_TypeDef *TIMx)
  */
 void bare_tim2_5_stop(TIM2_5_TypeDef *TIMx)
 {
-    TIMx->CR1 &= ~(1 << 0);              // Disable counter
+    bare_bitband_clear(&TIMx->CR1, TIM_CR1_CEN); // Disable counter
     bare_tim2_5_disable_interrupt(TIMx); // Disable NVIC interrupt
     bare_tim2_5_disable_clock(TIMx);     // Disable peripheral clock
 }
+
+/**
+ * @brief  Enable the timer clock and program PSC/ARR for an update rate
+ * @param  TIMx    Pointer to the TIM2–TIM5 peripheral
+ * @param  rate_hz Update event frequency in Hz
+ * @retval Achieved update frequency in Hz
+ */
+uint32_t bare_tim2_5_set_rate(TIM2_5_TypeDef *TIMx, uint32_t rate_hz)
+{
+    uint32_t clk = bare_rcc_get_timclk1();
+    uint32_t arr_max = ((TIMx == TIM2) || (TIMx == TIM5)) ? 0xFFFFFFFFUL : 0xFFFFUL;
+    uint32_t ticks, psc, arr;
+
+    if (rate_hz == 0U)
+    {
+        return 0U;
+    }
+
+    ticks = clk / rate_hz;
+    if (ticks == 0U)
+    {
+        ticks = 1U;
+    }
+
+    psc = (ticks - 1U) / arr_max;     // Smallest prescaler with ARR in range
+    arr = (ticks / (psc + 1U)) - 1U;
+
+    tim_track_clock(TIMx, TIM2_5_CLK_RATE, rate_hz);
+    bare_tim2_5_enable_clock(TIMx);
+    TIMx->PSC = psc;
+    TIMx->ARR = arr;
+    TIMx->EGR = (1 << 0);   // UG: load the new prescaler now
+    TIMx->SR = ~(1UL << 0); // Drop the UIF raised by UG
+
+    return clk / ((psc + 1U) * (arr + 1U));
+}
+
+/**
+ * @brief  Select the trigger output (TRGO) of a timer
+ * @param  TIMx Pointer to the TIM2–TIM5 peripheral
+ * @param  mode Signal routed to TRGO
+ */
+void bare_tim2_5_set_trgo(TIM2_5_TypeDef *TIMx, TIM2_5_TRGO_t mode)
+{
+    TIMx->CR2 = (TIMx->CR2 & ~(0x7UL << 4)) | ((uint32_t)(mode & 0x7U) << 4); // MMS
+}
+
+/**
+ * @brief  Start the counter only (no NVIC or update interrupt)
+ * @param  TIMx Pointer to the TIM2–TIM5 peripheral
+ */
+void bare_tim2_5_enable(TIM2_5_TypeDef *TIMx)
+{
+    bare_tim2_5_enable_clock(TIMx);
+    TIMx->CR1 |= (1 << 0); // Enable counter
+}
+
+/**
+ * @brief  Enable the timer clock and set the counter tick, counter free running at full width
+ * @param  TIMx    Pointer to the TIM2–TIM5 peripheral
+ * @param  tick_hz Counter tick frequency in Hz
+ * @retval Achieved tick frequency in Hz
+ */
+uint32_t bare_tim2_5_set_tick(TIM2_5_TypeDef *TIMx, uint32_t tick_hz)
+{
+    uint32_t clk = bare_rcc_get_timclk1();
+    uint32_t psc = (tick_hz == 0U) ? 0U : (clk / tick_hz);
+
+    psc = (psc == 0U) ? 0U : (psc - 1U);
+    if (psc > 0xFFFFU)
+    {
+        psc = 0xFFFFU;
+    }
+
+    tim_track_clock(TIMx, TIM2_5_CLK_TICK, tick_hz);
+    bare_tim2_5_enable_clock(TIMx);
+    TIMx->PSC = psc;
+    TIMx->ARR = ((TIMx == TIM2) || (TIMx == TIM5)) ? 0xFFFFFFFFUL : 0xFFFFUL;
+    TIMx->EGR = (1 << 0);   // UG: load the new prescaler now
+    TIMx->SR = ~(1UL << 0); // Drop the UIF raised by UG
+
+    return clk / (psc + 1U);
+}
+
+/**
+ * @brief  Route a timer channel to a pin (alternate function AF1 for TIM2, AF2 for TIM3-TIM5)
+ * @param  TIMx  Pointer to the TIM2–TIM5 peripheral
+ * @param  GPIOx Pointer to GPIO peripheral
+ * @param  pin   GPIO pin number
+ */
+void bare_tim2_5_set_pin(TIM2_5_TypeDef *TIMx, GPIO_TypeDef *GPIOx, GPIO_Pins_t pin)
+{
+    bare_gpio_AF(GPIOx, pin);
+    set_gpio_AFR(TIMx, GPIOx, pin);
+}
+
+/**
+ * @brief  Save PSC, ARR, CR1 and the clock tracking of a timer, stop tracking it
+ * @param  TIMx  Pointer to the TIM2–TIM5 peripheral
+ * @param  saved Receives the time base
+ */
+void bare_tim2_5_save(TIM2_5_TypeDef *TIMx, TIM2_5_Saved_t *saved)
+{
+    uint32_t i = bare_periph_tim2_5_index(TIMx);
+
+    saved->psc = TIMx->PSC;
+    saved->arr = TIMx->ARR;
+    saved->cr1 = TIMx->CR1;
+    saved->clk_mode = tim_clk_mode[i];
+    saved->clk_hz = tim_clk_hz[i];
+    tim_clk_mode[i] = (uint8_t)TIM2_5_CLK_NONE; // The borrower owns PSC/ARR meanwhile
+}
+
+/**
+ * @brief  Put back a time base saved by bare_tim2_5_save()
+ * @param  TIMx  Pointer to the TIM2–TIM5 peripheral
+ * @param  saved Time base
+ */
+void bare_tim2_5_restore(TIM2_5_TypeDef *TIMx, const TIM2_5_Saved_t *saved)
+{
+    uint32_t i = bare_periph_tim2_5_index(TIMx);
+
+    TIMx->CR1 = (saved->cr1 & ~TIM_CR1_CEN) | TIM_CR1_URS; // UG below raises no UIF
+    TIMx->PSC = saved->psc;
+    TIMx->ARR = saved->arr;
+    TIMx->EGR = TIM_EGR_UG; // Load the prescaler now
+    TIMx->CR1 = saved->cr1;
+
+    tim_clk_mode[i] = saved->clk_mode;
+    tim_clk_hz[i] = saved->clk_hz;
+}
@@ -0,0 +1,194 @@
+/*******************************************************************************************
+ * @file    bare_timchain.c
+ * @author  ka5j
+ * @brief   TIM2-TIM5 master/slave chaining implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    In a cascade the high timer is clocked by the low timer's update through TRGO.
+ *          The slave sees the trigger a few timer clocks after the low counter wraps, which
+ *          the combined read has to tolerate.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "tim2_5_registers.h"
+#include "bare_timchain.h"
+#include "bare_tim2_5.h"
+#include "bare_periph.h"
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define TIMCHAIN_TIMERS 4U
+#define TIMCHAIN_NO_ITR 0xFFU
+
+/** ITR index of a master (column) as seen by a slave (row), TIM2..TIM5 */
+static const uint8_t timchain_itr[TIMCHAIN_TIMERS][TIMCHAIN_TIMERS] = {
+    /*            TIM2             TIM3             TIM4             TIM5 */
+    /* TIM2 */ {TIMCHAIN_NO_ITR, 2U,              3U,              TIMCHAIN_NO_ITR},
+    /* TIM3 */ {1U,              TIMCHAIN_NO_ITR, 3U,              2U},
+    /* TIM4 */ {1U,              2U,              TIMCHAIN_NO_ITR, TIMCHAIN_NO_ITR},
+    /* TIM5 */ {0U,              1U,              2U,              TIMCHAIN_NO_ITR},
+};
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Internal trigger of the master on the slave, or TIMCHAIN_NO_ITR
+ */
+static uint8_t timchain_route(TIM2_5_TypeDef *master, TIM2_5_TypeDef *slave)
+{
+    return timchain_itr[bare_periph_tim2_5_index(slave)][bare_periph_tim2_5_index(master)];
+}
+
+/**
+ * @brief  Program the slave mode controller
+ */
+static void timchain_set_slave(TIM2_5_TypeDef *slave, uint8_t itr, uint32_t sms)
+{
+    /* Change TS with SMS disabled so a stale trigger is not acted upon */
+    slave->SMCR &= ~(TIM_SMCR_SMS_Msk | TIM_SMCR_TS_Msk);
+    slave->SMCR |= (uint32_t)itr << TIM_SMCR_TS_Pos;
+    slave->SMCR |= sms;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Connect a slave timer to a master timer
+ * @param  master Timer producing TRGO
+ * @param  slave  Timer reacting to it
+ * @param  link   Slave behaviour
+ * @retval TIMCHAIN_OK or TIMCHAIN_ERR_ROUTE
+ */
+TIMCHAIN_Status_t bare_timchain_link(TIM2_5_TypeDef *master, TIM2_5_TypeDef *slave,
+                                     TIMCHAIN_Link_t link)
+{
+    uint8_t itr = timchain_route(master, slave);
+
+    if (itr == TIMCHAIN_NO_ITR)
+    {
+        return TIMCHAIN_ERR_ROUTE;
+    }
+
+    switch (link)
+    {
+    case TIMCHAIN_CLOCK:
+        bare_tim2_5_set_trgo(master, TIM2_5_TRGO_UPDATE);
+        timchain_set_slave(slave, itr, TIM_SMS_EXTCLK1);
+        break;
+    case TIMCHAIN_START:
+        bare_tim2_5_set_trgo(master, TIM2_5_TRGO_ENABLE);
+        timchain_set_slave(slave, itr, TIM_SMS_TRIGGER);
+        break;
+    case TIMCHAIN_GATE:
+        bare_tim2_5_set_trgo(master, TIM2_5_TRGO_ENABLE);
+        timchain_set_slave(slave, itr, TIM_SMS_GATED);
+        break;
+    default:
+        bare_tim2_5_set_trgo(master, TIM2_5_TRGO_UPDATE);
+        timchain_set_slave(slave, itr, TIM_SMS_RESET);
+        break;
+    }
+
+    return TIMCHAIN_OK;
+}
+
+/**
+ * @brief  Build and start a cascaded free-running counter
+ * @param  c       Counter object to fill
+ * @param  low     Ticking timer
+ * @param  high    Overflow counter
+ * @param  tick_hz Requested tick
+ * @retval TIMCHAIN_OK or TIMCHAIN_ERR_ROUTE
+ */
+TIMCHAIN_Status_t bare_timchain_counter_init(TIMCHAIN_Counter_t *c, TIM2_5_TypeDef *low,
+                                             TIM2_5_TypeDef *high, uint32_t tick_hz)
+{
+    if (timchain_route(low, high) == TIMCHAIN_NO_ITR)
+    {
+        return TIMCHAIN_ERR_ROUTE;
+    }
+
+    c->low = low;
+    c->high = high;
+    c->low_bits = ((low == TIM2) || (low == TIM5)) ? 32U : 16U;
+
+    /* Full-width ARR on both; the high timer counts raw TRGO edges (PSC = 0) */
+    c->tick_hz = bare_tim2_5_set_tick(low, tick_hz);
+    bare_tim2_5_set_tick(high, 0U);
+    low->CR1 &= ~TIM_CR1_CEN;
+    low->CNT = 0U;
+    high->CNT = 0U;
+
+    bare_timchain_link(low, high, TIMCHAIN_CLOCK);
+
+    /* Slave first, so the first overflow of the low timer is not lost */
+    high->CR1 |= TIM_CR1_CEN;
+    low->CR1 |= TIM_CR1_CEN;
+
+    return TIMCHAIN_OK;
+}
+
+/**
+ * @brief  Read the combined counter
+ * @param  c Counter object
+ * @retval Ticks since the counter was started
+ */
+uint64_t bare_timchain_read(const TIMCHAIN_Counter_t *c)
+{
+    uint32_t h1;
+    uint32_t h2;
+    uint32_t lo;
+
+    /*
+     * The high word is sampled on both sides of the low word. The closing sample is taken
+     * two bus accesses after the low one, which outlasts the few timer clocks the slave
+     * needs to register a wrap, so a low word of 0 cannot be paired with a stale high word.
+     */
+    do
+    {
+        h1 = c->high->CNT;
+        lo = c->low->CNT;
+        (void)c->high->CNT;
+        h2 = c->high->CNT;
+    } while (h1 != h2);
+
+    return ((uint64_t)h2 << c->low_bits) | lo;
+}
+
+/**
+ * @brief  Start several timers on the same timer clock edge
+ * @param  master Timer whose enable starts the others
+ * @param  slaves Timers to start with it
+ * @param  count  Number of slaves
+ * @retval TIMCHAIN_OK or TIMCHAIN_ERR_ROUTE
+ */
+TIMCHAIN_Status_t bare_timchain_sync_start(TIM2_5_TypeDef *master, TIM2_5_TypeDef *const *slaves,
+                                           uint8_t count)
+{
+    uint8_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        if (timchain_route(master, slaves[i]) == TIMCHAIN_NO_ITR)
+        {
+            return TIMCHAIN_ERR_ROUTE;
+        }
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        bare_timchain_link(master, slaves[i], TIMCHAIN_START);
+    }
+
+    /* MSM delays the master by the trigger resynchronization the slaves go through */
+    master->SMCR |= TIM_SMCR_MSM;
+    master->CR1 |= TIM_CR1_CEN;
+
+    return TIMCHAIN_OK;
+}
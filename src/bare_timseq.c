@@ -0,0 +1,152 @@
+/*******************************************************************************************
+ * @file    bare_timseq.c
+ * @author  ka5j
+ * @brief   TIM2-TIM5 register frame sequencer implementation
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    On each update event with UDE set, the timer issues DBL + 1 DMA requests in a
+ *          row; every access to DMAR is redirected to the next register from DBA. The DMA
+ *          stream itself is a plain word-wide memory-to-peripheral transfer into DMAR.
+ *******************************************************************************************/
+
+#include "stm32f446re_addresses.h"
+#include "tim2_5_registers.h"
+#include "bare_timseq.h"
+#include "bare_dma.h"
+#include "bare_periph.h"
+#include "bare_bitband.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define TIMSEQ_TIMERS 4U
+
+/** Runtime state of each timer */
+typedef struct
+{
+    TIM2_5_TypeDef *tim;
+    const TIMSEQ_Config_t *cfg;
+} timseq_state_t;
+
+static timseq_state_t timseq_state[TIMSEQ_TIMERS];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  DMA event: a one-shot sequence has written its last frame
+ */
+static void timseq_dma_event(uint32_t events, void *ctx)
+{
+    timseq_state_t *st = (timseq_state_t *)ctx;
+
+    if (events & (DMA_EVENT_COMPLETE | DMA_EVENT_ERROR))
+    {
+        bare_bitband_clear(&st->tim->DIER, TIM_DIER_UDE);
+        if (st->cfg->done != NULL)
+        {
+            st->cfg->done(st->cfg->ctx);
+        }
+    }
+}
+
+/**
+ * @brief  Preload the compare registers a frame writes, on output channels only
+ * @note   On an input channel bit 3 of the CCMR byte is ICxPSC, not OCxPE.
+ */
+static void timseq_preload_ccr(TIM2_5_TypeDef *TIMx, const TIMSEQ_Config_t *cfg)
+{
+    uint32_t ch;
+
+    for (ch = 0U; ch < 4U; ch++)
+    {
+        uint32_t reg = (uint32_t)TIMSEQ_REG_CCR1 + ch;
+        volatile uint32_t *ccmr = (ch < 2U) ? &TIMx->CCMR1 : &TIMx->CCMR2;
+        uint32_t shift = (ch & 1U) * 8U;
+
+        if ((reg >= (uint32_t)cfg->first) && (reg < ((uint32_t)cfg->first + cfg->regs)) &&
+            !((*ccmr >> shift) & TIM_CCMR_CCS_Msk))
+        {
+            *ccmr |= TIM_CCMR_OCPE << shift;
+        }
+    }
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Start writing frames on each update event
+ * @param  TIMx Pointer to timer peripheral
+ * @param  cfg  Sequence
+ */
+void bare_timseq_start(TIM2_5_TypeDef *TIMx, const TIMSEQ_Config_t *cfg)
+{
+    uint32_t idx = bare_periph_tim2_5_index(TIMx);
+    DMA_Stream_TypeDef *stream = bare_periph_dma_stream(bare_periph_tim2_5(TIMx), 1U);
+    DMA_Config_t dma = {
+        .channel = bare_periph_dma_channel(bare_periph_tim2_5(TIMx), 1U),
+        .dir = DMA_DIR_MEM_TO_PERIPH,
+        .psize = DMA_SIZE_WORD,
+        .msize = DMA_SIZE_WORD,
+        .pinc = 0U,
+        .minc = 1U,
+        .circular = cfg->loop,
+        .priority = DMA_PRIORITY_HIGH,
+        .fifo = DMA_FIFO_DIRECT,
+        .complete_irq = !cfg->loop,
+    };
+
+    timseq_state[idx].tim = TIMx;
+    timseq_state[idx].cfg = cfg;
+
+    TIMx->DIER &= ~TIM_DIER_UDE;
+    bare_dma_stop(stream);
+
+    /* Preload so a frame only lands at the next update, all registers at once */
+    TIMx->CR1 |= TIM_CR1_ARPE;
+    timseq_preload_ccr(TIMx, cfg);
+
+    TIMx->DCR = ((uint32_t)cfg->first << TIM_DCR_DBA_Pos) |
+                ((uint32_t)(cfg->regs - 1U) << TIM_DCR_DBL_Pos);
+
+    bare_dma_config(stream, &dma);
+    bare_dma_set_callback(stream, cfg->loop ? NULL : timseq_dma_event, &timseq_state[idx]);
+    bare_dma_start(stream, (uint32_t)&TIMx->DMAR, (uint32_t)cfg->table, 0U,
+                   (uint16_t)(cfg->frames * cfg->regs));
+
+    TIMx->DIER |= TIM_DIER_UDE;
+}
+
+/**
+ * @brief  Stop the sequence
+ * @param  TIMx Pointer to timer peripheral
+ */
+void bare_timseq_stop(TIM2_5_TypeDef *TIMx)
+{
+    TIMx->DIER &= ~TIM_DIER_UDE;
+    bare_dma_stop(bare_periph_dma_stream(bare_periph_tim2_5(TIMx), 1U));
+}
+
+/**
+ * @brief  Index of the frame being written next
+ * @param  TIMx Pointer to timer peripheral
+ * @retval Frame index
+ */
+uint16_t bare_timseq_position(TIM2_5_TypeDef *TIMx)
+{
+    uint32_t idx = bare_periph_tim2_5_index(TIMx);
+    const TIMSEQ_Config_t *cfg = timseq_state[idx].cfg;
+    uint32_t left = bare_dma_remaining(bare_periph_dma_stream(bare_periph_tim2_5(TIMx), 1U));
+    uint32_t total = (uint32_t)cfg->frames * cfg->regs;
+
+    if (!cfg->loop && !(TIMx->DIER & TIM_DIER_UDE))
+    {
+        return cfg->frames;
+    }
+    return (uint16_t)((total - left) / cfg->regs);
+}
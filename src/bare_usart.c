@@ -15,13 +15,63 @@
 #include "bare_gpio.h"
 #include "rcc_registers.h"
 #include "usart_registers.h" // Must define USART2 base address and register map
+#include "nvic_registers.h"
+#include "bare_rcc.h"
+#include "bare_periph.h"
+#include "bare_reg.h"
+#include "bare_bitband.h"
+#include "bare_util.h"
+#include <stddef.h>
 
 /*******************************************************************************************
  *                                Configuration Constants
  *******************************************************************************************/
-#define PCLK1_FREQ 16000000UL                                   /*!< APB1 peripheral clock frequency (Hz) */
-#define USART_BAUD 115200UL                                     /*!< Desired USART baud rate */
-#define USARTDIV ((PCLK1_FREQ + (USART_BAUD / 2)) / USART_BAUD) /*!< Rounded divisor */
+#define USART_BAUD 115200UL /*!< Default USART baud rate */
+
+/*******************************************************************************************
+ *                                  Internal State
+ *******************************************************************************************/
+static USART_RxCallback_t usart_rx_callback; /*!< Per-byte receive hook (interrupt mode) */
+static uint32_t usart_baud = USART_BAUD;     /*!< Baud rate BRR is derived from */
+
+static uint8_t usart_tx_ring[USART_TX_RING_SIZE]; /*!< Bytes queued by bare_usart_write() */
+static volatile uint32_t usart_tx_head;           /*!< Written by the writer */
+static volatile uint32_t usart_tx_tail;           /*!< Written by the interrupt */
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Rounded BRR divisor (oversampling by 16) for the live PCLK1
+ */
+static uint32_t usart_brr(void)
+{
+    return (bare_rcc_get_pclk1() + (usart_baud / 2U)) / usart_baud;
+}
+
+/**
+ * @brief  Clock change hook: let the last frame leave, then re-derive BRR
+ */
+static void usart_clock_hook(RCC_ClockPhase_t phase)
+{
+    if (!(USART2->CR1 & (1 << 13))) // UE
+    {
+        return;
+    }
+
+    if (phase == RCC_CLOCK_PRE)
+    {
+        while (!(USART2->SR & (1 << 6)))
+            ; // Wait for TC (transmission complete)
+    }
+    else
+    {
+        bare_reg_modify(&USART2->CR1, BARE_FIELD(USART_CR1_UE, 0));
+        USART2->BRR = usart_brr();
+        bare_reg_modify(&USART2->CR1, BARE_FIELD(USART_CR1_UE, 1));
+    }
+}
 
 /*******************************************************************************************
  *                               Public API Functions
@@ -37,38 +87,39 @@ void bare_usart_init(void)
 {
     /* 1. Enable clocks for GPIOA and USART2 */
     bare_gpio_enable_clock(GPIOA);
-    RCC->APB1ENR |= (1 << 17); // USART2 clock enable
+    bare_periph_enable_clock(PERIPH_USART2);
 
     /* 2. Configure PA2 and PA3 to alternate function mode (AF7 = USART2) */
     bare_gpio_AF(GPIOA, 2);
     bare_gpio_AF(GPIOA, 3);
 
-    GPIOA->AFRL &= ~(0xF << 8); // Clear AF bits for PA2
-    GPIOA->AFRL |= (0x7 << 8);  // AF7 for PA2 (USART2_TX)
-
-    GPIOA->AFRL &= ~(0xF << 12); // Clear AF bits for PA3
-    GPIOA->AFRL |= (0x7 << 12);  // AF7 for PA3 (USART2_RX)
+    bare_gpio_set_AF(GPIOA, GPIO_PIN2, bare_periph(PERIPH_USART2)->af); // AF7 USART2_TX
+    bare_gpio_set_AF(GPIOA, GPIO_PIN3, bare_periph(PERIPH_USART2)->af); // AF7 USART2_RX
 
     /* 3. Disable USART before configuration */
-    USART2->CR1 &= ~(1 << 13); // UE = 0
+    bare_reg_modify(&USART2->CR1, BARE_FIELD(USART_CR1_UE, 0));
 
     /* 4. Set baud rate register (BRR) */
-    USART2->BRR = USARTDIV;
+    USART2->BRR = usart_brr();
+    bare_rcc_register_hook(usart_clock_hook); // Follow clock profile switches
 
-    /* 5. Enable transmitter and receiver */
-    USART2->CR1 |= (1 << 3); // TE = 1 (transmit enable)
-    USART2->CR1 |= (1 << 2); // RE = 1 (receive enable)
-
-    /* 6. Enable USART2 */
-    USART2->CR1 |= (1 << 13); // UE = 1
+    /* 5. 8N1, oversampling by 16, enable transmitter, receiver and USART2 in one RMW */
+    bare_reg_modify(&USART2->CR1, BARE_FIELD(USART_CR1_M, 0) |
+                                  BARE_FIELD(USART_CR1_PCE, 0) |
+                                  BARE_FIELD(USART_CR1_OVER8, 0) |
+                                  BARE_FIELD(USART_CR1_TE, 1) |
+                                  BARE_FIELD(USART_CR1_RE, 1) |
+                                  BARE_FIELD(USART_CR1_UE, 1));
 }
 
 /**
  * @brief  Send a single character over USART2.
  * @param  c: character to send
  */
-void uart_send_char(char c)
+void bare_usart_send_char(char c)
 {
+    while (usart_tx_tail != usart_tx_head)
+        ; // Queued bytes go first
     while (!(USART2->SR & (1 << 7)))
         ; // Wait for TXE (transmit buffer empty)
     USART2->DR = (uint8_t)c;
@@ -78,21 +129,155 @@ void uart_send_char(char c)
  * @brief  Send a null-terminated string over USART2.
  * @param  str: pointer to null-terminated character array
  */
-void uart_send_string(const char *str)
+void bare_usart_send_string(const char *str)
 {
     while (*str)
     {
-        uart_send_char(*str++);
+        bare_usart_send_char(*str++);
     }
 }
 
+/**
+ * @brief  Queue bytes for interrupt-driven transmission without waiting.
+ * @param  data: bytes to send
+ * @param  len: number of bytes
+ * @retval Number of bytes queued (less than len when the ring is full)
+ */
+uint16_t bare_usart_write(const void *data, uint16_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    uint32_t head = usart_tx_head;
+    uint32_t room = USART_TX_RING_SIZE - (head - usart_tx_tail);
+    uint16_t n = (len < room) ? len : (uint16_t)room;
+    uint16_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        usart_tx_ring[(head + i) & (USART_TX_RING_SIZE - 1U)] = src[i];
+    }
+
+    if (n != 0U)
+    {
+        BARE_BARRIER(); // Bytes stored before they are published
+        usart_tx_head = head + n;
+        bare_bitband_set(&USART2->CR1, USART_CR1_TXEIE);
+        bare_periph_enable_irq(PERIPH_USART2, 0U);
+    }
+    return n;
+}
+
+/**
+ * @brief  Free space in the transmit ring.
+ * @retval Bytes bare_usart_write() can accept right now
+ */
+uint16_t bare_usart_tx_free(void)
+{
+    return (uint16_t)(USART_TX_RING_SIZE - (usart_tx_head - usart_tx_tail));
+}
+
+/**
+ * @brief  Change the baud rate; kept across clock profile switches.
+ * @param  baud: rate in bit/s, as seen by the local clock
+ * @retval Rate PCLK1 / BRR actually programmed, 0 if out of range (BRR below 16)
+ *
+ * @note   Waits for the frame in progress to leave. Bytes still queued in the transmit
+ *         ring are sent at the new rate.
+ */
+uint32_t bare_usart_set_baud(uint32_t baud)
+{
+    uint32_t pclk1 = bare_rcc_get_pclk1();
+
+    if ((baud == 0U) || ((pclk1 / baud) < 16U))
+    {
+        return 0U;
+    }
+
+    usart_baud = baud;
+    usart_clock_hook(RCC_CLOCK_PRE);  // Let the current frame leave
+    usart_clock_hook(RCC_CLOCK_POST); // Reprogram BRR (only once initialized)
+
+    return pclk1 / usart_brr();
+}
+
+/**
+ * @brief  Configured baud rate.
+ * @retval Rate set by bare_usart_set_baud(), 115200 by default
+ */
+uint32_t bare_usart_get_baud(void)
+{
+    return usart_baud;
+}
+
 /**
  * @brief  Receive a single character via USART2.
  * @retval The received character
  */
-char uart_read_char(void)
+char bare_usart_read_char(void)
 {
     while (!(USART2->SR & (1 << 5)))
         ; // Wait for RXNE (receive buffer not empty)
     return (char)(USART2->DR & 0xFF);
 }
+
+/**
+ * @brief  Deliver every received byte to a callback from the USART2 interrupt.
+ * @param  cb: callback executed in interrupt context, NULL returns to polling mode
+ *
+ * @note   Overrun errors are cleared by the SR-then-DR read sequence of the handler.
+ */
+void bare_usart_set_rx_callback(USART_RxCallback_t cb)
+{
+    usart_rx_callback = cb;
+
+    if (cb != NULL)
+    {
+        bare_bitband_set(&USART2->CR1, USART_CR1_RXNEIE); // No lost update vs. the IRQ
+        bare_periph_enable_irq(PERIPH_USART2, 0U);
+    }
+    else
+    {
+        bare_bitband_clear(&USART2->CR1, USART_CR1_RXNEIE);
+        if (!(USART2->CR1 & USART_CR1_TXEIE))
+        {
+            bare_periph_disable_irq(PERIPH_USART2, 0U);
+        }
+    }
+}
+
+/*******************************************************************************************
+ *                               Interrupt Service Routines
+ *******************************************************************************************/
+
+/**
+ * @brief  USART2 global interrupt: forward received bytes to the registered callback and
+ *         feed the transmit ring into DR.
+ */
+void USART2_IRQHandler(void)
+{
+    uint32_t sr = USART2->SR;
+
+    if ((sr & USART_SR_TXE) && (USART2->CR1 & USART_CR1_TXEIE))
+    {
+        uint32_t tail = usart_tx_tail;
+
+        if (tail != usart_tx_head)
+        {
+            USART2->DR = usart_tx_ring[tail & (USART_TX_RING_SIZE - 1U)];
+            usart_tx_tail = tail + 1U;
+        }
+        else
+        {
+            bare_bitband_clear(&USART2->CR1, USART_CR1_TXEIE); // Ring drained
+        }
+    }
+
+    if ((sr & ((1 << 5) | (1 << 3))) && (USART2->CR1 & USART_CR1_RXNEIE)) // RXNE or ORE
+    {
+        uint8_t byte = (uint8_t)(USART2->DR & 0xFF);
+
+        if (usart_rx_callback != NULL)
+        {
+            usart_rx_callback(byte);
+        }
+    }
+}
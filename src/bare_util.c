@@ -0,0 +1,46 @@
+/*******************************************************************************************
+ * @file    bare_util.c
+ * @author  ka5j
+ * @brief   Shared driver helpers: decimal output over USART2
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Used by the text dumps of the profiler, logic analyzer, control loop runner and
+ *          clock calibration. The console has its own non-blocking output and only shares
+ *          the formatter.
+ *******************************************************************************************/
+
+#include "bare_util.h"
+#include "bare_usart.h"
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Write an unsigned decimal number over USART2
+ * @param  v: Value
+ */
+void bare_print_u32(uint32_t v)
+{
+    char buf[BARE_U32_CHARS];
+
+    bare_usart_send_string(bare_fmt_u32(buf, v));
+}
+
+/**
+ * @brief  Write a signed decimal number over USART2
+ * @param  v: Value
+ */
+void bare_print_i32(int32_t v)
+{
+    if (v < 0)
+    {
+        bare_usart_send_char('-');
+        bare_print_u32(0U - (uint32_t)v);
+    }
+    else
+    {
+        bare_print_u32((uint32_t)v);
+    }
+}
@@ -0,0 +1,256 @@
+/*******************************************************************************************
+ * @file    host_flash.c
+ * @author  ka5j
+ * @brief   Host test support: bare_flash_* backed by a file image of the F446 flash
+ * @version 1.0
+ * @date    2026-10-19
+ *******************************************************************************************/
+
+#define _GNU_SOURCE
+#include "host_mmio.h"
+#include "host_flash.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE MAP_FIXED
+#endif
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define HOST_FLASH_BASE 0x08000000UL
+#define HOST_ERASE_POLLS 3U /*!< erase_poll() calls answered FLASH_BUSY */
+#define HOST_NO_TEAR 0xFFFFFFFFUL /*!< Also: no program failure armed */
+
+static uint8_t *host_image;
+static int8_t host_erasing = -1;
+static uint32_t host_erase_polls;
+static uint32_t host_tear = HOST_NO_TEAR;
+static uint32_t host_fail = HOST_NO_TEAR;
+static uint8_t host_off;
+
+static const uint32_t host_sector_kb[FLASH_SECTORS] = {16U, 16U, 16U, 16U, 64U, 128U, 128U,
+                                                       128U};
+
+/*******************************************************************************************
+ *                               Test Control Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Map an image file, creating it erased if needed
+ */
+void host_flash_open(const char *path)
+{
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    struct stat st;
+    void *p;
+
+    if ((fd < 0) || (fstat(fd, &st) != 0))
+    {
+        perror(path);
+        exit(2);
+    }
+    if (st.st_size != (off_t)HOST_FLASH_SIZE)
+    {
+        static uint8_t erased[4096];
+        uint32_t off;
+
+        memset(erased, 0xFF, sizeof(erased));
+        for (off = 0U; off < HOST_FLASH_SIZE; off += sizeof(erased))
+        {
+            if (pwrite(fd, erased, sizeof(erased), (off_t)off) != (ssize_t)sizeof(erased))
+            {
+                perror(path);
+                exit(2);
+            }
+        }
+    }
+
+    p = mmap((void *)HOST_FLASH_BASE, HOST_FLASH_SIZE, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+    close(fd);
+    if (p != (void *)HOST_FLASH_BASE)
+    {
+        fprintf(stderr, "host_flash: cannot map %s at 0x%08lx\n", path, HOST_FLASH_BASE);
+        exit(2);
+    }
+    host_image = (uint8_t *)p;
+    host_erasing = -1;
+    host_tear = HOST_NO_TEAR;
+    host_fail = HOST_NO_TEAR;
+    host_off = 0U;
+}
+
+/**
+ * @brief  Unmap the image
+ */
+void host_flash_close(void)
+{
+    if (host_image != NULL)
+    {
+        munmap(host_image, HOST_FLASH_SIZE);
+        host_image = NULL;
+    }
+}
+
+/**
+ * @brief  Cut the power after a number of further programmed words
+ */
+void host_flash_tear_after(uint32_t words)
+{
+    host_tear = words;
+}
+
+/**
+ * @brief  Fail one program operation after a number of further programmed words
+ */
+void host_flash_fail_after(uint32_t words)
+{
+    host_fail = words;
+}
+
+/**
+ * @brief  Check whether a torn write cut the power
+ */
+uint8_t host_flash_powered_off(void)
+{
+    return host_off;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+uintptr_t bare_flash_sector_addr(uint8_t sector)
+{
+    uintptr_t addr = HOST_FLASH_BASE;
+    uint8_t s;
+
+    for (s = 0U; (s < sector) && (s < FLASH_SECTORS); s++)
+    {
+        addr += host_sector_kb[s] * 1024U;
+    }
+    return addr;
+}
+
+uint32_t bare_flash_sector_size(uint8_t sector)
+{
+    return (sector < FLASH_SECTORS) ? host_sector_kb[sector] * 1024U : 0U;
+}
+
+FLASH_Status_t bare_flash_program(uintptr_t addr, const uint32_t *words, uint32_t n)
+{
+    volatile uint32_t *dst = (volatile uint32_t *)addr;
+    uint32_t i;
+
+    if ((addr & 3U) || (addr < HOST_FLASH_BASE) ||
+        ((addr + 4U * (uintptr_t)n) > (HOST_FLASH_BASE + HOST_FLASH_SIZE)))
+    {
+        return FLASH_ERR_PARAM;
+    }
+    while (bare_flash_erase_poll() == FLASH_BUSY)
+        ; // A background erase must finish first
+    if (host_off)
+    {
+        return FLASH_ERR_PROG;
+    }
+
+    for (i = 0U; i < n; i++)
+    {
+        if (host_tear == 0U)
+        {
+            dst[i] &= words[i] | 0xFFFF0000UL; // Power lost halfway through the word
+            host_tear = HOST_NO_TEAR;
+            host_off = 1U;
+            return FLASH_ERR_PROG;
+        }
+        if (host_fail == 0U)
+        {
+            host_fail = HOST_NO_TEAR; // Program error: this word and the rest left erased
+            return FLASH_ERR_PROG;
+        }
+        if (host_tear != HOST_NO_TEAR)
+        {
+            host_tear--;
+        }
+        if (host_fail != HOST_NO_TEAR)
+        {
+            host_fail--;
+        }
+        dst[i] &= words[i]; // Programming only clears bits
+    }
+    for (i = 0U; i < n; i++)
+    {
+        if (dst[i] != words[i])
+        {
+            return FLASH_ERR_VERIFY;
+        }
+    }
+    return FLASH_OK;
+}
+
+FLASH_Status_t bare_flash_erase_start(uint8_t sector)
+{
+    if (sector >= FLASH_SECTORS)
+    {
+        return FLASH_ERR_PARAM;
+    }
+    if (host_erasing >= 0)
+    {
+        return FLASH_BUSY;
+    }
+    if (host_off)
+    {
+        return FLASH_ERR_PROG;
+    }
+    host_erasing = (int8_t)sector;
+    host_erase_polls = 0U;
+    return FLASH_OK;
+}
+
+FLASH_Status_t bare_flash_erase_poll(void)
+{
+    if (host_erasing < 0)
+    {
+        return FLASH_OK;
+    }
+    if (host_off)
+    {
+        return FLASH_ERR_PROG; // Power lost: the erase never finishes
+    }
+    if (++host_erase_polls < HOST_ERASE_POLLS)
+    {
+        return FLASH_BUSY;
+    }
+    memset((void *)bare_flash_sector_addr((uint8_t)host_erasing), 0xFF,
+           bare_flash_sector_size((uint8_t)host_erasing));
+    host_erasing = -1;
+    return FLASH_OK;
+}
+
+FLASH_Status_t bare_flash_erase(uint8_t sector)
+{
+    FLASH_Status_t status = bare_flash_erase_start(sector);
+
+    if (status != FLASH_OK)
+    {
+        return status;
+    }
+    do
+    {
+        status = bare_flash_erase_poll();
+    } while (status == FLASH_BUSY);
+    return status;
+}
+
+const FLASH_Ops_t bare_flash_ops = {
+    .sector_addr = bare_flash_sector_addr,
+    .sector_size = bare_flash_sector_size,
+    .program = bare_flash_program,
+    .erase_start = bare_flash_erase_start,
+    .erase_poll = bare_flash_erase_poll,
+};
@@ -0,0 +1,67 @@
+/*******************************************************************************************
+ * @file    host_flash.h
+ * @author  ka5j
+ * @brief   Host test support: bare_flash_* backed by a file image of the F446 flash
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    host_flash.c replaces src/bare_flash.c in host builds. The image file is mapped
+ *          shared at the flash base address (0x08000000), so records survive closing and
+ *          reopening it the way they survive a reset, and storage code reads it in place
+ *          just as it reads flash on the target.
+ *
+ *          The backend behaves like the driver on NOR flash: programming only clears bits
+ *          (a word that was not erased fails the verify), waits for a running erase, and
+ *          an erase takes a few polls to complete. host_flash_tear_after() cuts the power
+ *          in the middle of programming, host_flash_fail_after() makes one program fail.
+ *******************************************************************************************/
+
+#ifndef HOST_FLASH_H_
+#define HOST_FLASH_H_
+
+#include "bare_flash.h"
+#include <stdint.h>
+
+#define HOST_FLASH_SIZE 0x80000UL /*!< 512 KB, sectors 0-7 */
+
+/**
+ * @brief Map an image file, creating it erased (all 0xFF) if it does not exist; exits on
+ *        failure
+ *
+ * @param path  Image file
+ */
+void host_flash_open(const char *path);
+
+/**
+ * @brief Unmap the image (everything programmed so far stays in the file)
+ */
+void host_flash_close(void);
+
+/**
+ * @brief Cut the power after a number of further programmed words
+ *
+ * The next word is left half programmed (its low half only), and every later program or
+ * erase fails until the image is reopened.
+ *
+ * @param words  Whole words still programmed
+ */
+void host_flash_tear_after(uint32_t words);
+
+/**
+ * @brief Fail one program operation after a number of further programmed words
+ *
+ * The program call that reaches the next word returns FLASH_ERR_PROG and leaves that
+ * word and the rest of the call erased. The power stays on and later calls succeed.
+ *
+ * @param words  Whole words still programmed
+ */
+void host_flash_fail_after(uint32_t words);
+
+/**
+ * @brief Check whether a torn write cut the power
+ *
+ * @return uint8_t 1 once the tear has happened
+ */
+uint8_t host_flash_powered_off(void);
+
+#endif /* HOST_FLASH_H_ */
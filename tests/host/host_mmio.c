@@ -0,0 +1,39 @@
+/*******************************************************************************************
+ * @file    host_mmio.c
+ * @author  ka5j
+ * @brief   Host test support: peripheral address windows backed by RAM
+ * @version 1.0
+ * @date    2026-10-19
+ *******************************************************************************************/
+
+#define _GNU_SOURCE
+#include "host_mmio.h"
+#include <sys/mman.h>
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE MAP_FIXED
+#endif
+
+/**
+ * @brief  Map one window at its target address
+ */
+static void host_map_window(unsigned long base, unsigned long size)
+{
+    void *p = mmap((void *)base, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+
+    if (p != (void *)base)
+    {
+        fprintf(stderr, "host_mmio: cannot map 0x%08lx\n", base);
+        exit(2);
+    }
+}
+
+/**
+ * @brief  Map the peripheral and core windows
+ */
+void host_mmio_map(void)
+{
+    host_map_window(0x40000000UL, 0x10080000UL); // APB1 ... AHB2
+    host_map_window(0xE0000000UL, 0x00100000UL); // Private peripheral bus (NVIC, DWT, SCB)
+}
@@ -0,0 +1,37 @@
+/*******************************************************************************************
+ * @file    host_mmio.h
+ * @author  ka5j
+ * @brief   Host test support: peripheral address windows backed by RAM
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The drivers reach registers through fixed addresses (RCC, NVIC, I2C1, ...).
+ *          host_mmio_map() maps zero-filled memory at the STM32F446 peripheral and core
+ *          addresses, so driver code runs unchanged on a 64-bit Linux host. Registers are
+ *          plain memory: flags that hardware would set must be set by the test.
+ *******************************************************************************************/
+
+#ifndef HOST_MMIO_H_
+#define HOST_MMIO_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Map the peripheral (0x40000000-0x5007FFFF) and core (0xE0000000-0xE00FFFFF)
+ *        windows; exits on failure
+ */
+void host_mmio_map(void);
+
+/** Test assertion: print the failing expression and exit */
+#define CHECK(cond)                                                                           \
+    do                                                                                        \
+    {                                                                                         \
+        if (!(cond))                                                                          \
+        {                                                                                     \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond);          \
+            exit(1);                                                                          \
+        }                                                                                     \
+    } while (0)
+
+#endif /* HOST_MMIO_H_ */
@@ -0,0 +1,104 @@
+/*******************************************************************************************
+ * @file    host_reg.c
+ * @author  ka5j
+ * @brief   Host test support: count register accesses made through bare_reg.h
+ * @version 1.0
+ * @date    2026-10-19
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "host_reg.h"
+#include <stddef.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define HOST_REG_SLOTS 32U
+
+typedef struct
+{
+    volatile uint32_t *reg;
+    uint32_t reads;
+    uint32_t writes;
+} host_reg_count_t;
+
+static host_reg_count_t host_regs[HOST_REG_SLOTS];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+/**
+ * @brief  Counter slot of a register, created on first use
+ */
+static host_reg_count_t *host_reg_slot(volatile uint32_t *reg, uint8_t create)
+{
+    uint32_t i;
+
+    for (i = 0U; i < HOST_REG_SLOTS; i++)
+    {
+        if (host_regs[i].reg == reg)
+        {
+            return &host_regs[i];
+        }
+        if ((host_regs[i].reg == NULL) && create)
+        {
+            host_regs[i].reg = reg;
+            return &host_regs[i];
+        }
+    }
+    CHECK(!create); // More registers than slots
+    return NULL;
+}
+
+/*******************************************************************************************
+ *                               Public API Functions
+ *******************************************************************************************/
+
+uint32_t host_reg_read(volatile uint32_t *reg)
+{
+    host_reg_slot(reg, 1U)->reads++;
+    return *reg;
+}
+
+void host_reg_write(volatile uint32_t *reg, uint32_t v)
+{
+    host_reg_slot(reg, 1U)->writes++;
+    *reg = v;
+}
+
+void host_reg_reset(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < HOST_REG_SLOTS; i++)
+    {
+        host_regs[i] = (host_reg_count_t){NULL, 0U, 0U};
+    }
+}
+
+uint32_t host_reg_reads(volatile uint32_t *reg)
+{
+    host_reg_count_t *c = host_reg_slot(reg, 0U);
+
+    return (c != NULL) ? c->reads : 0U;
+}
+
+uint32_t host_reg_writes(volatile uint32_t *reg)
+{
+    host_reg_count_t *c = host_reg_slot(reg, 0U);
+
+    return (c != NULL) ? c->writes : 0U;
+}
+
+uint32_t host_reg_total(void)
+{
+    uint32_t total = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < HOST_REG_SLOTS; i++)
+    {
+        total += host_regs[i].reads + host_regs[i].writes;
+    }
+    return total;
+}
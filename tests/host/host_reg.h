@@ -0,0 +1,65 @@
+/*******************************************************************************************
+ * @file    host_reg.h
+ * @author  ka5j
+ * @brief   Host test support: count register accesses made through bare_reg.h
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Force-included (-include host/host_reg.h) into every source of a test, so the
+ *          BARE_REG_READ / BARE_REG_WRITE hooks below replace the plain accesses in
+ *          bare_reg.h. Each access still reaches the register, and is counted per register.
+ *******************************************************************************************/
+
+#ifndef HOST_REG_H_
+#define HOST_REG_H_
+
+#include <stdint.h>
+
+#define BARE_REG_READ(reg) host_reg_read(reg)
+#define BARE_REG_WRITE(reg, v) host_reg_write((reg), (v))
+
+/**
+ * @brief Counted register read
+ *
+ * @param reg  Register
+ * @return uint32_t Register value
+ */
+uint32_t host_reg_read(volatile uint32_t *reg);
+
+/**
+ * @brief Counted register write
+ *
+ * @param reg  Register
+ * @param v    Value
+ */
+void host_reg_write(volatile uint32_t *reg, uint32_t v);
+
+/**
+ * @brief Clear all counts
+ */
+void host_reg_reset(void);
+
+/**
+ * @brief Reads of a register since the last reset
+ *
+ * @param reg  Register
+ * @return uint32_t Read count
+ */
+uint32_t host_reg_reads(volatile uint32_t *reg);
+
+/**
+ * @brief Writes to a register since the last reset
+ *
+ * @param reg  Register
+ * @return uint32_t Write count
+ */
+uint32_t host_reg_writes(volatile uint32_t *reg);
+
+/**
+ * @brief Accesses to all registers since the last reset
+ *
+ * @return uint32_t Read and write count
+ */
+uint32_t host_reg_total(void);
+
+#endif /* HOST_REG_H_ */
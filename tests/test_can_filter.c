@@ -0,0 +1,209 @@
+/*******************************************************************************************
+ * @file    test_can_filter.c
+ * @author  ka5j
+ * @brief   Host test: filter bank packing against the rule sets it was built from
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Bank counts are checked for mixes of 11 and 29-bit identifier and mask rules
+ *          (pairing of odd ones out, covered rules dropped, both FIFOs, overflow). Each
+ *          packed set is then probed with every rule's identifier, its single-bit
+ *          neighbours (inside and outside the mask), both identifier widths and random
+ *          identifiers: a data frame must reach a FIFO through bare_can_filter_match()
+ *          exactly when a rule for that FIFO accepts it.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_can_filter.h"
+
+#define RANDOM_PROBES 2000U
+
+/** Reference: a frame passes when one rule for the FIFO accepts its identifier */
+static uint8_t ref_accept(const CAN_FilterRule_t *rules, uint32_t count, uint32_t id,
+                          uint8_t ide, uint8_t fifo)
+{
+    uint32_t w = ide ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        if ((rules[i].ide == ide) && (rules[i].fifo == fifo) &&
+            (((id ^ rules[i].id) & rules[i].mask & w) == 0U))
+        {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/** Packed banks: a frame passes when one bank for the FIFO matches it */
+static uint8_t bank_accept(const CAN_FilterBank_t *banks, int32_t n, uint32_t id, uint8_t ide,
+                           uint8_t rtr, uint8_t fifo)
+{
+    int32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        if ((banks[i].fifo == fifo) && bare_can_filter_match(&banks[i], id, ide, rtr))
+        {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/** Compare one data frame on both FIFOs; a mask rule also lets its remote frame through */
+static void probe(const CAN_FilterRule_t *rules, uint32_t count, const CAN_FilterBank_t *banks,
+                  int32_t n, uint32_t id, uint8_t ide)
+{
+    uint32_t w = ide ? CAN_EXT_ID_MASK : CAN_STD_ID_MASK;
+    uint8_t fifo;
+    uint32_t i;
+
+    id &= w;
+    for (fifo = 0U; fifo < 2U; fifo++)
+    {
+        CHECK(bank_accept(banks, n, id, ide, 0U, fifo) ==
+              ref_accept(rules, count, id, ide, fifo));
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        if ((rules[i].ide == ide) && ((rules[i].mask & w) != w) &&
+            (((id ^ rules[i].id) & rules[i].mask & w) == 0U))
+        {
+            CHECK(bank_accept(banks, n, id, ide, 1U, rules[i].fifo));
+        }
+    }
+}
+
+/** Pack a rule set, check its bank count, then probe it */
+static void check_rules(const CAN_FilterRule_t *rules, uint32_t count, int32_t expect_banks)
+{
+    static uint32_t seed = 12345U;
+    CAN_FilterBank_t banks[CAN_FILTER_BANKS];
+    int32_t n = bare_can_filter_pack(rules, count, banks, CAN_FILTER_BANKS);
+    uint32_t i;
+    uint32_t b;
+
+    CHECK(n == expect_banks);
+
+    /* Exactly n banks fit, one fewer does not */
+    if (n > 0)
+    {
+        CHECK(bare_can_filter_pack(rules, count, banks, (uint32_t)(n - 1)) == -1);
+        CHECK(bare_can_filter_pack(rules, count, banks, (uint32_t)n) == n);
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        uint32_t bits = rules[i].ide ? 29U : 11U;
+
+        probe(rules, count, banks, n, rules[i].id, rules[i].ide);
+        probe(rules, count, banks, n, rules[i].id, (uint8_t)!rules[i].ide);
+        probe(rules, count, banks, n, rules[i].id | ~rules[i].mask, rules[i].ide);
+        for (b = 0U; b < bits; b++)
+        {
+            probe(rules, count, banks, n, rules[i].id ^ (1UL << b), rules[i].ide);
+        }
+    }
+
+    probe(rules, count, banks, n, 0U, 0U); // What zeroed filter slots would accept
+    probe(rules, count, banks, n, 0U, 1U);
+    for (i = 0U; i < RANDOM_PROBES; i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        probe(rules, count, banks, n, seed >> 3, (uint8_t)(seed & 1U));
+    }
+}
+
+#define STD_ID(v, f) {(v), CAN_STD_ID_MASK, 0U, (f)}
+#define EXT_ID(v, f) {(v), CAN_EXT_ID_MASK, 1U, (f)}
+#define STD_MASK(v, m, f) {(v), (m), 0U, (f)}
+#define EXT_MASK(v, m, f) {(v), (m), 1U, (f)}
+
+int main(void)
+{
+    /* Five standard IDs: four per 16-bit list bank */
+    static const CAN_FilterRule_t std_ids[] = {
+        STD_ID(0x100U, 0U), STD_ID(0x101U, 0U), STD_ID(0x234U, 0U), STD_ID(0x7FFU, 0U),
+        STD_ID(0x000U, 0U),
+    };
+
+    /* Three extended IDs: a pair, then the odd one out with the standard ID */
+    static const CAN_FilterRule_t ext_ids[] = {
+        EXT_ID(0x18FF50E5UL, 0U), EXT_ID(0x0CF00400UL, 0U), EXT_ID(0x1FFFFFFFUL, 0U),
+        STD_ID(0x123U, 0U),
+    };
+
+    /* Three standard masks and two IDs: a mask pair, mask + ID, one list bank */
+    static const CAN_FilterRule_t std_masks[] = {
+        STD_MASK(0x100U, 0x700U, 0U), STD_MASK(0x020U, 0x7F0U, 0U),
+        STD_MASK(0x005U, 0x00FU, 0U),
+        STD_ID(0x7E8U, 0U), STD_ID(0x7DFU, 0U),
+    };
+
+    /* One standard mask takes an ID as its partner, leaving four for one list bank */
+    static const CAN_FilterRule_t mask_odd[] = {
+        STD_MASK(0x600U, 0x600U, 1U), STD_ID(0x010U, 1U), STD_ID(0x011U, 1U),
+        STD_ID(0x012U, 1U), STD_ID(0x013U, 1U), STD_ID(0x014U, 1U),
+    };
+
+    /* Every class, both FIFOs: FIFO 0 = 1 + 2 + 2 + 1, FIFO 1 = 1 + 1 */
+    static const CAN_FilterRule_t mixed[] = {
+        EXT_MASK(0x18FEF000UL, 0x1FFFF000UL, 0U),
+        EXT_ID(0x00000001UL, 0U), EXT_ID(0x10000000UL, 0U), EXT_ID(0x0ABCDEF0UL, 0U),
+        STD_MASK(0x300U, 0x780U, 0U), STD_MASK(0x555U, 0x555U, 0U),
+        STD_MASK(0x0AAU, 0x0FFU, 0U),
+        STD_ID(0x001U, 0U), STD_ID(0x002U, 0U), STD_ID(0x003U, 0U), STD_ID(0x004U, 0U),
+        STD_ID(0x005U, 0U), STD_ID(0x006U, 0U),
+        EXT_MASK(0x00000000UL, 0x1F000000UL, 1U),
+        STD_ID(0x7F0U, 1U), STD_ID(0x7F1U, 1U),
+    };
+
+    /* Covered and duplicate rules cost nothing: one 16-bit mask bank */
+    static const CAN_FilterRule_t covered[] = {
+        STD_MASK(0x100U, 0x700U, 0U), STD_ID(0x123U, 0U), STD_ID(0x1FFU, 0U),
+        STD_MASK(0x180U, 0x780U, 0U), STD_MASK(0x100U, 0x700U, 0U),
+    };
+
+    /* A lone extended ID repeats itself in the second slot */
+    static const CAN_FilterRule_t lone_ext[] = {
+        EXT_ID(0x01234567UL, 0U),
+    };
+
+    /* Same identifier on both FIFOs is not a duplicate */
+    static const CAN_FilterRule_t both_fifos[] = {
+        STD_ID(0x321U, 0U), STD_ID(0x321U, 1U), EXT_ID(0x321UL, 1U),
+    };
+
+    CAN_FilterRule_t many[CAN_FILTER_MAX_RULES + 1U];
+    CAN_FilterBank_t banks[CAN_FILTER_BANKS];
+    uint32_t i;
+
+    check_rules(std_ids, 5U, 2);
+    check_rules(ext_ids, 4U, 2);
+    check_rules(std_masks, 5U, 3);
+    check_rules(mask_odd, 6U, 2);
+    check_rules(mixed, 16U, 8);
+    check_rules(covered, 5U, 1);
+    check_rules(lone_ext, 1U, 1);
+    check_rules(both_fifos, 3U, 2);
+
+    /* 112 standard IDs fill all 28 banks; one extended ID more does not fit */
+    for (i = 0U; i < CAN_FILTER_MAX_RULES; i++)
+    {
+        CAN_FilterRule_t r = STD_ID(i * 3U, (uint8_t)(i & 1U));
+
+        many[i] = r;
+    }
+    check_rules(many, CAN_FILTER_MAX_RULES, 28);
+    many[0].id = 0x1ABCDUL;
+    many[0].mask = CAN_EXT_ID_MASK;
+    many[0].ide = 1U;
+    CHECK(bare_can_filter_pack(many, CAN_FILTER_MAX_RULES, banks, CAN_FILTER_BANKS) == -1);
+    CHECK(bare_can_filter_pack(many, CAN_FILTER_MAX_RULES + 1U, banks, CAN_FILTER_BANKS) == -1);
+
+    printf("test_can_filter: ok\n");
+    return 0;
+}
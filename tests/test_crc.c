@@ -0,0 +1,208 @@
+/*******************************************************************************************
+ * @file    test_crc.c
+ * @author  ka5j
+ * @brief   Host test: CRC table paths against bitwise references and the unit's algorithm
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The references here are the textbook one-bit-at-a-time definitions. The
+ *          hardware-equivalent path models the CRC unit (CRC-32/MPEG-2, one word MSB first)
+ *          and replays bare_crc32()'s bit-reversal scheme on it, so the register sequence
+ *          the driver uses is checked without the peripheral.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_crc_sw.h"
+
+#define CHECK_LEN 9U
+#define RANDOM_MAX 67U
+
+static const char check_str[] = "123456789";
+
+/*******************************************************************************************
+ *                                Bitwise References
+ *******************************************************************************************/
+
+static uint32_t ref_crc32(const uint8_t *p, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+    uint32_t b;
+
+    while (len--)
+    {
+        crc ^= *p++;
+        for (b = 0U; b < 8U; b++)
+        {
+            crc = (crc >> 1) ^ ((crc & 1U) ? 0xEDB88320UL : 0U);
+        }
+    }
+    return ~crc;
+}
+
+static uint16_t ref_crc16_ccitt(const uint8_t *p, size_t len)
+{
+    uint16_t crc = 0xFFFFU;
+    uint32_t b;
+
+    while (len--)
+    {
+        crc ^= (uint16_t)(*p++ << 8);
+        for (b = 0U; b < 8U; b++)
+        {
+            crc = (uint16_t)((crc << 1) ^ ((crc & 0x8000U) ? 0x1021U : 0U));
+        }
+    }
+    return crc;
+}
+
+static uint16_t ref_crc16_modbus(const uint8_t *p, size_t len)
+{
+    uint16_t crc = 0xFFFFU;
+    uint32_t b;
+
+    while (len--)
+    {
+        crc ^= *p++;
+        for (b = 0U; b < 8U; b++)
+        {
+            crc = (uint16_t)((crc >> 1) ^ ((crc & 1U) ? 0xA001U : 0U));
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************************************
+ *                              CRC Unit Model
+ *******************************************************************************************/
+
+/** One write to CRC->DR: the whole word shifted in MSB first, poly 0x04C11DB7 */
+static uint32_t unit_write(uint32_t reg, uint32_t word)
+{
+    uint32_t b;
+
+    reg ^= word;
+    for (b = 0U; b < 32U; b++)
+    {
+        reg = (reg << 1) ^ ((reg & 0x80000000UL) ? 0x04C11DB7UL : 0U);
+    }
+    return reg;
+}
+
+static uint32_t rbit(uint32_t v)
+{
+    uint32_t r = 0U;
+    uint32_t b;
+
+    for (b = 0U; b < 32U; b++)
+    {
+        r = (r << 1) | ((v >> b) & 1U);
+    }
+    return r;
+}
+
+/** bare_crc32() on the modelled unit: reversed LE words in, reversed DR out, tail bitwise */
+static uint32_t unit_crc32(const uint8_t *p, size_t len)
+{
+    uint32_t reg = BARE_CRC32_STM32_INIT;
+    uint32_t b;
+
+    for (; len >= 4U; p += 4, len -= 4U)
+    {
+        uint32_t w = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+                     ((uint32_t)p[3] << 24);
+        reg = unit_write(reg, rbit(w));
+    }
+    reg = rbit(reg);
+    while (len--)
+    {
+        reg ^= *p++;
+        for (b = 0U; b < 8U; b++)
+        {
+            reg = (reg >> 1) ^ ((reg & 1U) ? 0xEDB88320UL : 0U);
+        }
+    }
+    return ~reg;
+}
+
+/*******************************************************************************************
+ *                                      Tests
+ *******************************************************************************************/
+
+static void test_check_values(void)
+{
+    const uint8_t *p = (const uint8_t *)check_str;
+
+    CHECK(ref_crc32(p, CHECK_LEN) == 0xCBF43926UL);
+    CHECK(bare_crc32_sw(BARE_CRC32_INIT, p, CHECK_LEN) == 0xCBF43926UL);
+    CHECK(unit_crc32(p, CHECK_LEN) == 0xCBF43926UL);
+
+    CHECK(ref_crc16_ccitt(p, CHECK_LEN) == 0x29B1U);
+    CHECK(bare_crc16_ccitt(BARE_CRC16_CCITT_INIT, p, CHECK_LEN) == 0x29B1U);
+
+    CHECK(ref_crc16_modbus(p, CHECK_LEN) == 0x4B37U);
+    CHECK(bare_crc16_modbus(BARE_CRC16_MODBUS_INIT, p, CHECK_LEN) == 0x4B37U);
+
+    /* A single zero word from the reset value: the figure usually quoted for the STM32 unit */
+    CHECK(unit_write(BARE_CRC32_STM32_INIT, 0U) == 0xC704DD7BUL);
+}
+
+static void test_random_buffers(void)
+{
+    static uint8_t buf[RANDOM_MAX + 4U];
+    uint32_t seed = 12345U;
+    uint32_t len;
+    uint32_t off;
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(buf); i++)
+    {
+        seed = seed * 1103515245UL + 12345UL;
+        buf[i] = (uint8_t)(seed >> 16);
+    }
+
+    /* Every length and alignment: slicing-by-4 main loop and byte tail */
+    for (off = 0U; off < 4U; off++)
+    {
+        for (len = 0U; len <= RANDOM_MAX; len++)
+        {
+            uint32_t ref = ref_crc32(&buf[off], len);
+
+            CHECK(bare_crc32_sw(BARE_CRC32_INIT, &buf[off], len) == ref);
+            CHECK(unit_crc32(&buf[off], len) == ref);
+            CHECK(bare_crc16_ccitt(BARE_CRC16_CCITT_INIT, &buf[off], len) ==
+                  ref_crc16_ccitt(&buf[off], len));
+            CHECK(bare_crc16_modbus(BARE_CRC16_MODBUS_INIT, &buf[off], len) ==
+                  ref_crc16_modbus(&buf[off], len));
+        }
+    }
+
+    /* Incremental use continues the same CRC */
+    CHECK(bare_crc32_sw(bare_crc32_sw(BARE_CRC32_INIT, buf, 13U), &buf[13], 40U) ==
+          ref_crc32(buf, 53U));
+    CHECK(bare_crc16_ccitt(bare_crc16_ccitt(BARE_CRC16_CCITT_INIT, buf, 5U), &buf[5], 30U) ==
+          ref_crc16_ccitt(buf, 35U));
+}
+
+static void test_stm32_words(void)
+{
+    uint32_t words[16];
+    uint32_t reg = BARE_CRC32_STM32_INIT;
+    uint32_t i;
+
+    for (i = 0U; i < 16U; i++)
+    {
+        words[i] = i * 0x9E3779B9UL;
+        reg = unit_write(reg, words[i]);
+        CHECK(bare_crc32_stm32_sw(BARE_CRC32_STM32_INIT, words, i + 1U) == reg);
+    }
+}
+
+int main(void)
+{
+    test_check_values();
+    test_random_buffers();
+    test_stm32_words();
+
+    printf("test_crc: ok\n");
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*******************************************************************************************
+ * @file    test_ctrl_pid.c
+ * @author  ka5j
+ * @brief   Host test: q15 PID step, anti-windup and gain scaling
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    bare_ctrl_pid_q15() is pure arithmetic, so each case drives it with chosen
+ *          setpoint/measurement sequences and checks the output and the integrator
+ *          exactly. The integrator must hold while the output sits at out_max or out_min
+ *          and the error keeps pushing outward, leave the limit on the first step of a
+ *          reversed error, ignore setpoint steps in the derivative term, and scale every
+ *          gain by 2^shift.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_ctrl.h"
+#include <string.h>
+
+#define Q15_HALF 16384 /*!< 0.5 */
+#define OUT_LIMIT 8000
+
+/** Output of one term k * x in q15, k scaled by 2^shift (the controller's own rounding) */
+static int32_t term(int32_t k, uint8_t shift, int32_t x)
+{
+    return (int32_t)((((int64_t)k << (shift + 1U)) * x) >> 16);
+}
+
+/** Integrator increment of one step, q15 with 16 extra fraction bits */
+static int32_t integ_step(int32_t ki, uint8_t shift, int32_t e)
+{
+    return (int32_t)(((int64_t)ki << (shift + 1U)) * e);
+}
+
+static void pid_setup(CTRL_PidQ15_t *pid, q15_t kp, q15_t ki, q15_t kd, uint8_t shift)
+{
+    memset(pid, 0, sizeof(*pid));
+    pid->kp = kp;
+    pid->ki = ki;
+    pid->kd = kd;
+    pid->shift = shift;
+    pid->out_min = -OUT_LIMIT;
+    pid->out_max = OUT_LIMIT;
+    bare_ctrl_pid_reset(pid, 0, 0);
+}
+
+/*******************************************************************************************
+ *                                      Tests
+ *******************************************************************************************/
+
+/** kp, ki and kd are each multiplied by 2^shift */
+static void test_shift(void)
+{
+    CTRL_PidQ15_t pid;
+    uint8_t shift;
+
+    for (shift = 0U; shift <= 3U; shift++)
+    {
+        /* P: 0.5 * 2^shift of a 1000 error */
+        pid_setup(&pid, Q15_HALF, 0, 0, shift);
+        CHECK(bare_ctrl_pid_q15(&pid, 1000, 0) == (q15_t)(500 << shift));
+        CHECK(pid.integ == 0);
+
+        /* I: the integrator grows by ki * 2^shift * e per step */
+        pid_setup(&pid, 0, 1024, 0, shift);
+        CHECK(bare_ctrl_pid_q15(&pid, 1000, 0) == term(1024, shift, 1000));
+        CHECK(pid.integ == integ_step(1024, shift, 1000));
+        CHECK(bare_ctrl_pid_q15(&pid, 1000, 0) == (2 * integ_step(1024, shift, 1000)) >> 16);
+        CHECK(pid.integ == 2 * integ_step(1024, shift, 1000));
+
+        /* D: a measurement rise of 100 pulls the output down by kd * 2^shift * 100 */
+        pid_setup(&pid, 0, 0, 2048, shift);
+        CHECK(bare_ctrl_pid_q15(&pid, 0, 0) == 0);
+        CHECK(bare_ctrl_pid_q15(&pid, 0, 100) == term(2048, shift, -100));
+    }
+}
+
+/** Error held outward at either limit: output clamped, integrator not wound further in */
+static void test_saturation(int32_t sign)
+{
+    CTRL_PidQ15_t pid;
+    int32_t held;
+    uint32_t i;
+    q15_t out = 0;
+
+    /* Proportional alone past the limit: the integrator never starts */
+    pid_setup(&pid, Q15_HALF, 4096, 0, 0U);
+    for (i = 0U; i < 50U; i++)
+    {
+        CHECK(bare_ctrl_pid_q15(&pid, (q15_t)(sign * 20000), 0) == sign * OUT_LIMIT);
+        CHECK(pid.integ == 0);
+    }
+
+    /* Integral drives into the limit (the last step only as far as the limit), then holds */
+    pid_setup(&pid, 3277, 2048, 0, 0U);
+    for (i = 0U; (i < 100U) && (out != sign * OUT_LIMIT); i++)
+    {
+        out = bare_ctrl_pid_q15(&pid, (q15_t)(sign * 10000), 0);
+    }
+    CHECK(out == sign * OUT_LIMIT);
+    held = pid.integ;
+    CHECK((held * sign) <= (OUT_LIMIT * 65536));
+
+    for (i = 0U; i < 200U; i++)
+    {
+        CHECK(bare_ctrl_pid_q15(&pid, (q15_t)(sign * 10000), 0) == sign * OUT_LIMIT);
+        CHECK(pid.integ == held);
+    }
+
+    /* Error reverses: the integrator moves on the very first step and the output leaves
+     * the limit at once instead of unwinding first */
+    out = bare_ctrl_pid_q15(&pid, (q15_t)(-sign * 10000), 0);
+    CHECK(pid.integ == held + integ_step(2048, 0U, -sign * 10000));
+    CHECK(out == (q15_t)(((int64_t)pid.integ + ((int64_t)3277 << 1) * (-sign * 10000)) >> 16));
+    CHECK((out * sign) < OUT_LIMIT);
+}
+
+/** Setpoint steps do not reach the derivative term; measurement steps do */
+static void test_no_kick(void)
+{
+    CTRL_PidQ15_t pid;
+    q15_t before;
+    q15_t after;
+
+    /* Derivative only: a setpoint step leaves the output where it was */
+    pid_setup(&pid, 0, 0, Q15_HALF, 0U);
+    bare_ctrl_pid_reset(&pid, 1000, 0);
+    CHECK(bare_ctrl_pid_q15(&pid, 0, 1000) == 0);
+    CHECK(bare_ctrl_pid_q15(&pid, 10000, 1000) == 0);
+    CHECK(bare_ctrl_pid_q15(&pid, -10000, 1000) == 0);
+
+    /* PD: the step changes the output by the proportional part alone */
+    pid_setup(&pid, 3277, 0, Q15_HALF, 0U);
+    bare_ctrl_pid_reset(&pid, 1000, 0);
+    before = bare_ctrl_pid_q15(&pid, 1000, 1000);
+    after = bare_ctrl_pid_q15(&pid, 3000, 1000);
+    CHECK(before == 0);
+    CHECK(after == term(3277, 0U, 2000));
+
+    /* The same error from a measurement change carries the derivative too */
+    after = bare_ctrl_pid_q15(&pid, 3000, 0);
+    CHECK(after == (q15_t)((((int64_t)3277 << 1) * 3000 - ((int64_t)Q15_HALF << 1) * -1000) >>
+                           16));
+}
+
+/** Reset takes over the applied output without a bump */
+static void test_reset(void)
+{
+    CTRL_PidQ15_t pid;
+
+    pid_setup(&pid, Q15_HALF, 1024, Q15_HALF, 1U);
+    bare_ctrl_pid_reset(&pid, 500, 3000);
+    CHECK(bare_ctrl_pid_q15(&pid, 500, 500) == 3000);
+}
+
+int main(void)
+{
+    test_shift();
+    test_saturation(1);
+    test_saturation(-1);
+    test_no_kick();
+    test_reset();
+
+    printf("test_ctrl_pid: ok\n");
+    return 0;
+}
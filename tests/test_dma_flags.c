@@ -0,0 +1,70 @@
+/*******************************************************************************************
+ * @file    test_dma_flags.c
+ * @author  ka5j
+ * @brief   Host test: the DMA interrupt dispatcher reports only enabled flags
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The stream's flags are planted in LISR and the vector is called directly.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_dma.h"
+#include "dma_registers.h"
+
+void DMA2_Stream0_IRQHandler(void);
+
+static uint32_t last_events;
+static uint32_t calls;
+
+static void on_event(uint32_t events, void *ctx)
+{
+    (void)ctx;
+    last_events = events;
+    calls++;
+}
+
+int main(void)
+{
+    const DMA_Config_t cfg = {
+        .dir = DMA_DIR_MEM_TO_MEM,
+        .psize = DMA_SIZE_WORD,
+        .msize = DMA_SIZE_WORD,
+        .pinc = 1U,
+        .fifo = DMA_FIFO_HALF,
+        .complete_irq = 1U,
+    };
+
+    host_mmio_map();
+    bare_dma_config(DMA2_Stream0, &cfg);
+    bare_dma_set_callback(DMA2_Stream0, on_event, NULL);
+
+    /* FIFO error latched, FEIE off: not an error, and nothing else to report */
+    DMA2->LISR = DMA_FLAG_FEIF;
+    DMA2_Stream0_IRQHandler();
+    CHECK(calls == 0U);
+
+    /* Completion with a stray FIFO error flag */
+    DMA2->LISR = DMA_FLAG_FEIF | DMA_FLAG_TCIF;
+    DMA2_Stream0_IRQHandler();
+    CHECK(calls == 1U && last_events == DMA_EVENT_COMPLETE);
+
+    /* Half transfer flag without HTIE */
+    DMA2->LISR = DMA_FLAG_HTIF | DMA_FLAG_TCIF;
+    DMA2_Stream0_IRQHandler();
+    CHECK(calls == 2U && last_events == DMA_EVENT_COMPLETE);
+
+    /* Transfer error is enabled with the completion interrupt */
+    DMA2->LISR = DMA_FLAG_TEIF;
+    DMA2_Stream0_IRQHandler();
+    CHECK(calls == 3U && last_events == DMA_EVENT_ERROR);
+
+    /* FIFO error once FEIE is set */
+    DMA2_Stream0->FCR |= DMA_SxFCR_FEIE;
+    DMA2->LISR = DMA_FLAG_FEIF;
+    DMA2_Stream0_IRQHandler();
+    CHECK(calls == 4U && last_events == DMA_EVENT_ERROR);
+
+    printf("test_dma_flags: ok\n");
+    return 0;
+}
@@ -0,0 +1,278 @@
+/*******************************************************************************************
+ * @file    test_dsp_kernels.c
+ * @author  ka5j
+ * @brief   Host test: packed-pair DSP kernels against their scalar *_ref twins
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    On the host __ARM_FEATURE_DSP is unset, so the kernels run on the C emulations
+ *          of SMLAD, SMUAD, SMLALD and QADD16. Each kernel and its reference get their own
+ *          state and the same blocks, several in a row so the history carries over, and
+ *          must agree bit for bit in output and state. Tap counts, block lengths and
+ *          buffer offsets are odd as well as even (pair loop tails, halfword aligned
+ *          packed loads), and inputs are random or full scale so that every saturation
+ *          path is taken.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_dsp.h"
+#include <string.h>
+
+#define BLOCK_MAX 37U
+#define TAPS_MAX 33U
+#define BLOCKS 4U
+
+static uint32_t seed = 1U;
+
+static uint32_t rnd(void)
+{
+    seed = (seed * 1103515245U) + 12345U;
+    return seed >> 8;
+}
+
+/** Random q15, or only full-scale values when loud */
+static q15_t rnd_q15(uint8_t loud)
+{
+    static const q15_t rails[4] = {32767, -32768, -32767, 0};
+
+    return loud ? rails[rnd() & 3U] : (q15_t)rnd();
+}
+
+static q31_t rnd_q31(uint8_t loud)
+{
+    static const q31_t rails[4] = {INT32_MAX, INT32_MIN, -INT32_MAX, 0};
+
+    return loud ? rails[rnd() & 3U] : (q31_t)((rnd() << 8) ^ rnd());
+}
+
+static void fill_q15(q15_t *p, uint32_t n, uint8_t loud)
+{
+    while (n--)
+    {
+        *p++ = rnd_q15(loud);
+    }
+}
+
+/*******************************************************************************************
+ *                                      Tests
+ *******************************************************************************************/
+
+static void test_fir_q15(uint16_t taps, uint32_t block, uint8_t loud)
+{
+    q15_t coeffs[TAPS_MAX];
+    q15_t st_a[TAPS_MAX - 1U + BLOCK_MAX];
+    q15_t st_b[TAPS_MAX - 1U + BLOCK_MAX];
+    q15_t in[BLOCK_MAX];
+    q15_t out_a[BLOCK_MAX];
+    q15_t out_b[BLOCK_MAX];
+    DSP_FirQ15_t a;
+    DSP_FirQ15_t b;
+    uint32_t k;
+
+    fill_q15(coeffs, taps, loud);
+    bare_dsp_fir_q15_init(&a, coeffs, taps, st_a);
+    bare_dsp_fir_q15_init(&b, coeffs, taps, st_b);
+
+    for (k = 0U; k < BLOCKS; k++)
+    {
+        fill_q15(in, block, loud);
+        bare_dsp_fir_q15(&a, in, out_a, block);
+        bare_dsp_fir_q15_ref(&b, in, out_b, block);
+        CHECK(memcmp(out_a, out_b, block * sizeof(q15_t)) == 0);
+        CHECK(memcmp(st_a, st_b, (taps - 1U) * sizeof(q15_t)) == 0);
+    }
+}
+
+/** Coefficients scaled to 2 / (taps + 1) of full scale: the 64-bit sum can still pass
+ *  2^62 (saturated output) but never wraps */
+static void test_fir_q31(uint16_t taps, uint32_t block, uint8_t loud)
+{
+    int64_t cmax = (int64_t)((0x80000000UL / (taps + 1U)) * 2U) - 1;
+    q31_t coeffs[TAPS_MAX];
+    q31_t st_a[TAPS_MAX - 1U + BLOCK_MAX];
+    q31_t st_b[TAPS_MAX - 1U + BLOCK_MAX];
+    q31_t in[BLOCK_MAX];
+    q31_t out_a[BLOCK_MAX];
+    q31_t out_b[BLOCK_MAX];
+    DSP_FirQ31_t a;
+    DSP_FirQ31_t b;
+    uint32_t i;
+    uint32_t k;
+
+    for (i = 0U; i < taps; i++)
+    {
+        coeffs[i] = (q31_t)(((int64_t)rnd_q31(loud) * cmax) >> 31);
+    }
+    bare_dsp_fir_q31_init(&a, coeffs, taps, st_a);
+    bare_dsp_fir_q31_init(&b, coeffs, taps, st_b);
+
+    for (k = 0U; k < BLOCKS; k++)
+    {
+        for (i = 0U; i < block; i++)
+        {
+            in[i] = rnd_q31(loud);
+        }
+        bare_dsp_fir_q31(&a, in, out_a, block);
+        bare_dsp_fir_q31_ref(&b, in, out_b, block);
+        CHECK(memcmp(out_a, out_b, block * sizeof(q31_t)) == 0);
+        CHECK(memcmp(st_a, st_b, (taps - 1U) * sizeof(q31_t)) == 0);
+    }
+}
+
+static void test_decim_q15(uint8_t factor, uint16_t taps, uint32_t groups, uint8_t loud)
+{
+    uint32_t block = factor * groups;
+    q15_t coeffs[TAPS_MAX];
+    q15_t st_a[TAPS_MAX - 1U + BLOCK_MAX];
+    q15_t st_b[TAPS_MAX - 1U + BLOCK_MAX];
+    q15_t in[BLOCK_MAX];
+    q15_t out_a[BLOCK_MAX];
+    q15_t out_b[BLOCK_MAX];
+    DSP_DecimQ15_t a;
+    DSP_DecimQ15_t b;
+    uint32_t k;
+
+    CHECK(block <= BLOCK_MAX);
+    fill_q15(coeffs, taps, loud);
+    bare_dsp_decim_q15_init(&a, factor, coeffs, taps, st_a);
+    bare_dsp_decim_q15_init(&b, factor, coeffs, taps, st_b);
+
+    for (k = 0U; k < BLOCKS; k++)
+    {
+        fill_q15(in, block, loud);
+        bare_dsp_decim_q15(&a, in, out_a, block);
+        bare_dsp_decim_q15_ref(&b, in, out_b, block);
+        CHECK(memcmp(out_a, out_b, groups * sizeof(q15_t)) == 0);
+        CHECK(memcmp(st_a, st_b, (taps - 1U) * sizeof(q15_t)) == 0);
+    }
+}
+
+/** Random coefficients: the accumulator may wrap, which both sides must do identically */
+static void test_biquad_q15(uint8_t stages, uint8_t post_shift, uint32_t block, uint8_t loud)
+{
+    q15_t coeffs[5U * 3U];
+    q15_t st_a[4U * 3U];
+    q15_t st_b[4U * 3U];
+    q15_t in[BLOCK_MAX];
+    q15_t out_a[BLOCK_MAX];
+    q15_t out_b[BLOCK_MAX];
+    DSP_BiquadQ15_t a;
+    DSP_BiquadQ15_t b;
+    uint32_t k;
+
+    fill_q15(coeffs, 5U * stages, loud);
+    bare_dsp_biquad_q15_init(&a, stages, coeffs, st_a, post_shift);
+    bare_dsp_biquad_q15_init(&b, stages, coeffs, st_b, post_shift);
+
+    for (k = 0U; k < BLOCKS; k++)
+    {
+        fill_q15(in, block, loud);
+        bare_dsp_biquad_q15(&a, in, out_a, block);
+        bare_dsp_biquad_q15_ref(&b, in, out_b, block);
+        CHECK(memcmp(out_a, out_b, block * sizeof(q15_t)) == 0);
+        CHECK(memcmp(st_a, st_b, 4U * stages * sizeof(q15_t)) == 0);
+    }
+
+    /* In place, as the cascade itself runs every stage after the first */
+    fill_q15(in, block, loud);
+    memcpy(out_a, in, block * sizeof(q15_t));
+    bare_dsp_biquad_q15(&a, out_a, out_a, block);
+    bare_dsp_biquad_q15_ref(&b, in, out_b, block);
+    CHECK(memcmp(out_a, out_b, block * sizeof(q15_t)) == 0);
+}
+
+static void test_movavg_q15(uint8_t log2_len, uint32_t block, uint8_t loud)
+{
+    q15_t st_a[16U + BLOCK_MAX];
+    q15_t st_b[16U + BLOCK_MAX];
+    q15_t in[BLOCK_MAX];
+    q15_t out_a[BLOCK_MAX];
+    q15_t out_b[BLOCK_MAX];
+    DSP_MovAvgQ15_t a;
+    DSP_MovAvgQ15_t b;
+    uint32_t k;
+
+    bare_dsp_movavg_q15_init(&a, log2_len, st_a);
+    bare_dsp_movavg_q15_init(&b, log2_len, st_b);
+
+    for (k = 0U; k < BLOCKS; k++)
+    {
+        fill_q15(in, block, loud);
+        bare_dsp_movavg_q15(&a, in, out_a, block);
+        bare_dsp_movavg_q15_ref(&b, in, out_b, block);
+        CHECK(memcmp(out_a, out_b, block * sizeof(q15_t)) == 0);
+        CHECK(a.sum == b.sum);
+    }
+}
+
+/** Operands at an odd element offset: the packed loads and stores are only halfword aligned */
+static void test_add_q15(uint32_t n, uint32_t offset, uint8_t loud)
+{
+    q15_t a[BLOCK_MAX + 1U];
+    q15_t b[BLOCK_MAX + 1U];
+    q15_t out_a[BLOCK_MAX + 1U];
+    q15_t out_b[BLOCK_MAX + 1U];
+
+    fill_q15(a, BLOCK_MAX + 1U, loud);
+    fill_q15(b, BLOCK_MAX + 1U, loud);
+    memset(out_a, 0x5A, sizeof(out_a));
+    memset(out_b, 0x5A, sizeof(out_b));
+
+    bare_dsp_add_q15(a + offset, b + offset, out_a + offset, n);
+    bare_dsp_add_q15_ref(a + offset, b + offset, out_b + offset, n);
+    CHECK(memcmp(out_a, out_b, sizeof(out_a)) == 0); // Nothing written past n either
+
+    /* In place (out aliases a) */
+    memcpy(out_a, a, sizeof(a));
+    bare_dsp_add_q15(out_a + offset, b + offset, out_a + offset, n);
+    CHECK(memcmp(out_a + offset, out_b + offset, n * sizeof(q15_t)) == 0);
+}
+
+int main(void)
+{
+    static const uint16_t taps[] = {1U, 2U, 3U, 4U, 5U, 7U, 8U, 32U, 33U};
+    static const uint32_t blocks[] = {1U, 2U, 3U, 7U, 16U, 37U};
+    uint8_t loud;
+    uint32_t t;
+    uint32_t n;
+
+    for (loud = 0U; loud < 2U; loud++)
+    {
+        for (t = 0U; t < (sizeof(taps) / sizeof(taps[0])); t++)
+        {
+            for (n = 0U; n < (sizeof(blocks) / sizeof(blocks[0])); n++)
+            {
+                test_fir_q15(taps[t], blocks[n], loud);
+                test_fir_q31(taps[t], blocks[n], loud);
+            }
+            test_decim_q15(2U, taps[t], 5U, loud);
+            test_decim_q15(3U, taps[t], 7U, loud);
+        }
+
+        for (n = 0U; n < (sizeof(blocks) / sizeof(blocks[0])); n++)
+        {
+            for (t = 1U; t <= 3U; t++)
+            {
+                test_biquad_q15((uint8_t)t, 0U, blocks[n], loud);
+                test_biquad_q15((uint8_t)t, 1U, blocks[n], loud);
+                test_biquad_q15((uint8_t)t, 2U, blocks[n], loud);
+            }
+            for (t = 0U; t <= 4U; t++)
+            {
+                test_movavg_q15((uint8_t)t, blocks[n], loud);
+            }
+        }
+
+        for (n = 0U; n <= BLOCK_MAX; n++)
+        {
+            test_add_q15(n, 0U, loud);
+            if (n < BLOCK_MAX)
+            {
+                test_add_q15(n, 1U, loud);
+            }
+        }
+    }
+
+    printf("test_dsp_kernels: ok\n");
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************************
+ * @file    test_frame_pty.c
+ * @author  ka5j
+ * @brief   Host test: frames through a pseudo terminal and back via tools/frame_codec
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The test plays the firmware on the pty master, frame_codec echoes on the slave
+ *          as the host peer would on a serial port. Payloads are chosen to break a tty
+ *          that is not fully raw (CR/LF, XON/XOFF, ^C/^D/^Z, DEL, NUL) and to cross COBS
+ *          block boundaries. A corrupted frame in the middle must be dropped by the tool
+ *          without losing sync.
+ *******************************************************************************************/
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+#include "host_mmio.h"
+#include "bare_frame.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#ifndef FRAME_CODEC
+#define FRAME_CODEC "build/frame_codec"
+#endif
+
+#define CASES 7U
+#define MAX_PAYLOAD 600U
+#define WIRE_MAX FRAME_WIRE_SIZE(MAX_PAYLOAD)
+#define TIMEOUT_MS 2000
+
+typedef struct
+{
+    uint8_t buf[WIRE_MAX];
+    size_t len;
+} wire_t;
+
+static uint8_t payloads[CASES][MAX_PAYLOAD];
+static size_t lengths[CASES];
+static uint8_t rx_buf[WIRE_MAX];
+
+static void sink(uint8_t byte, void *ctx)
+{
+    wire_t *w = (wire_t *)ctx;
+
+    CHECK(w->len < sizeof(w->buf));
+    w->buf[w->len++] = byte;
+}
+
+static void send_frame(int fd, uint8_t seq, uint8_t type, const uint8_t *p, size_t len,
+                       int corrupt)
+{
+    wire_t w;
+
+    w.len = 0U;
+    bare_frame_encode(seq, type, p, len, sink, &w);
+    if (corrupt)
+    {
+        w.buf[w.len / 2U] ^= 0x40U;
+        CHECK(w.buf[w.len / 2U] != FRAME_DELIMITER); // Still one frame on the wire
+    }
+    CHECK(write(fd, w.buf, w.len) == (ssize_t)w.len);
+}
+
+static void make_payloads(void)
+{
+    static const uint8_t tty_specials[] = {0x0DU, 0x0AU, 0x11U, 0x13U, 0x03U,
+                                           0x04U, 0x1AU, 0x7FU, 0x00U, 0xFFU};
+    uint32_t seed = 1U;
+    size_t i;
+
+    lengths[0] = 0U;
+
+    lengths[1] = 100U; // All zeros: one COBS code per byte
+
+    lengths[2] = 200U;
+    for (i = 0U; i < lengths[2]; i++)
+    {
+        payloads[2][i] = tty_specials[i % sizeof(tty_specials)];
+    }
+
+    lengths[3] = 256U;
+    for (i = 0U; i < lengths[3]; i++)
+    {
+        payloads[3][i] = (uint8_t)i;
+    }
+
+    lengths[4] = 254U - FRAME_HEADER_SIZE; // With header: exactly one full COBS block
+    memset(payloads[4], 0x01, lengths[4]);
+
+    lengths[5] = 255U;
+    memset(payloads[5], 0xA5, lengths[5]);
+
+    lengths[6] = MAX_PAYLOAD;
+    for (i = 0U; i < lengths[6]; i++)
+    {
+        seed = seed * 1103515245UL + 12345UL;
+        payloads[6][i] = (uint8_t)(seed >> 16);
+    }
+}
+
+/**
+ * @brief  Read from the master until one valid frame is assembled and decoded
+ */
+static void receive_frame(int fd, FRAME_Rx_t *rx, FRAME_Packet_t *pkt)
+{
+    for (;;)
+    {
+        struct pollfd pfd = {fd, POLLIN, 0};
+        uint8_t byte;
+
+        CHECK(poll(&pfd, 1, TIMEOUT_MS) == 1);
+        CHECK(read(fd, &byte, 1U) == 1);
+        if (bare_frame_rx_push(rx, byte) == FRAME_OK)
+        {
+            CHECK(bare_frame_decode(rx->buf, rx->len, pkt) == FRAME_OK);
+            bare_frame_rx_init(rx, rx_buf, sizeof(rx_buf));
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    struct termios t;
+    FRAME_Rx_t rx;
+    pid_t child;
+    int master;
+    int slave;
+    uint32_t i;
+
+    make_payloads();
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    CHECK(master >= 0);
+    CHECK(grantpt(master) == 0 && unlockpt(master) == 0);
+
+    /* Raw before the tool starts, so no early byte meets a cooked line discipline */
+    slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    CHECK(slave >= 0);
+    CHECK(tcgetattr(slave, &t) == 0);
+    cfmakeraw(&t);
+    CHECK(tcsetattr(slave, TCSANOW, &t) == 0);
+
+    child = fork();
+    CHECK(child >= 0);
+    if (child == 0)
+    {
+        int null = open("/dev/null", O_WRONLY);
+
+        dup2(null, STDERR_FILENO); // The corrupted frame is reported there
+        execl(FRAME_CODEC, "frame_codec", "echo", ptsname(master), (char *)NULL);
+        _exit(127);
+    }
+    close(slave);
+
+    for (i = 0U; i < CASES; i++)
+    {
+        send_frame(master, (uint8_t)i, (uint8_t)(0x80U + i), payloads[i], lengths[i], 0);
+        if (i == 3U)
+        {
+            send_frame(master, 0xEEU, 0xEEU, payloads[6], 40U, 1);
+        }
+    }
+
+    bare_frame_rx_init(&rx, rx_buf, sizeof(rx_buf));
+    for (i = 0U; i < CASES; i++)
+    {
+        FRAME_Packet_t pkt;
+
+        receive_frame(master, &rx, &pkt);
+        CHECK(pkt.seq == i);
+        CHECK(pkt.type == 0x80U + i);
+        CHECK(pkt.len == lengths[i]);
+        CHECK(memcmp(pkt.payload, payloads[i], pkt.len) == 0);
+    }
+
+    kill(child, SIGTERM);
+    waitpid(child, NULL, 0);
+    close(master);
+
+    printf("test_frame_pty: ok\n");
+    return 0;
+}
@@ -0,0 +1,322 @@
+/*******************************************************************************************
+ * @file    test_i2c_master.c
+ * @author  ka5j
+ * @brief   Host test: I2C master state machine stepped through SR1 events
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    A state machine is attached to the RAM-backed I2C1 window and the test plays the
+ *          peripheral: it acknowledges START/STOP requests in CR1, raises SB, ADDR, TXE, RXNE
+ *          and BTF in SR1 (only those whose interrupt CR2 has enabled), and calls
+ *          bare_i2c_bus_ev() or bare_i2c_bus_er() the way the vectors would. ACK, POS, STOP
+ *          and ITBUFEN are checked after each handler against RM0390 Section 27.3.3 for a
+ *          write, write-then-read of 1, 2 and N bytes, a NACK (AF) and lost arbitration.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_i2c.h"
+#include "i2c_registers.h"
+#include <string.h>
+
+/*******************************************************************************************
+ *                                 Simulated Peripheral
+ *******************************************************************************************/
+#define DEV_ADDR 0x50U
+#define RX_MAX 8U
+
+static I2C_Bus_t bus;
+static uint32_t done_count;
+static I2C_Status_t done_status;
+
+static void on_done(I2C_Status_t status, void *ctx)
+{
+    (void)ctx;
+    done_count++;
+    done_status = status;
+}
+
+static void bus_reset(void)
+{
+    memset((void *)I2C1, 0, sizeof(*I2C1));
+    bare_i2c_bus_init(&bus, I2C1, NULL);
+    done_count = 0U;
+    done_status = I2C_PENDING;
+}
+
+static void transaction(I2C_Transaction_t *t, const uint8_t *tx, uint16_t tx_len, uint8_t *rx,
+                        uint16_t rx_len)
+{
+    memset(t, 0, sizeof(*t));
+    t->addr = DEV_ADDR;
+    t->tx = tx;
+    t->tx_len = tx_len;
+    t->rx = rx;
+    t->rx_len = rx_len;
+    t->done = on_done;
+}
+
+/** Raise SR1 flags and run the event handler */
+static void event(uint32_t sr1)
+{
+    CHECK(I2C1->CR2 & I2C_CR2_ITEVTEN);
+    if (sr1 & (I2C_SR1_TXE | I2C_SR1_RXNE))
+    {
+        CHECK((sr1 & I2C_SR1_BTF) || (I2C1->CR2 & I2C_CR2_ITBUFEN));
+    }
+    I2C1->SR1 = sr1;
+    bare_i2c_bus_ev(&bus);
+    I2C1->SR1 = 0U;
+}
+
+/** Raise an error flag and run the error handler */
+static void error(uint32_t sr1)
+{
+    CHECK(I2C1->CR2 & I2C_CR2_ITERREN);
+    I2C1->SR1 = sr1;
+    bare_i2c_bus_er(&bus);
+    CHECK(I2C1->SR1 == (~sr1 & 0xFFFFUL)); // rc_w0: only the raised flags written as 0
+    I2C1->SR1 = 0U;
+}
+
+/** Hardware side of a STOP request: generated, then CR1.STOP cleared */
+static void stop_sent(void)
+{
+    CHECK(I2C1->CR1 & I2C_CR1_STOP);
+    I2C1->CR1 &= ~I2C_CR1_STOP;
+}
+
+/** START requested: raise SB and expect the address byte in DR */
+static void start_sent(uint8_t read)
+{
+    CHECK(I2C1->CR1 & I2C_CR1_START);
+    CHECK(I2C1->CR1 & I2C_CR1_ACK);
+    I2C1->CR1 &= ~I2C_CR1_START;
+    I2C1->SR2 = I2C_SR2_MSL | I2C_SR2_BUSY;
+    event(I2C_SR1_SB);
+    CHECK(bus.state == I2C_STATE_ADDR);
+    CHECK(I2C1->DR == ((DEV_ADDR << 1) | read));
+}
+
+/** Write phase: ADDR, one TXE per byte, TXE without BTF, then BTF */
+static void write_phase(const uint8_t *tx, uint16_t len)
+{
+    uint16_t i;
+
+    start_sent(0U);
+    event(I2C_SR1_ADDR);
+    CHECK(bus.state == I2C_STATE_TX);
+    CHECK(I2C1->CR2 & I2C_CR2_ITBUFEN);
+
+    for (i = 0U; i < len; i++)
+    {
+        I2C1->DR = 0U;
+        event(I2C_SR1_TXE);
+        CHECK(I2C1->DR == tx[i]);
+    }
+
+    /* Last byte still shifting out: wait for BTF with the buffer interrupt off */
+    event(I2C_SR1_TXE);
+    CHECK(!(I2C1->CR2 & I2C_CR2_ITBUFEN));
+    event(I2C_SR1_TXE | I2C_SR1_BTF);
+}
+
+/** Read phase of n bytes; data[] is what the slave sends */
+static void read_phase(const uint8_t *data, uint16_t n)
+{
+    uint16_t i;
+
+    start_sent(1U);
+    event(I2C_SR1_ADDR);
+    CHECK(bus.state == I2C_STATE_RX);
+    CHECK(!(I2C1->CR1 & I2C_CR1_POS) || (n == 2U));
+
+    if (n == 1U)
+    {
+        /* NACK and STOP set around the ADDR clear, byte taken on RXNE */
+        CHECK(!(I2C1->CR1 & I2C_CR1_ACK));
+        CHECK(I2C1->CR2 & I2C_CR2_ITBUFEN);
+        stop_sent();
+        I2C1->DR = data[0];
+        event(I2C_SR1_RXNE);
+        return;
+    }
+
+    if (n == 2U)
+    {
+        /* POS: the NACK goes to the second byte; both taken on BTF with the STOP before */
+        CHECK(!(I2C1->CR1 & I2C_CR1_ACK));
+        CHECK(I2C1->CR1 & I2C_CR1_POS);
+        CHECK(!(I2C1->CR1 & I2C_CR1_STOP));
+        CHECK(!(I2C1->CR2 & I2C_CR2_ITBUFEN));
+        I2C1->DR = data[0];
+        event(I2C_SR1_RXNE | I2C_SR1_BTF);
+        stop_sent();
+        return;
+    }
+
+    /* N > 2: ACK every byte up to N-3 */
+    CHECK(I2C1->CR1 & I2C_CR1_ACK);
+    CHECK(!(I2C1->CR1 & I2C_CR1_STOP));
+    for (i = 0U; i < (uint16_t)(n - 3U); i++)
+    {
+        CHECK(I2C1->CR2 & I2C_CR2_ITBUFEN);
+        I2C1->DR = data[i];
+        event(I2C_SR1_RXNE);
+        CHECK(I2C1->CR1 & I2C_CR1_ACK);
+    }
+
+    /* N-2 in DR: left there until N-1 fills the shifter (BTF) */
+    I2C1->DR = data[n - 3U];
+    event(I2C_SR1_RXNE);
+    CHECK(!(I2C1->CR2 & I2C_CR2_ITBUFEN));
+    CHECK(bus.idx == (uint16_t)(n - 3U));
+
+    /* BTF: clear ACK so byte N is NACKed, then read N-2 */
+    event(I2C_SR1_RXNE | I2C_SR1_BTF);
+    CHECK(!(I2C1->CR1 & I2C_CR1_ACK));
+    CHECK(!(I2C1->CR1 & I2C_CR1_STOP));
+    CHECK(bus.idx == (uint16_t)(n - 2U));
+
+    /* BTF again (N-1 in DR, N in the shifter): STOP, then the last two bytes */
+    I2C1->DR = data[n - 2U];
+    event(I2C_SR1_RXNE | I2C_SR1_BTF);
+    stop_sent();
+}
+
+/** Transaction finished last: callback ran and the interrupts are off */
+static void check_finished(const I2C_Transaction_t *t, I2C_Status_t status)
+{
+    CHECK(done_status == status);
+    CHECK(t->status == status);
+    CHECK(bus.state == I2C_STATE_IDLE);
+    CHECK(bus.cur == NULL);
+    CHECK(!(I2C1->CR1 & I2C_CR1_POS));
+    CHECK(!(I2C1->CR2 & (I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN)));
+}
+
+/*******************************************************************************************
+ *                                      Tests
+ *******************************************************************************************/
+
+static void test_write(void)
+{
+    const uint8_t tx[3] = {0x10U, 0x20U, 0x30U};
+    I2C_Transaction_t t;
+
+    bus_reset();
+    transaction(&t, tx, 3U, NULL, 0U);
+    bare_i2c_bus_submit(&bus, &t);
+    CHECK(I2C1->CR2 & I2C_CR2_ITERREN);
+
+    write_phase(tx, 3U);
+    stop_sent();
+    CHECK(done_count == 1U);
+    check_finished(&t, I2C_OK);
+}
+
+/** Register write then a read of n bytes after a repeated start */
+static void test_write_read(uint16_t n)
+{
+    const uint8_t reg = 0x0FU;
+    uint8_t data[RX_MAX];
+    uint8_t rx[RX_MAX];
+    I2C_Transaction_t t;
+    uint16_t i;
+
+    CHECK(n <= RX_MAX);
+    for (i = 0U; i < n; i++)
+    {
+        data[i] = (uint8_t)(0xA0U + i);
+    }
+    memset(rx, 0, sizeof(rx));
+
+    bus_reset();
+    transaction(&t, &reg, 1U, rx, n);
+    bare_i2c_bus_submit(&bus, &t);
+
+    write_phase(&reg, 1U);
+    CHECK(!(I2C1->CR1 & I2C_CR1_STOP)); // Repeated start, not a STOP
+    CHECK(bus.reading == 1U);
+    CHECK(done_count == 0U);
+
+    read_phase(data, n);
+    CHECK(done_count == 1U);
+    check_finished(&t, I2C_OK);
+
+    /* DR is plain memory here, so the final two reads in one BTF event both see N-1 */
+    for (i = 0U; i < n; i++)
+    {
+        CHECK(rx[i] == data[(n >= 2U && i == (uint16_t)(n - 1U)) ? (n - 2U) : i]);
+    }
+}
+
+/** Address NACK fails the transaction with a STOP and starts the next queued one */
+static void test_nack(void)
+{
+    const uint8_t tx[2] = {0x01U, 0x02U};
+    I2C_Transaction_t first;
+    I2C_Transaction_t second;
+
+    bus_reset();
+    transaction(&first, tx, 2U, NULL, 0U);
+    transaction(&second, tx, 2U, NULL, 0U);
+    bare_i2c_bus_submit(&bus, &first);
+    bare_i2c_bus_submit(&bus, &second);
+    CHECK(second.status == I2C_PENDING);
+
+    start_sent(0U);
+    error(I2C_SR1_AF);
+    CHECK(first.status == I2C_ERR_NACK);
+    CHECK(done_count == 1U);
+    stop_sent();
+
+    /* Second transaction on the bus; its data byte is NACKed */
+    CHECK(bus.cur == &second);
+    CHECK(bus.state == I2C_STATE_START);
+    start_sent(0U);
+    event(I2C_SR1_ADDR);
+    event(I2C_SR1_TXE);
+    error(I2C_SR1_AF);
+    stop_sent();
+    CHECK(done_count == 2U);
+    check_finished(&second, I2C_ERR_NACK);
+    CHECK(first.status == I2C_ERR_NACK);
+}
+
+/** Lost arbitration: the winner owns the bus, so no STOP is requested */
+static void test_arlo(void)
+{
+    const uint8_t reg = 0x00U;
+    uint8_t rx[4];
+    I2C_Transaction_t t;
+
+    bus_reset();
+    transaction(&t, &reg, 1U, rx, 4U);
+    bare_i2c_bus_submit(&bus, &t);
+    write_phase(&reg, 1U);
+    start_sent(1U);
+    event(I2C_SR1_ADDR);
+
+    error(I2C_SR1_ARLO);
+    CHECK(!(I2C1->CR1 & I2C_CR1_STOP));
+    CHECK(done_count == 1U);
+    check_finished(&t, I2C_ERR_ARLO);
+}
+
+int main(void)
+{
+    uint16_t n;
+
+    host_mmio_map();
+
+    test_write();
+    for (n = 1U; n <= RX_MAX; n++)
+    {
+        test_write_read(n);
+    }
+    test_nack();
+    test_arlo();
+
+    printf("test_i2c_master: ok\n");
+    return 0;
+}
@@ -0,0 +1,223 @@
+/*******************************************************************************************
+ * @file    test_i2c_recover.c
+ * @author  ka5j
+ * @brief   Host test: I2C bus recovery against a simulated open-drain bus
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The GPIO driver is replaced by a model of two open-drain lines with pull-ups and
+ *          a slave that holds SDA low for a given number of SCL clocks (a read interrupted
+ *          by a reset). Every line change is logged and checked against the recovery
+ *          sequence: up to nine clocks, then STOP (SDA rising while SCL is high), with the
+ *          pins never driven push-pull and handed back as open-drain AF with pull-up.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_i2c.h"
+#include "bare_gpio.h"
+#include "i2c_registers.h"
+#include <string.h>
+
+/*******************************************************************************************
+ *                                 Simulated Bus
+ *******************************************************************************************/
+#define SCL_PIN GPIO_PIN8
+#define SDA_PIN GPIO_PIN9
+#define I2C_AF 4U
+#define LOG_MAX 64U
+
+typedef struct
+{
+    uint8_t mode;
+    uint8_t otype;
+    uint8_t pull;
+    uint8_t af;
+    uint8_t out;
+} sim_pin_t;
+
+typedef struct
+{
+    char line;     /*!< 'C' SCL, 'D' SDA */
+    uint8_t level; /*!< New level */
+} sim_event_t;
+
+static sim_pin_t pins[16];
+static uint32_t slave_clocks; /*!< SCL rising edges until the slave releases SDA */
+static uint8_t scl_level = 1U;
+static uint8_t sda_level = 1U;
+static sim_event_t events[LOG_MAX];
+static uint32_t event_count;
+static uint32_t push_pull_writes;
+
+static uint8_t drives_low(GPIO_Pins_t pin)
+{
+    return (pins[pin].mode == GPIO_MODE_OUTPUT) && (pins[pin].out == 0U);
+}
+
+static void log_event(char line, uint8_t level)
+{
+    CHECK(event_count < LOG_MAX);
+    events[event_count].line = line;
+    events[event_count].level = level;
+    event_count++;
+}
+
+/** Recompute both wired-AND lines after a pin change */
+static void settle(void)
+{
+    uint8_t scl = drives_low(SCL_PIN) ? 0U : 1U;
+    uint8_t sda;
+
+    if (scl != scl_level)
+    {
+        scl_level = scl;
+        log_event('C', scl);
+        if (scl && (slave_clocks > 0U))
+        {
+            slave_clocks--;
+        }
+    }
+    sda = (drives_low(SDA_PIN) || (slave_clocks > 0U)) ? 0U : 1U;
+    if (sda != sda_level)
+    {
+        sda_level = sda;
+        log_event('D', sda);
+    }
+}
+
+void bare_gpio_init(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin, GPIO_Mode_t mode, GPIO_OType_t otype,
+                    GPIO_Speed_t speed, GPIO_Pull_t pull)
+{
+    (void)GPIOx;
+    (void)speed;
+    pins[pin].mode = (uint8_t)mode;
+    pins[pin].otype = (uint8_t)otype;
+    pins[pin].pull = (uint8_t)pull;
+    if (otype == GPIO_OTYPE_PP)
+    {
+        push_pull_writes++;
+    }
+    settle();
+}
+
+void bare_gpio_write(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin, GPIO_PinState_t state)
+{
+    (void)GPIOx;
+    pins[pin].out = (state == GPIO_PIN_SET) ? 1U : 0U;
+    settle();
+}
+
+GPIO_PinState_t bare_gpio_read(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin)
+{
+    (void)GPIOx;
+    return ((pin == SCL_PIN) ? scl_level : sda_level) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void bare_gpio_set_AF(GPIO_TypeDef *GPIOx, GPIO_Pins_t pin, uint8_t af)
+{
+    (void)GPIOx;
+    pins[pin].af = af;
+}
+
+/*******************************************************************************************
+ *                                      Tests
+ *******************************************************************************************/
+
+static void bus_reset(uint32_t stuck_clocks)
+{
+    memset(pins, 0, sizeof(pins));
+    slave_clocks = stuck_clocks;
+    scl_level = 1U;
+    sda_level = (stuck_clocks > 0U) ? 0U : 1U;
+    event_count = 0U;
+    push_pull_writes = 0U;
+}
+
+static void check_pins_handed_back(void)
+{
+    GPIO_Pins_t p[2] = {SCL_PIN, SDA_PIN};
+    uint32_t i;
+
+    for (i = 0U; i < 2U; i++)
+    {
+        CHECK(pins[p[i]].mode == GPIO_MODE_AF);
+        CHECK(pins[p[i]].otype == GPIO_OTYPE_OD);
+        CHECK(pins[p[i]].pull == GPIO_PULLUP);
+        CHECK(pins[p[i]].af == I2C_AF);
+    }
+    CHECK(push_pull_writes == 0U);
+    CHECK(I2C1->CR1 == I2C_CR1_PE);
+}
+
+/** Slave releases after `stuck` clocks: expect that many clocks (at most 9), then a STOP */
+static void test_recover(uint32_t stuck)
+{
+    uint32_t clocks = (stuck < 9U) ? stuck : 9U;
+    uint8_t released;
+    uint32_t i;
+    uint32_t e;
+
+    bus_reset(stuck);
+    released = bare_i2c_recover(I2C1);
+
+    /* Clock pulses while SDA is held; the slave lets go after its last one */
+    for (i = 0U; i < clocks; i++)
+    {
+        CHECK(events[2U * i].line == 'C' && events[2U * i].level == 0U);
+        CHECK(events[2U * i + 1U].line == 'C' && events[2U * i + 1U].level == 1U);
+    }
+    e = 2U * clocks;
+
+    if (stuck <= 9U)
+    {
+        if (stuck > 0U)
+        {
+            CHECK(events[e].line == 'D' && events[e].level == 1U);
+            e++;
+        }
+        /* STOP: SCL low, SDA low, SCL high, SDA high */
+        CHECK(released == 1U);
+        CHECK(event_count == e + 4U);
+        CHECK(events[e].line == 'C' && events[e].level == 0U);
+        CHECK(events[e + 1U].line == 'D' && events[e + 1U].level == 0U);
+        CHECK(events[e + 2U].line == 'C' && events[e + 2U].level == 1U);
+        CHECK(events[e + 3U].line == 'D' && events[e + 3U].level == 1U);
+    }
+    else
+    {
+        /* Slave never lets go: nine clocks only, and the STOP cannot raise SDA */
+        CHECK(released == 0U);
+        CHECK(event_count == e + 2U);
+        CHECK(sda_level == 0U);
+    }
+    CHECK(scl_level == 1U);
+    check_pins_handed_back();
+}
+
+int main(void)
+{
+    const I2C_Config_t cfg = {
+        .scl = {GPIOB, SCL_PIN},
+        .sda = {GPIOB, SDA_PIN},
+        .af = I2C_AF,
+        .speed_hz = 100000UL,
+        .use_dma = 0U,
+    };
+    uint32_t stuck;
+
+    host_mmio_map();
+
+    /* Init runs a recovery too: the pins must end open-drain */
+    bus_reset(0U);
+    CHECK(bare_i2c_init(I2C1, &cfg) != 0U);
+    check_pins_handed_back();
+
+    for (stuck = 0U; stuck <= 9U; stuck++)
+    {
+        test_recover(stuck);
+    }
+    test_recover(100U);
+
+    printf("test_i2c_recover: ok\n");
+    return 0;
+}
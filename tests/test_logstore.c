@@ -0,0 +1,340 @@
+/*******************************************************************************************
+ * @file    test_logstore.c
+ * @author  ka5j
+ * @brief   Host test: log store on a file-backed flash image, across remounts and power cuts
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    The store uses a ring of sectors 1-3 (3 x 16 KB) in host_flash's image, and every
+ *          remount closes and reopens the file as a reset would. Three runs:
+ *          - append and remount: config values and log history read back;
+ *          - wrap: the ring rotates many times, the oldest log records are dropped while
+ *            every config tag, also one written only once at the start, stays current;
+ *          - torn writes: power is cut after each possible number of programmed words,
+ *            including during a rotation. After the remount the store holds every flushed
+ *            record, at most the one being programmed besides, and keeps appending;
+ *          - program errors: one program operation fails at each possible word around the
+ *            rotation that copies the first sector's config records forward. The store
+ *            keeps running (and erasing) before the remount; no config value is lost.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "host_flash.h"
+#include "bare_logstore.h"
+#include <string.h>
+#include <unistd.h>
+
+#define IMAGE "build/test_logstore.img"
+
+#define RING_FIRST 1U
+#define RING_SECTORS 3U
+#define RING_BYTES (RING_SECTORS * 16384U)
+
+#define TAG_COUNTER 1U /*!< Config: updated all the time */
+#define TAG_ONCE 5U    /*!< Config: written once, must survive every rotation */
+#define TAG_LOG 0x40U  /*!< Log records, payload starts with a running number */
+#define LOG_LEN 100U
+
+#define TORN_BASE_STEPS 140U /*!< Fills most of the first sector */
+#define TORN_STEPS 40U       /*!< Crosses into the next sector */
+#define FAIL_BASE_STEPS 280U /*!< Into the second sector, most of it filled */
+#define FAIL_STEPS 40U       /*!< Crosses into the third: the first one is reclaimed */
+#define FAIL_POLLS 8U        /*!< bare_logstore_poll() calls after the error */
+
+static const LOGSTORE_Config_t ring = {&bare_flash_ops, RING_FIRST, RING_SECTORS};
+static const char once_value[] = "written once";
+
+/** Log numbers seen by bare_logstore_foreach() */
+typedef struct
+{
+    uint32_t first;
+    uint32_t count;
+    uint32_t once;
+} walk_t;
+
+/*******************************************************************************************
+ *                                     Helpers
+ *******************************************************************************************/
+
+static void mount(void)
+{
+    host_flash_close();
+    host_flash_open(IMAGE);
+    CHECK(bare_logstore_init(&ring) == LOGSTORE_OK);
+}
+
+static void fresh(void)
+{
+    host_flash_close();
+    unlink(IMAGE);
+    mount();
+}
+
+static LOGSTORE_Status_t append_log(uint32_t n)
+{
+    uint8_t rec[LOG_LEN];
+    uint32_t i;
+
+    for (i = 0U; i < LOG_LEN; i++)
+    {
+        rec[i] = (uint8_t)(n * 7U + i);
+    }
+    memcpy(rec, &n, sizeof(n));
+    return bare_logstore_append(TAG_LOG, rec, LOG_LEN);
+}
+
+static uint32_t read_counter(void)
+{
+    uint32_t v = 0xDEADBEEFUL;
+    uint8_t len = 0U;
+
+    CHECK(bare_logstore_read(TAG_COUNTER, &v, sizeof(v), &len) == LOGSTORE_OK);
+    CHECK(len == sizeof(v));
+    return v;
+}
+
+static void check_once(void)
+{
+    char buf[sizeof(once_value)];
+    uint8_t len = 0U;
+
+    CHECK(bare_logstore_read(TAG_ONCE, buf, sizeof(buf), &len) == LOGSTORE_OK);
+    CHECK(len == sizeof(once_value));
+    CHECK(memcmp(buf, once_value, sizeof(buf)) == 0);
+}
+
+/** Log records must be complete and numbered without gaps, oldest first */
+static void visit(uint8_t tag, const void *data, uint8_t len, void *ctx)
+{
+    walk_t *w = (walk_t *)ctx;
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t n;
+    uint32_t i;
+
+    if (tag == TAG_ONCE)
+    {
+        w->once++;
+    }
+    if (tag != TAG_LOG)
+    {
+        return;
+    }
+    CHECK(len == LOG_LEN);
+    memcpy(&n, p, sizeof(n));
+    for (i = sizeof(n); i < LOG_LEN; i++)
+    {
+        CHECK(p[i] == (uint8_t)(n * 7U + i));
+    }
+    if (w->count == 0U)
+    {
+        w->first = n;
+    }
+    CHECK(n == w->first + w->count);
+    w->count++;
+}
+
+static walk_t walk(void)
+{
+    walk_t w = {0U, 0U, 0U};
+
+    CHECK(bare_logstore_foreach(visit, &w) == LOGSTORE_OK);
+    CHECK(w.once >= 1U);
+    return w;
+}
+
+/*******************************************************************************************
+ *                                      Tests
+ *******************************************************************************************/
+
+static void test_append_remount(void)
+{
+    uint32_t v;
+    uint32_t i;
+    walk_t w;
+
+    fresh();
+    CHECK(bare_logstore_read(TAG_COUNTER, &v, sizeof(v), NULL) == LOGSTORE_ERR_NOT_FOUND);
+    CHECK(bare_logstore_append(TAG_ONCE, once_value, sizeof(once_value)) == LOGSTORE_OK);
+    for (i = 0U; i < 10U; i++)
+    {
+        CHECK(append_log(i) == LOGSTORE_OK);
+        CHECK(bare_logstore_append(TAG_COUNTER, &i, sizeof(i)) == LOGSTORE_OK);
+    }
+    CHECK(read_counter() == 9U); // Still in the RAM buffer
+    CHECK(bare_logstore_flush() == LOGSTORE_OK);
+
+    mount();
+    CHECK(read_counter() == 9U);
+    check_once();
+    w = walk();
+    CHECK(w.first == 0U && w.count == 10U);
+    CHECK(bare_logstore_stats()->torn == 0U);
+}
+
+static void test_wrap(void)
+{
+    uint32_t n;
+    walk_t w;
+
+    fresh();
+    CHECK(bare_logstore_append(TAG_ONCE, once_value, sizeof(once_value)) == LOGSTORE_OK);
+    for (n = 0U; bare_logstore_stats()->rotations < 4U * RING_SECTORS; n++)
+    {
+        CHECK(append_log(n) == LOGSTORE_OK);
+        if ((n % 10U) == 0U)
+        {
+            CHECK(bare_logstore_append(TAG_COUNTER, &n, sizeof(n)) == LOGSTORE_OK);
+        }
+        bare_logstore_poll();
+    }
+    CHECK(bare_logstore_stats()->erases >= 3U * RING_SECTORS);
+
+    w = walk();
+    CHECK(w.first > 0U);           // Oldest history dropped
+    CHECK(w.first + w.count == n); // Newest all there
+    CHECK(w.count >= 140U);        // The last full sector and the open one
+    CHECK(read_counter() == ((n - 1U) / 10U) * 10U);
+    check_once();
+
+    mount();
+    CHECK(read_counter() == ((n - 1U) / 10U) * 10U);
+    check_once();
+    w = walk();
+    CHECK(w.first + w.count == n);
+}
+
+/** One step: a log record and the counter, flushed. Returns 0 if the flash failed */
+static uint8_t step(uint32_t n)
+{
+    uint32_t v = n + 1U;
+
+    return (append_log(n) == LOGSTORE_OK) &&
+           (bare_logstore_append(TAG_COUNTER, &v, sizeof(v)) == LOGSTORE_OK) &&
+           (bare_logstore_flush() == LOGSTORE_OK);
+}
+
+/** After a failed step and a remount: flushed steps there, the interrupted one at most */
+static uint32_t check_after_failure(uint32_t steps_done)
+{
+    uint32_t counter = read_counter();
+    walk_t w = walk();
+
+    CHECK(counter == steps_done || counter == steps_done + 1U);
+    CHECK(w.first + w.count == counter || w.first + w.count == counter + 1U);
+    check_once();
+
+    /* And the store keeps working behind the damage */
+    CHECK(step(w.first + w.count));
+    mount();
+    CHECK(read_counter() == w.first + w.count + 1U);
+    w = walk();
+    CHECK(w.first + w.count == read_counter());
+    check_once();
+    return w.first;
+}
+
+/** Take the ring back to a snapshot and mount it, as after a reset */
+static void restore(const uint8_t *snapshot)
+{
+    host_flash_close();
+    host_flash_open(IMAGE);
+    memcpy((void *)bare_flash_sector_addr(RING_FIRST), snapshot, RING_BYTES);
+    CHECK(bare_logstore_init(&ring) == LOGSTORE_OK);
+}
+
+/** Fill the ring with a number of steps and keep a copy of it */
+static void prepare(uint8_t *snapshot, uint32_t steps, uint32_t rotations)
+{
+    uint32_t n;
+
+    fresh();
+    CHECK(bare_logstore_append(TAG_ONCE, once_value, sizeof(once_value)) == LOGSTORE_OK);
+    for (n = 0U; n < steps; n++)
+    {
+        CHECK(step(n));
+    }
+    CHECK(bare_logstore_stats()->rotations == rotations); // The format included
+    memcpy(snapshot, (const void *)bare_flash_sector_addr(RING_FIRST), RING_BYTES);
+}
+
+static void test_torn(void)
+{
+    static uint8_t snapshot[RING_BYTES];
+    uint32_t torn_mounts = 0U;
+    uint32_t tear;
+
+    prepare(snapshot, TORN_BASE_STEPS, 1U);
+    for (tear = 0U;; tear++)
+    {
+        uint32_t done = 0U;
+
+        restore(snapshot);
+        host_flash_tear_after(tear);
+        while ((done < TORN_STEPS) && step(TORN_BASE_STEPS + done))
+        {
+            done++;
+        }
+        if (done == TORN_STEPS)
+        {
+            CHECK(!host_flash_powered_off());
+            CHECK(bare_logstore_stats()->rotations == 1U); // Counted since the mount
+            break; // Every word of the run has been torn once
+        }
+        CHECK(host_flash_powered_off());
+
+        /* Reset: nothing dropped yet, the oldest log record is still the first one */
+        mount();
+        torn_mounts += bare_logstore_stats()->torn;
+        CHECK(check_after_failure(TORN_BASE_STEPS + done) == 0U);
+    }
+    CHECK(tear > TORN_STEPS * (1U + LOG_LEN / 4U));
+    CHECK(torn_mounts > 0U);
+}
+
+static void test_prog_error(void)
+{
+    static uint8_t snapshot[RING_BYTES];
+    uint32_t fail;
+
+    prepare(snapshot, FAIL_BASE_STEPS, 2U);
+    for (fail = 0U;; fail++)
+    {
+        uint32_t done = 0U;
+        uint32_t i;
+
+        restore(snapshot);
+        host_flash_fail_after(fail);
+        while ((done < FAIL_STEPS) && step(FAIL_BASE_STEPS + done))
+        {
+            done++;
+        }
+        if (done == FAIL_STEPS)
+        {
+            CHECK(bare_logstore_stats()->rotations == 1U);
+            break; // Every word of the run has failed once
+        }
+        CHECK(!host_flash_powered_off());
+
+        /* The application carries on: a queued erase would complete now */
+        for (i = 0U; i < FAIL_POLLS; i++)
+        {
+            bare_logstore_poll();
+        }
+        mount();
+        (void)check_after_failure(FAIL_BASE_STEPS + done);
+    }
+    CHECK(fail > FAIL_STEPS * (1U + LOG_LEN / 4U));
+}
+
+int main(void)
+{
+    test_append_remount();
+    test_wrap();
+    test_torn();
+    test_prog_error();
+    host_flash_close();
+    unlink(IMAGE);
+
+    printf("test_logstore: ok\n");
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************************
+ * @file    test_rcc_profile.c
+ * @author  ka5j
+ * @brief   Host test: failed clock switches never lower the flash latency under a fast clock
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    RCC and PWR are plain memory, so ready flags only change when the test sets
+ *          them. A flag that never rises plays the part of a clock that does not start.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_rcc.h"
+#include "stm32f446re_addresses.h"
+#include "rcc_registers.h"
+#include "flash_registers.h"
+
+#define CFGR_SWS_PLL (0x2UL << 2)
+#define CR_HSIRDY (1UL << 1)
+#define ACR_5WS (FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN | 5UL)
+
+static uint32_t pre_calls;
+static uint32_t post_calls;
+
+static void count_hook(RCC_ClockPhase_t phase)
+{
+    if (phase == RCC_CLOCK_PRE)
+    {
+        pre_calls++;
+    }
+    else
+    {
+        post_calls++;
+    }
+}
+
+int main(void)
+{
+    host_mmio_map();
+    CHECK(bare_rcc_register_hook(count_hook) == RCC_OK);
+
+    /* Running from the PLL at 5 wait states and HSI never gets ready: nothing changes */
+    RCC->CFGR = CFGR_SWS_PLL | 0x2UL;
+    FLASH->ACR = ACR_5WS;
+    CHECK(bare_rcc_set_profile(RCC_PROFILE_HSI_16MHZ) == RCC_ERR_TIMEOUT);
+    CHECK(FLASH->ACR == ACR_5WS);
+    CHECK(pre_calls == 1U && post_calls == 0U);
+
+    /* HSI switch confirmed but the PLL never locks: left on HSI, drivers follow */
+    RCC->CFGR = 0U;
+    RCC->CR = CR_HSIRDY;
+    CHECK(bare_rcc_set_profile(RCC_PROFILE_PLL_84MHZ) == RCC_ERR_TIMEOUT);
+    CHECK((FLASH->ACR & FLASH_ACR_LATENCY_Msk) == 0U);
+    CHECK(bare_rcc_get_profile() == RCC_PROFILE_HSI_16MHZ);
+    CHECK(pre_calls == 2U && post_calls == 1U);
+
+    /* Plain HSI profile with SWS confirming it */
+    FLASH->ACR = ACR_5WS;
+    CHECK(bare_rcc_set_profile(RCC_PROFILE_HSI_16MHZ) == RCC_OK);
+    CHECK((FLASH->ACR & FLASH_ACR_LATENCY_Msk) == 0U);
+    CHECK(post_calls == 2U);
+
+    printf("test_rcc_profile: ok\n");
+    return 0;
+}
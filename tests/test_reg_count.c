@@ -0,0 +1,93 @@
+/*******************************************************************************************
+ * @file    test_reg_count.c
+ * @author  ka5j
+ * @brief   Host test: bus accesses of merged field updates (bare_reg.h)
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Built with -include host/host_reg.h, which routes BARE_REG_READ / BARE_REG_WRITE
+ *          through counters. A merged update must cost one read and one write however many
+ *          fields it names, a full-mask update or bare_reg_write() no read at all. The
+ *          driver sequences checked are bare_usart_init() (CR1: disable, then one RMW for
+ *          the frame format and the enables), bare_usart_set_baud() (CR1: disable and
+ *          enable) and SysTick_Init() (CSR: one store).
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "host_reg.h"
+#include "bare_reg.h"
+#include "bare_usart.h"
+#include "bare_systick.h"
+#include "usart_registers.h"
+#include "systick_registers.h"
+
+/*******************************************************************************************
+ *                                      Tests
+ *******************************************************************************************/
+
+static void test_merge(void)
+{
+    volatile uint32_t reg = 0xA5A5A5A5UL;
+
+    host_reg_reset();
+    bare_reg_modify(&reg, BARE_FIELD(0x0000000FUL, 0x3U) | BARE_FIELD(0x00000F00UL, 0xCU) |
+                              BARE_FIELD(0x00F00000UL, 0x0U));
+    CHECK(reg == 0xA505ACA3UL);
+    CHECK(host_reg_reads(&reg) == 1U && host_reg_writes(&reg) == 1U);
+
+    host_reg_reset();
+    bare_reg_modify(&reg, BARE_FIELD_ALL | BARE_FIELD(0x000000F0UL, 0x7U));
+    CHECK(reg == 0x00000070UL);
+    CHECK(host_reg_reads(&reg) == 0U && host_reg_writes(&reg) == 1U);
+
+    host_reg_reset();
+    bare_reg_modify(&reg, 0U); // Nothing to update: no access
+    bare_reg_write(&reg, BARE_FIELD(0x00000003UL, 0x2U));
+    CHECK(reg == 0x00000002UL);
+    CHECK(host_reg_reads(&reg) == 0U && host_reg_writes(&reg) == 1U);
+    CHECK(bare_reg_get(&reg, 0x00000003UL) == 0x2U);
+    CHECK(host_reg_reads(&reg) == 1U);
+}
+
+static void test_usart_init(void)
+{
+    USART2->CR1 = USART_CR1_M | USART_CR1_PCE | USART_CR1_OVER8 | USART_CR1_UE; // Stale setup
+
+    host_reg_reset();
+    bare_usart_init();
+    CHECK(USART2->CR1 == (USART_CR1_TE | USART_CR1_RE | USART_CR1_UE));
+    CHECK(host_reg_reads(&USART2->CR1) == 2U);
+    CHECK(host_reg_writes(&USART2->CR1) == 2U);
+
+    /* Baud change: UE off and on around the BRR store, nothing else through the layer */
+    USART2->SR = USART_SR_TC;
+    host_reg_reset();
+    CHECK(bare_usart_set_baud(9600U) != 0U);
+    CHECK(USART2->CR1 == (USART_CR1_TE | USART_CR1_RE | USART_CR1_UE));
+    CHECK(host_reg_reads(&USART2->CR1) == 2U && host_reg_writes(&USART2->CR1) == 2U);
+    CHECK(host_reg_total() == 4U);
+}
+
+static void test_systick_init(void)
+{
+    SYSTICK->CSR = 0U;
+
+    host_reg_reset();
+    SysTick_Init(SYSTICK_RELOAD, SYSTICK_PROCESSOR_CLK, SYSTICK_ENABLE_INTERRUPT,
+                 SYSTICK_CLK_IMPL, SYSTICK_CALIB);
+    CHECK(SYSTICK->CSR == (SYSTICK_CSR_CLKSOURCE | SYSTICK_CSR_TICKINT | SYSTICK_CSR_ENABLE));
+    CHECK(host_reg_reads(&SYSTICK->CSR) == 0U);
+    CHECK(host_reg_writes(&SYSTICK->CSR) == 1U);
+}
+
+int main(void)
+{
+    host_mmio_map();
+
+    test_merge();
+    test_usart_init();
+    test_systick_init();
+
+    printf("test_reg_count: ok\n");
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*******************************************************************************************
+ * @file    test_timseq_preload.c
+ * @author  ka5j
+ * @brief   Host test: the register sequencer preloads only the output channels it writes
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    TIM3 has PWM outputs on CH1, CH3 and CH4 and an input capture on CH2 with a /2
+ *          edge prescaler. Bit 3 of a CCMR channel byte is OCxPE on an output but ICxPSC
+ *          on an input (setting it turns /2 into /8), so only output channels whose CCRx
+ *          is in the frame may gain it.
+ *******************************************************************************************/
+
+#include "host_mmio.h"
+#include "bare_timseq.h"
+#include "tim2_5_registers.h"
+
+#define OUT_PWM1 (TIM_OCM_PWM1 << 4)                            /*!< OCxM, channel byte */
+#define IN_DIV2 (TIM_CCMR_CCS_TI | (1UL << TIM_CCMR_ICPSC_Pos)) /*!< TI, every 2nd edge */
+
+static const uint32_t table[2U * 4U];
+
+static void setup(void)
+{
+    TIM3->CR1 = 0U;
+    TIM3->CCMR1 = OUT_PWM1 | (IN_DIV2 << 8);
+    TIM3->CCMR2 = OUT_PWM1 | (OUT_PWM1 << 8);
+}
+
+int main(void)
+{
+    TIMSEQ_Config_t cfg = {TIMSEQ_REG_ARR, 3U, table, 2U, 1U, NULL, NULL};
+
+    host_mmio_map();
+
+    /* ARR, padding, CCR1: CH1 only */
+    setup();
+    bare_timseq_start(TIM3, &cfg);
+    CHECK(TIM3->CR1 & TIM_CR1_ARPE);
+    CHECK(TIM3->CCMR1 == ((OUT_PWM1 | TIM_CCMR_OCPE) | (IN_DIV2 << 8)));
+    CHECK(TIM3->CCMR2 == (OUT_PWM1 | (OUT_PWM1 << 8)));
+
+    /* CCR1-CCR4: every output, the capture prescaler of CH2 untouched */
+    setup();
+    cfg.first = TIMSEQ_REG_CCR1;
+    cfg.regs = 4U;
+    bare_timseq_start(TIM3, &cfg);
+    CHECK(TIM3->CCMR1 == ((OUT_PWM1 | TIM_CCMR_OCPE) | (IN_DIV2 << 8)));
+    CHECK(TIM3->CCMR2 == ((OUT_PWM1 | TIM_CCMR_OCPE) | ((OUT_PWM1 | TIM_CCMR_OCPE) << 8)));
+
+    /* PSC and ARR only: no channel */
+    setup();
+    cfg.first = TIMSEQ_REG_PSC;
+    cfg.regs = 2U;
+    bare_timseq_start(TIM3, &cfg);
+    CHECK(TIM3->CCMR1 == (OUT_PWM1 | (IN_DIV2 << 8)));
+    CHECK(TIM3->CCMR2 == (OUT_PWM1 | (OUT_PWM1 << 8)));
+
+    printf("test_timseq_preload: ok\n");
+    return 0;
+}
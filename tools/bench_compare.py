@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Compare two driver_benchmark runs and flag regressions.
+
+Reads the BENCH BEGIN ... BENCH END block written by examples/driver_benchmark.c
+from a baseline capture and a new capture (a file, or a serial port when pyserial
+is installed) and prints every metric side by side. Units:
+
+    cycles        latencies and one-off costs (irq_*, init_*, usart_dma_start, ...)
+    cycles_x100   per-item costs scaled by 100: per GPIO toggle (gpio_*) and per
+                  byte on each CRC path (crc32_*_hw / _table / _dma, crc16_*_table)
+    Bps           throughput in bytes per second (usart_*, frame_encode/decode)
+    hz            information only (hclk)
+
+Metrics in cycles or cycles_x100 regress when they grow, Bps metrics when they
+shrink, by more than the tolerance. Info metrics only warn when they differ, since
+a different clock makes the cycle counts incomparable. Metrics present in one run
+only (a baseline from before a case was added) are listed but never flagged.
+Exits with status 1 on any regression.
+
+    python3 tools/bench_compare.py baseline.txt new.txt
+    python3 tools/bench_compare.py baseline.txt --port /dev/ttyACM0 --save new.txt
+"""
+
+import argparse
+import sys
+
+LOWER_IS_BETTER = {"cycles", "cycles_x100"}
+HIGHER_IS_BETTER = {"Bps"}
+
+
+def read_bench(lines, save=None):
+    """Return {metric: (value, unit)} from the first complete BENCH block."""
+    metrics = None
+    for raw in lines:
+        line = raw.strip()
+        if save is not None and line and not line.startswith("#"):
+            save.write(line + "\n")
+        if line == "BENCH BEGIN":
+            metrics = {}
+        elif line == "BENCH END" and metrics is not None:
+            return metrics
+        elif metrics is not None and line and not line.startswith("#"):
+            name, value, unit = line.split(",")
+            metrics[name] = (int(value), unit)
+    raise SystemExit("no complete BENCH BEGIN ... BENCH END block in input")
+
+
+def serial_lines(port, baud):
+    try:
+        import serial
+    except ImportError:
+        raise SystemExit("--port needs pyserial (pip install pyserial)")
+    with serial.Serial(port, baud, timeout=None) as s:
+        while True:
+            yield s.readline().decode(errors="replace")
+
+
+def compare(base, new, tolerance):
+    """Print the comparison table; return the number of regressions."""
+    regressions = 0
+    print(f"{'metric':<24} {'baseline':>12} {'new':>12} {'change':>9}  unit")
+    for name in sorted(set(base) | set(new)):
+        if name not in base or name not in new:
+            where = "baseline" if name in base else "new run"
+            print(f"{name:<24} only in the {where}")
+            continue
+        (old, unit), (cur, new_unit) = base[name], new[name]
+        if unit != new_unit:
+            print(f"{name:<24} unit changed {unit} -> {new_unit}")
+            continue
+        change = 100.0 * (cur - old) / old if old else 0.0
+        if unit in LOWER_IS_BETTER:
+            worse = change > tolerance
+        elif unit in HIGHER_IS_BETTER:
+            worse = -change > tolerance
+        else:
+            worse = False
+        flag = ""
+        if worse:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif unit not in LOWER_IS_BETTER | HIGHER_IS_BETTER and cur != old:
+            flag = "  warning: runs are not comparable"
+        print(f"{name:<24} {old:>12} {cur:>12} {change:>+8.1f}%  {unit}{flag}")
+    return regressions
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("baseline", help="capture of the reference run")
+    ap.add_argument("new", nargs="?", default="-", help="capture of the new run (default: stdin)")
+    ap.add_argument("--port", help="read the new run from a serial port instead")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--save", help="also write the new run's result lines to this file")
+    ap.add_argument("--tolerance", type=float, default=5.0,
+                    help="allowed change in percent before flagging (default: 5)")
+    args = ap.parse_args()
+
+    with open(args.baseline, errors="replace") as f:
+        base = read_bench(f)
+
+    if args.port:
+        lines = serial_lines(args.port, args.baud)
+    elif args.new == "-":
+        lines = sys.stdin
+    else:
+        lines = open(args.new, errors="replace")
+
+    save = open(args.save, "w") if args.save else None
+    new = read_bench(lines, save)
+    if save is not None:
+        save.close()
+
+    regressions = compare(base, new, args.tolerance)
+    if regressions:
+        print(f"{regressions} regression(s) beyond {args.tolerance:g}%", file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,217 @@
+/*******************************************************************************************
+ * @file    frame_codec.c
+ * @author  ka5j
+ * @brief   Host side of the bare_frame link: encode, decode and echo frames
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @note    Built from the same bare_frame.c / bare_crc_sw.c as the firmware, so both ends
+ *          of the link share one codec:
+ *              cc -std=c99 -Iinc tools/frame_codec.c src/bare_frame.c src/bare_crc_sw.c \
+ *                 -o frame_codec
+ *
+ *          frame_codec encode TYPE [SEQ]   payload on stdin -> one wire frame on stdout
+ *          frame_codec decode [DEV]        wire bytes -> "seq type len hex" per frame
+ *          frame_codec echo DEV            send every valid frame back, as the firmware
+ *                                          peer of a loopback test
+ *
+ *          DEV is a serial port or pty, switched to raw 8N1 so that no byte is translated
+ *          (0x0D, 0x11/0x13 and 0x00 all occur on the wire). Without DEV, decode reads
+ *          stdin. Bad frames are reported on stderr and skipped.
+ *******************************************************************************************/
+
+#define _DEFAULT_SOURCE
+#include "bare_frame.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+/*******************************************************************************************
+ *                                Internal Definitions
+ *******************************************************************************************/
+#define CODEC_MAX_PAYLOAD 4096U
+#define CODEC_BUFFER_SIZE FRAME_WIRE_SIZE(CODEC_MAX_PAYLOAD)
+
+/** Output buffered per frame so a frame leaves in one write() */
+typedef struct
+{
+    uint8_t buf[CODEC_BUFFER_SIZE];
+    size_t len;
+} codec_out_t;
+
+static uint8_t codec_rx_buf[CODEC_BUFFER_SIZE];
+
+/*******************************************************************************************
+ *                               Internal Helper Functions
+ *******************************************************************************************/
+
+static void codec_sink(uint8_t byte, void *ctx)
+{
+    codec_out_t *out = (codec_out_t *)ctx;
+
+    if (out->len < sizeof(out->buf))
+    {
+        out->buf[out->len++] = byte;
+    }
+}
+
+static int codec_write_all(int fd, const uint8_t *p, size_t len)
+{
+    while (len != 0U)
+    {
+        ssize_t n = write(fd, p, len);
+
+        if (n <= 0)
+        {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Open a serial device or pty in raw mode
+ */
+static int codec_open_tty(const char *path)
+{
+    struct termios t;
+    int fd = open(path, O_RDWR | O_NOCTTY);
+
+    if (fd < 0)
+    {
+        perror(path);
+        exit(2);
+    }
+    if (tcgetattr(fd, &t) == 0)
+    {
+        cfmakeraw(&t);
+        t.c_cc[VMIN] = 1;
+        t.c_cc[VTIME] = 0;
+        (void)tcsetattr(fd, TCSANOW, &t);
+    }
+    return fd;
+}
+
+/**
+ * @brief  Feed bytes from fd to the assembler; handle each valid frame
+ * @param  echo_fd Where to send valid frames back, -1 to print them instead
+ */
+static int codec_receive(int fd, int echo_fd)
+{
+    FRAME_Rx_t rx;
+    uint8_t chunk[256];
+    ssize_t n;
+
+    bare_frame_rx_init(&rx, codec_rx_buf, sizeof(codec_rx_buf));
+    while ((n = read(fd, chunk, sizeof(chunk))) > 0)
+    {
+        ssize_t i;
+
+        for (i = 0; i < n; i++)
+        {
+            FRAME_Status_t st = bare_frame_rx_push(&rx, chunk[i]);
+            FRAME_Packet_t pkt;
+
+            if (st == FRAME_ERR_OVERFLOW)
+            {
+                fprintf(stderr, "frame_codec: frame too long, dropped\n");
+                continue;
+            }
+            if (st != FRAME_OK)
+            {
+                continue;
+            }
+
+            st = bare_frame_decode(rx.buf, rx.len, &pkt);
+            bare_frame_rx_init(&rx, codec_rx_buf, sizeof(codec_rx_buf));
+            if (st != FRAME_OK)
+            {
+                fprintf(stderr, "frame_codec: bad frame (status %d)\n", (int)st);
+                continue;
+            }
+
+            if (echo_fd >= 0)
+            {
+                codec_out_t out;
+
+                out.len = 0U;
+                bare_frame_encode(pkt.seq, pkt.type, pkt.payload, pkt.len, codec_sink, &out);
+                if (codec_write_all(echo_fd, out.buf, out.len) != 0)
+                {
+                    return 1;
+                }
+            }
+            else
+            {
+                size_t k;
+
+                printf("%u %u %zu ", pkt.seq, pkt.type, pkt.len);
+                for (k = 0U; k < pkt.len; k++)
+                {
+                    printf("%02x", pkt.payload[k]);
+                }
+                printf("\n");
+                fflush(stdout);
+            }
+        }
+    }
+    return 0;
+}
+
+static int codec_encode(uint8_t type, uint8_t seq)
+{
+    static uint8_t payload[CODEC_MAX_PAYLOAD];
+    static codec_out_t out;
+    size_t len = fread(payload, 1U, sizeof(payload), stdin);
+
+    if (!feof(stdin))
+    {
+        fprintf(stderr, "frame_codec: payload longer than %u bytes\n", CODEC_MAX_PAYLOAD);
+        return 1;
+    }
+    out.len = 0U;
+    bare_frame_encode(seq, type, payload, len, codec_sink, &out);
+    return codec_write_all(STDOUT_FILENO, out.buf, out.len) ? 1 : 0;
+}
+
+static void codec_usage(void)
+{
+    fprintf(stderr, "usage: frame_codec encode TYPE [SEQ] | decode [DEV] | echo DEV\n");
+    exit(2);
+}
+
+/*******************************************************************************************
+ *                                    Main Program
+ *******************************************************************************************/
+int main(int argc, char **argv)
+{
+    int fd;
+
+    if (argc < 2)
+    {
+        codec_usage();
+    }
+
+    if (strcmp(argv[1], "encode") == 0 && argc >= 3)
+    {
+        uint8_t seq = (argc >= 4) ? (uint8_t)strtoul(argv[3], NULL, 0) : 0U;
+
+        return codec_encode((uint8_t)strtoul(argv[2], NULL, 0), seq);
+    }
+    if (strcmp(argv[1], "decode") == 0)
+    {
+        return codec_receive((argc >= 3) ? codec_open_tty(argv[2]) : STDIN_FILENO, -1);
+    }
+    if (strcmp(argv[1], "echo") == 0 && argc >= 3)
+    {
+        fd = codec_open_tty(argv[2]);
+        return codec_receive(fd, fd);
+    }
+    codec_usage();
+    return 2;
+}
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""Convert a bare_logic capture into a VCD file.
+
+Reads the run-length encoded text written by bare_logic_dump() (a capture file,
+stdin, or a serial port when pyserial is installed) and writes a Value Change
+Dump with one wire per captured pin, viewable in GTKWave or PulseView. The
+trigger sample is marked with a 'trigger' event.
+
+    python3 tools/logic_vcd.py capture.txt -o capture.vcd
+    python3 tools/logic_vcd.py --port /dev/ttyACM0 --name PC -o capture.vcd
+"""
+
+import argparse
+import sys
+
+
+def read_dump(lines):
+    """Return (rate_hz, channels, samples, trigger, runs) from the first LOGIC block."""
+    header = None
+    runs = []
+    for raw in lines:
+        line = raw.strip()
+        if line.startswith("LOGIC "):
+            _, rate, channels, samples, trigger = line.split()
+            header = (int(rate), int(channels, 16), int(samples), int(trigger))
+            runs = []
+        elif line == "END" and header is not None:
+            return header + (runs,)
+        elif header is not None and line:
+            value, count = line.split()
+            runs.append((int(value, 16), int(count)))
+    raise SystemExit("no complete LOGIC ... END block in input")
+
+
+def serial_lines(port, baud):
+    try:
+        import serial
+    except ImportError:
+        raise SystemExit("--port needs pyserial (pip install pyserial)")
+    with serial.Serial(port, baud, timeout=None) as s:
+        while True:
+            yield s.readline().decode(errors="replace")
+
+
+def vcd_ids():
+    """Short printable identifiers: !, ", #, ..."""
+    n = 0
+    while True:
+        code, k = "", n
+        while True:
+            code += chr(33 + k % 94)
+            k //= 94
+            if k == 0:
+                break
+        yield code
+        n += 1
+
+
+def write_vcd(out, rate, channels, samples, trigger, runs, name):
+    pins = [p for p in range(16) if channels & (1 << p)]
+    ids = vcd_ids()
+    wire = {p: next(ids) for p in pins}
+    trig_id = next(ids)
+
+    def ns(index):
+        return (index * 1000000000) // rate
+
+    out.write("$date bare_logic capture $end\n")
+    out.write(f"$comment {samples} samples at {rate} Hz, trigger at sample {trigger} $end\n")
+    out.write("$timescale 1ns $end\n")
+    out.write(f"$scope module {name} $end\n")
+    for p in pins:
+        out.write(f"$var wire 1 {wire[p]} {name}{p} $end\n")
+    out.write(f"$var event 1 {trig_id} trigger $end\n")
+    out.write("$upscope $end\n$enddefinitions $end\n")
+
+    index = 0
+    last = None
+    for value, count in runs:
+        out.write(f"#{ns(index)}\n")
+        for p in pins:
+            bit = (value >> p) & 1
+            if last is None or ((last >> p) & 1) != bit:
+                out.write(f"{bit}{wire[p]}\n")
+        if trigger == index:
+            out.write(f"1{trig_id}\n")
+        elif index < trigger < index + count:
+            out.write(f"#{ns(trigger)}\n1{trig_id}\n")
+        last = value
+        index += count
+    out.write(f"#{ns(index)}\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("dump", nargs="?", default="-", help="capture file (default: stdin)")
+    ap.add_argument("-o", "--output", default="-", help="VCD file (default: stdout)")
+    ap.add_argument("--port", help="read the dump from a serial port instead")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--name", default="P", help="port name used for the wires (P0, P1, ...)")
+    args = ap.parse_args()
+
+    if args.port:
+        lines = serial_lines(args.port, args.baud)
+    elif args.dump == "-":
+        lines = sys.stdin
+    else:
+        lines = open(args.dump, errors="replace")
+
+    rate, channels, samples, trigger, runs = read_dump(lines)
+    if rate == 0:
+        raise SystemExit("capture has a zero sample rate")
+
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    write_vcd(out, rate, channels, samples, trigger, runs, args.name)
+    if out is not sys.stdout:
+        out.close()
+        print(f"{samples} samples, {bin(channels).count('1')} channels, "
+              f"{1e6 * samples / rate:.1f} us -> {args.output}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
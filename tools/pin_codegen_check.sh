@@ -0,0 +1,81 @@
+#!/bin/sh
+# Disassembly check for inc/bare_pin.h.
+#
+# Compiles a probe that wraps every pin operation in its own function, disassembles it
+# and checks that each wrapper performs exactly the expected number of peripheral stores
+# and loads and no conditional branches. Besides those, only set-up of the address and
+# value is allowed: ldr from the literal pool, mov/movw/movt/mvn, the bit operations that
+# build a BSRR word (and/bic/orr/orn/eor, shifts, ubfx, uxtb/uxth) and the return (bx).
+# Any other instruction (a call, a tail branch, a stack push, IT blocks) fails the check
+# and is listed.
+#
+#     tools/pin_codegen_check.sh            # arm-none-eabi-gcc from PATH
+#     CC=clang CFLAGS="--target=arm-none-eabi -mcpu=cortex-m4 -mthumb" tools/pin_codegen_check.sh
+
+set -eu
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+CC=${CC:-arm-none-eabi-gcc}
+OBJDUMP=${OBJDUMP:-arm-none-eabi-objdump}
+CFLAGS=${CFLAGS:-"-mcpu=cortex-m4 -mthumb -mfloat-abi=hard -mfpu=fpv4-sp-d16"}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+cat > "$WORK/probe.c" <<'EOF'
+#include "bare_pin.h"
+
+BARE_PIN_DEFINE(led, GPIOA, 5)
+BARE_PIN_GROUP_DEFINE(bus, GPIOC, 0x00FFUL)
+
+void probe_set(void) { led_set(); }
+void probe_clear(void) { led_clear(); }
+void probe_write_const(void) { led_write(1); }
+void probe_toggle(void) { led_toggle(); }
+void probe_group_set(void) { bus_set(); }
+void probe_group_write(void) { bus_write(0x5AU); }
+void probe_group_write_var(uint32_t v) { bus_write(v); }
+EOF
+
+# shellcheck disable=SC2086
+"$CC" $CFLAGS -O2 -ffreestanding -ffunction-sections -I"$ROOT/inc" -c "$WORK/probe.c" \
+    -o "$WORK/probe.o"
+"$OBJDUMP" -d --no-show-raw-insn "$WORK/probe.o" > "$WORK/probe.lst"
+
+# name  stores  loads-from-GPIO
+EXPECT="probe_set 1 0
+probe_clear 1 0
+probe_write_const 1 0
+probe_toggle 1 1
+probe_group_set 1 0
+probe_group_write 1 0
+probe_group_write_var 1 0"
+
+status=0
+while read -r fn want_st want_ld; do
+    awk -v fn="$fn" -v want_st="$want_st" -v want_ld="$want_ld" '
+        $0 ~ "<" fn ">:$"       { inside = 1; next }
+        inside && /^$/          { inside = 0 }
+        inside && /^ *[0-9a-f]+:/ {
+            if ($0 ~ /\.(word|short|byte)/) next   # Literal pool data
+            op = $2; sub(/\.[nw]$/, "", op); n++
+            if (op ~ /^str/)                                      st++
+            else if (op ~ /^ldr/ && ($0 ~ /\[pc/ || $0 ~ /<.*>/)) setup++
+            else if (op ~ /^ldr/)                                 ld++
+            else if (op ~ /^b(eq|ne|cs|cc|hs|lo|mi|pl|vs|vc|hi|ls|ge|lt|gt|le)$/ ||
+                     op ~ /^cbn?z$/ || op ~ /^it/)                br++
+            else if (op ~ /^(movs?|movw|movt|mvns?|ands?|bics?|orrs?|orns?|eors?)$/ ||
+                     op ~ /^(lsls?|lsrs?|ubfx|uxt[bh]|nop)$/)     setup++
+            else if (op == "bx" && $3 == "lr")                    setup++
+            else { bad++; unknown = unknown " " op }
+        }
+        END {
+            ok = (st == want_st && ld + 0 == want_ld && br + 0 == 0 && bad + 0 == 0)
+            printf "%-24s %2d insns  %d store  %d load  %d branch  %s%s\n", fn, n, st, ld, br,
+                   ok ? "ok" : "FAIL", (bad + 0) ? "  unexpected:" unknown : ""
+            exit ok ? 0 : 1
+        }' "$WORK/probe.lst" || status=1
+done <<EOF2
+$EXPECT
+EOF2
+
+exit "$status"
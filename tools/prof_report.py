@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Flat profile from a bare_prof histogram dump.
+
+Reads the text written by bare_prof_dump() (a capture file, stdin, or a serial
+port when pyserial is installed), maps every sampled address to the function
+that contains it using the symbol table of the firmware ELF, and prints a flat
+profile sorted by sample count.
+
+    python3 tools/prof_report.py firmware.elf capture.txt
+    python3 tools/prof_report.py firmware.elf --port /dev/ttyACM0
+"""
+
+import argparse
+import bisect
+import struct
+import sys
+
+STT_FUNC = 2
+
+
+def read_functions(path):
+    """Return a sorted list of (start, end, name) for the FUNC symbols of an ELF32 file."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        raise SystemExit(f"{path}: not an ELF32 file")
+    endian = "<" if data[5] == 1 else ">"
+
+    shoff, = struct.unpack_from(endian + "I", data, 0x20)
+    shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+
+    sections = []
+    for i in range(shnum):
+        sections.append(struct.unpack_from(endian + "IIIIIIIIII", data, shoff + i * shentsize))
+
+    funcs = []
+    for sh in sections:
+        sh_type, sh_offset, sh_size, sh_link, sh_entsize = sh[1], sh[4], sh[5], sh[6], sh[9]
+        if sh_type != 2 or sh_entsize == 0:  # SHT_SYMTAB
+            continue
+        strtab = sections[sh_link]
+        str_off = strtab[4]
+        for off in range(sh_offset, sh_offset + sh_size, sh_entsize):
+            st_name, st_value, st_size, st_info = struct.unpack_from(endian + "IIIB", data, off)
+            if (st_info & 0xF) != STT_FUNC or st_value == 0:
+                continue
+            end = data.index(b"\0", str_off + st_name)
+            name = data[str_off + st_name:end].decode(errors="replace")
+            start = st_value & ~1  # Thumb bit
+            funcs.append((start, start + max(st_size, 2), name))
+
+    funcs.sort()
+    return funcs
+
+
+def read_dump(lines):
+    """Parse a dump, return (samples, dropped, shift, {address: count})."""
+    header = None
+    buckets = {}
+    for raw in lines:
+        line = raw.strip()
+        if line.startswith("PROF "):
+            _, samples, dropped, shift = line.split()
+            header = (int(samples), int(dropped), int(shift))
+            buckets = {}
+        elif line == "END" and header is not None:
+            return header + (buckets,)
+        elif header is not None and line:
+            key, count = line.split()
+            buckets[int(key, 16) << header[2]] = int(count)
+    raise SystemExit("no complete PROF ... END block in input")
+
+
+def serial_lines(port, baud):
+    try:
+        import serial
+    except ImportError:
+        raise SystemExit("--port needs pyserial (pip install pyserial)")
+    with serial.Serial(port, baud, timeout=None) as s:
+        while True:
+            yield s.readline().decode(errors="replace")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("elf", help="firmware ELF with symbols")
+    ap.add_argument("dump", nargs="?", default="-", help="capture file (default: stdin)")
+    ap.add_argument("--port", help="read the dump from a serial port instead")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--top", type=int, default=0, help="only print the N hottest functions")
+    args = ap.parse_args()
+
+    funcs = read_functions(args.elf)
+    starts = [f[0] for f in funcs]
+
+    if args.port:
+        lines = serial_lines(args.port, args.baud)
+    elif args.dump == "-":
+        lines = sys.stdin
+    else:
+        lines = open(args.dump, errors="replace")
+
+    samples, dropped, shift, buckets = read_dump(lines)
+
+    profile = {}
+    for addr, count in buckets.items():
+        i = bisect.bisect_right(starts, addr) - 1
+        if i >= 0 and addr < funcs[i][1]:
+            name = funcs[i][2]
+        else:
+            name = f"?? 0x{addr:08x}"
+        profile[name] = profile.get(name, 0) + count
+
+    total = max(samples, 1)
+    print(f"{samples} samples, {dropped} dropped, {1 << shift}-byte buckets")
+    print(f"{'%':>7} {'samples':>9}  function")
+    rows = sorted(profile.items(), key=lambda kv: kv[1], reverse=True)
+    if args.top:
+        rows = rows[:args.top]
+    for name, count in rows:
+        print(f"{100.0 * count / total:7.2f} {count:9d}  {name}")
+
+
+if __name__ == "__main__":
+    main()